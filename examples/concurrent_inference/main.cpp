@@ -0,0 +1,144 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.intelnics.com/opennn                                                                                   */
+/*                                                                                                              */
+/*   C O N C U R R E N T   I N F E R E N C E   A P P L I C A T I O N                                            */
+/*                                                                                                              */
+/*   Roberto Lopez                                                                                              */
+/*   Intelnics - The artificial intelligence company                                                            */
+/*   robertolopez@intelnics.com                                                                                 */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// This application measures the throughput of a shared inference plan which is evaluated
+// from an increasing number of threads, each one with its own workspace.
+
+// System includes
+
+#include <iostream>
+#include <sstream>
+#include <time.h>
+#include <stdexcept>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// OpenNN includes
+
+#include "../../source/opennn.h"
+
+using namespace OpenNN;
+
+int main(void)
+{
+   try
+   {
+      std::cout << "OpenNN. Concurrent Inference Application." << std::endl;
+
+      srand( (unsigned)time( NULL ) );
+
+      const unsigned inputs_number = 16;
+      const unsigned hidden_perceptrons_number = 32;
+      const unsigned outputs_number = 4;
+
+      const unsigned instances_number = 1000;
+      const unsigned evaluations_number = 400000;
+
+      // Neural network
+
+      NeuralNetwork neural_network(inputs_number, hidden_perceptrons_number, outputs_number);
+
+      neural_network.randomize_parameters_normal();
+
+      neural_network.construct_scaling_layer();
+      neural_network.construct_unscaling_layer();
+
+      const InferencePlan inference_plan = neural_network.compile_inference_plan();
+
+      // Input data
+
+      Matrix<double> input_data(instances_number, inputs_number);
+      input_data.randomize_normal();
+
+      // Throughput
+
+#ifdef _OPENMP
+      const int maximum_threads_number = omp_get_max_threads();
+#else
+      const int maximum_threads_number = 1;
+#endif
+
+      double serial_throughput = 0.0;
+
+      for(int threads_number = 1; threads_number <= maximum_threads_number; threads_number *= 2)
+      {
+         double checksum = 0.0;
+
+#ifdef _OPENMP
+         const double start_time = omp_get_wtime();
+#else
+         const clock_t start_clock = clock();
+#endif
+
+         #pragma omp parallel num_threads(threads_number) reduction(+ : checksum)
+         {
+            Vector<double> workspace(inference_plan.get_workspace_size());
+            Vector<double> outputs(outputs_number);
+
+            #pragma omp for schedule(static)
+            for(int i = 0; i < (int)evaluations_number; i++)
+            {
+               inference_plan.calculate_outputs(input_data[i%instances_number], &outputs[0], &workspace[0]);
+
+               checksum += outputs[0];
+            }
+         }
+
+#ifdef _OPENMP
+         const double elapsed_time = omp_get_wtime() - start_time;
+#else
+         const double elapsed_time = (double)(clock() - start_clock)/CLOCKS_PER_SEC;
+#endif
+
+         const double throughput = evaluations_number/elapsed_time;
+
+         if(threads_number == 1)
+         {
+            serial_throughput = throughput;
+         }
+
+         std::cout << "Threads: " << threads_number
+                   << "\tEvaluations per second: " << throughput
+                   << "\tSpeedup: " << throughput/serial_throughput
+                   << "\tChecksum: " << checksum << std::endl;
+      }
+
+      return(0);
+   }
+   catch(std::exception& e)
+   {
+      std::cerr << e.what() << std::endl;
+
+      return(1);
+   }
+}  
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2014 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -23,6 +23,7 @@ SUBDIRS += airfoil_self_noise
 #SUBDIRS += car_problem
 #SUBDIRS += car_problem_neurocomputing
 #SUBDIRS += catenary_problem
+SUBDIRS += concurrent_inference
 #SUBDIRS += de_jong_function
 #SUBDIRS += easom_function
 #SUBDIRS += fed_batch_fermenter
@@ -1709,6 +1709,15 @@ ConjugateGradient::ConjugateGradientResults::write_final_results(
 
   values.push_back(buffer.str());
 
+  // Training rate evaluations number
+
+  names.push_back("Training rate evaluations number");
+
+  buffer.str("");
+  buffer << training_rate_evaluations_number;
+
+  values.push_back(buffer.str());
+
   // Elapsed time
 
   names.push_back("Elapsed time");
@@ -1807,11 +1816,14 @@ ConjugateGradient::perform_training(void) {
   double old_training_rate = 0.0;
 
   Vector<double> directional_point(2, 0.0);
+  Vector<double> directional_gradient;
 
   bool stop_training = false;
 
   unsigned generalization_failures = 0;
 
+  training_rate_algorithm.reset_evaluations_number();
+
   // Main loop
 
   for (unsigned iteration = 0; iteration <= maximum_iterations_number;
@@ -1839,14 +1851,25 @@ ConjugateGradient::perform_training(void) {
     // Performance functional stuff
 
     if (iteration == 0) {
-      performance = performance_functional_pointer->calculate_performance();
+      const PerformanceFunctional::FirstOrderperformance
+          first_order_performance =
+              performance_functional_pointer
+                  ->calculate_first_order_performance();
+
+      performance = first_order_performance.performance;
+      gradient = first_order_performance.gradient;
+
       performance_increase = 0.0;
     } else {
       performance = directional_point[1];
       performance_increase = old_performance - performance;
-    }
 
-    gradient = performance_functional_pointer->calculate_gradient();
+      if (directional_gradient.empty()) {
+        gradient = performance_functional_pointer->calculate_gradient();
+      } else {
+        gradient = directional_gradient;
+      }
+    }
 
     gradient_norm = gradient.calculate_norm();
 
@@ -1906,7 +1929,8 @@ ConjugateGradient::perform_training(void) {
     }
 
     directional_point = training_rate_algorithm.calculate_directional_point(
-        performance, training_direction, initial_training_rate);
+        performance, gradient, training_direction, initial_training_rate,
+        directional_gradient);
 
     training_rate = directional_point[0];
 
@@ -1917,7 +1941,8 @@ ConjugateGradient::perform_training(void) {
           calculate_gradient_descent_training_direction(gradient);
 
       directional_point = training_rate_algorithm.calculate_directional_point(
-          performance, training_direction, first_training_rate);
+          performance, gradient, training_direction, first_training_rate,
+          directional_gradient);
 
       training_rate = directional_point[0];
     }
@@ -2065,6 +2090,8 @@ ConjugateGradient::perform_training(void) {
 
       results_pointer->final_training_direction = training_direction;
       results_pointer->final_training_rate = training_rate;
+      results_pointer->training_rate_evaluations_number =
+          training_rate_algorithm.get_evaluations_number();
       results_pointer->elapsed_time = elapsed_time;
 
       results_pointer->iterations_number = iteration;
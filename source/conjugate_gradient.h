@@ -181,6 +181,11 @@ class ConjugateGradient : public TrainingAlgorithm {
 
     double final_training_rate;
 
+    /// Number of performance evaluations made by the training rate algorithm
+    /// during the training process.
+
+    unsigned training_rate_evaluations_number;
+
     /// Elapsed time of the training process.
 
     double elapsed_time;
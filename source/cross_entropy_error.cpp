@@ -294,7 +294,7 @@ double CrossEntropyError::calculate_performance(void) const {
      {
         // Input vector
   
-     inputs = data_set_pointer->get_training_input_instance(i);
+     data_set_pointer->get_training_input_instance(i, inputs);
   
         // Output vector
   
@@ -302,7 +302,7 @@ double CrossEntropyError::calculate_performance(void) const {
   
         // Target vector
   
-        targets = data_set_pointer->get_training_target_instance(i);
+        data_set_pointer->get_training_target_instance(i, targets);
   
         // Cross entropy error
   
@@ -371,7 +371,7 @@ double CrossEntropyError::calculate_generalization_performance(void) const {
   for (unsigned i = 0; i < generalization_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_generalization_input_instance(i);
+    data_set_pointer->get_generalization_input_instance(i, inputs);
 
     // Output vector
 
@@ -379,7 +379,7 @@ double CrossEntropyError::calculate_generalization_performance(void) const {
 
     // Target vector
 
-    targets = data_set_pointer->get_generalization_target_instance(i);
+    data_set_pointer->get_generalization_target_instance(i, targets);
 
     // Cross entropy error
 
@@ -414,30 +414,6 @@ Vector<double> CrossEntropyError::calculate_gradient(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
-
-  const unsigned neural_parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
-
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
-
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
-
 #ifndef NDEBUG
 
   std::ostringstream buffer;
@@ -462,90 +438,32 @@ Vector<double> CrossEntropyError::calculate_gradient(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
-
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
-
-  // Data set stuff
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
-
-  // Sum squared error stuff
-
-  Vector<double> output_objective_gradient(outputs_number);
-
-  Vector<Vector<double> > layers_delta;
-
-  Vector<double> point_gradient(neural_parameters_number, 0.0);
-
-  Vector<double> gradient(neural_parameters_number, 0.0);
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
-
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
+  return (calculate_training_gradient());
+}
 
-    if (!has_conditions_layer) {
-      const Vector<double>& outputs = layers_activation[layers_number - 1];
+// void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+// Matrix<double>&) const method
 
-      for (unsigned j = 0; j < outputs_number; j++) {
-        // output_objective_gradient[j] = -targets[j]/outputs[j]
-        //+ (1.0 - targets[j])*(1.0 - outputs[j]);
+/// Calculates the derivatives of the cross entropy error with respect to the
+/// outputs of the neural network, for a block of instances.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param output_gradient Matrix to store the outputs gradient.
 
-        output_objective_gradient[j] =
-            -targets[j] / outputs[j] + (1.0 - targets[j]) / (1.0 - outputs[j]);
-      }
+void CrossEntropyError::calculate_output_gradient(
+    const Matrix<double>& outputs, const Matrix<double>& targets,
+    Matrix<double>& output_gradient) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            output_objective_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
-
-      const Vector<double>& outputs =
-          particular_solution +
-          homogeneous_solution * layers_activation[layers_number - 1];
-
-      for (unsigned j = 0; j < outputs_number; j++) {
-        //            output_objective_gradient[j]
-        //            = -targets[j]/outputs[j] + (1.0 - targets[j])*(1.0 -
-        // outputs[j]);
-
-        output_objective_gradient[j] =
-            -targets[j] / outputs[j] + (1.0 - targets[j]) * (1.0 - outputs[j]);
-      }
+  output_gradient.set(instances_number, outputs_number);
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            homogeneous_solution,
-                                            output_objective_gradient);
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_gradient[i][j] = -targets[i][j] / outputs[i][j] +
+                              (1.0 - targets[i][j]) / (1.0 - outputs[i][j]);
     }
-
-    point_gradient =
-        calculate_point_gradient(inputs, layers_activation, layers_delta);
-
-    gradient += point_gradient;
   }
-
-  return (gradient);
 }
 
 // Matrix<double> calculate_Hessian(void) const
@@ -558,6 +476,59 @@ Matrix<double> CrossEntropyError::calculate_Hessian(void) const {
   return (objective_Hessian);
 }
 
+// void calculate_output_vector_dot_Hessian(const Matrix<double>&, const
+// Matrix<double>&, const Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates, for a block of instances, the product of the second derivatives
+/// of the cross entropy error with respect to the outputs of the neural network
+/// and a given direction of the outputs.
+/// The cross entropy error is a sum over the outputs, so that those second
+/// derivatives form a diagonal matrix.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param outputs_direction Direction of the outputs, with one instance per
+/// row.
+/// @param output_product Matrix to store the outputs Hessian product.
+
+void CrossEntropyError::calculate_output_vector_dot_Hessian(
+    const Matrix<double>& outputs, const Matrix<double>& targets,
+    const Matrix<double>& outputs_direction,
+    Matrix<double>& output_product) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
+
+  output_product.set(instances_number, outputs_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_product[i][j] =
+          (targets[i][j] / (outputs[i][j] * outputs[i][j]) +
+           (1.0 - targets[i][j]) /
+               ((1.0 - outputs[i][j]) * (1.0 - outputs[i][j]))) *
+          outputs_direction[i][j];
+    }
+  }
+}
+
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const
+// method
+
+/// Returns the exact product of the cross entropy error Hessian and a vector of
+/// parameters, which is calculated with the R-operator without forming the
+/// Hessian matrix.
+/// @param vector Vector of multilayer perceptron parameters in the product.
+
+Vector<double> CrossEntropyError::calculate_vector_dot_Hessian(
+    const Vector<double>& vector) const {
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  return (calculate_training_vector_dot_Hessian(vector));
+}
+
 // std::string write_performance_term_type(void) const method
 
 /// Returns a string with the name of the cross entropy error performance type,
@@ -96,8 +96,18 @@ class CrossEntropyError : public PerformanceTerm {
   double calculate_minimum_generalization_performance(void);
 
   Vector<double> calculate_gradient(void) const;
+
+  void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+                                 Matrix<double>&) const;
+
+  void calculate_output_vector_dot_Hessian(const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           Matrix<double>&) const;
   Matrix<double> calculate_Hessian(void) const;
 
+  Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
   std::string write_performance_term_type(void) const;
 
   // Serialization methods
@@ -127,6 +127,7 @@ DataSet& DataSet::operator=(const DataSet& other_data_set) {
     // Data matrix
 
     data = other_data_set.data;
+    single_precision_data.set();
 
     // Variables
 
@@ -214,6 +215,44 @@ bool DataSet::empty(void) const { return (data.empty()); }
 
 const Matrix<double>& DataSet::get_data(void) const { return (data); }
 
+// bool has_single_precision_data(void) const method
+
+/// Returns true if the data set holds an up to date copy of the data matrix in
+/// single precision, and false otherwise.
+
+bool DataSet::has_single_precision_data(void) const {
+  return (!single_precision_data.empty() || data.empty());
+}
+
+// void update_single_precision_data(void) method
+
+/// Builds the copy of the data matrix in single precision, if it is not up to
+/// date.
+/// That copy is read by the single precision versions of the training blocks,
+/// with half the memory traffic of the data matrix.
+/// The copy is cleared whenever the data changes, so this method must be
+/// called again before reading the single precision blocks.
+
+void DataSet::update_single_precision_data(void) {
+  if (has_single_precision_data()) {
+    return;
+  }
+
+  const unsigned instances_number = data.get_rows_number();
+  const unsigned variables_number = data.get_columns_number();
+
+  single_precision_data.set(instances_number, variables_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    const double* instance = data[i];
+    float* single_precision_instance = single_precision_data[i];
+
+    for (unsigned j = 0; j < variables_number; j++) {
+      single_precision_instance[j] = (float)instance[j];
+    }
+  }
+}
+
 // const std::string& get_data_file_name(void) const method
 
 /// Returns the name of the data file.
@@ -260,8 +299,8 @@ Matrix<double> DataSet::arrange_training_data(void) const {
 
   Vector<unsigned> variables_indices(0, 1, variables_number - 1);
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   return (data.arrange_submatrix(training_indices, variables_indices));
 }
@@ -275,8 +314,8 @@ Matrix<double> DataSet::arrange_training_data(void) const {
 Matrix<double> DataSet::arrange_generalization_data(void) const {
   const unsigned variables_number = variables.get_variables_number();
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   Vector<unsigned> variables_indices(0, 1, variables_number - 1);
 
@@ -293,7 +332,7 @@ Matrix<double> DataSet::arrange_testing_data(void) const {
   const unsigned variables_number = variables.get_variables_number();
   Vector<unsigned> variables_indices(0, 1, variables_number - 1);
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   return (data.arrange_submatrix(testing_indices, variables_indices));
 }
@@ -308,7 +347,7 @@ Matrix<double> DataSet::arrange_input_data(void) const {
   const unsigned instances_number = instances.get_instances_number();
   Vector<unsigned> indices(0, 1, instances_number - 1);
 
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   return (data.arrange_submatrix(indices, inputs_indices));
 }
@@ -323,7 +362,7 @@ Matrix<double> DataSet::arrange_target_data(void) const {
   const unsigned instances_number = instances.get_instances_number();
   Vector<unsigned> indices(0, 1, instances_number - 1);
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   return (data.arrange_submatrix(indices, targets_indices));
 }
@@ -335,10 +374,10 @@ Matrix<double> DataSet::arrange_target_data(void) const {
 /// The number of columns is the number of input variables.
 
 Matrix<double> DataSet::arrange_training_input_data(void) const {
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   return (data.arrange_submatrix(training_indices, inputs_indices));
 }
@@ -350,10 +389,10 @@ Matrix<double> DataSet::arrange_training_input_data(void) const {
 /// The number of columns is the number of target variables.
 
 Matrix<double> DataSet::arrange_training_target_data(void) const {
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   return (data.arrange_submatrix(training_indices, targets_indices));
 }
@@ -365,10 +404,10 @@ Matrix<double> DataSet::arrange_training_target_data(void) const {
 /// The number of columns is the number of input variables.
 
 Matrix<double> DataSet::get_generalization_input_data(void) const {
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   return (data.arrange_submatrix(generalization_indices, inputs_indices));
 }
@@ -380,10 +419,10 @@ Matrix<double> DataSet::get_generalization_input_data(void) const {
 /// The number of columns is the number of target variables.
 
 Matrix<double> DataSet::get_generalization_target_data(void) const {
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   return (data.arrange_submatrix(generalization_indices, targets_indices));
 }
@@ -395,9 +434,9 @@ Matrix<double> DataSet::get_generalization_target_data(void) const {
 /// The number of columns is the number of input variables.
 
 Matrix<double> DataSet::arrange_testing_input_data(void) const {
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   return (data.arrange_submatrix(testing_indices, inputs_indices));
 }
@@ -409,9 +448,9 @@ Matrix<double> DataSet::arrange_testing_input_data(void) const {
 /// The number of columns is the number of target variables.
 
 Matrix<double> DataSet::arrange_testing_target_data(void) const {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   return (data.arrange_submatrix(testing_indices, targets_indices));
 }
@@ -458,7 +497,7 @@ Vector<double> DataSet::get_training_instance(
 #ifndef NDEBUG
 
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
+      instances.get_training_indices().size();
 
   if (training_instance_index >= training_instances_number) {
     std::ostringstream buffer;
@@ -474,8 +513,8 @@ Vector<double> DataSet::get_training_instance(
 
 #endif
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   return (data.arrange_row(training_indices[training_instance_index]));
 }
@@ -493,7 +532,7 @@ Vector<double> DataSet::get_generalization_instance(
 #ifndef NDEBUG
 
   const unsigned generalization_instances_number =
-      instances.count_generalization_instances_number();
+      instances.get_generalization_indices().size();
 
   if (generalization_instance_index >= generalization_instances_number) {
     std::ostringstream buffer;
@@ -509,8 +548,8 @@ Vector<double> DataSet::get_generalization_instance(
 
 #endif
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   return (
       data.arrange_row(generalization_indices[generalization_instance_index]));
@@ -529,7 +568,7 @@ Vector<double> DataSet::get_testing_instance(
 #ifndef NDEBUG
 
   const unsigned testing_instances_number =
-      instances.count_testing_instances_number();
+      instances.get_testing_indices().size();
 
   if (testing_instance_index >= testing_instances_number) {
     std::ostringstream buffer;
@@ -545,7 +584,7 @@ Vector<double> DataSet::get_testing_instance(
 
 #endif
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   return (data.arrange_row(testing_indices[testing_instance_index]));
 }
@@ -576,7 +615,7 @@ Vector<double> DataSet::get_input_instance(
 
 #endif
 
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   return (data.arrange_row(instance_index, inputs_indices));
 }
@@ -608,7 +647,7 @@ Vector<double> DataSet::get_target_instance(
 
 #endif
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   return (data.arrange_row(instance_index, targets_indices));
 }
@@ -625,7 +664,7 @@ Vector<double> DataSet::get_training_input_instance(
 #ifndef NDEBUG
 
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
+      instances.get_training_indices().size();
 
   if (training_instance_index >= training_instances_number) {
     std::ostringstream buffer;
@@ -642,10 +681,10 @@ Vector<double> DataSet::get_training_input_instance(
 
 #endif
 
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   return (data.arrange_row(training_indices[training_instance_index],
                            inputs_indices));
@@ -664,7 +703,7 @@ Vector<double> DataSet::get_generalization_input_instance(
 #ifndef NDEBUG
 
   const unsigned generalization_instances_number =
-      instances.count_generalization_instances_number();
+      instances.get_generalization_indices().size();
 
   if (generalization_instance_index >= generalization_instances_number) {
     std::ostringstream buffer;
@@ -680,10 +719,10 @@ Vector<double> DataSet::get_generalization_input_instance(
 
 #endif
 
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   return (data.arrange_row(
       generalization_indices[generalization_instance_index], inputs_indices));
@@ -701,7 +740,7 @@ Vector<double> DataSet::get_testing_input_instance(
 #ifndef NDEBUG
 
   const unsigned testing_instances_number =
-      instances.count_testing_instances_number();
+      instances.get_testing_indices().size();
 
   if (testing_instance_index >= testing_instances_number) {
     std::ostringstream buffer;
@@ -717,9 +756,9 @@ Vector<double> DataSet::get_testing_input_instance(
 
 #endif
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   return (data.arrange_row(testing_indices[testing_instance_index],
                            inputs_indices));
@@ -737,7 +776,7 @@ Vector<double> DataSet::get_training_target_instance(
 #ifndef NDEBUG
 
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
+      instances.get_training_indices().size();
 
   if (training_instance_index >= training_instances_number) {
     std::ostringstream buffer;
@@ -753,10 +792,10 @@ Vector<double> DataSet::get_training_target_instance(
 
 #endif
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   return (data.arrange_row(training_indices[training_instance_index],
                            targets_indices));
@@ -775,7 +814,7 @@ Vector<double> DataSet::get_generalization_target_instance(
 #ifndef NDEBUG
 
   const unsigned generalization_instances_number =
-      instances.count_generalization_instances_number();
+      instances.get_generalization_indices().size();
 
   if (generalization_instance_index >= generalization_instances_number) {
     std::ostringstream buffer;
@@ -791,10 +830,10 @@ Vector<double> DataSet::get_generalization_target_instance(
 
 #endif
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   return (data.arrange_row(
       generalization_indices[generalization_instance_index], targets_indices));
@@ -812,7 +851,7 @@ Vector<double> DataSet::get_testing_target_instance(
 #ifndef NDEBUG
 
   const unsigned testing_instances_number =
-      instances.count_testing_instances_number();
+      instances.get_testing_indices().size();
 
   if (testing_instance_index >= testing_instances_number) {
     std::ostringstream buffer;
@@ -828,14 +867,540 @@ Vector<double> DataSet::get_testing_target_instance(
 
 #endif
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   return (data.arrange_row(testing_indices[testing_instance_index],
                            targets_indices));
 }
 
+// void get_training_input_instance(const unsigned&, Vector<double>&) const
+// method
+
+/// Copies the input values of a given training instance into a vector
+/// supplied by the caller.
+/// The row is read directly from the data matrix through the cached tables of
+/// indices, and the vector is only reallocated when its size changes.
+/// This is intended for loops over all the training instances.
+/// @param training_instance_index Index of training instance.
+/// @param inputs Vector to store the input values.
+
+void DataSet::get_training_input_instance(
+    const unsigned& training_instance_index, Vector<double>& inputs) const {
+  const Vector<unsigned>& training_indices = instances.get_training_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned training_instances_number = training_indices.size();
+
+  if (training_instance_index >= training_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_training_input_instance(const unsigned&, "
+              "Vector<double>&) const method.\n"
+           << "Index of training instance (" << training_instance_index
+           << ") must be less than number of training instances ("
+           << training_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
+
+  const unsigned inputs_number = inputs_indices.size();
+
+  const double* instance = data[training_indices[training_instance_index]];
+
+  if (inputs.size() != inputs_number) {
+    inputs.set(inputs_number);
+  }
+
+  for (unsigned j = 0; j < inputs_number; j++) {
+    inputs[j] = instance[inputs_indices[j]];
+  }
+}
+
+// void get_training_target_instance(const unsigned&, Vector<double>&) const
+// method
+
+/// Copies the target values of a given training instance into a vector
+/// supplied by the caller.
+/// The row is read directly from the data matrix through the cached tables of
+/// indices, and the vector is only reallocated when its size changes.
+/// This is intended for loops over all the training instances.
+/// @param training_instance_index Index of training instance.
+/// @param targets Vector to store the target values.
+
+void DataSet::get_training_target_instance(
+    const unsigned& training_instance_index, Vector<double>& targets) const {
+  const Vector<unsigned>& training_indices = instances.get_training_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned training_instances_number = training_indices.size();
+
+  if (training_instance_index >= training_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_training_target_instance(const unsigned&, "
+              "Vector<double>&) const method.\n"
+           << "Index of training instance (" << training_instance_index
+           << ") must be less than number of training instances ("
+           << training_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
+
+  const unsigned targets_number = targets_indices.size();
+
+  const double* instance = data[training_indices[training_instance_index]];
+
+  if (targets.size() != targets_number) {
+    targets.set(targets_number);
+  }
+
+  for (unsigned j = 0; j < targets_number; j++) {
+    targets[j] = instance[targets_indices[j]];
+  }
+}
+
+// void get_generalization_input_instance(const unsigned&, Vector<double>&) const
+// method
+
+/// Copies the input values of a given generalization instance into a vector
+/// supplied by the caller.
+/// The row is read directly from the data matrix through the cached tables of
+/// indices, and the vector is only reallocated when its size changes.
+/// This is intended for loops over all the generalization instances.
+/// @param generalization_instance_index Index of generalization instance.
+/// @param inputs Vector to store the input values.
+
+void DataSet::get_generalization_input_instance(
+    const unsigned& generalization_instance_index, Vector<double>& inputs) const {
+  const Vector<unsigned>& generalization_indices = instances.get_generalization_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned generalization_instances_number = generalization_indices.size();
+
+  if (generalization_instance_index >= generalization_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_generalization_input_instance(const unsigned&, "
+              "Vector<double>&) const method.\n"
+           << "Index of generalization instance (" << generalization_instance_index
+           << ") must be less than number of generalization instances ("
+           << generalization_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
+
+  const unsigned inputs_number = inputs_indices.size();
+
+  const double* instance = data[generalization_indices[generalization_instance_index]];
+
+  if (inputs.size() != inputs_number) {
+    inputs.set(inputs_number);
+  }
+
+  for (unsigned j = 0; j < inputs_number; j++) {
+    inputs[j] = instance[inputs_indices[j]];
+  }
+}
+
+// void get_generalization_target_instance(const unsigned&, Vector<double>&) const
+// method
+
+/// Copies the target values of a given generalization instance into a vector
+/// supplied by the caller.
+/// The row is read directly from the data matrix through the cached tables of
+/// indices, and the vector is only reallocated when its size changes.
+/// This is intended for loops over all the generalization instances.
+/// @param generalization_instance_index Index of generalization instance.
+/// @param targets Vector to store the target values.
+
+void DataSet::get_generalization_target_instance(
+    const unsigned& generalization_instance_index, Vector<double>& targets) const {
+  const Vector<unsigned>& generalization_indices = instances.get_generalization_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned generalization_instances_number = generalization_indices.size();
+
+  if (generalization_instance_index >= generalization_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_generalization_target_instance(const unsigned&, "
+              "Vector<double>&) const method.\n"
+           << "Index of generalization instance (" << generalization_instance_index
+           << ") must be less than number of generalization instances ("
+           << generalization_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
+
+  const unsigned targets_number = targets_indices.size();
+
+  const double* instance = data[generalization_indices[generalization_instance_index]];
+
+  if (targets.size() != targets_number) {
+    targets.set(targets_number);
+  }
+
+  for (unsigned j = 0; j < targets_number; j++) {
+    targets[j] = instance[targets_indices[j]];
+  }
+}
+
+// void get_testing_input_instance(const unsigned&, Vector<double>&) const
+// method
+
+/// Copies the input values of a given testing instance into a vector
+/// supplied by the caller.
+/// The row is read directly from the data matrix through the cached tables of
+/// indices, and the vector is only reallocated when its size changes.
+/// This is intended for loops over all the testing instances.
+/// @param testing_instance_index Index of testing instance.
+/// @param inputs Vector to store the input values.
+
+void DataSet::get_testing_input_instance(
+    const unsigned& testing_instance_index, Vector<double>& inputs) const {
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned testing_instances_number = testing_indices.size();
+
+  if (testing_instance_index >= testing_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_testing_input_instance(const unsigned&, "
+              "Vector<double>&) const method.\n"
+           << "Index of testing instance (" << testing_instance_index
+           << ") must be less than number of testing instances ("
+           << testing_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
+
+  const unsigned inputs_number = inputs_indices.size();
+
+  const double* instance = data[testing_indices[testing_instance_index]];
+
+  if (inputs.size() != inputs_number) {
+    inputs.set(inputs_number);
+  }
+
+  for (unsigned j = 0; j < inputs_number; j++) {
+    inputs[j] = instance[inputs_indices[j]];
+  }
+}
+
+// void get_testing_target_instance(const unsigned&, Vector<double>&) const
+// method
+
+/// Copies the target values of a given testing instance into a vector
+/// supplied by the caller.
+/// The row is read directly from the data matrix through the cached tables of
+/// indices, and the vector is only reallocated when its size changes.
+/// This is intended for loops over all the testing instances.
+/// @param testing_instance_index Index of testing instance.
+/// @param targets Vector to store the target values.
+
+void DataSet::get_testing_target_instance(
+    const unsigned& testing_instance_index, Vector<double>& targets) const {
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned testing_instances_number = testing_indices.size();
+
+  if (testing_instance_index >= testing_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_testing_target_instance(const unsigned&, "
+              "Vector<double>&) const method.\n"
+           << "Index of testing instance (" << testing_instance_index
+           << ") must be less than number of testing instances ("
+           << testing_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
+
+  const unsigned targets_number = targets_indices.size();
+
+  const double* instance = data[testing_indices[testing_instance_index]];
+
+  if (targets.size() != targets_number) {
+    targets.set(targets_number);
+  }
+
+  for (unsigned j = 0; j < targets_number; j++) {
+    targets[j] = instance[targets_indices[j]];
+  }
+}
+
+// void get_training_input_block(const unsigned&, const unsigned&,
+// Matrix<double>&) const method
+
+/// Copies the input values of a block of consecutive training instances into
+/// a matrix supplied by the caller, with one instance per row.
+/// The matrix is only reallocated when the size of the block changes.
+/// This is intended for the batch versions of the training algorithms.
+/// @param first_training_instance Index of the first training instance in the
+/// block.
+/// @param block_instances_number Number of training instances in the block.
+/// @param inputs Matrix to store the input values.
+
+void DataSet::get_training_input_block(
+    const unsigned& first_training_instance,
+    const unsigned& block_instances_number, Matrix<double>& inputs) const {
+  const Vector<unsigned>& training_indices = instances.get_training_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned training_instances_number = training_indices.size();
+
+  if (block_instances_number == 0 ||
+      first_training_instance + block_instances_number >
+          training_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_training_input_block(const unsigned&, const "
+              "unsigned&, Matrix<double>&) const method.\n"
+           << "Block of training instances must be within the number of "
+              "training instances (" << training_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
+
+  const unsigned inputs_number = inputs_indices.size();
+
+  inputs.set(block_instances_number, inputs_number);
+
+  for (unsigned i = 0; i < block_instances_number; i++) {
+    const double* instance =
+        data[training_indices[first_training_instance + i]];
+
+    double* block_row = inputs[i];
+
+    for (unsigned j = 0; j < inputs_number; j++) {
+      block_row[j] = instance[inputs_indices[j]];
+    }
+  }
+}
+
+// void get_training_target_block(const unsigned&, const unsigned&,
+// Matrix<double>&) const method
+
+/// Copies the target values of a block of consecutive training instances into
+/// a matrix supplied by the caller, with one instance per row.
+/// The matrix is only reallocated when the size of the block changes.
+/// This is intended for the batch versions of the training algorithms.
+/// @param first_training_instance Index of the first training instance in the
+/// block.
+/// @param block_instances_number Number of training instances in the block.
+/// @param targets Matrix to store the target values.
+
+void DataSet::get_training_target_block(
+    const unsigned& first_training_instance,
+    const unsigned& block_instances_number, Matrix<double>& targets) const {
+  const Vector<unsigned>& training_indices = instances.get_training_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned training_instances_number = training_indices.size();
+
+  if (block_instances_number == 0 ||
+      first_training_instance + block_instances_number >
+          training_instances_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_training_target_block(const unsigned&, const "
+              "unsigned&, Matrix<double>&) const method.\n"
+           << "Block of training instances must be within the number of "
+              "training instances (" << training_instances_number << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
+
+  const unsigned targets_number = targets_indices.size();
+
+  targets.set(block_instances_number, targets_number);
+
+  for (unsigned i = 0; i < block_instances_number; i++) {
+    const double* instance =
+        data[training_indices[first_training_instance + i]];
+
+    double* block_row = targets[i];
+
+    for (unsigned j = 0; j < targets_number; j++) {
+      block_row[j] = instance[targets_indices[j]];
+    }
+  }
+}
+
+// void get_training_input_block(const unsigned&, const unsigned&,
+// Matrix<float>&) const method
+
+/// Copies the input values of a block of consecutive training instances into
+/// a single precision matrix supplied by the caller, with one instance per
+/// row.
+/// The values are read from the single precision copy of the data, which must
+/// have been built with the update_single_precision_data method.
+/// @param first_training_instance Index of the first training instance in the
+/// block.
+/// @param block_instances_number Number of training instances in the block.
+/// @param inputs Matrix to store the input values.
+
+void DataSet::get_training_input_block(const unsigned& first_training_instance,
+                                       const unsigned& block_instances_number,
+                                       Matrix<float>& inputs) const {
+  const Vector<unsigned>& training_indices = instances.get_training_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (!has_single_precision_data()) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_training_input_block(const unsigned&, const "
+              "unsigned&, Matrix<float>&) const method.\n"
+           << "Single precision data is not up to date.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
+
+  const unsigned inputs_number = inputs_indices.size();
+
+  inputs.set(block_instances_number, inputs_number);
+
+  for (unsigned i = 0; i < block_instances_number; i++) {
+    const float* instance =
+        single_precision_data[training_indices[first_training_instance + i]];
+
+    float* block_row = inputs[i];
+
+    for (unsigned j = 0; j < inputs_number; j++) {
+      block_row[j] = instance[inputs_indices[j]];
+    }
+  }
+}
+
+// void get_training_target_block(const unsigned&, const unsigned&,
+// Matrix<float>&) const method
+
+/// Copies the target values of a block of consecutive training instances into
+/// a single precision matrix supplied by the caller, with one instance per
+/// row.
+/// The values are read from the single precision copy of the data, which must
+/// have been built with the update_single_precision_data method.
+/// @param first_training_instance Index of the first training instance in the
+/// block.
+/// @param block_instances_number Number of training instances in the block.
+/// @param targets Matrix to store the target values.
+
+void DataSet::get_training_target_block(
+    const unsigned& first_training_instance,
+    const unsigned& block_instances_number, Matrix<float>& targets) const {
+  const Vector<unsigned>& training_indices = instances.get_training_indices();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (!has_single_precision_data()) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: DataSet class.\n"
+           << "void get_training_target_block(const unsigned&, const "
+              "unsigned&, Matrix<float>&) const method.\n"
+           << "Single precision data is not up to date.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
+
+  const unsigned targets_number = targets_indices.size();
+
+  targets.set(block_instances_number, targets_number);
+
+  for (unsigned i = 0; i < block_instances_number; i++) {
+    const float* instance =
+        single_precision_data[training_indices[first_training_instance + i]];
+
+    float* block_row = targets[i];
+
+    for (unsigned j = 0; j < targets_number; j++) {
+      block_row[j] = instance[targets_indices[j]];
+    }
+  }
+}
+
 // Vector<double> get_variable(const unsigned&) const method
 
 /// Returns all the instances of a single variable in the data set.
@@ -873,6 +1438,7 @@ void DataSet::set(void) {
   data_file_name = "";
 
   data.set();
+  single_precision_data.set();
 
   variables.set();
   instances.set();
@@ -893,6 +1459,7 @@ void DataSet::set(const unsigned& new_variables_number,
   data_file_name = "";
 
   data.set(new_instances_number, new_variables_number);
+  single_precision_data.set();
 
   instances.set(new_instances_number);
 
@@ -920,6 +1487,7 @@ void DataSet::set(const unsigned& new_inputs_number,
   const unsigned new_variables_number = new_inputs_number + new_targets_number;
 
   data.set(new_instances_number, new_variables_number);
+  single_precision_data.set();
 
   // Variables
 
@@ -942,6 +1510,7 @@ void DataSet::set(const DataSet& other_data_set) {
   data_file_name = other_data_set.data_file_name;
 
   data = other_data_set.data;
+  single_precision_data.set();
 
   variables = other_data_set.variables;
 
@@ -1033,6 +1602,7 @@ void DataSet::set_data(const Matrix<double>& new_data) {
   // Set data
 
   data = new_data;
+  single_precision_data.set();
 }
 
 // void set_data_file_name(const std::string&) method
@@ -1057,6 +1627,7 @@ void DataSet::set_instances_number(const unsigned& new_instances_number) {
   const unsigned variables_number = variables.get_variables_number();
 
   data.set(new_instances_number, variables_number);
+  single_precision_data.set();
 
   instances.set(new_instances_number);
 }
@@ -1073,6 +1644,7 @@ void DataSet::set_variables_number(const unsigned& new_variables_number) {
   const unsigned instances_number = instances.get_instances_number();
 
   data.set(instances_number, new_variables_number);
+  single_precision_data.set();
 
   variables.set(new_variables_number);
 }
@@ -1122,6 +1694,7 @@ void DataSet::set_instance(const unsigned& instance_index,
   // Set instance
 
   data.set_row(instance_index, instance);
+  single_precision_data.set();
 }
 
 // void set_training_instance(const unsigned&, const Vector<double>&) method
@@ -1139,7 +1712,7 @@ void DataSet::set_training_instance(
 #ifndef NDEBUG
 
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
+      instances.get_training_indices().size();
 
   if (i >= training_instances_number) {
     std::ostringstream buffer;
@@ -1155,8 +1728,8 @@ void DataSet::set_training_instance(
 
 #endif
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   const unsigned index = training_indices[i];
 
@@ -1179,7 +1752,7 @@ void DataSet::set_generalization_instance(
 #ifndef NDEBUG
 
   const unsigned generalization_instances_number =
-      instances.count_generalization_instances_number();
+      instances.get_generalization_indices().size();
 
   if (i >= generalization_instances_number) {
     std::ostringstream buffer;
@@ -1195,8 +1768,8 @@ void DataSet::set_generalization_instance(
 
 #endif
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   const unsigned index = generalization_indices[i];
 
@@ -1218,7 +1791,7 @@ void DataSet::set_testing_instance(const unsigned& i,
 #ifndef NDEBUG
 
   const unsigned testing_instances_number =
-      instances.count_testing_instances_number();
+      instances.get_testing_indices().size();
 
   if (i >= testing_instances_number) {
     std::ostringstream buffer;
@@ -1234,7 +1807,7 @@ void DataSet::set_testing_instance(const unsigned& i,
 
 #endif
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   const unsigned index = testing_indices[i];
 
@@ -1288,7 +1861,7 @@ void DataSet::set_input_instance(const unsigned& instance_index,
 
 #endif
 
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   unsigned input_variable_index;
 
@@ -1297,6 +1870,8 @@ void DataSet::set_input_instance(const unsigned& instance_index,
 
     data[instance_index][input_variable_index] = input_instance[i];
   }
+
+  single_precision_data.set();
 }
 
 // void set_target_instance(const unsigned&, const Vector<double>&) method
@@ -1346,7 +1921,7 @@ void DataSet::set_target_instance(const unsigned& instance_index,
 
 #endif
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   unsigned target_variable_index;
 
@@ -1355,6 +1930,8 @@ void DataSet::set_target_instance(const unsigned& instance_index,
 
     data[instance_index][target_variable_index] = target_instance[i];
   }
+
+  single_precision_data.set();
 }
 
 // void set_training_input_instance(const unsigned&, const Vector<double>&)
@@ -1371,7 +1948,7 @@ void DataSet::set_training_input_instance(
 #ifndef NDEBUG
 
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
+      instances.get_training_indices().size();
 
   if (i >= training_instances_number) {
     std::ostringstream buffer;
@@ -1387,8 +1964,8 @@ void DataSet::set_training_input_instance(
 
 #endif
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   const unsigned index = training_indices[i];
 
@@ -1410,7 +1987,7 @@ void DataSet::set_generalization_input_instance(
 #ifndef NDEBUG
 
   const unsigned generalization_instances_number =
-      instances.count_generalization_instances_number();
+      instances.get_generalization_indices().size();
 
   if (i >= generalization_instances_number) {
     std::ostringstream buffer;
@@ -1426,8 +2003,8 @@ void DataSet::set_generalization_input_instance(
 
 #endif
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   const unsigned index = generalization_indices[i];
 
@@ -1448,7 +2025,7 @@ void DataSet::set_testing_input_instance(
 #ifndef NDEBUG
 
   const unsigned testing_instances_number =
-      instances.count_testing_instances_number();
+      instances.get_testing_indices().size();
 
   if (i >= testing_instances_number) {
     std::ostringstream buffer;
@@ -1464,7 +2041,7 @@ void DataSet::set_testing_input_instance(
 
 #endif
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   const unsigned index = testing_indices[i];
 
@@ -1485,7 +2062,7 @@ void DataSet::set_training_target_instance(
 #ifndef NDEBUG
 
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
+      instances.get_training_indices().size();
 
   if (i >= training_instances_number) {
     std::ostringstream buffer;
@@ -1501,8 +2078,8 @@ void DataSet::set_training_target_instance(
 
 #endif
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   const unsigned index = training_indices[i];
 
@@ -1525,7 +2102,7 @@ void DataSet::set_generalization_target_instance(
 #ifndef NDEBUG
 
   const unsigned generalization_instances_number =
-      instances.count_generalization_instances_number();
+      instances.get_generalization_indices().size();
 
   if (i >= generalization_instances_number) {
     std::ostringstream buffer;
@@ -1541,8 +2118,8 @@ void DataSet::set_generalization_target_instance(
 
 #endif
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   const unsigned index = generalization_indices[i];
 
@@ -1563,7 +2140,7 @@ void DataSet::set_testing_target_instance(
 #ifndef NDEBUG
 
   const unsigned testing_instances_number =
-      instances.count_testing_instances_number();
+      instances.get_testing_indices().size();
 
   if (i >= testing_instances_number) {
     std::ostringstream buffer;
@@ -1579,7 +2156,7 @@ void DataSet::set_testing_target_instance(
 
 #endif
 
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   const unsigned index = testing_indices[i];
 
@@ -1618,6 +2195,7 @@ void DataSet::add_instance(const Vector<double>& instance) {
   const unsigned instances_number = instances.get_instances_number();
 
   data.append_row(instance);
+  single_precision_data.set();
 
   instances.set(instances_number + 1);
 }
@@ -1650,6 +2228,7 @@ void DataSet::subtract_instance(const unsigned& instance_index) {
 #endif
 
   data.subtract_row(instance_index);
+  single_precision_data.set();
 
   instances.set_instances_number(instances_number - 1);
 }
@@ -1683,6 +2262,7 @@ void DataSet::append_variable(const Vector<double>& variable) {
   const unsigned variables_number = variables.get_variables_number();
 
   data.append_column(variable);
+  single_precision_data.set();
 
   Matrix<double> new_data(data);
 
@@ -1718,6 +2298,7 @@ void DataSet::subtract_variable(const unsigned& variable_index) {
 #endif
 
   data.subtract_column(variable_index);
+  single_precision_data.set();
 
   Matrix<double> new_data(data);
 
@@ -1883,8 +2464,8 @@ Matrix<double> DataSet::calculate_data_statistics_matrix(void) const {
 
 Vector<Statistics<double> > DataSet::calculate_training_instances_statistics(
     void) const {
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   return (data.calculate_rows_statistics(training_indices));
 }
@@ -1904,8 +2485,8 @@ Vector<Statistics<double> > DataSet::calculate_training_instances_statistics(
 
 Vector<Statistics<double> >
 DataSet::calculate_generalization_instances_statistics(void) const {
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   return (data.calculate_rows_statistics(generalization_indices));
 }
@@ -1925,7 +2506,7 @@ DataSet::calculate_generalization_instances_statistics(void) const {
 
 Vector<Statistics<double> > DataSet::calculate_testing_instances_statistics(
     void) const {
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
   return (data.calculate_rows_statistics(testing_indices));
 }
@@ -1943,7 +2524,7 @@ Vector<Statistics<double> > DataSet::calculate_testing_instances_statistics(
 /// </ul>
 
 Vector<Statistics<double> > DataSet::calculate_inputs_statistics(void) const {
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   return (data.calculate_columns_statistics(inputs_indices));
 }
@@ -1961,7 +2542,7 @@ Vector<Statistics<double> > DataSet::calculate_inputs_statistics(void) const {
 /// </ul>
 
 Vector<Statistics<double> > DataSet::calculate_targets_statistics(void) const {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   return (data.calculate_columns_statistics(targets_indices));
 }
@@ -1971,10 +2552,10 @@ Vector<Statistics<double> > DataSet::calculate_targets_statistics(void) const {
 /// Returns the mean values of the target variables on the training instances.
 
 Vector<double> DataSet::calculate_training_target_data_mean(void) const {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
-  const Vector<unsigned> training_indices =
-      instances.arrange_training_indices();
+  const Vector<unsigned>& training_indices =
+      instances.get_training_indices();
 
   return (data.calculate_mean(training_indices, targets_indices));
 }
@@ -1985,10 +2566,10 @@ Vector<double> DataSet::calculate_training_target_data_mean(void) const {
 /// instances.
 
 Vector<double> DataSet::calculate_generalization_target_data_mean(void) const {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
-  const Vector<unsigned> generalization_indices =
-      instances.arrange_generalization_indices();
+  const Vector<unsigned>& generalization_indices =
+      instances.get_generalization_indices();
 
   return (data.calculate_mean(generalization_indices, targets_indices));
 }
@@ -1998,9 +2579,9 @@ Vector<double> DataSet::calculate_generalization_target_data_mean(void) const {
 /// Returns the mean values of the target variables on the testing instances.
 
 Vector<double> DataSet::calculate_testing_target_data_mean(void) const {
-  const Vector<unsigned> testing_indices = instances.arrange_testing_indices();
+  const Vector<unsigned>& testing_indices = instances.get_testing_indices();
 
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   return (data.calculate_mean(testing_indices, targets_indices));
 }
@@ -2093,6 +2674,7 @@ void DataSet::scale_data_mean_standard_deviation(
   }
 
   data.scale_mean_standard_deviation(data_statistics);
+  single_precision_data.set();
 }
 
 // Vector< Statistics<double> > scale_data_minimum_maximum(void) method
@@ -2168,6 +2750,7 @@ void DataSet::scale_data_minimum_maximum(
   }
 
   data.scale_minimum_maximum(data_statistics);
+  single_precision_data.set();
 }
 
 // void scale_data(const std::string&, const Vector< Statistics<double> >&)
@@ -2251,9 +2834,10 @@ Vector<Statistics<double> > DataSet::scale_data(
 
 void DataSet::scale_inputs_mean_standard_deviation(
     const Vector<Statistics<double> >& inputs_statistics) {
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   data.scale_columns_mean_standard_deviation(inputs_statistics, inputs_indices);
+  single_precision_data.set();
 }
 
 // Vector< Statistics<double> > scale_inputs_mean_standard_deviation(void)
@@ -2284,9 +2868,10 @@ Vector<Statistics<double> > DataSet::scale_inputs_mean_standard_deviation(
 
 void DataSet::scale_inputs_minimum_maximum(
     const Vector<Statistics<double> >& inputs_statistics) {
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   data.scale_columns_minimum_maximum(inputs_statistics, inputs_indices);
+  single_precision_data.set();
 }
 
 // Vector< Vector<double> > scale_inputs_minimum_maximum(void) method
@@ -2379,10 +2964,11 @@ void DataSet::scale_inputs(
 
 void DataSet::scale_targets_mean_standard_deviation(
     const Vector<Statistics<double> >& targets_statistics) {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   data.scale_columns_mean_standard_deviation(targets_statistics,
                                              targets_indices);
+  single_precision_data.set();
 }
 
 // Vector< Statistics<double> > scale_targets_mean_standard_deviation(void)
@@ -2415,9 +3001,10 @@ Vector<Statistics<double> > DataSet::scale_targets_mean_standard_deviation(
 
 void DataSet::scale_targets_minimum_maximum(
     const Vector<Statistics<double> >& targets_statistics) {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   data.scale_columns_minimum_maximum(targets_statistics, targets_indices);
+  single_precision_data.set();
 }
 
 // Vector< Statistics<double> > scale_targets_minimum_maximum(void) method
@@ -2511,6 +3098,7 @@ void DataSet::scale_targets(
 void DataSet::unscale_data_mean_standard_deviation(
     const Vector<Statistics<double> >& data_statistics) {
   data.unscale_mean_standard_deviation(data_statistics);
+  single_precision_data.set();
 }
 
 // void unscale_data_minimum_maximum(const Vector< Statistics<double> >&) method
@@ -2524,6 +3112,7 @@ void DataSet::unscale_data_mean_standard_deviation(
 void DataSet::unscale_data_minimum_maximum(
     const Vector<Statistics<double> >& data_statistics) {
   data.unscale_minimum_maximum(data_statistics);
+  single_precision_data.set();
 }
 
 // void unscale_inputs_mean_standard_deviation(const Vector< Statistics<double>
@@ -2537,10 +3126,11 @@ void DataSet::unscale_data_minimum_maximum(
 
 void DataSet::unscale_inputs_mean_standard_deviation(
     const Vector<Statistics<double> >& inputs_statistics) {
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   data.unscale_columns_mean_standard_deviation(inputs_statistics,
                                                inputs_indices);
+  single_precision_data.set();
 }
 
 // void unscale_inputs_minimum_maximum(const Vector< Statistics<double> >&)
@@ -2554,9 +3144,10 @@ void DataSet::unscale_inputs_mean_standard_deviation(
 
 void DataSet::unscale_inputs_minimum_maximum(
     const Vector<Statistics<double> >& inputs_statistics) {
-  const Vector<unsigned> inputs_indices = variables.arrange_inputs_indices();
+  const Vector<unsigned>& inputs_indices = variables.get_inputs_indices();
 
   data.unscale_columns_minimum_maximum(inputs_statistics, inputs_indices);
+  single_precision_data.set();
 }
 
 // void unscale_targets_mean_standard_deviation(const Vector< Statistics<double>
@@ -2570,10 +3161,11 @@ void DataSet::unscale_inputs_minimum_maximum(
 
 void DataSet::unscale_targets_mean_standard_deviation(
     const Vector<Statistics<double> >& targets_statistics) {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   data.unscale_columns_mean_standard_deviation(targets_statistics,
                                                targets_indices);
+  single_precision_data.set();
 }
 
 // void unscale_targets_minimum_maximum(const Vector< Statistics<double> >&)
@@ -2587,9 +3179,10 @@ void DataSet::unscale_targets_mean_standard_deviation(
 
 void DataSet::unscale_targets_minimum_maximum(
     const Vector<Statistics<double> >& targets_statistics) {
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   data.unscale_columns_minimum_maximum(targets_statistics, targets_indices);
+  single_precision_data.set();
 }
 
 // void initialize_data(const double& value) method
@@ -2599,6 +3192,7 @@ void DataSet::unscale_targets_minimum_maximum(
 
 void DataSet::initialize_data(const double& new_value) {
   data.initialize(new_value);
+  single_precision_data.set();
 }
 
 // void randomize_data_uniform(const double&, const double&) method
@@ -2610,6 +3204,7 @@ void DataSet::initialize_data(const double& new_value) {
 void DataSet::randomize_data_uniform(const double& minimum,
                                      const double& maximum) {
   data.randomize_uniform(minimum, maximum);
+  single_precision_data.set();
 }
 
 // void randomize_data_normal(const double&, const double&) method
@@ -2621,6 +3216,7 @@ void DataSet::randomize_data_uniform(const double& minimum,
 void DataSet::randomize_data_normal(const double& mean,
                                     const double& standard_deviation) {
   data.randomize_normal(mean, standard_deviation);
+  single_precision_data.set();
 }
 
 // tinyxml2::XMLDocument* to_XML(void) const method
@@ -2919,6 +3515,7 @@ void DataSet::save_data(const std::string& file_name) const {
 
 void DataSet::load_data(void) {
   data.load(data_file_name);
+  single_precision_data.set();
 
   const unsigned columns_number = data.get_columns_number();
 
@@ -2959,7 +3556,7 @@ Vector<unsigned> DataSet::calculate_target_class_distribution(void) const {
 
   const unsigned instances_number = instances.get_instances_number();
   const unsigned targets_number = variables.count_targets_number();
-  const Vector<unsigned> targets_indices = variables.arrange_targets_indices();
+  const Vector<unsigned>& targets_indices = variables.get_targets_indices();
 
   Vector<unsigned> class_distribution;
 
@@ -126,6 +126,9 @@ class DataSet {
 
   const Matrix<double>& get_data(void) const;
 
+  bool has_single_precision_data(void) const;
+  void update_single_precision_data(void);
+
   Matrix<double> arrange_training_data(void) const;
   Matrix<double> arrange_generalization_data(void) const;
   Matrix<double> arrange_testing_data(void) const;
@@ -160,6 +163,27 @@ class DataSet {
   Vector<double> get_testing_input_instance(const unsigned&) const;
   Vector<double> get_testing_target_instance(const unsigned&) const;
 
+  void get_training_input_instance(const unsigned&, Vector<double>&) const;
+  void get_training_target_instance(const unsigned&, Vector<double>&) const;
+
+  void get_generalization_input_instance(const unsigned&,
+                                         Vector<double>&) const;
+  void get_generalization_target_instance(const unsigned&,
+                                          Vector<double>&) const;
+
+  void get_testing_input_instance(const unsigned&, Vector<double>&) const;
+  void get_testing_target_instance(const unsigned&, Vector<double>&) const;
+
+  void get_training_input_block(const unsigned&, const unsigned&,
+                                Matrix<double>&) const;
+  void get_training_target_block(const unsigned&, const unsigned&,
+                                 Matrix<double>&) const;
+
+  void get_training_input_block(const unsigned&, const unsigned&,
+                                Matrix<float>&) const;
+  void get_training_target_block(const unsigned&, const unsigned&,
+                                 Matrix<float>&) const;
+
   // Variable methods
 
   Vector<double> get_variable(const unsigned&) const;
@@ -352,6 +376,13 @@ class DataSet {
 
   Matrix<double> data;
 
+  /// Copy of the data matrix rounded to single precision, which is read by the
+  /// single precision training instead of the data matrix.
+  /// It is only built when needed, and it is cleared whenever the data
+  /// changes.
+
+  Matrix<float> single_precision_data;
+
   /// Variables object (inputs and target variables).
 
   Variables variables;
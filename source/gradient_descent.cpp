@@ -1251,14 +1251,21 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training(
     // Performance functional stuff
 
     if (iteration == 0) {
-      performance = performance_functional_pointer->calculate_performance();
+      const PerformanceFunctional::FirstOrderperformance
+          first_order_performance =
+              performance_functional_pointer
+                  ->calculate_first_order_performance();
+
+      performance = first_order_performance.performance;
+      gradient = first_order_performance.gradient;
+
       performance_increase = 1.0e99;
     } else {
       performance = directional_point[1];
       performance_increase = old_performance - performance;
-    }
 
-    gradient = performance_functional_pointer->calculate_gradient();
+      gradient = performance_functional_pointer->calculate_gradient();
+    }
 
     gradient_norm = gradient.calculate_norm();
 
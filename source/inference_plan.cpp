@@ -0,0 +1,684 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   I N F E R E N C E   P L A N   C L A S S
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "inference_plan.h"
+#include "neural_network.h"
+
+namespace OpenNN {
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates an empty inference plan.
+
+InferencePlan::InferencePlan(void) { set(); }
+
+// NEURAL NETWORK CONSTRUCTOR
+
+/// Neural network constructor.
+/// It compiles an inference plan from a neural network.
+/// @param neural_network Neural network to be compiled.
+
+InferencePlan::InferencePlan(const NeuralNetwork& neural_network) {
+  set(neural_network);
+}
+
+// DESTRUCTOR
+
+/// Destructor.
+
+InferencePlan::~InferencePlan(void) {}
+
+// bool is_empty(void) const method
+
+/// Returns true if the plan has not been compiled from any neural network,
+/// and false otherwise.
+
+bool InferencePlan::is_empty(void) const {
+  return (layers_perceptrons_number.empty());
+}
+
+// const unsigned& get_inputs_number(void) const method
+
+/// Returns the number of inputs to the plan.
+
+const unsigned& InferencePlan::get_inputs_number(void) const {
+  return (inputs_number);
+}
+
+// const unsigned& get_outputs_number(void) const method
+
+/// Returns the number of outputs from the plan.
+
+const unsigned& InferencePlan::get_outputs_number(void) const {
+  return (outputs_number);
+}
+
+// unsigned get_layers_number(void) const method
+
+/// Returns the number of layers of the multilayer perceptron in the plan.
+
+unsigned InferencePlan::get_layers_number(void) const {
+  return (layers_perceptrons_number.size());
+}
+
+// const Vector<double>& get_parameters(void) const method
+
+/// Returns the block with all the parameters of the plan.
+
+const Vector<double>& InferencePlan::get_parameters(void) const {
+  return (parameters);
+}
+
+// const Vector<float>& get_single_parameters(void) const method
+
+/// Returns the block with all the parameters of the plan rounded to single
+/// precision.
+
+const Vector<float>& InferencePlan::get_single_parameters(void) const {
+  return (single_parameters);
+}
+
+// const unsigned& get_workspace_size(void) const method
+
+/// Returns the number of doubles that the workspace for calculating the
+/// outputs of one instance must hold.
+
+const unsigned& InferencePlan::get_workspace_size(void) const {
+  return (workspace_size);
+}
+
+// void set(void) method
+
+/// Sets an empty inference plan.
+
+void InferencePlan::set(void) {
+  inputs_number = 0;
+  outputs_number = 0;
+
+  layers_inputs_number.set();
+  layers_perceptrons_number.set();
+  layers_parameters_index.set();
+  layers_activation_function.set();
+  layers_activation_accuracy.set();
+
+  unscaling = false;
+  unscaling_index = 0;
+
+  probabilistic_method = ProbabilisticLayer::NoProbabilistic;
+
+  bounding = false;
+  bounding_index = 0;
+
+  parameters.set();
+  single_parameters.set();
+
+  workspace_size = 0;
+}
+
+// void set(const NeuralNetwork&) method
+
+/// Compiles the inference plan from a neural network.
+/// The neural network must have a multilayer perceptron, and its conditions
+/// layer, if any, must not apply conditions.
+/// @param neural_network Neural network to be compiled.
+
+void InferencePlan::set(const NeuralNetwork& neural_network) {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network.has_multilayer_perceptron()
+          ? neural_network.get_multilayer_perceptron_pointer()
+          : NULL;
+
+  if (!multilayer_perceptron_pointer ||
+      multilayer_perceptron_pointer->get_layers_number() == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: InferencePlan class.\n"
+           << "void set(const NeuralNetwork&) method.\n"
+           << "Neural network must have a multilayer perceptron.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  const ConditionsLayer* conditions_layer_pointer =
+      neural_network.has_conditions_layer()
+          ? neural_network.get_conditions_layer_pointer()
+          : NULL;
+
+  if (conditions_layer_pointer &&
+      conditions_layer_pointer->get_conditions_method() !=
+          ConditionsLayer::NoConditions) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: InferencePlan class.\n"
+           << "void set(const NeuralNetwork&) method.\n"
+           << "Conditions layer is not supported.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  set();
+
+  const Vector<PerceptronLayer>& layers =
+      multilayer_perceptron_pointer->get_layers();
+
+  const unsigned layers_number = layers.size();
+
+  inputs_number = multilayer_perceptron_pointer->get_inputs_number();
+  outputs_number = multilayer_perceptron_pointer->get_outputs_number();
+
+  // Layers
+
+  layers_inputs_number.set(layers_number);
+  layers_perceptrons_number.set(layers_number);
+  layers_parameters_index.set(layers_number);
+  layers_activation_function.set(layers_number);
+  layers_activation_accuracy.set(layers_number);
+
+  unsigned parameters_number = 0;
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    layers_inputs_number[i] = layers[i].get_inputs_number();
+    layers_perceptrons_number[i] = layers[i].get_perceptrons_number();
+    layers_parameters_index[i] = parameters_number;
+    layers_activation_function[i] = layers[i].get_activation_function();
+    layers_activation_accuracy[i] = layers[i].get_activation_accuracy();
+
+    parameters_number += layers[i].get_parameters().size();
+
+    if (i < layers_number - 1 &&
+        2 * layers_perceptrons_number[i] > workspace_size) {
+      workspace_size = 2 * layers_perceptrons_number[i];
+    }
+  }
+
+  // Unscaling and bounding
+
+  const UnscalingLayer* unscaling_layer_pointer =
+      neural_network.has_unscaling_layer()
+          ? neural_network.get_unscaling_layer_pointer()
+          : NULL;
+
+  const bool has_unscaling =
+      unscaling_layer_pointer &&
+      unscaling_layer_pointer->get_unscaling_method() !=
+          UnscalingLayer::NoUnscaling;
+
+  unscaling = has_unscaling &&
+              layers_activation_function[layers_number - 1] !=
+                  Perceptron::Linear;
+
+  if (unscaling) {
+    unscaling_index = parameters_number;
+    parameters_number += 2 * outputs_number;
+  }
+
+  const BoundingLayer* bounding_layer_pointer =
+      neural_network.has_bounding_layer()
+          ? neural_network.get_bounding_layer_pointer()
+          : NULL;
+
+  bounding = bounding_layer_pointer &&
+             bounding_layer_pointer->get_bounding_neurons_number() > 0;
+
+  if (bounding) {
+    bounding_index = parameters_number;
+    parameters_number += 2 * outputs_number;
+  }
+
+  parameters.set(parameters_number);
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    const Vector<double>& layer_parameters = layers[i].get_parameters();
+
+    std::copy(layer_parameters.begin(), layer_parameters.end(),
+              parameters.begin() + layers_parameters_index[i]);
+  }
+
+  // Fold scaling into the first layer
+
+  const ScalingLayer* scaling_layer_pointer =
+      neural_network.has_scaling_layer()
+          ? neural_network.get_scaling_layer_pointer()
+          : NULL;
+
+  if (scaling_layer_pointer &&
+      scaling_layer_pointer->get_scaling_method() != ScalingLayer::NoScaling) {
+    const Vector<double> zeros(inputs_number, 0.0);
+
+    const Vector<double> slopes =
+        scaling_layer_pointer->calculate_derivatives(zeros);
+    const Vector<double> intercepts =
+        scaling_layer_pointer->calculate_outputs(zeros);
+
+    double* perceptron_parameters = &parameters[0];
+
+    for (unsigned j = 0; j < layers_perceptrons_number[0]; j++) {
+      for (unsigned k = 0; k < inputs_number; k++) {
+        perceptron_parameters[0] += perceptron_parameters[1 + k] *
+                                    intercepts[k];
+        perceptron_parameters[1 + k] *= slopes[k];
+      }
+
+      perceptron_parameters += 1 + inputs_number;
+    }
+  }
+
+  // Unscaling coefficients, folded into a linear last layer
+
+  if (has_unscaling) {
+    const Vector<double> zeros(outputs_number, 0.0);
+
+    const Vector<double> slopes =
+        unscaling_layer_pointer->calculate_derivatives(zeros);
+    const Vector<double> intercepts =
+        unscaling_layer_pointer->calculate_outputs(zeros);
+
+    if (unscaling) {
+      std::copy(slopes.begin(), slopes.end(),
+                parameters.begin() + unscaling_index);
+      std::copy(intercepts.begin(), intercepts.end(),
+                parameters.begin() + unscaling_index + outputs_number);
+    } else {
+      const unsigned last_layer_inputs_number =
+          layers_inputs_number[layers_number - 1];
+
+      double* perceptron_parameters =
+          &parameters[layers_parameters_index[layers_number - 1]];
+
+      for (unsigned j = 0; j < outputs_number; j++) {
+        for (unsigned k = 0; k < 1 + last_layer_inputs_number; k++) {
+          perceptron_parameters[k] *= slopes[j];
+        }
+
+        perceptron_parameters[0] += intercepts[j];
+
+        perceptron_parameters += 1 + last_layer_inputs_number;
+      }
+    }
+  }
+
+  // Probabilistic method
+
+  const ProbabilisticLayer* probabilistic_layer_pointer =
+      neural_network.has_probabilistic_layer()
+          ? neural_network.get_probabilistic_layer_pointer()
+          : NULL;
+
+  if (probabilistic_layer_pointer) {
+    probabilistic_method =
+        probabilistic_layer_pointer->get_probabilistic_method();
+  }
+
+  // Bounds
+
+  if (bounding) {
+    const Vector<double>& lower_bounds =
+        bounding_layer_pointer->get_lower_bounds();
+    const Vector<double>& upper_bounds =
+        bounding_layer_pointer->get_upper_bounds();
+
+    std::copy(lower_bounds.begin(), lower_bounds.end(),
+              parameters.begin() + bounding_index);
+    std::copy(upper_bounds.begin(), upper_bounds.end(),
+              parameters.begin() + bounding_index + outputs_number);
+  }
+
+  // Single precision parameters
+
+  single_parameters.set(parameters.size());
+
+  std::copy(parameters.begin(), parameters.end(), single_parameters.begin());
+}
+
+// void calculate_outputs(const double*, double*, double*) const method
+
+/// Calculates the outputs of the plan for one instance.
+/// This method does not allocate memory and does not modify the plan.
+/// @param inputs Array with the inputs, of size the number of inputs.
+/// @param outputs Array to store the outputs, of size the number of outputs.
+/// @param workspace Array of size the workspace size, used for the outputs of
+/// the hidden layers.
+/// It must not overlap with the outputs.
+
+void InferencePlan::calculate_outputs(const double* inputs, double* outputs,
+                                      double* workspace) const {
+  calculate_outputs_kernel(parameters.empty() ? NULL : &parameters[0], inputs,
+                           outputs, workspace);
+}
+
+// void calculate_outputs(const float*, float*, float*) const method
+
+/// Calculates the outputs of the plan for one instance in single precision.
+/// The inputs, the outputs, the parameters and the outputs of the hidden
+/// layers are floats, and so are the combinations of the perceptrons.
+/// Only the activations are evaluated in double precision, and rounded to
+/// single precision when they are stored.
+/// This method does not allocate memory and does not modify the plan.
+/// @param inputs Array with the inputs, of size the number of inputs.
+/// @param outputs Array to store the outputs, of size the number of outputs.
+/// @param workspace Array of size the workspace size, used for the outputs of
+/// the hidden layers.
+/// It must not overlap with the outputs.
+
+void InferencePlan::calculate_outputs(const float* inputs, float* outputs,
+                                      float* workspace) const {
+  calculate_outputs_kernel(
+      single_parameters.empty() ? NULL : &single_parameters[0], inputs,
+      outputs, workspace);
+}
+
+// void calculate_outputs(const Matrix<double>&, Matrix<double>&,
+// Vector<double>&) const method
+
+/// Calculates the outputs of the plan for a block of instances.
+/// The outputs matrix and the workspace are only reallocated when their sizes
+/// change, so that repeated calls with blocks of the same size do not allocate
+/// memory.
+/// @param inputs Matrix of inputs, with one instance per row.
+/// @param outputs Matrix to store the outputs, with one instance per row.
+/// @param workspace Vector used for the outputs of the hidden layers.
+
+void InferencePlan::calculate_outputs(const Matrix<double>& inputs,
+                                      Matrix<double>& outputs,
+                                      Vector<double>& workspace) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: InferencePlan class.\n"
+           << "void calculate_outputs(const Matrix<double>&, Matrix<double>&, "
+              "Vector<double>&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = inputs.get_rows_number();
+
+  if (instances_number == 0) {
+    outputs.set();
+    return;
+  }
+
+  outputs.set(instances_number, outputs_number);
+
+  if (workspace.size() < workspace_size) {
+    workspace.set(workspace_size);
+  }
+
+  double* workspace_data = workspace.empty() ? NULL : &workspace[0];
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    calculate_outputs(inputs[i], outputs[i], workspace_data);
+  }
+}
+
+// Vector<double> calculate_outputs(const Vector<double>&) const method
+
+/// Returns the outputs of the plan for one instance.
+/// This method allocates the outputs and the workspace, and it is meant for
+/// convenience rather than for speed.
+/// @param inputs Vector of inputs.
+
+Vector<double> InferencePlan::calculate_outputs(
+    const Vector<double>& inputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned size = inputs.size();
+
+  if (size != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: InferencePlan class.\n"
+           << "Vector<double> calculate_outputs(const Vector<double>&) const "
+              "method.\n"
+           << "Size of inputs (" << size
+           << ") must be equal to number of inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  Vector<double> outputs(outputs_number);
+  Vector<double> workspace(workspace_size);
+
+  calculate_outputs(inputs.empty() ? NULL : &inputs[0], &outputs[0],
+                    workspace.empty() ? NULL : &workspace[0]);
+
+  return (outputs);
+}
+
+// Matrix<double> calculate_outputs(const Matrix<double>&) const method
+
+/// Returns the outputs of the plan for a block of instances.
+/// @param inputs Matrix of inputs, with one instance per row.
+
+Matrix<double> InferencePlan::calculate_outputs(
+    const Matrix<double>& inputs) const {
+  Matrix<double> outputs;
+  Vector<double> workspace;
+
+  calculate_outputs(inputs, outputs, workspace);
+
+  return (outputs);
+}
+
+// void calculate_outputs(const Matrix<float>&, Matrix<float>&, Vector<float>&)
+// const method
+
+/// Calculates the outputs of the plan for a block of instances in single
+/// precision.
+/// The outputs matrix and the workspace are only reallocated when their sizes
+/// change.
+/// @param inputs Matrix of inputs, with one instance per row.
+/// @param outputs Matrix to store the outputs, with one instance per row.
+/// @param workspace Vector used for the outputs of the hidden layers.
+
+void InferencePlan::calculate_outputs(const Matrix<float>& inputs,
+                                      Matrix<float>& outputs,
+                                      Vector<float>& workspace) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: InferencePlan class.\n"
+           << "void calculate_outputs(const Matrix<float>&, Matrix<float>&, "
+              "Vector<float>&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = inputs.get_rows_number();
+
+  if (instances_number == 0) {
+    outputs.set();
+    return;
+  }
+
+  outputs.set(instances_number, outputs_number);
+
+  if (workspace.size() < workspace_size) {
+    workspace.set(workspace_size);
+  }
+
+  float* workspace_data = workspace.empty() ? NULL : &workspace[0];
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    calculate_outputs(inputs[i], outputs[i], workspace_data);
+  }
+}
+
+// template <class Type> void calculate_outputs_kernel(const Type*, const
+// Type*, Type*, Type*) const method
+
+/// Calculates the outputs of the plan for one instance, with a parameters
+/// block, inputs, outputs and workspace of the same floating point type.
+/// The products of synaptic weights and inputs, and the bias, are summed in
+/// that type, so that the loop is vectorized with its full width.
+/// @param parameters_data Parameters block of the plan in the given type.
+/// @param inputs Array with the inputs.
+/// @param outputs Array to store the outputs.
+/// @param workspace Array used for the outputs of the hidden layers.
+
+template <class Type>
+void InferencePlan::calculate_outputs_kernel(const Type* parameters_data,
+                                             const Type* inputs, Type* outputs,
+                                             Type* workspace) const {
+  const unsigned layers_number = layers_perceptrons_number.size();
+
+  const unsigned half_workspace_size = workspace_size / 2;
+
+  const Type* layer_inputs = inputs;
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    const unsigned layer_inputs_number = layers_inputs_number[i];
+    const unsigned layer_perceptrons_number = layers_perceptrons_number[i];
+
+    Type* layer_outputs = i == layers_number - 1
+                                ? outputs
+                                : workspace + (i % 2) * half_workspace_size;
+
+    const Type* perceptron_parameters =
+        parameters_data + layers_parameters_index[i];
+
+    for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+      Type sum = 0;
+
+#pragma omp simd reduction(+ : sum)
+      for (unsigned k = 0; k < layer_inputs_number; k++) {
+        sum += perceptron_parameters[1 + k] * layer_inputs[k];
+      }
+
+      layer_outputs[j] = perceptron_parameters[0] + sum;
+
+      perceptron_parameters += 1 + layer_inputs_number;
+    }
+
+    Perceptron::calculate_activations(
+        layers_activation_function[i], layers_activation_accuracy[i],
+        layer_outputs, layer_outputs, layer_perceptrons_number);
+
+    layer_inputs = layer_outputs;
+  }
+
+  // Unscaling
+
+  if (unscaling) {
+    const Type* slopes = parameters_data + unscaling_index;
+    const Type* intercepts = slopes + outputs_number;
+
+    for (unsigned j = 0; j < outputs_number; j++) {
+      outputs[j] = slopes[j] * outputs[j] + intercepts[j];
+    }
+  }
+
+  // Probabilistic
+
+  switch (probabilistic_method) {
+    case ProbabilisticLayer::Competitive: {
+      unsigned maximal_index = 0;
+
+      for (unsigned j = 1; j < outputs_number; j++) {
+        if (outputs[j] > outputs[maximal_index]) {
+          maximal_index = j;
+        }
+      }
+
+      for (unsigned j = 0; j < outputs_number; j++) {
+        outputs[j] = j == maximal_index ? 1.0 : 0.0;
+      }
+    } break;
+
+    case ProbabilisticLayer::Softmax: {
+      double sum = 0.0;
+
+      for (unsigned j = 0; j < outputs_number; j++) {
+        outputs[j] = exp(outputs[j]);
+        sum += outputs[j];
+      }
+
+      for (unsigned j = 0; j < outputs_number; j++) {
+        outputs[j] /= sum;
+      }
+    } break;
+
+    case ProbabilisticLayer::NoProbabilistic: {
+      // Do nothing
+    } break;
+  }
+
+  // Bounding
+
+  if (bounding) {
+    const Type* lower_bounds = parameters_data + bounding_index;
+    const Type* upper_bounds = lower_bounds + outputs_number;
+
+    for (unsigned j = 0; j < outputs_number; j++) {
+      if (outputs[j] < lower_bounds[j]) {
+        outputs[j] = lower_bounds[j];
+      } else if (outputs[j] > upper_bounds[j]) {
+        outputs[j] = upper_bounds[j];
+      }
+    }
+  }
+}
+}
+
+// OpenNN: Open Neural Networks Library.
+// Neural Designer Copyright © 2013 Roberto López and Ismael Santana (Intelnics)
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,205 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   I N F E R E N C E   P L A N   C L A S S   H E A D E R
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __INFERENCEPLAN_H__
+#define __INFERENCEPLAN_H__
+
+// System includes
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sstream>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+#include "perceptron.h"
+#include "probabilistic_layer.h"
+
+namespace OpenNN {
+
+class NeuralNetwork;
+
+/// This class represents a frozen, flat form of a neural network, which is
+/// only used for calculating outputs.
+/// All the parameters needed for that are stored in a single block.
+/// The affine scaling of the inputs is folded into the first layer of the
+/// multilayer perceptron, and so is the affine unscaling of the outputs when
+/// the last layer is linear.
+/// The outputs are calculated with caller provided memory, so that evaluating
+/// the plan does not allocate memory.
+/// A plan does not follow later changes in the neural network from which it
+/// was compiled.
+/// This is the entry point for serving a trained neural network from several
+/// threads: the output methods neither modify the plan nor display warnings,
+/// so any number of threads can evaluate a shared plan at the same time, each
+/// one with its own workspace.
+/// The outputs can also be calculated in single precision, with a copy of the
+/// parameters rounded to floats, which halves the memory traffic.
+
+class InferencePlan {
+
+ public:
+
+  // DEFAULT CONSTRUCTOR
+
+  explicit InferencePlan(void);
+
+  // NEURAL NETWORK CONSTRUCTOR
+
+  explicit InferencePlan(const NeuralNetwork&);
+
+  // DESTRUCTOR
+
+  virtual ~InferencePlan(void);
+
+  // GET METHODS
+
+  bool is_empty(void) const;
+
+  const unsigned& get_inputs_number(void) const;
+  const unsigned& get_outputs_number(void) const;
+
+  unsigned get_layers_number(void) const;
+
+  const Vector<double>& get_parameters(void) const;
+  const Vector<float>& get_single_parameters(void) const;
+
+  const unsigned& get_workspace_size(void) const;
+
+  // SET METHODS
+
+  void set(void);
+  void set(const NeuralNetwork&);
+
+  // OUTPUT METHODS
+
+  void calculate_outputs(const double*, double*, double*) const;
+
+  void calculate_outputs(const Matrix<double>&, Matrix<double>&,
+                         Vector<double>&) const;
+
+  Vector<double> calculate_outputs(const Vector<double>&) const;
+  Matrix<double> calculate_outputs(const Matrix<double>&) const;
+
+  // Single precision output methods
+
+  void calculate_outputs(const float*, float*, float*) const;
+
+  void calculate_outputs(const Matrix<float>&, Matrix<float>&,
+                         Vector<float>&) const;
+
+ protected:
+
+  template <class Type>
+  void calculate_outputs_kernel(const Type*, const Type*, Type*, Type*) const;
+
+  // MEMBERS
+
+  /// Number of inputs to the plan.
+
+  unsigned inputs_number;
+
+  /// Number of outputs from the plan.
+
+  unsigned outputs_number;
+
+  /// Number of inputs to each layer of the multilayer perceptron.
+
+  Vector<unsigned> layers_inputs_number;
+
+  /// Number of perceptrons in each layer of the multilayer perceptron.
+
+  Vector<unsigned> layers_perceptrons_number;
+
+  /// Index of the parameters of each layer in the parameters block.
+
+  Vector<unsigned> layers_parameters_index;
+
+  /// Activation function of each layer of the multilayer perceptron.
+
+  Vector<Perceptron::ActivationFunction> layers_activation_function;
+
+  /// Activation accuracy of each layer of the multilayer perceptron.
+
+  Vector<Perceptron::ActivationAccuracy> layers_activation_accuracy;
+
+  /// True if the outputs are unscaled after the multilayer perceptron, false
+  /// if there is no unscaling or it has been folded into the last layer.
+
+  bool unscaling;
+
+  /// Index of the unscaling slopes in the parameters block, which are
+  /// followed by the unscaling intercepts.
+
+  unsigned unscaling_index;
+
+  /// Method for interpreting the outputs as probabilities.
+
+  ProbabilisticLayer::ProbabilisticMethod probabilistic_method;
+
+  /// True if the outputs are bounded, false otherwise.
+
+  bool bounding;
+
+  /// Index of the lower bounds in the parameters block, which are followed by
+  /// the upper bounds.
+
+  unsigned bounding_index;
+
+  /// Block with the parameters of all the layers, followed by the unscaling
+  /// coefficients and the bounds.
+  /// The parameters of each perceptron are its bias followed by its synaptic
+  /// weights.
+
+  Vector<double> parameters;
+
+  /// Parameters block rounded to single precision.
+
+  Vector<float> single_parameters;
+
+  /// Size of the workspace needed for calculating the outputs of one instance.
+
+  unsigned workspace_size;
+};
+}
+
+#endif
+
+// OpenNN: Open Neural Networks Library.
+// Neural Designer Copyright © 2013 Roberto López and Ismael Santana (Intelnics)
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -62,6 +62,8 @@ Instances::Instances(const tinyxml2::XMLDocument& instances_document) {
 Instances::Instances(const Instances& other_instances) {
   items = other_instances.items;
 
+  indices_updated = false;
+
   display = other_instances.display;
 }
 
@@ -81,6 +83,7 @@ Instances::~Instances(void) {}
 Instances& Instances::operator=(const Instances& other_instances) {
   if (this != &other_instances) {
     items = other_instances.items;
+    indices_updated = false;
     display = other_instances.display;
   }
 
@@ -439,6 +442,47 @@ Vector<unsigned> Instances::arrange_testing_indices(void) const {
   return (testing_indices);
 }
 
+// const Vector<unsigned>& get_training_indices(void) const method
+
+/// Returns a reference to the cached indices of the training instances.
+/// The table is only rebuilt when the uses of the instances have changed,
+/// so that this method can be called for every instance in a loop.
+/// Note that the reference is invalidated by any change in the uses.
+
+const Vector<unsigned>& Instances::get_training_indices(void) const {
+  if (!indices_updated) {
+    update_indices();
+  }
+
+  return (training_indices);
+}
+
+// const Vector<unsigned>& get_generalization_indices(void) const method
+
+/// Returns a reference to the cached indices of the generalization instances.
+/// Note that the reference is invalidated by any change in the uses.
+
+const Vector<unsigned>& Instances::get_generalization_indices(void) const {
+  if (!indices_updated) {
+    update_indices();
+  }
+
+  return (generalization_indices);
+}
+
+// const Vector<unsigned>& get_testing_indices(void) const method
+
+/// Returns a reference to the cached indices of the testing instances.
+/// Note that the reference is invalidated by any change in the uses.
+
+const Vector<unsigned>& Instances::get_testing_indices(void) const {
+  if (!indices_updated) {
+    update_indices();
+  }
+
+  return (testing_indices);
+}
+
 // const bool& get_display(void) const method
 
 /// Returns true if messages from this class can be displayed on the screen,
@@ -496,6 +540,8 @@ void Instances::set_default(void) { display = true; }
 /// The size must be equal to the number of instances.
 
 void Instances::set_uses(const Vector<Instances::Use>& new_uses) {
+  indices_updated = false;
+
   const unsigned instances_number = get_instances_number();
 
 // Control sentence (if debug)
@@ -532,6 +578,8 @@ void Instances::set_uses(const Vector<Instances::Use>& new_uses) {
 /// The size must be equal to the number of instances.
 
 void Instances::set_uses(const Vector<std::string>& new_uses) {
+  indices_updated = false;
+
   const unsigned instances_number = get_instances_number();
 
   std::ostringstream buffer;
@@ -580,6 +628,8 @@ void Instances::set_uses(const Vector<std::string>& new_uses) {
 /// @param new_use Use for that instance.
 
 void Instances::set_use(const unsigned& i, const Use& new_use) {
+  indices_updated = false;
+
   items[i].use = new_use;
 }
 
@@ -591,6 +641,8 @@ void Instances::set_use(const unsigned& i, const Use& new_use) {
 /// "Testing" or "Unused")
 
 void Instances::set_use(const unsigned& i, const std::string& new_use) {
+  indices_updated = false;
+
   if (new_use == "Training") {
     items[i].use = Training;
   } else if (new_use == "Generalization") {
@@ -615,6 +667,8 @@ void Instances::set_use(const unsigned& i, const std::string& new_use) {
 /// Sets all the instances in the data set for training.
 
 void Instances::set_training(void) {
+  indices_updated = false;
+
   const unsigned instances_number = get_instances_number();
 
   for (unsigned i = 0; i < instances_number; i++) {
@@ -627,6 +681,8 @@ void Instances::set_training(void) {
 /// Sets all the instances in the data set for generalization.
 
 void Instances::set_generalization(void) {
+  indices_updated = false;
+
   const unsigned instances_number = get_instances_number();
 
   for (unsigned i = 0; i < instances_number; i++) {
@@ -639,6 +695,8 @@ void Instances::set_generalization(void) {
 /// Sets all the instances in the data set for testing.
 
 void Instances::set_testing(void) {
+  indices_updated = false;
+
   const unsigned instances_number = get_instances_number();
 
   for (unsigned i = 0; i < instances_number; i++) {
@@ -664,6 +722,8 @@ void Instances::set_display(const bool& new_display) { display = new_display; }
 /// @param new_instances_number Number of instances.
 
 void Instances::set_instances_number(const unsigned& new_instances_number) {
+  indices_updated = false;
+
   items.set(new_instances_number);
 
   split_instances();
@@ -834,6 +894,7 @@ void Instances::split_random_indices(
     const double& training_instances_ratio,
     const double& generalization_instances_ratio,
     const double& testing_instances_ratio) {
+  indices_updated = false;
 
   const unsigned used_instances_number = count_used_instances_number();
 
@@ -935,6 +996,8 @@ void Instances::split_sequential_indices(
     const double& training_instances_ratio,
     const double& generalization_instances_ratio,
     const double& testing_instances_ratio) {
+  indices_updated = false;
+
   const unsigned used_instances_number = count_used_instances_number();
 
   const double total_ratio =
@@ -1111,6 +1174,40 @@ Vector<double> Instances::calculate_uses_percentage(void) const {
   return (uses_percentage);
 }
 
+// void update_indices(void) const method
+
+/// Rebuilds the cached tables of training, generalization and testing indices
+/// in a single pass over the instances.
+
+void Instances::update_indices(void) const {
+  const unsigned instances_number = get_instances_number();
+
+  const Vector<unsigned> count = count_uses();
+
+  training_indices.set(count[0]);
+  generalization_indices.set(count[1]);
+  testing_indices.set(count[2]);
+
+  unsigned training_count = 0;
+  unsigned generalization_count = 0;
+  unsigned testing_count = 0;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    if (items[i].use == Training) {
+      training_indices[training_count] = i;
+      training_count++;
+    } else if (items[i].use == Generalization) {
+      generalization_indices[generalization_count] = i;
+      generalization_count++;
+    } else if (items[i].use == Testing) {
+      testing_indices[testing_count] = i;
+      testing_count++;
+    }
+  }
+
+  indices_updated = true;
+}
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current instances object.
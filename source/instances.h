@@ -156,6 +156,10 @@ class Instances {
   Vector<unsigned> arrange_generalization_indices(void) const;
   Vector<unsigned> arrange_testing_indices(void) const;
 
+  const Vector<unsigned>& get_training_indices(void) const;
+  const Vector<unsigned>& get_generalization_indices(void) const;
+  const Vector<unsigned>& get_testing_indices(void) const;
+
   const bool& get_display(void) const;
 
   // Set methods
@@ -216,9 +220,33 @@ class Instances {
 
   Vector<Item> items;
 
+  /// Indices of the training instances.
+  /// This table is rebuilt lazily whenever the uses of the instances change.
+
+  mutable Vector<unsigned> training_indices;
+
+  /// Indices of the generalization instances.
+  /// This table is rebuilt lazily whenever the uses of the instances change.
+
+  mutable Vector<unsigned> generalization_indices;
+
+  /// Indices of the testing instances.
+  /// This table is rebuilt lazily whenever the uses of the instances change.
+
+  mutable Vector<unsigned> testing_indices;
+
+  /// True if the tables of indices are consistent with the uses of the
+  /// instances, false otherwise.
+
+  mutable bool indices_updated;
+
   /// Display messages to screen.
 
   bool display;
+
+  // PRIVATE METHODS
+
+  void update_indices(void) const;
 };
 }
 
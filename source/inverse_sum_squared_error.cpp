@@ -376,7 +376,7 @@ double InverseSumSquaredError::calculate_generalization_performance(
   for (unsigned i = 0; i < generalization_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_generalization_input_instance(i);
+    data_set_pointer->get_generalization_input_instance(i, inputs);
 
     // Output vector
 
@@ -384,7 +384,7 @@ double InverseSumSquaredError::calculate_generalization_performance(
 
     // Target vector
 
-    targets = data_set_pointer->get_generalization_target_instance(i);
+    data_set_pointer->get_generalization_target_instance(i, targets);
 
     // Sum of squares error
 
@@ -328,12 +328,70 @@ LevenbergMarquardtAlgorithm::get_damping_parameter_history(void) const {
   return (damping_parameter_history);
 }
 
+// const SolverType& get_solver_type(void) const method
+
+/// Returns the method for solving the damped normal equations.
+
+const LevenbergMarquardtAlgorithm::SolverType&
+LevenbergMarquardtAlgorithm::get_solver_type(void) const {
+  return (solver_type);
+}
+
+// std::string write_solver_type(void) const method
+
+/// Returns a string with the name of the solver type.
+
+std::string LevenbergMarquardtAlgorithm::write_solver_type(void) const {
+  switch (solver_type) {
+    case CHOLESKY_SOLVER: {
+      return ("CHOLESKY_SOLVER");
+    } break;
+
+    case CONJUGATE_GRADIENT_SOLVER: {
+      return ("CONJUGATE_GRADIENT_SOLVER");
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: LevenbergMarquardtAlgorithm class.\n"
+             << "std::string write_solver_type(void) const method.\n"
+             << "Unknown solver type.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+}
+
+// const unsigned& get_maximum_conjugate_gradient_iterations_number(void) const
+// method
+
+/// Returns the maximum number of conjugate gradient iterations for solving the
+/// damped normal equations.
+
+const unsigned& LevenbergMarquardtAlgorithm::
+    get_maximum_conjugate_gradient_iterations_number(void) const {
+  return (maximum_conjugate_gradient_iterations_number);
+}
+
+// const double& get_conjugate_gradient_tolerance(void) const method
+
+/// Returns the norm of the conjugate gradient residual, relative to the
+/// gradient norm, at which the damped normal equations are assumed to be
+/// solved.
+
+const double& LevenbergMarquardtAlgorithm::get_conjugate_gradient_tolerance(
+    void) const {
+  return (conjugate_gradient_tolerance);
+}
+
 // void set_default(void) method
 
 /// Sets the following default values for the Levenberg-Marquardt algorithm:
 /// Training parameters:
 /// <ul>
 /// <li> Levenberg-Marquardt parameter: 0.001.
+/// <li> Solver type: Cholesky.
 /// </ul>
 /// Stopping criteria:
 /// <ul>
@@ -397,6 +455,11 @@ void LevenbergMarquardtAlgorithm::set_default(void) {
   maximum_damping_parameter = 1.0e6;
 
   reserve_damping_parameter_history = false;
+
+  solver_type = CHOLESKY_SOLVER;
+
+  maximum_conjugate_gradient_iterations_number = 100;
+  conjugate_gradient_tolerance = 1.0e-3;
 }
 
 // void set_damping_parameter(const double&) method
@@ -506,6 +569,101 @@ void LevenbergMarquardtAlgorithm::set_reserve_damping_parameter_history(
   reserve_damping_parameter_history = new_reserve_damping_parameter_history;
 }
 
+// void set_solver_type(const SolverType&) method
+
+/// Sets a new method for solving the damped normal equations.
+/// @param new_solver_type Solver type.
+
+void LevenbergMarquardtAlgorithm::set_solver_type(
+    const SolverType& new_solver_type) {
+  solver_type = new_solver_type;
+}
+
+// void set_solver_type(const std::string&) method
+
+/// Sets a new method for solving the damped normal equations from a string.
+/// The possible values are "CHOLESKY_SOLVER" and "CONJUGATE_GRADIENT_SOLVER".
+/// @param new_solver_type String with the solver type.
+
+void LevenbergMarquardtAlgorithm::set_solver_type(
+    const std::string& new_solver_type) {
+  if (new_solver_type == "CHOLESKY_SOLVER") {
+    set_solver_type(CHOLESKY_SOLVER);
+  } else if (new_solver_type == "CONJUGATE_GRADIENT_SOLVER") {
+    set_solver_type(CONJUGATE_GRADIENT_SOLVER);
+  } else {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LevenbergMarquardtAlgorithm class.\n"
+           << "void set_solver_type(const std::string&) method.\n"
+           << "Unknown solver type: " << new_solver_type << ".\n";
+
+    throw std::logic_error(buffer.str());
+  }
+}
+
+// void set_maximum_conjugate_gradient_iterations_number(const unsigned&) method
+
+/// Sets a new maximum number of conjugate gradient iterations for solving the
+/// damped normal equations.
+/// Each conjugate gradient iteration costs one product of the Hessian
+/// approximation and a vector.
+/// @param new_maximum_conjugate_gradient_iterations_number Maximum conjugate
+/// gradient iterations number.
+
+void LevenbergMarquardtAlgorithm::
+    set_maximum_conjugate_gradient_iterations_number(
+        const unsigned& new_maximum_conjugate_gradient_iterations_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_maximum_conjugate_gradient_iterations_number == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LevenbergMarquardtAlgorithm class.\n"
+           << "void set_maximum_conjugate_gradient_iterations_number("
+              "const unsigned&) method.\n"
+           << "Maximum number of conjugate gradient iterations must be greater "
+              "than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  maximum_conjugate_gradient_iterations_number =
+      new_maximum_conjugate_gradient_iterations_number;
+}
+
+// void set_conjugate_gradient_tolerance(const double&) method
+
+/// Sets a new norm of the conjugate gradient residual, relative to the
+/// gradient norm, at which the damped normal equations are assumed to be
+/// solved.
+/// @param new_conjugate_gradient_tolerance Conjugate gradient tolerance.
+
+void LevenbergMarquardtAlgorithm::set_conjugate_gradient_tolerance(
+    const double& new_conjugate_gradient_tolerance) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_conjugate_gradient_tolerance <= 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LevenbergMarquardtAlgorithm class.\n"
+           << "void set_conjugate_gradient_tolerance(const double&) method.\n"
+           << "Conjugate gradient tolerance must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  conjugate_gradient_tolerance = new_conjugate_gradient_tolerance;
+}
+
 // void set_warning_parameters_norm(const double&) method
 
 /// Sets a new value for the parameters vector norm at which a warning message
@@ -1040,12 +1198,111 @@ Matrix<double> LevenbergMarquardtAlgorithm::calculate_Hessian_approximation(
 
 #endif
 
-  Matrix<double> identity(parameters_number, parameters_number);
+  Matrix<double> Hessian_approximation =
+      terms_Jacobian.calculate_transpose().dot(terms_Jacobian) * 2.0;
 
-  identity.initialize_identity();
+  for (unsigned i = 0; i < parameters_number; i++) {
+    Hessian_approximation[i][i] += damping_parameter;
+  }
 
-  return (terms_Jacobian.calculate_transpose().dot(terms_Jacobian) * 2.0 +
-          identity * damping_parameter);
+  return (Hessian_approximation);
+}
+
+// unsigned calculate_conjugate_gradient_increment(const Vector<double>&, const
+// Vector<double>&, Vector<double>&) const method
+
+/// Solves the damped normal equations with the preconditioned conjugate
+/// gradient method, which only needs products of the Hessian approximation
+/// and a vector.
+/// Those products are calculated by the performance functional without
+/// forming the terms Jacobian, and the damping is added to them.
+/// The preconditioner is the diagonal of the Hessian approximation.
+/// Returns the number of conjugate gradient iterations.
+/// @param gradient Performance gradient at the current parameters.
+/// @param JacobianT_dot_Jacobian_diagonal Diagonal of the product of the
+/// transposed terms Jacobian and the terms Jacobian.
+/// @param parameters_increment Solution of the damped normal equations.
+
+unsigned LevenbergMarquardtAlgorithm::calculate_conjugate_gradient_increment(
+    const Vector<double>& gradient,
+    const Vector<double>& JacobianT_dot_Jacobian_diagonal,
+    Vector<double>& parameters_increment) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+  if (JacobianT_dot_Jacobian_diagonal.size() != gradient.size()) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LevenbergMarquardtAlgorithm class.\n"
+           << "unsigned calculate_conjugate_gradient_increment(const "
+              "Vector<double>&, const Vector<double>&, Vector<double>&) const "
+              "method.\n"
+           << "Size of diagonal must be equal to size of gradient.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned parameters_number = gradient.size();
+
+  parameters_increment.set(parameters_number, 0.0);
+
+  const Vector<double> preconditioner =
+      JacobianT_dot_Jacobian_diagonal + damping_parameter;
+
+  Vector<double> residual = gradient * (-1.0);
+  Vector<double> preconditioned_residual = residual / preconditioner;
+
+  Vector<double> search_direction(preconditioned_residual);
+
+  double residual_dot_preconditioned_residual =
+      residual.dot(preconditioned_residual);
+
+  const double tolerance =
+      conjugate_gradient_tolerance * gradient.calculate_norm();
+
+  unsigned iterations_number = 0;
+
+  while (iterations_number < maximum_conjugate_gradient_iterations_number &&
+         residual.calculate_norm() > tolerance) {
+    const Vector<double> Hessian_approximation_dot_search_direction =
+        performance_functional_pointer
+            ->calculate_JacobianT_dot_Jacobian_dot_vector(search_direction) +
+        search_direction * damping_parameter;
+
+    iterations_number++;
+
+    const double curvature =
+        search_direction.dot(Hessian_approximation_dot_search_direction);
+
+    if (curvature <= 0.0) {
+      break;
+    }
+
+    const double step = residual_dot_preconditioned_residual / curvature;
+
+    parameters_increment += search_direction * step;
+
+    residual -= Hessian_approximation_dot_search_direction * step;
+    preconditioned_residual = residual / preconditioner;
+
+    const double new_residual_dot_preconditioned_residual =
+        residual.dot(preconditioned_residual);
+
+    const double beta = new_residual_dot_preconditioned_residual /
+                        residual_dot_preconditioned_residual;
+
+    search_direction = preconditioned_residual + search_direction * beta;
+
+    residual_dot_preconditioned_residual =
+        new_residual_dot_preconditioned_residual;
+  }
+
+  return (iterations_number);
 }
 
 // void resize_training_history(const unsigned&) method
@@ -1100,8 +1357,12 @@ void LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults::
     gradient_norm_history.resize(new_size);
   }
 
+  // The conjugate gradient solver never forms the Hessian approximation
+
   if (Levenberg_Marquardt_algorithm_pointer
-          ->get_reserve_Hessian_approximation_history()) {
+          ->get_reserve_Hessian_approximation_history() &&
+      Levenberg_Marquardt_algorithm_pointer->get_solver_type() ==
+          LevenbergMarquardtAlgorithm::CHOLESKY_SOLVER) {
     Hessian_approximation_history.resize(new_size);
   }
 
@@ -1315,16 +1576,6 @@ LevenbergMarquardtAlgorithm::perform_training(void) {
 
   double parameters_norm;
 
-  // Data set stuff
-
-  const DataSet* data_set_pointer =
-      performance_functional_pointer->get_data_set_pointer();
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
   // Performance functional stuff
 
   double performance = 0.0;
@@ -1336,24 +1587,28 @@ LevenbergMarquardtAlgorithm::perform_training(void) {
 
   unsigned generalization_failures = 0;
 
-  Vector<double> terms(training_instances_number);
-  Matrix<double> terms_Jacobian(training_instances_number, parameters_number);
+  PerformanceTerm::TermsJacobianProducts terms_Jacobian_products;
+
+  PerformanceFunctional::FirstOrderperformance first_order_performance;
+
+  Vector<double> JacobianT_dot_Jacobian_diagonal;
 
   Vector<double> gradient(parameters_number);
 
   double gradient_norm;
 
-  Matrix<double> JacobianT_dot_Jacobian(parameters_number, parameters_number);
+  Matrix<double> Hessian_approximation;
 
-  Matrix<double> Hessian_approximation(parameters_number, parameters_number);
+  if (solver_type == CHOLESKY_SOLVER) {
+    Hessian_approximation.set(parameters_number, parameters_number, 0.0);
+  }
 
   // Training strategy stuff
 
   Vector<double> parameters_increment(parameters_number);
   double parameters_increment_norm;
 
-  Matrix<double> identity(parameters_number, parameters_number);
-  identity.initialize_identity();
+  unsigned damping_trials_number;
 
   bool stop_training = false;
 
@@ -1376,14 +1631,31 @@ LevenbergMarquardtAlgorithm::perform_training(void) {
 
     // Performance functional
 
-    terms = performance_functional_pointer->calculate_terms();
+    if (solver_type == CHOLESKY_SOLVER) {
+      // The terms Jacobian is accumulated into its products with the terms
+      // and with itself, so that it is never formed
 
-    performance = calculate_performance(
-        terms);  //*performance_terms).calculate_sum()/2.0;
+      terms_Jacobian_products =
+          performance_functional_pointer->calculate_terms_Jacobian_products();
 
-    terms_Jacobian = performance_functional_pointer->calculate_terms_Jacobian();
+      performance = terms_Jacobian_products.terms_squared_sum;
 
-    gradient = calculate_gradient(terms, terms_Jacobian);
+      gradient = terms_Jacobian_products.JacobianT_dot_terms * 2.0;
+    } else {
+      // Only the diagonal of the Hessian approximation is needed, for
+      // preconditioning the conjugate gradient iterations
+
+      first_order_performance =
+          performance_functional_pointer->calculate_first_order_performance();
+
+      performance = first_order_performance.performance;
+
+      gradient = first_order_performance.gradient;
+
+      JacobianT_dot_Jacobian_diagonal =
+          performance_functional_pointer
+              ->calculate_JacobianT_dot_Jacobian_diagonal();
+    }
 
     gradient_norm = gradient.calculate_norm();
 
@@ -1392,17 +1664,73 @@ LevenbergMarquardtAlgorithm::perform_training(void) {
                 << std::endl;
     }
 
-    JacobianT_dot_Jacobian =
-        terms_Jacobian.calculate_transpose().dot(terms_Jacobian);
+    const Matrix<double>& JacobianT_dot_Jacobian =
+        terms_Jacobian_products.JacobianT_dot_Jacobian;
+
+    damping_trials_number = 0;
 
     do {
-      Hessian_approximation =
-          (JacobianT_dot_Jacobian + identity * damping_parameter);
+      damping_trials_number++;
+
+      if (solver_type == CONJUGATE_GRADIENT_SOLVER) {
+        calculate_conjugate_gradient_increment(
+            gradient, JacobianT_dot_Jacobian_diagonal, parameters_increment);
+      } else if (damping_trials_number > 1) {
+        // Once a step has been rejected, the Gauss-Newton matrix is reduced
+        // to tridiagonal form, so that every further damping parameter of the
+        // iteration is tried without a new factorization
+
+        if (damping_trials_number == 2) {
+          for (unsigned i = 0; i < parameters_number; i++) {
+            for (unsigned j = 0; j <= i; j++) {
+              Hessian_approximation[i][j] = JacobianT_dot_Jacobian[i][j];
+            }
+          }
+
+          LinearAlgebraicEquations::perform_tridiagonal_reduction(
+              Hessian_approximation);
+        }
+
+        parameters_increment = gradient * (-1.0);
+
+        if (!LinearAlgebraicEquations::perform_tridiagonal_substitution(
+                 Hessian_approximation, damping_parameter,
+                 parameters_increment)) {
+          parameters_increment.initialize(0.0);
+
+          set_damping_parameter(damping_parameter * damping_parameter_factor);
+
+          continue;
+        }
+      } else {
+        // The Cholesky factorization only reads the lower triangle
+
+        for (unsigned i = 0; i < parameters_number; i++) {
+          for (unsigned j = 0; j < i; j++) {
+            Hessian_approximation[i][j] = JacobianT_dot_Jacobian[i][j];
+          }
+
+          Hessian_approximation[i][i] =
+              JacobianT_dot_Jacobian[i][i] + damping_parameter;
+        }
+
+        // A matrix which is not numerically positive definite means that the
+        // damping is too small, so it is increased without evaluating a step
+
+        if (!LinearAlgebraicEquations::perform_Cholesky_factorization(
+                 Hessian_approximation)) {
+          parameters_increment.initialize(0.0);
+
+          set_damping_parameter(damping_parameter * damping_parameter_factor);
 
-      parameters_increment = gradient * (-1.0);
+          continue;
+        }
+
+        parameters_increment = gradient * (-1.0);
 
-      LinearAlgebraicEquations::perform_Gauss_Jordan_elimination(
-          Hessian_approximation, parameters_increment);
+        LinearAlgebraicEquations::perform_Cholesky_substitution(
+            Hessian_approximation, parameters_increment);
+      }
 
       const double new_performance =
           performance_functional_pointer->calculate_performance(
@@ -1472,7 +1800,8 @@ LevenbergMarquardtAlgorithm::perform_training(void) {
       results_pointer->gradient_norm_history[iteration] = gradient_norm;
     }
 
-    if (reserve_Hessian_approximation_history) {
+    if (reserve_Hessian_approximation_history &&
+        solver_type == CHOLESKY_SOLVER) {
       results_pointer->Hessian_approximation_history[iteration] =
           Hessian_approximation;  // as computed by linear algebraic equations
                                   // object
@@ -1646,6 +1975,15 @@ Matrix<std::string> LevenbergMarquardtAlgorithm::to_string_matrix(void) const {
   Vector<std::string> labels;
   Vector<std::string> values;
 
+  // Solver type
+
+  labels.push_back("Solver type");
+
+  buffer.str("");
+  buffer << write_solver_type();
+
+  values.push_back(buffer.str());
+
   // Minimum parameters increment norm
 
   labels.push_back("Minimum parameters increment norm");
@@ -1841,6 +2179,39 @@ tinyxml2::XMLDocument* LevenbergMarquardtAlgorithm::to_XML(void) const {
   text = document->NewText(buffer.str().c_str());
   element->LinkEndChild(text);
 
+  // Solver type
+
+  element = document->NewElement("SolverType");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << write_solver_type();
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Maximum conjugate gradient iterations number
+
+  element = document->NewElement("MaximumConjugateGradientIterationsNumber");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << maximum_conjugate_gradient_iterations_number;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Conjugate gradient tolerance
+
+  element = document->NewElement("ConjugateGradientTolerance");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << conjugate_gradient_tolerance;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
   // Warning parameters norm
 
   element = document->NewElement("WarningParametersNorm");
@@ -2175,6 +2546,59 @@ void LevenbergMarquardtAlgorithm::from_XML(
     }
   }
 
+  // Solver type
+
+  const tinyxml2::XMLElement* solver_type_element =
+      root_element->FirstChildElement("SolverType");
+
+  if (solver_type_element) {
+    const std::string new_solver_type = solver_type_element->GetText();
+
+    try {
+      set_solver_type(new_solver_type);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Maximum conjugate gradient iterations number
+
+  const tinyxml2::XMLElement*
+      maximum_conjugate_gradient_iterations_number_element =
+          root_element->FirstChildElement(
+              "MaximumConjugateGradientIterationsNumber");
+
+  if (maximum_conjugate_gradient_iterations_number_element) {
+    const unsigned new_maximum_conjugate_gradient_iterations_number =
+        atoi(maximum_conjugate_gradient_iterations_number_element->GetText());
+
+    try {
+      set_maximum_conjugate_gradient_iterations_number(
+          new_maximum_conjugate_gradient_iterations_number);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Conjugate gradient tolerance
+
+  const tinyxml2::XMLElement* conjugate_gradient_tolerance_element =
+      root_element->FirstChildElement("ConjugateGradientTolerance");
+
+  if (conjugate_gradient_tolerance_element) {
+    const double new_conjugate_gradient_tolerance =
+        atof(conjugate_gradient_tolerance_element->GetText());
+
+    try {
+      set_conjugate_gradient_tolerance(new_conjugate_gradient_tolerance);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
   // Warning parameters norm
 
   const tinyxml2::XMLElement* warning_parameters_norm_element =
@@ -70,6 +70,16 @@ class LevenbergMarquardtAlgorithm : public TrainingAlgorithm {
 
   virtual ~LevenbergMarquardtAlgorithm(void);
 
+  // ENUMERATIONS
+
+  /// Enumeration of the available methods for solving the damped normal
+  /// equations at each iteration.
+
+  enum SolverType {
+    CHOLESKY_SOLVER,
+    CONJUGATE_GRADIENT_SOLVER
+  };
+
   // STRUCTURES
 
   ///
@@ -236,6 +246,12 @@ class LevenbergMarquardtAlgorithm : public TrainingAlgorithm {
 
   const Vector<double>& get_damping_parameter_history(void) const;
 
+  const SolverType& get_solver_type(void) const;
+  std::string write_solver_type(void) const;
+
+  const unsigned& get_maximum_conjugate_gradient_iterations_number(void) const;
+  const double& get_conjugate_gradient_tolerance(void) const;
+
   // Set methods
 
   void set_default(void);
@@ -249,6 +265,12 @@ class LevenbergMarquardtAlgorithm : public TrainingAlgorithm {
 
   void set_reserve_damping_parameter_history(const bool&);
 
+  void set_solver_type(const SolverType&);
+  void set_solver_type(const std::string&);
+
+  void set_maximum_conjugate_gradient_iterations_number(const unsigned&);
+  void set_conjugate_gradient_tolerance(const double&);
+
   // Training parameters
 
   void set_warning_parameters_norm(const double&);
@@ -300,6 +322,10 @@ class LevenbergMarquardtAlgorithm : public TrainingAlgorithm {
                                     const Matrix<double>&) const;
   Matrix<double> calculate_Hessian_approximation(const Matrix<double>&) const;
 
+  unsigned calculate_conjugate_gradient_increment(const Vector<double>&,
+                                                  const Vector<double>&,
+                                                  Vector<double>&) const;
+
   LevenbergMarquardtAlgorithmResults* perform_training(void);
 
   std::string write_training_algorithm_type(void) const;
@@ -342,6 +368,24 @@ class LevenbergMarquardtAlgorithm : public TrainingAlgorithm {
 
   Vector<double> damping_parameter_history;
 
+  /// Method for solving the damped normal equations.
+  /// The Cholesky solver factorizes the Hessian approximation, which is
+  /// formed at each iteration.
+  /// The conjugate gradient solver only needs products of the Hessian
+  /// approximation and a vector, so that it is never formed.
+
+  SolverType solver_type;
+
+  /// Maximum number of conjugate gradient iterations for solving the damped
+  /// normal equations.
+
+  unsigned maximum_conjugate_gradient_iterations_number;
+
+  /// Norm of the conjugate gradient residual, relative to the gradient norm,
+  /// at which the damped normal equations are assumed to be solved.
+
+  double conjugate_gradient_tolerance;
+
   /// Value for the parameters norm at which a warning message is written to the
   /// screen.
 
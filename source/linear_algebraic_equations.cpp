@@ -307,6 +307,533 @@ Vector<double> LinearAlgebraicEquations::calculate_Gauss_Jordan_solution(
   return (b_matrix.arrange_column(0));
 }
 
+// static bool perform_Cholesky_factorization(Matrix<double>&) method
+
+/// Computes the Cholesky factorization A = L*L^T of a symmetric positive
+/// definite matrix.
+/// Only the lower triangle of a is read, and on output it is replaced by the
+/// factor L. The strict upper triangle is left untouched.
+/// The elimination works on rows of L, so that all the inner products are
+/// contiguous in memory.
+/// Returns false if the matrix is not positive definite, which is much cheaper
+/// to detect than to solve the system.
+/// @param a Symmetric matrix, replaced by its Cholesky factor.
+
+bool LinearAlgebraicEquations::perform_Cholesky_factorization(
+    Matrix<double>& a) {
+  const unsigned n = a.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (a.get_columns_number() != n) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LinearAlgebraicEquations class.\n"
+           << "bool perform_Cholesky_factorization(Matrix<double>&) method.\n"
+           << "Matrix A must be square.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  double sum;
+
+  for (unsigned i = 0; i < n; i++) {
+    double* row_i = a[i];
+
+    for (unsigned j = 0; j <= i; j++) {
+      const double* row_j = a[j];
+
+      sum = row_i[j];
+
+      for (unsigned k = 0; k < j; k++) {
+        sum -= row_i[k] * row_j[k];
+      }
+
+      if (j < i) {
+        row_i[j] = sum / row_j[j];
+      } else if (sum > 0.0) {
+        row_i[i] = sqrt(sum);
+      } else {
+        return (false);
+      }
+    }
+  }
+
+  return (true);
+}
+
+// static void perform_Cholesky_substitution(const Matrix<double>&,
+// Vector<double>&) method
+
+/// Solves the linear system A*x = b from the Cholesky factor of A, by forward
+/// substitution with L and backward substitution with L^T.
+/// On output, b is replaced by the solution vector.
+/// @param L Cholesky factor, as returned by perform_Cholesky_factorization.
+/// @param b Right-hand side vector, replaced by the solution.
+
+void LinearAlgebraicEquations::perform_Cholesky_substitution(
+    const Matrix<double>& L, Vector<double>& b) {
+  const unsigned n = L.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (b.size() != n) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LinearAlgebraicEquations class.\n"
+           << "void perform_Cholesky_substitution(const Matrix<double>&, "
+              "Vector<double>&) method.\n"
+           << "Size of b must be equal to number of rows of L.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  // Forward substitution with L
+
+  for (unsigned i = 0; i < n; i++) {
+    const double* row = L[i];
+
+    for (unsigned k = 0; k < i; k++) {
+      b[i] -= row[k] * b[k];
+    }
+
+    b[i] /= row[i];
+  }
+
+  // Backward substitution with L^T, sweeping the rows of L
+
+  for (int i = n - 1; i >= 0; i--) {
+    const double* row = L[i];
+
+    b[i] /= row[i];
+
+    for (int k = 0; k < i; k++) {
+      b[k] -= row[k] * b[i];
+    }
+  }
+}
+
+// static bool perform_LDLT_factorization(Matrix<double>&) method
+
+/// Computes the factorization A = L*D*L^T of a symmetric matrix, where L is
+/// unit lower triangular and D is diagonal.
+/// Unlike the Cholesky factorization, it does not require the matrix to be
+/// positive definite, only that no zero pivot is found.
+/// Only the lower triangle of a is read. On output, the strict lower triangle
+/// is replaced by L and the diagonal by D.
+/// Returns false if a zero pivot is found.
+/// @param a Symmetric matrix, replaced by its LDLT factors.
+
+bool LinearAlgebraicEquations::perform_LDLT_factorization(Matrix<double>& a) {
+  const unsigned n = a.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (a.get_columns_number() != n) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LinearAlgebraicEquations class.\n"
+           << "bool perform_LDLT_factorization(Matrix<double>&) method.\n"
+           << "Matrix A must be square.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  // Elements of L times D for the current row
+
+  Vector<double> scaled_row(n);
+
+  double sum;
+
+  for (unsigned i = 0; i < n; i++) {
+    double* row_i = a[i];
+
+    for (unsigned j = 0; j < i; j++) {
+      const double* row_j = a[j];
+
+      sum = row_i[j];
+
+      for (unsigned k = 0; k < j; k++) {
+        sum -= scaled_row[k] * row_j[k];
+      }
+
+      scaled_row[j] = sum;
+
+      row_i[j] = sum / row_j[j];
+    }
+
+    sum = row_i[i];
+
+    for (unsigned k = 0; k < i; k++) {
+      sum -= scaled_row[k] * row_i[k];
+    }
+
+    if (sum == 0.0) {
+      return (false);
+    }
+
+    row_i[i] = sum;
+  }
+
+  return (true);
+}
+
+// static void perform_LDLT_substitution(const Matrix<double>&,
+// Vector<double>&) method
+
+/// Solves the linear system A*x = b from the LDLT factors of A.
+/// On output, b is replaced by the solution vector.
+/// @param LDLT Factors, as returned by perform_LDLT_factorization.
+/// @param b Right-hand side vector, replaced by the solution.
+
+void LinearAlgebraicEquations::perform_LDLT_substitution(
+    const Matrix<double>& LDLT, Vector<double>& b) {
+  const unsigned n = LDLT.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (b.size() != n) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LinearAlgebraicEquations class.\n"
+           << "void perform_LDLT_substitution(const Matrix<double>&, "
+              "Vector<double>&) method.\n"
+           << "Size of b must be equal to number of rows of factors.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  // Forward substitution with L
+
+  for (unsigned i = 0; i < n; i++) {
+    const double* row = LDLT[i];
+
+    for (unsigned k = 0; k < i; k++) {
+      b[i] -= row[k] * b[k];
+    }
+  }
+
+  // Diagonal
+
+  for (unsigned i = 0; i < n; i++) {
+    b[i] /= LDLT[i][i];
+  }
+
+  // Backward substitution with L^T
+
+  for (int i = n - 1; i >= 0; i--) {
+    const double* row = LDLT[i];
+
+    for (int k = 0; k < i; k++) {
+      b[k] -= row[k] * b[i];
+    }
+  }
+}
+
+// static Vector<double> calculate_Cholesky_solution(Matrix<double>, const
+// Vector<double>&) method
+
+/// Returns the solution vector x to the linear equation Ax = b, for a
+/// symmetric matrix A.
+/// It uses the Cholesky factorization, and falls back to the LDLT
+/// factorization if the matrix is not positive definite.
+/// An exception is thrown if both factorizations fail.
+/// @param a Symmetric matrix.
+/// @param b b vector.
+
+Vector<double> LinearAlgebraicEquations::calculate_Cholesky_solution(
+    Matrix<double> a, const Vector<double>& b) {
+  Vector<double> x(b);
+
+  const Vector<double> diagonal = a.get_diagonal();
+
+  if (perform_Cholesky_factorization(a)) {
+    perform_Cholesky_substitution(a, x);
+
+    return (x);
+  }
+
+  restore_lower_triangle(a);
+
+  a.set_diagonal(diagonal);
+
+  if (perform_LDLT_factorization(a)) {
+    perform_LDLT_substitution(a, x);
+
+    return (x);
+  }
+
+  std::ostringstream buffer;
+
+  buffer << "OpenNN Exception: LinearAlgebraicEquations class.\n"
+         << "Vector<double> calculate_Cholesky_solution(Matrix<double>, const "
+            "Vector<double>&) method.\n"
+         << "Matrix A is singular.\n";
+
+  throw std::logic_error(buffer.str());
+}
+
+// static void perform_tridiagonal_reduction(Matrix<double>&) method
+
+/// Computes the reduction A = Q*T*Q^T of a symmetric matrix, where T is
+/// tridiagonal and Q is the product of n-1 Householder reflections.
+/// The reduction only depends on A, so that systems with the matrix A + s*I
+/// can then be solved for any shift s at a cost which is quadratic in n.
+/// Only the lower triangle of a is read. On output, the diagonal holds the
+/// diagonal of T and the superdiagonal its off-diagonal. Each reflection is
+/// stored in the column below the diagonal: its scaling factor on the
+/// subdiagonal, and its vector, whose first element is one, below it.
+/// @param a Symmetric matrix, replaced by its tridiagonal reduction.
+
+void LinearAlgebraicEquations::perform_tridiagonal_reduction(
+    Matrix<double>& a) {
+  const unsigned n = a.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (a.get_columns_number() != n) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LinearAlgebraicEquations class.\n"
+           << "void perform_tridiagonal_reduction(Matrix<double>&) method.\n"
+           << "Matrix A must be square.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  Vector<double> v(n);
+  Vector<double> w(n);
+
+  for (unsigned k = 0; k + 1 < n; k++) {
+    const unsigned first = k + 1;
+
+    // Reflection which annihilates the column below the subdiagonal
+
+    double tail_squared_norm = 0.0;
+
+    for (unsigned i = first + 1; i < n; i++) {
+      tail_squared_norm += a[i][k] * a[i][k];
+    }
+
+    const double subdiagonal = a[first][k];
+
+    if (tail_squared_norm == 0.0) {
+      a[k][first] = subdiagonal;
+      a[first][k] = 0.0;
+
+      continue;
+    }
+
+    const double norm = sqrt(subdiagonal * subdiagonal + tail_squared_norm);
+
+    const double alpha = subdiagonal > 0.0 ? -norm : norm;
+
+    const double v_first = subdiagonal - alpha;
+
+    const double beta = -v_first / alpha;
+
+    v[first] = 1.0;
+
+    for (unsigned i = first + 1; i < n; i++) {
+      v[i] = a[i][k] / v_first;
+    }
+
+    // Product of the trailing block and the reflection vector, from its
+    // lower triangle
+
+    for (unsigned i = first; i < n; i++) {
+      w[i] = 0.0;
+    }
+
+    for (unsigned i = first; i < n; i++) {
+      const double* row = a[i];
+
+      for (unsigned j = first; j < i; j++) {
+        w[i] += row[j] * v[j];
+        w[j] += row[j] * v[i];
+      }
+
+      w[i] += row[i] * v[i];
+    }
+
+    double w_dot_v = 0.0;
+
+    for (unsigned i = first; i < n; i++) {
+      w[i] *= beta;
+
+      w_dot_v += w[i] * v[i];
+    }
+
+    for (unsigned i = first; i < n; i++) {
+      w[i] -= 0.5 * beta * w_dot_v * v[i];
+    }
+
+    // Rank two update of the lower triangle of the trailing block
+
+    for (unsigned i = first; i < n; i++) {
+      double* row = a[i];
+
+      for (unsigned j = first; j <= i; j++) {
+        row[j] -= v[i] * w[j] + w[i] * v[j];
+      }
+    }
+
+    a[k][first] = alpha;
+    a[first][k] = beta;
+
+    for (unsigned i = first + 1; i < n; i++) {
+      a[i][k] = v[i];
+    }
+  }
+}
+
+// static bool perform_tridiagonal_substitution(const Matrix<double>&, const
+// double&, Vector<double>&) method
+
+/// Solves the linear system (A + shift*I)*x = b from the tridiagonal reduction
+/// of A.
+/// The right-hand side is transformed with the reflections, the shifted
+/// tridiagonal system is solved by its LDLT factorization and the solution is
+/// transformed back, with a number of operations proportional to n^2.
+/// On output, b is replaced by the solution vector.
+/// Returns false if the shifted matrix is not positive definite, in which case
+/// b is left in an unspecified state.
+/// @param a Tridiagonal reduction, as returned by
+/// perform_tridiagonal_reduction.
+/// @param shift Value added to the diagonal of A.
+/// @param b Right-hand side vector, replaced by the solution.
+
+bool LinearAlgebraicEquations::perform_tridiagonal_substitution(
+    const Matrix<double>& a, const double& shift, Vector<double>& b) {
+  const unsigned n = a.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (b.size() != n) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: LinearAlgebraicEquations class.\n"
+           << "bool perform_tridiagonal_substitution(const Matrix<double>&, "
+              "const double&, Vector<double>&) method.\n"
+           << "Size of b must be equal to number of rows of reduction.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  if (n == 0) {
+    return (true);
+  }
+
+  double sum;
+
+  // Product with Q^T, which applies the reflections in order
+
+  for (unsigned k = 0; k + 1 < n; k++) {
+    const double beta = a[k + 1][k];
+
+    if (beta == 0.0) {
+      continue;
+    }
+
+    sum = b[k + 1];
+
+    for (unsigned i = k + 2; i < n; i++) {
+      sum += a[i][k] * b[i];
+    }
+
+    sum *= beta;
+
+    b[k + 1] -= sum;
+
+    for (unsigned i = k + 2; i < n; i++) {
+      b[i] -= sum * a[i][k];
+    }
+  }
+
+  // LDLT factorization of the shifted tridiagonal matrix and forward
+  // substitution
+
+  Vector<double> pivots(n);
+
+  pivots[0] = a[0][0] + shift;
+
+  if (!(pivots[0] > 0.0)) {
+    return (false);
+  }
+
+  for (unsigned i = 1; i < n; i++) {
+    const double off_diagonal = a[i - 1][i];
+
+    const double l = off_diagonal / pivots[i - 1];
+
+    pivots[i] = a[i][i] + shift - l * off_diagonal;
+
+    if (!(pivots[i] > 0.0)) {
+      return (false);
+    }
+
+    b[i] -= l * b[i - 1];
+  }
+
+  // Backward substitution
+
+  b[n - 1] /= pivots[n - 1];
+
+  for (int i = n - 2; i >= 0; i--) {
+    b[i] = (b[i] - a[i][i + 1] * b[i + 1]) / pivots[i];
+  }
+
+  // Product with Q, which applies the reflections in reverse order
+
+  for (int k = n - 2; k >= 0; k--) {
+    const double beta = a[k + 1][k];
+
+    if (beta == 0.0) {
+      continue;
+    }
+
+    sum = b[k + 1];
+
+    for (unsigned i = k + 2; i < n; i++) {
+      sum += a[i][k] * b[i];
+    }
+
+    sum *= beta;
+
+    b[k + 1] -= sum;
+
+    for (unsigned i = k + 2; i < n; i++) {
+      b[i] -= sum * a[i][k];
+    }
+  }
+
+  return (true);
+}
+
 // static void swap(double&, double&) const method
 
 /// Swaps to real numbers a and b, so that they become a=b and b=a.
@@ -318,6 +845,25 @@ void LinearAlgebraicEquations::swap(double& a, double& b) {
   a = b;
   b = temp;
 }
+
+// static void restore_lower_triangle(Matrix<double>&) method
+
+/// Copies the strict upper triangle of a matrix into its strict lower
+/// triangle.
+/// The symmetric factorizations only overwrite the lower triangle, so this
+/// recovers the original symmetric matrix after a failed factorization,
+/// except for the diagonal, which must be restored by the caller.
+/// @param a Matrix whose lower triangle is to be restored.
+
+void LinearAlgebraicEquations::restore_lower_triangle(Matrix<double>& a) {
+  const unsigned n = a.get_rows_number();
+
+  for (unsigned i = 0; i < n; i++) {
+    for (unsigned j = 0; j < i; j++) {
+      a[i][j] = a[j][i];
+    }
+  }
+}
 }
 
 // OpenNN: Open Neural Networks Library.
@@ -51,6 +51,27 @@ class LinearAlgebraicEquations {
   static Vector<double> calculate_Gauss_Jordan_solution(Matrix<double>,
                                                         const Vector<double>&);
 
+  // Cholesky methods
+
+  static bool perform_Cholesky_factorization(Matrix<double>&);
+  static void perform_Cholesky_substitution(const Matrix<double>&,
+                                            Vector<double>&);
+
+  // LDLT methods
+
+  static bool perform_LDLT_factorization(Matrix<double>&);
+  static void perform_LDLT_substitution(const Matrix<double>&,
+                                        Vector<double>&);
+
+  static Vector<double> calculate_Cholesky_solution(Matrix<double>,
+                                                    const Vector<double>&);
+
+  // Tridiagonal reduction methods
+
+  static void perform_tridiagonal_reduction(Matrix<double>&);
+  static bool perform_tridiagonal_substitution(const Matrix<double>&,
+                                               const double&, Vector<double>&);
+
   // CONSTRUCTOR
 
   LinearAlgebraicEquations(void);
@@ -70,6 +91,8 @@ class LinearAlgebraicEquations {
  private:
 
   static void swap(double&, double&);
+
+  static void restore_lower_triangle(Matrix<double>&);
 };
 }
 
@@ -22,11 +22,13 @@
 
 // System includes
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
@@ -36,6 +38,9 @@
 
 namespace OpenNN {
 
+template <class Type>
+class LUFactorization;
+
 /// This template class defines a matrix for general purpose use.
 /// This matrix also implements some mathematical methods which can be useful.
 
@@ -3752,6 +3757,9 @@ class Matrix {
   // Type calculate_determinant(void) const method
 
   /// Returns the determinant of a square matrix.
+  /// Matrices larger than two by two are reduced through their LU
+  /// factorization with partial pivoting.
+  /// For integer types, the result is rounded to the nearest integer.
 
   Type calculate_determinant(void) const {
 // Control sentence (if debug)
@@ -3785,33 +3793,14 @@ class Matrix {
     } else if (rows_number == 2) {
       determinant = data[0][0] * data[1][1] - data[1][0] * data[0][1];
     } else {
-      int sign;
-
-      for (unsigned row_index = 0; row_index < rows_number; row_index++) {
-        // Calculate sub data
-
-        Matrix<Type> sub_matrix(rows_number - 1, columns_number - 1);
-
-        for (unsigned i = 1; i < rows_number; i++) {
-          unsigned j2 = 0;
-
-          for (unsigned j = 0; j < columns_number; j++) {
-            if (j == row_index) {
-              continue;
-            }
+      const LUFactorization<Type> LU_factorization(*this);
 
-            sub_matrix[i - 1][j2] = data[i][j];
+      const double LU_determinant = LU_factorization.calculate_determinant();
 
-            j2++;
-          }
-        }
-
-        // sign = (unsigned)(pow(-1.0, row_index+2.0));
-
-        sign = static_cast<int>((((row_index + 2) % 2) == 0) ? 1 : -1);
-
-        determinant +=
-            sign * data[0][row_index] * sub_matrix.calculate_determinant();
+      if (std::numeric_limits<Type>::is_integer) {
+        determinant = static_cast<Type>(floor(LU_determinant + 0.5));
+      } else {
+        determinant = static_cast<Type>(LU_determinant);
       }
     }
 
@@ -3865,7 +3854,9 @@ class Matrix {
   // Matrix<Type> calculate_inverse(void) const method
 
   /// Returns the inverse of a square matrix.
-  /// An error message is printed if the matrix is singular.
+  /// It is computed from the LU factorization with partial pivoting, solving
+  /// for the columns of the identity matrix.
+  /// An exception is thrown if the matrix is singular.
 
   Matrix<Type> calculate_inverse(void) const {
 // Control sentence (if debug)
@@ -3884,9 +3875,9 @@ class Matrix {
 
 #endif
 
-    const double determinant = calculate_determinant();
+    const LUFactorization<Type> LU_factorization(*this);
 
-    if (determinant == 0.0) {
+    if (LU_factorization.is_singular()) {
       std::ostringstream buffer;
 
       buffer << "OpenNN Exception: Matrix Template.\n"
@@ -3896,17 +3887,7 @@ class Matrix {
       throw std::logic_error(buffer.str());
     }
 
-    // Calculate cofactor matrix
-
-    const Matrix<double> cofactor = calculate_cofactor();
-
-    // Adjoint matrix is the transpose of cofactor matrix
-
-    const Matrix<double> adjoint = cofactor.calculate_transpose();
-
-    // Inverse matrix is adjoint matrix divided by matrix determinant
-
-    const Matrix<double> inverse = adjoint / determinant;
+    const Matrix<double> inverse = LU_factorization.calculate_inverse();
 
     return (inverse);
   }
@@ -4523,14 +4504,36 @@ class Matrix {
 
     // Calculate matrix-vector poduct
 
+    // Each row is traversed contiguously with four independent partial sums,
+    // which breaks the dependency chain of a single accumulator.
+
     Vector<Type> product(rows_number);
 
+    const unsigned unrolled_columns_number =
+        columns_number - columns_number % 4;
+
     for (unsigned i = 0; i < rows_number; i++) {
-      product[i] = 0;
+      const Type* row = data[i];
 
-      for (unsigned j = 0; j < columns_number; j++) {
-        product[i] += vector[j] * data[i][j];
+      Type sum_0 = 0;
+      Type sum_1 = 0;
+      Type sum_2 = 0;
+      Type sum_3 = 0;
+
+      unsigned j = 0;
+
+      for (; j < unrolled_columns_number; j += 4) {
+        sum_0 += row[j] * vector[j];
+        sum_1 += row[j + 1] * vector[j + 1];
+        sum_2 += row[j + 2] * vector[j + 2];
+        sum_3 += row[j + 3] * vector[j + 3];
       }
+
+      for (; j < columns_number; j++) {
+        sum_0 += row[j] * vector[j];
+      }
+
+      product[i] = (sum_0 + sum_1) + (sum_2 + sum_3);
     }
 
     return (product);
@@ -4539,7 +4542,11 @@ class Matrix {
   // Matrix<Type> dot(const Matrix<Type>&) const method
 
   /// Returns the dot product of this matrix with another matrix.
-  ///
+  /// The product is computed by blocks, so that the panels of both matrices
+  /// which are being used stay in cache.
+  /// Inside each block, four rows of the product are updated at a time with
+  /// contiguous sweeps over the rows of the other matrix, which the compiler
+  /// can vectorize.
   /// @param other_matrix Matrix to be multiplied to this matrix.
 
   Matrix<Type> dot(const Matrix<Type>& other_matrix) const {
@@ -4567,10 +4574,71 @@ class Matrix {
 
     Matrix<Type> product(rows_number, other_columns_number, 0.0);
 
-    for (unsigned i = 0; i < rows_number; i++) {
-      for (unsigned j = 0; j < other_columns_number; j++) {
-        for (unsigned k = 0; k < columns_number; k++) {
-          product[i][j] += data[i][k] * other_matrix[k][j];
+    // Block sizes, chosen so that a block of the other matrix fits in the
+    // level 2 cache and a row panel of it fits in the level 1 cache
+
+    const unsigned rows_block_size = 64;
+    const unsigned inner_block_size = 128;
+    const unsigned columns_block_size = 256;
+
+    unsigned rows_end;
+    unsigned inner_end;
+    unsigned columns_end;
+
+    unsigned i;
+
+    for (unsigned jj = 0; jj < other_columns_number;
+         jj += columns_block_size) {
+      columns_end = std::min(jj + columns_block_size, other_columns_number);
+
+      for (unsigned kk = 0; kk < columns_number; kk += inner_block_size) {
+        inner_end = std::min(kk + inner_block_size, columns_number);
+
+        for (unsigned ii = 0; ii < rows_number; ii += rows_block_size) {
+          rows_end = std::min(ii + rows_block_size, rows_number);
+
+          // Four rows at a time
+
+          for (i = ii; i + 4 <= rows_end; i += 4) {
+            Type* product_0 = product[i];
+            Type* product_1 = product[i + 1];
+            Type* product_2 = product[i + 2];
+            Type* product_3 = product[i + 3];
+
+            for (unsigned k = kk; k < inner_end; k++) {
+              const Type a_0 = data[i][k];
+              const Type a_1 = data[i + 1][k];
+              const Type a_2 = data[i + 2][k];
+              const Type a_3 = data[i + 3][k];
+
+              const Type* other_row = other_matrix[k];
+
+              for (unsigned j = jj; j < columns_end; j++) {
+                const Type b = other_row[j];
+
+                product_0[j] += a_0 * b;
+                product_1[j] += a_1 * b;
+                product_2[j] += a_2 * b;
+                product_3[j] += a_3 * b;
+              }
+            }
+          }
+
+          // Remaining rows
+
+          for (; i < rows_end; i++) {
+            Type* product_row = product[i];
+
+            for (unsigned k = kk; k < inner_end; k++) {
+              const Type a = data[i][k];
+
+              const Type* other_row = other_matrix[k];
+
+              for (unsigned j = jj; j < columns_end; j++) {
+                product_row[j] += a * other_row[j];
+              }
+            }
+          }
         }
       }
     }
@@ -5038,6 +5106,404 @@ class Matrix {
   Type** data;
 };
 
+/// This template class represents the LU factorization with partial pivoting
+/// of a square matrix, P*A = L*U.
+/// The factors are computed once, and then they can be reused to obtain the
+/// determinant, the logarithm of the determinant, the solution of linear
+/// systems with one or several right-hand sides and the inverse matrix.
+/// The factorization is always carried out in double precision.
+
+template <class Type>
+class LUFactorization {
+
+ public:
+
+  // DEFAULT CONSTRUCTOR
+
+  /// Default constructor. It creates an empty factorization.
+
+  explicit LUFactorization(void) : permutation_sign(1), singular(false) {}
+
+  // MATRIX CONSTRUCTOR
+
+  /// Matrix constructor. It factorizes a given square matrix.
+  /// @param matrix Matrix to be factorized.
+
+  explicit LUFactorization(const Matrix<Type>& matrix)
+      : permutation_sign(1), singular(false) {
+    set(matrix);
+  }
+
+  // METHODS
+
+  // const Matrix<double>& get_factors(void) const method
+
+  /// Returns the L and U factors packed in a single matrix.
+  /// The strictly lower part contains L, whose diagonal elements are one, and
+  /// the upper part contains U.
+
+  const Matrix<double>& get_factors(void) const { return (factors); }
+
+  // const Vector<unsigned>& get_pivots(void) const method
+
+  /// Returns the row permutation, as the index of the original row which was
+  /// moved into each row of the factors.
+
+  const Vector<unsigned>& get_pivots(void) const { return (pivots); }
+
+  // bool is_singular(void) const method
+
+  /// Returns true if a zero pivot was found during the factorization, and
+  /// false otherwise.
+
+  bool is_singular(void) const { return (singular); }
+
+  // void set(const Matrix<Type>&) method
+
+  /// Computes the LU factorization of a square matrix by Gaussian elimination
+  /// with partial pivoting.
+  /// The elimination works on whole rows, so that all the memory accesses are
+  /// contiguous.
+  /// @param matrix Matrix to be factorized.
+
+  void set(const Matrix<Type>& matrix) {
+    const unsigned rows_number = matrix.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+    if (matrix.get_columns_number() != rows_number) {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: LUFactorization Template.\n"
+             << "void set(const Matrix<Type>&) method.\n"
+             << "Matrix must be square.\n";
+
+      throw std::logic_error(buffer.str());
+    }
+
+#endif
+
+    factors.set(rows_number, rows_number);
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      for (unsigned j = 0; j < rows_number; j++) {
+        factors[i][j] = static_cast<double>(matrix[i][j]);
+      }
+    }
+
+    pivots.set(rows_number);
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      pivots[i] = i;
+    }
+
+    permutation_sign = 1;
+    singular = false;
+
+    unsigned pivot_index;
+    double pivot;
+    double multiplier;
+
+    for (unsigned k = 0; k < rows_number; k++) {
+      // Find pivot
+
+      pivot_index = k;
+
+      for (unsigned i = k + 1; i < rows_number; i++) {
+        if (fabs(factors[i][k]) > fabs(factors[pivot_index][k])) {
+          pivot_index = i;
+        }
+      }
+
+      if (pivot_index != k) {
+        for (unsigned j = 0; j < rows_number; j++) {
+          std::swap(factors[k][j], factors[pivot_index][j]);
+        }
+
+        std::swap(pivots[k], pivots[pivot_index]);
+
+        permutation_sign = -permutation_sign;
+      }
+
+      pivot = factors[k][k];
+
+      if (pivot == 0.0) {
+        singular = true;
+        continue;
+      }
+
+      // Eliminate below the pivot
+
+      const double* pivot_row = factors[k];
+
+      for (unsigned i = k + 1; i < rows_number; i++) {
+        double* row = factors[i];
+
+        multiplier = row[k] / pivot;
+
+        row[k] = multiplier;
+
+        if (multiplier != 0.0) {
+          for (unsigned j = k + 1; j < rows_number; j++) {
+            row[j] -= multiplier * pivot_row[j];
+          }
+        }
+      }
+    }
+  }
+
+  // double calculate_determinant(void) const method
+
+  /// Returns the determinant of the factorized matrix, which is the product of
+  /// the diagonal of U times the sign of the permutation.
+
+  double calculate_determinant(void) const {
+    if (singular) {
+      return (0.0);
+    }
+
+    const unsigned rows_number = factors.get_rows_number();
+
+    double determinant = permutation_sign;
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      determinant *= factors[i][i];
+    }
+
+    return (determinant);
+  }
+
+  // double calculate_log_determinant(void) const method
+
+  /// Returns the natural logarithm of the absolute value of the determinant.
+  /// It does not overflow for large matrices, as the determinant itself might.
+  /// If the matrix is singular, minus infinity is returned.
+
+  double calculate_log_determinant(void) const {
+    if (singular) {
+      return (-std::numeric_limits<double>::infinity());
+    }
+
+    const unsigned rows_number = factors.get_rows_number();
+
+    double log_determinant = 0.0;
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      log_determinant += log(fabs(factors[i][i]));
+    }
+
+    return (log_determinant);
+  }
+
+  // int calculate_determinant_sign(void) const method
+
+  /// Returns the sign of the determinant: 1, -1, or 0 if the matrix is
+  /// singular.
+
+  int calculate_determinant_sign(void) const {
+    if (singular) {
+      return (0);
+    }
+
+    const unsigned rows_number = factors.get_rows_number();
+
+    int sign = permutation_sign;
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      if (factors[i][i] < 0.0) {
+        sign = -sign;
+      }
+    }
+
+    return (sign);
+  }
+
+  // Vector<double> calculate_solution(const Vector<double>&) const method
+
+  /// Returns the solution x of the linear system A*x = b, by forward and
+  /// backward substitution with the factors.
+  /// @param b Right-hand side vector.
+
+  Vector<double> calculate_solution(const Vector<double>& b) const {
+    const unsigned rows_number = factors.get_rows_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+    check_solution(b.size(), "Vector<double> calculate_solution(const "
+                             "Vector<double>&) const method.\n");
+
+#endif
+
+    Vector<double> x(rows_number);
+
+    // Forward substitution with L
+
+    double sum;
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      const double* row = factors[i];
+
+      sum = b[pivots[i]];
+
+      for (unsigned j = 0; j < i; j++) {
+        sum -= row[j] * x[j];
+      }
+
+      x[i] = sum;
+    }
+
+    // Backward substitution with U
+
+    for (int i = rows_number - 1; i >= 0; i--) {
+      const double* row = factors[i];
+
+      sum = x[i];
+
+      for (unsigned j = i + 1; j < rows_number; j++) {
+        sum -= row[j] * x[j];
+      }
+
+      x[i] = sum / row[i];
+    }
+
+    return (x);
+  }
+
+  // Matrix<double> calculate_solution(const Matrix<double>&) const method
+
+  /// Returns the solution X of the linear systems A*X = B, where each column
+  /// of B is a right-hand side.
+  /// All the right-hand sides are substituted together, row by row.
+  /// @param B Matrix of right-hand sides.
+
+  Matrix<double> calculate_solution(const Matrix<double>& B) const {
+    const unsigned rows_number = factors.get_rows_number();
+
+    const unsigned right_hand_sides_number = B.get_columns_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+    check_solution(B.get_rows_number(),
+                   "Matrix<double> calculate_solution(const "
+                   "Matrix<double>&) const method.\n");
+
+#endif
+
+    Matrix<double> X(rows_number, right_hand_sides_number);
+
+    // Forward substitution with L
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      const double* row = factors[i];
+      const double* b_row = B[pivots[i]];
+      double* x_row = X[i];
+
+      for (unsigned k = 0; k < right_hand_sides_number; k++) {
+        x_row[k] = b_row[k];
+      }
+
+      for (unsigned j = 0; j < i; j++) {
+        const double value = row[j];
+        const double* x_previous_row = X[j];
+
+        if (value != 0.0) {
+          for (unsigned k = 0; k < right_hand_sides_number; k++) {
+            x_row[k] -= value * x_previous_row[k];
+          }
+        }
+      }
+    }
+
+    // Backward substitution with U
+
+    for (int i = rows_number - 1; i >= 0; i--) {
+      const double* row = factors[i];
+      double* x_row = X[i];
+
+      for (unsigned j = i + 1; j < rows_number; j++) {
+        const double value = row[j];
+        const double* x_next_row = X[j];
+
+        if (value != 0.0) {
+          for (unsigned k = 0; k < right_hand_sides_number; k++) {
+            x_row[k] -= value * x_next_row[k];
+          }
+        }
+      }
+
+      for (unsigned k = 0; k < right_hand_sides_number; k++) {
+        x_row[k] /= row[i];
+      }
+    }
+
+    return (X);
+  }
+
+  // Matrix<double> calculate_inverse(void) const method
+
+  /// Returns the inverse of the factorized matrix, as the solution for the
+  /// columns of the identity matrix.
+
+  Matrix<double> calculate_inverse(void) const {
+    const unsigned rows_number = factors.get_rows_number();
+
+    Matrix<double> identity(rows_number, rows_number, 0.0);
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      identity[i][i] = 1.0;
+    }
+
+    return (calculate_solution(identity));
+  }
+
+ private:
+
+  // void check_solution(const unsigned&, const std::string&) const method
+
+  /// Throws an exception if the factorization cannot be used to solve a
+  /// system with a given number of rows.
+  /// @param size Number of rows of the right-hand side.
+  /// @param method Method which is checked.
+
+  void check_solution(const unsigned& size, const std::string& method) const {
+    std::ostringstream buffer;
+
+    if (size != factors.get_rows_number()) {
+      buffer << "OpenNN Exception: LUFactorization Template.\n" << method
+             << "Size of right-hand side must be equal to size of matrix.\n";
+
+      throw std::logic_error(buffer.str());
+    } else if (singular) {
+      buffer << "OpenNN Exception: LUFactorization Template.\n" << method
+             << "Matrix is singular.\n";
+
+      throw std::logic_error(buffer.str());
+    }
+  }
+
+  /// L and U factors, packed in a single matrix.
+
+  Matrix<double> factors;
+
+  /// Row permutation.
+
+  Vector<unsigned> pivots;
+
+  /// Sign of the row permutation.
+
+  int permutation_sign;
+
+  /// True if a zero pivot was found.
+
+  bool singular;
+};
+
 /// This method re-writes the input operator >> for the Matrix template.
 /// @param is Input stream.
 /// @param m Input matrix.
@@ -202,50 +202,10 @@ double MeanSquaredError::calculate_performance(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  // Data set stuff
-
-  const Instances& instances = data_set_pointer->get_instances();
-
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  // Mean squared error stuff
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
-
-  double sum_squared_error = 0.0;
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    // Output vector
-
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    // Target vector
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    // Sum squared error
-
-    sum_squared_error += outputs.calculate_sum_squared_error(targets);
-  }
+      data_set_pointer->get_instances().count_training_instances_number();
 
-  return (sum_squared_error / (double)training_instances_number);
+  return (calculate_training_error() / (double)training_instances_number);
 }
 
 // double calculate_performance(const Vector<double>&) const method
@@ -316,7 +276,7 @@ double MeanSquaredError::calculate_performance(
   for (unsigned i = 0; i < training_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
     // Output vector
 
@@ -325,7 +285,7 @@ double MeanSquaredError::calculate_performance(
 
     // Target vector
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     // Sum squared error
 
@@ -335,6 +295,33 @@ double MeanSquaredError::calculate_performance(
   return (sum_squared_error / (double)training_instances_number);
 }
 
+// Vector<double> calculate_performances(const Vector< Vector<double> >&) const
+// method
+
+/// Returns which would be the mean squared error performances of a neural
+/// network for several hypothetical vectors of parameters.
+/// All the vectors are evaluated in a single pass over the training instances,
+/// and the errors are then divided by the number of training instances.
+/// @param parameters Vectors of potential parameters for the neural network
+/// associated to the performance term.
+
+Vector<double> MeanSquaredError::calculate_performances(
+    const Vector<Vector<double> >& parameters) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const unsigned training_instances_number =
+      data_set_pointer->get_instances().count_training_instances_number();
+
+  return (calculate_training_errors(parameters) /
+          (double)training_instances_number);
+}
+
 // double calculate_generalization_performance(void) const method
 
 /// Returns the mean squared error of the multilayer perceptron measured on the
@@ -375,7 +362,7 @@ double MeanSquaredError::calculate_generalization_performance(void) const {
     for (unsigned i = 0; i < generalization_instances_number; i++) {
       // Input vector
 
-      inputs = data_set_pointer->get_generalization_input_instance(i);
+      data_set_pointer->get_generalization_input_instance(i, inputs);
 
       // Output vector
 
@@ -383,7 +370,7 @@ double MeanSquaredError::calculate_generalization_performance(void) const {
 
       // Target vector
 
-      targets = data_set_pointer->get_generalization_target_instance(i);
+      data_set_pointer->get_generalization_target_instance(i, targets);
 
       // Sum of squares error
 
@@ -410,116 +397,135 @@ Vector<double> MeanSquaredError::calculate_gradient(void) const {
 
 #endif
 
-  // Multilayer percepron stuff
+  const Instances& instances = data_set_pointer->get_instances();
 
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
+  const unsigned training_instances_number =
+      instances.count_training_instances_number();
 
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
+  return (calculate_training_gradient() / (double)training_instances_number);
+}
 
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
+// void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+// Matrix<double>&) const method
 
-  const unsigned parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
+/// Calculates the derivatives of the squared errors with respect to the outputs
+/// of the neural network, for a block of instances.
+/// The mean over the training instances is taken by the calculate_gradient
+/// method.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param output_gradient Matrix to store the outputs gradient.
 
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
+void MeanSquaredError::calculate_output_gradient(
+    const Matrix<double>& outputs, const Matrix<double>& targets,
+    Matrix<double>& output_gradient) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
+  output_gradient.set(instances_number, outputs_number);
 
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_gradient[i][j] = (outputs[i][j] - targets[i][j]) * 2.0;
+    }
+  }
+}
 
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
+// double calculate_outputs_error(const Matrix<double>&, const Matrix<double>&)
+// const method
 
-  // Data set stuff
+/// Returns the sum squared error between a block of outputs and targets.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-  const Instances& instances = data_set_pointer->get_instances();
+double MeanSquaredError::calculate_outputs_error(
+    const Matrix<double>& outputs, const Matrix<double>& targets) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
+  double sum_squared_error = 0.0;
 
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      const double error = outputs[i][j] - targets[i][j];
 
-  // Mean squared error stuff
+      sum_squared_error += error * error;
+    }
+  }
 
-  Vector<Vector<double> > layers_delta;
+  return (sum_squared_error);
+}
 
-  Vector<double> output_objective_gradient(outputs_number);
+// Matrix<double> calculate_Hessian(void) const method
 
-  Vector<double> point_gradient(parameters_number, 0.0);
+/// @todo
 
-  Vector<double> objective_gradient(parameters_number, 0.0);
+Matrix<double> MeanSquaredError::calculate_Hessian(void) const {
+  Matrix<double> H;
 
-  // Main loop
+  return (H);
+}
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
-
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
-
-    if (!has_conditions_layer) {
-      output_objective_gradient =
-          (layers_activation[layers_number - 1] - targets) *
-          (2.0 / (double)training_instances_number);
-
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            output_objective_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
-
-      output_objective_gradient =
-          (particular_solution +
-           homogeneous_solution * layers_activation[layers_number - 1] -
-           targets) *
-          (2.0 / (double)training_instances_number);
-
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            homogeneous_solution,
-                                            output_objective_gradient);
+// void calculate_output_vector_dot_Hessian(const Matrix<double>&, const
+// Matrix<double>&, const Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates, for a block of instances, the product of the second derivatives
+/// of the squared errors with respect to the outputs of the neural network and
+/// a given direction of the outputs, which is twice that direction.
+/// The mean over the training instances is taken by the
+/// calculate_vector_dot_Hessian method.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param outputs_direction Direction of the outputs, with one instance per
+/// row.
+/// @param output_product Matrix to store the outputs Hessian product.
+
+void MeanSquaredError::calculate_output_vector_dot_Hessian(
+    const Matrix<double>& outputs, const Matrix<double>&,
+    const Matrix<double>& outputs_direction,
+    Matrix<double>& output_product) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
+
+  output_product.set(instances_number, outputs_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_product[i][j] = outputs_direction[i][j] * 2.0;
     }
+  }
+}
 
-    point_gradient =
-        calculate_point_gradient(inputs, layers_activation, layers_delta);
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const
+// method
 
-    objective_gradient += point_gradient;
-  }
+/// Returns the exact product of the mean squared error Hessian and a vector of
+/// parameters, which is calculated with the R-operator without forming the
+/// Hessian matrix.
+/// It is the mean over the training instances of the sum squared error product.
+/// @param vector Vector of multilayer perceptron parameters in the product.
 
-  return (objective_gradient);
-}
+Vector<double> MeanSquaredError::calculate_vector_dot_Hessian(
+    const Vector<double>& vector) const {
+#ifndef NDEBUG
 
-// Matrix<double> calculate_Hessian(void) const method
+  check();
 
-/// @todo
+#endif
 
-Matrix<double> MeanSquaredError::calculate_Hessian(void) const {
-  Matrix<double> H;
+  const Instances& instances = data_set_pointer->get_instances();
 
-  return (H);
+  const unsigned training_instances_number =
+      instances.count_training_instances_number();
+
+  return (calculate_training_vector_dot_Hessian(vector) /
+          (double)training_instances_number);
 }
 
 // FirstOrderPerformance calculate_first_order_performance(void) const method
 
-/// @todo
+/// Returns the mean squared error and its gradient, which are calculated with a
+/// single forward and backward propagation of the training instances.
 
 PerformanceTerm::FirstOrderPerformance
 MeanSquaredError::calculate_first_order_performance(void) const {
@@ -531,10 +537,16 @@ MeanSquaredError::calculate_first_order_performance(void) const {
 
 #endif
 
+  const unsigned training_instances_number =
+      data_set_pointer->get_instances().count_training_instances_number();
+
   FirstOrderPerformance first_order_performance;
 
-  first_order_performance.performance = calculate_performance();
-  first_order_performance.gradient = calculate_gradient();
+  calculate_training_error_gradient(first_order_performance.performance,
+                                    first_order_performance.gradient);
+
+  first_order_performance.performance /= (double)training_instances_number;
+  first_order_performance.gradient /= (double)training_instances_number;
 
   return (first_order_performance);
 }
@@ -577,50 +589,10 @@ Vector<double> MeanSquaredError::calculate_terms(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  // Data set stuff
-
-  const Instances& instances = data_set_pointer->get_instances();
-
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  // Mean squared error stuff
-
-  Vector<double> performance_terms(training_instances_number);
+      data_set_pointer->get_instances().count_training_instances_number();
 
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    // Output vector
-
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    // Target vector
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    // Error
-
-    performance_terms[i] = outputs.calculate_distance(targets);
-  }
-
-  return (performance_terms / sqrt((double)training_instances_number));
+  return (calculate_training_terms() / sqrt((double)training_instances_number));
 }
 
 // Vector<double> calculate_terms(const Vector<double>&) const method
@@ -691,129 +663,90 @@ Matrix<double> MeanSquaredError::calculate_terms_Jacobian(void) const {
 
 #endif
 
-  // Neural network stuff
+  const unsigned training_instances_number =
+      data_set_pointer->get_instances().count_training_instances_number();
 
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
+  return (calculate_training_terms_Jacobian() /
+          sqrt((double)training_instances_number));
+}
 
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
+// FirstOrderTerms calculate_first_order_terms(void) method
 
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
+/// Returns a first order objective terms performance structure, which contains
+/// the values and the Jacobian of the objective terms function.
+/// Both are calculated with a single forward and backward propagation of the
+/// training instances.
 
-  const unsigned neural_parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
+PerformanceTerm::FirstOrderTerms
+MeanSquaredError::calculate_first_order_terms(void) const {
+// Control sentence (if debug)
 
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
+#ifndef NDEBUG
 
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
+  check();
 
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
+#endif
 
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
+  const unsigned training_instances_number =
+      data_set_pointer->get_instances().count_training_instances_number();
 
-  // Data set stuff
+  const double scaling = 1.0 / sqrt((double)training_instances_number);
 
-  const Instances& instances = data_set_pointer->get_instances();
+  FirstOrderTerms first_order_terms;
 
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
+  calculate_training_terms_Jacobian(first_order_terms.terms,
+                                    first_order_terms.Jacobian);
 
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
+  first_order_terms.terms *= scaling;
+  first_order_terms.Jacobian *= scaling;
 
-  // Objective functional
+  return (first_order_terms);
+}
 
-  Vector<double> term(outputs_number);
-  double term_norm;
+// TermsJacobianProducts calculate_terms_Jacobian_products(void) const method
 
-  Vector<double> output_objective_gradient(outputs_number);
+/// Returns the mean squared error and the products of the transposed terms
+/// Jacobian with the terms and with itself.
+/// They are accumulated over the training instances without forming the
+/// terms Jacobian, and then divided by the number of training instances.
 
-  Vector<Vector<double> > layers_delta(layers_number);
-  Vector<double> point_gradient(neural_parameters_number);
+PerformanceTerm::TermsJacobianProducts
+MeanSquaredError::calculate_terms_Jacobian_products(void) const {
+// Control sentence (if debug)
 
-  Matrix<double> terms_Jacobian(training_instances_number,
-                                neural_parameters_number);
+#ifndef NDEBUG
 
-  // Main loop
+  check();
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
-
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
-
-    if (!has_conditions_layer) {
-      const Vector<double>& outputs =
-          first_order_forward_propagation[0][layers_number - 1];
-
-      term = (outputs - targets);
-      term_norm = term.calculate_norm();
-
-      if (term_norm == 0.0) {
-        output_objective_gradient.initialize(0.0);
-      } else {
-        output_objective_gradient = term / term_norm;
-      }
-
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            output_objective_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
-
-      term = (particular_solution +
-              homogeneous_solution * layers_activation[layers_number - 1] -
-              targets) /
-             sqrt((double)training_instances_number);
-      term_norm = term.calculate_norm();
-
-      if (term_norm == 0.0) {
-        output_objective_gradient.initialize(0.0);
-      } else {
-        output_objective_gradient = term / term_norm;
-      }
-
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            homogeneous_solution,
-                                            output_objective_gradient);
-    }
+#endif
 
-    point_gradient =
-        calculate_point_gradient(inputs, layers_activation, layers_delta);
+  const unsigned training_instances_number =
+      data_set_pointer->get_instances().count_training_instances_number();
 
-    terms_Jacobian.set_row(i, point_gradient);
-  }
+  const double scaling = 1.0 / (double)training_instances_number;
 
-  return (terms_Jacobian / sqrt((double)training_instances_number));
-}
+  TermsJacobianProducts terms_Jacobian_products =
+      calculate_training_terms_Jacobian_products();
 
-// FirstOrderTerms calculate_first_order_terms(void) method
+  terms_Jacobian_products.terms_squared_sum *= scaling;
+  terms_Jacobian_products.JacobianT_dot_terms *= scaling;
+  terms_Jacobian_products.JacobianT_dot_Jacobian *= scaling;
 
-/// Returns a first order objective terms performance structure, which contains
-/// the values and the Jacobian of the objective terms function.
+  return (terms_Jacobian_products);
+}
 
-/// @todo
+// Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(const
+// Vector<double>&) const method
+
+/// Returns the product of the transposed terms Jacobian, the terms Jacobian
+/// and a vector of parameters, which is the product of the Gauss-Newton
+/// approximation of the mean squared error Hessian and the vector.
+/// It is calculated over the training instances without forming the terms
+/// Jacobian, and then divided by the number of training instances.
+/// @param vector Vector of multilayer perceptron parameters in the product.
 
-MeanSquaredError::FirstOrderTerms MeanSquaredError::calculate_first_order_terms(
-    void) {
+Vector<double> MeanSquaredError::calculate_JacobianT_dot_Jacobian_dot_vector(
+    const Vector<double>& vector) const {
 // Control sentence (if debug)
 
 #ifndef NDEBUG
@@ -822,13 +755,35 @@ MeanSquaredError::FirstOrderTerms MeanSquaredError::calculate_first_order_terms(
 
 #endif
 
-  FirstOrderTerms first_order_terms;
+  const unsigned training_instances_number =
+      data_set_pointer->get_instances().count_training_instances_number();
+
+  return (calculate_training_JacobianT_dot_Jacobian_dot_vector(vector) /
+          (double)training_instances_number);
+}
 
-  first_order_terms.terms = calculate_terms();
+// Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const method
 
-  first_order_terms.Jacobian = calculate_terms_Jacobian();
+/// Returns the diagonal of the product of the transposed terms Jacobian and
+/// the terms Jacobian.
+/// It is calculated over the training instances without forming the terms
+/// Jacobian, and then divided by the number of training instances.
 
-  return (first_order_terms);
+Vector<double> MeanSquaredError::calculate_JacobianT_dot_Jacobian_diagonal(
+    void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const unsigned training_instances_number =
+      data_set_pointer->get_instances().count_training_instances_number();
+
+  return (calculate_training_JacobianT_dot_Jacobian_diagonal() /
+          (double)training_instances_number);
 }
 
 // std::string write_performance_term_type(void) const method
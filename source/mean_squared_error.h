@@ -97,12 +97,27 @@ class MeanSquaredError : public PerformanceTerm {
 
   double calculate_performance(void) const;
   double calculate_performance(const Vector<double>&) const;
+
+  Vector<double> calculate_performances(const Vector<Vector<double> >&) const;
   double calculate_generalization_performance(void) const;
 
   Vector<double> calculate_gradient(void) const;
 
+  void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+                                 Matrix<double>&) const;
+
+  void calculate_output_vector_dot_Hessian(const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           Matrix<double>&) const;
+
+  double calculate_outputs_error(const Matrix<double>&,
+                                 const Matrix<double>&) const;
+
   Matrix<double> calculate_Hessian(void) const;
 
+  Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
   FirstOrderPerformance calculate_first_order_performance(void) const;
   SecondOrderPerformance calculate_second_order_performance(void) const;
 
@@ -113,7 +128,13 @@ class MeanSquaredError : public PerformanceTerm {
 
   Matrix<double> calculate_terms_Jacobian(void) const;
 
-  FirstOrderTerms calculate_first_order_terms(void);
+  FirstOrderTerms calculate_first_order_terms(void) const;
+
+  TermsJacobianProducts calculate_terms_Jacobian_products(void) const;
+
+  Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(
+      const Vector<double>&) const;
+  Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const;
 
   std::string write_performance_term_type(void) const;
 
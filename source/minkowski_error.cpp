@@ -248,48 +248,7 @@ double MinkowskiError::calculate_performance(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  // Data set
-
-  const Instances& instances = data_set_pointer->get_instances();
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
-
-  double Minkowski_error = 0.0;
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    // Output vector
-
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    // Target vector
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    // Minkowski error
-
-    Minkowski_error +=
-        (outputs - targets).calculate_p_norm(Minkowski_parameter);
-  }
-
-  return (Minkowski_error);
+  return (calculate_training_error());
 }
 
 // double calculate_performance(const Vector<double>&) const method
@@ -356,7 +315,7 @@ double MinkowskiError::calculate_performance(
   for (unsigned i = 0; i < training_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
     // Output vector
 
@@ -365,7 +324,7 @@ double MinkowskiError::calculate_performance(
 
     // Target vector
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     // Minkowski error
 
@@ -413,7 +372,7 @@ double MinkowskiError::calculate_generalization_performance(void) const {
   for (unsigned i = 0; i < generalization_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_generalization_input_instance(i);
+    data_set_pointer->get_generalization_input_instance(i, inputs);
 
     // Output vector
 
@@ -421,7 +380,7 @@ double MinkowskiError::calculate_generalization_performance(void) const {
 
     // Target vector
 
-    targets = data_set_pointer->get_generalization_target_instance(i);
+    data_set_pointer->get_generalization_target_instance(i, targets);
 
     // Minkowski error
 
@@ -447,114 +406,98 @@ Vector<double> MinkowskiError::calculate_gradient(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  // Neural network stuff
-
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
-
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
-
-  const unsigned neural_parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
-
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
+  return (calculate_training_gradient());
+}
 
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
+// FirstOrderPerformance calculate_first_order_performance(void) const method
 
-  // Data set stuff
+/// Returns the Minkowski error and its gradient, which are calculated with a
+/// single forward and backward propagation of the training instances.
 
-  const Instances& instances = data_set_pointer->get_instances();
+PerformanceTerm::FirstOrderPerformance
+MinkowskiError::calculate_first_order_performance(void) const {
+// Control sentence (if debug)
 
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
+#ifndef NDEBUG
 
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
+  check();
 
-  // Minkowski error stuff
+#endif
 
-  Vector<double> output_gradient(outputs_number);
+  FirstOrderPerformance first_order_performance;
 
-  Vector<Matrix<double> > layers_combination_parameters_Jacobian;
+  calculate_training_error_gradient(first_order_performance.performance,
+                                    first_order_performance.gradient);
 
-  Vector<Vector<double> > layers_inputs(layers_number);
-  Vector<Vector<double> > layers_delta;
+  return (first_order_performance);
+}
 
-  Vector<double> point_gradient(neural_parameters_number, 0.0);
+// void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+// Matrix<double>&) const method
 
-  Vector<double> gradient(neural_parameters_number, 0.0);
+/// Calculates the gradient of the Minkowski error of each instance with respect
+/// to the outputs of the neural network, for a block of instances.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param output_gradient Matrix to store the outputs gradient.
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Data set
+void MinkowskiError::calculate_output_gradient(
+    const Matrix<double>& outputs, const Matrix<double>& targets,
+    Matrix<double>& output_gradient) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+  output_gradient.set(instances_number, outputs_number);
 
-    targets = data_set_pointer->get_training_target_instance(i);
+  Vector<double> errors(outputs_number);
 
-    // Neural network
+  double p_norm;
 
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      errors[j] = outputs[i][j] - targets[i][j];
+    }
 
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
+    p_norm = errors.calculate_p_norm(Minkowski_parameter);
 
-    layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(
-        inputs, layers_activation);
+    for (unsigned j = 0; j < outputs_number; j++) {
+      if (p_norm == 0.0) {
+        output_gradient[i][j] = 0.0;
+      } else {
+        output_gradient[i][j] =
+            errors[j] * pow(fabs(errors[j]), Minkowski_parameter - 2.0) /
+            pow(p_norm, Minkowski_parameter - 1.0);
+      }
+    }
+  }
+}
 
-    layers_combination_parameters_Jacobian = multilayer_perceptron_pointer
-        ->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+// double calculate_outputs_error(const Matrix<double>&, const Matrix<double>&)
+// const method
 
-    // Performance functional
+/// Returns the sum over a block of instances of the Minkowski norms of the
+/// differences between outputs and targets.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-    if (!has_conditions_layer) {
-      output_gradient = (layers_activation[layers_number - 1] - targets)
-          .calculate_p_norm_gradient(Minkowski_parameter);
+double MinkowskiError::calculate_outputs_error(
+    const Matrix<double>& outputs, const Matrix<double>& targets) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-      layers_delta =
-          calculate_layers_delta(layers_activation_derivative, output_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+  double Minkowski_error = 0.0;
 
-      output_gradient =
-          (particular_solution +
-           homogeneous_solution * layers_activation[layers_number - 1] -
-           targets).calculate_pow(Minkowski_parameter - 1.0) *
-          Minkowski_parameter;
+  for (unsigned i = 0; i < instances_number; i++) {
+    double sum = 0.0;
 
-      layers_delta = calculate_layers_delta(
-          layers_activation_derivative, homogeneous_solution, output_gradient);
+    for (unsigned j = 0; j < outputs_number; j++) {
+      sum += pow(fabs(outputs[i][j] - targets[i][j]), Minkowski_parameter);
     }
 
-    point_gradient = calculate_point_gradient(
-        layers_combination_parameters_Jacobian, layers_delta);
-
-    gradient += point_gradient;
+    Minkowski_error += pow(sum, 1.0 / Minkowski_parameter);
   }
 
-  return (gradient);
+  return (Minkowski_error);
 }
 
 // Matrix<double> calculate_Hessian(void) const method
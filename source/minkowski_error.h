@@ -98,6 +98,14 @@ class MinkowskiError : public PerformanceTerm {
   double calculate_generalization_performance(void) const;
 
   Vector<double> calculate_gradient(void) const;
+
+  FirstOrderPerformance calculate_first_order_performance(void) const;
+
+  void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+                                 Matrix<double>&) const;
+
+  double calculate_outputs_error(const Matrix<double>&,
+                                 const Matrix<double>&) const;
   Matrix<double> calculate_Hessian(void) const;
 
   std::string write_performance_term_type(void) const;
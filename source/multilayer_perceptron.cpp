@@ -408,7 +408,7 @@ Vector<double> MultilayerPerceptron::arrange_parameters(void) const {
   unsigned position = 0;
 
   for (unsigned i = 0; i < layers_number; i++) {
-    const Vector<double> layer_parameters = layers[i].arrange_parameters();
+    const Vector<double>& layer_parameters = layers[i].get_parameters();
     const unsigned layer_parameters_number = layer_parameters.size();
 
     parameters.tuck_in(position, layer_parameters);
@@ -418,6 +418,36 @@ Vector<double> MultilayerPerceptron::arrange_parameters(void) const {
   return (parameters);
 }
 
+// Vector<float> arrange_single_precision_parameters(void) const method
+
+/// Returns the values of all the biases and synaptic weights in the multilayer
+/// perceptron as a single vector, rounded to single precision.
+/// The parameters are arranged as in the arrange_parameters method.
+
+Vector<float> MultilayerPerceptron::arrange_single_precision_parameters(
+    void) const {
+  const unsigned layers_number = get_layers_number();
+
+  const unsigned parameters_number = count_parameters_number();
+
+  Vector<float> parameters(parameters_number);
+
+  unsigned position = 0;
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    const Vector<double>& layer_parameters = layers[i].get_parameters();
+    const unsigned layer_parameters_number = layer_parameters.size();
+
+    for (unsigned j = 0; j < layer_parameters_number; j++) {
+      parameters[position + j] = (float)layer_parameters[j];
+    }
+
+    position += layer_parameters_number;
+  }
+
+  return (parameters);
+}
+
 // Vector<unsigned> count_layers_parameters_numbers(void) const method
 
 /// Returns the number of parameters for each layer in this multilayer
@@ -546,7 +576,7 @@ unsigned MultilayerPerceptron::get_layer_bias_index(
 
   for (unsigned j = 0; j < perceptron_index; j++) {
     layer_bias_index +=
-        layers[layer_index].get_perceptron(j).count_parameters_number();
+        layers[layer_index].count_perceptron_parameters_number();
   }
 
   return (layer_bias_index);
@@ -627,7 +657,7 @@ unsigned MultilayerPerceptron::get_layer_synaptic_weight_index(
   if (perceptron_index > 0) {
     for (unsigned i = 0; i < perceptron_index - 1; i++) {
       layer_synaptic_weight_index +=
-          layers[layer_index].get_perceptron(i).count_parameters_number();
+          layers[layer_index].count_perceptron_parameters_number();
     }
   }
 
@@ -695,7 +725,7 @@ Matrix<unsigned> MultilayerPerceptron::arrange_parameters_indices(void) const {
   for (unsigned i = 0; i < layers_number; i++) {
     for (unsigned j = 0; j < layers_size[i]; j++) {
       perceptron_parameters_number =
-          layers[i].get_perceptron(j).count_parameters_number();
+          layers[i].count_perceptron_parameters_number();
 
       for (unsigned k = 0; k < perceptron_parameters_number; k++) {
         parameters_indices[parameter_index][0] = i;
@@ -1181,7 +1211,6 @@ void MultilayerPerceptron::set_parameters(
 
   for (unsigned i = 0; i < layers_number; i++) {
     layer_parameters_number = layers[i].count_parameters_number();
-    layer_parameters = layers[i].arrange_parameters();
 
     layer_parameters =
         new_parameters.take_out(position, layer_parameters_number);
@@ -1299,6 +1328,24 @@ void MultilayerPerceptron::set_layers_activation_function(
   }
 }
 
+// void set_layers_activation_accuracy(const Perceptron::ActivationAccuracy&)
+// method
+
+/// Sets the accuracy of the activation kernels in all the layers.
+/// The fast mode approximates the exponentials with polynomials, which speeds
+/// up inference at the cost of a maximum absolute error of 1e-8 in the
+/// activations.
+/// @param new_activation_accuracy Exact or fast activation kernels.
+
+void MultilayerPerceptron::set_layers_activation_accuracy(
+    const Perceptron::ActivationAccuracy& new_activation_accuracy) {
+  const unsigned layers_number = get_layers_number();
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    layers[i].set_activation_accuracy(new_activation_accuracy);
+  }
+}
+
 // void set_display(const bool&) method
 
 /// Sets a new display value.
@@ -2413,6 +2460,8 @@ MultilayerPerceptron::calculate_output_interlayers_Delta(
 /// Returns the outputs from the multilayer perceptron for given sets of inputs
 /// and parameters.
 /// This function is called the parameters outputs.
+/// The parameters of each layer are read in place from the parameters vector,
+/// at offsets accumulated layer by layer, so that they are never copied.
 /// @param inputs Vector of inputs to the first layer of the multilayer
 /// perceptron.
 /// @param parameters Vector of potential parameters for the multilayer
@@ -2462,30 +2511,29 @@ Vector<double> MultilayerPerceptron::calculate_outputs(
 
   const unsigned layers_number = get_layers_number();
 
-  Vector<double> outputs;
-
   if (layers_number == 0) {
-    return (outputs);
-  } else {
-    const Vector<unsigned> layers_parameters_numbers =
-        count_layers_parameters_numbers();
+    return (Vector<double>());
+  }
 
-    const Vector<unsigned> layers_cumulative_parameters_number =
-        arrange_layers_cumulative_parameters_number();
+  Vector<double> outputs(get_outputs_number());
+  Vector<double> workspace(count_workspace_size());
 
-    Vector<double> layer_parameters;
+  const unsigned half_workspace_size = workspace.size() / 2;
 
-    layer_parameters = parameters.take_out(0, layers_parameters_numbers[0]);
+  const double* layer_inputs = inputs.empty() ? NULL : &inputs[0];
 
-    outputs = layers[0].calculate_outputs(inputs, layer_parameters);
+  const double* layer_parameters = parameters.empty() ? NULL : &parameters[0];
 
-    for (unsigned i = 1; i < layers_number; i++) {
-      layer_parameters =
-          parameters.take_out(layers_cumulative_parameters_number[i - 1],
-                              layers_parameters_numbers[i]);
+  for (unsigned i = 0; i < layers_number; i++) {
+    double* layer_outputs = i == layers_number - 1
+                                ? &outputs[0]
+                                : &workspace[(i % 2) * half_workspace_size];
 
-      outputs = layers[i].calculate_outputs(outputs, layer_parameters);
-    }
+    layers[i].calculate_outputs(layer_inputs, layer_parameters, layer_outputs);
+
+    layer_parameters += layers[i].count_parameters_number();
+
+    layer_inputs = layer_outputs;
   }
 
   return (outputs);
@@ -2971,7 +3019,7 @@ MultilayerPerceptron::calculate_perceptrons_combination_parameters_gradient(
     perceptrons_combination_gradient[i].set(layers_size[i]);
 
     for (unsigned j = 0; j < layers_size[i]; j++) {
-      const Perceptron& perceptron = layers[i].get_perceptron(j);
+      const Perceptron perceptron = layers[i].get_perceptron(j);
 
       perceptrons_combination_gradient[i][j] =
           perceptron.calculate_combination_gradient(layers_inputs[i],
@@ -3459,6 +3507,386 @@ MultilayerPerceptron::calculate_second_order_forward_propagation(
   return (second_order_forward_propagation);
 }
 
+// void calculate_first_order_forward_propagation(const Matrix<double>&,
+// Vector< Matrix<double> >&, Vector< Matrix<double> >&) const method
+
+/// Calculates the activations and the activation derivatives of every layer
+/// for a block of instances.
+/// This is the batch counterpart of the first order forward propagation, used
+/// by the back-propagation algorithm over blocks of instances.
+/// Both vectors of matrices are workspaces owned by the caller, which are only
+/// reallocated when the block size changes.
+/// @param inputs Matrix of inputs, with one instance per row.
+/// @param layers_activation Activations of every layer, with one instance per
+/// row.
+/// @param layers_activation_derivative Activation derivatives of every layer,
+/// with one instance per row.
+
+void MultilayerPerceptron::calculate_first_order_forward_propagation(
+    const Matrix<double>& inputs, Vector<Matrix<double> >& layers_activation,
+    Vector<Matrix<double> >& layers_activation_derivative) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  const unsigned inputs_number = get_inputs_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+           << "void calculate_first_order_forward_propagation(const "
+              "Matrix<double>&, Vector< Matrix<double> >&, Vector< "
+              "Matrix<double> >&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned layers_number = get_layers_number();
+
+  layers_activation.set(layers_number);
+  layers_activation_derivative.set(layers_number);
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    if (i == 0) {
+      layers[i].calculate_first_order_forward_propagation(
+          inputs, layers_activation[i], layers_activation_derivative[i]);
+    } else {
+      layers[i].calculate_first_order_forward_propagation(
+          layers_activation[i - 1], layers_activation[i],
+          layers_activation_derivative[i]);
+    }
+  }
+}
+
+// void calculate_first_order_forward_propagation(const Matrix<float>&, const
+// Vector<float>&, Vector< Matrix<float> >&, Vector< Matrix<float> >&) const
+// method
+
+/// Calculates the activations and the activation derivatives of every layer
+/// for a block of instances in single precision.
+/// The parameters of each layer are read in place from a single precision
+/// parameters vector, such as the one returned by the
+/// arrange_single_precision_parameters method.
+/// @param inputs Matrix of single precision inputs, with one instance per row.
+/// @param parameters Single precision parameters of the multilayer perceptron.
+/// @param layers_activation Activations of every layer, with one instance per
+/// row.
+/// @param layers_activation_derivative Activation derivatives of every layer,
+/// with one instance per row.
+
+void MultilayerPerceptron::calculate_first_order_forward_propagation(
+    const Matrix<float>& inputs, const Vector<float>& parameters,
+    Vector<Matrix<float> >& layers_activation,
+    Vector<Matrix<float> >& layers_activation_derivative) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned parameters_size = parameters.size();
+
+  const unsigned parameters_number = count_parameters_number();
+
+  if (parameters_size != parameters_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+           << "void calculate_first_order_forward_propagation(const "
+              "Matrix<float>&, const Vector<float>&, Vector< Matrix<float> "
+              ">&, Vector< Matrix<float> >&) const method.\n"
+           << "Size of parameters (" << parameters_size
+           << ") must be equal to number of parameters (" << parameters_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned layers_number = get_layers_number();
+
+  layers_activation.set(layers_number);
+  layers_activation_derivative.set(layers_number);
+
+  const float* layer_parameters = parameters.empty() ? NULL : &parameters[0];
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    const Matrix<float>& layer_inputs =
+        i == 0 ? inputs : layers_activation[i - 1];
+
+    layers[i].calculate_first_order_forward_propagation(
+        layer_inputs, layer_parameters, layers_activation[i],
+        layers_activation_derivative[i]);
+
+    layer_parameters += layers[i].count_parameters_number();
+  }
+}
+
+// void calculate_outputs(const Matrix<double>&, Vector< Matrix<double> >&)
+// const method
+
+/// Calculates the outputs of every layer for a block of instances.
+/// Each layer is evaluated as one matrix product followed by the element-wise
+/// activations over the whole block.
+/// The vector of layers outputs is a workspace owned by the caller.
+/// Its matrices are only reallocated when their sizes change, so that
+/// consecutive blocks of the same size do not allocate memory.
+/// On return, the last element contains the outputs of the multilayer
+/// perceptron.
+/// @param inputs Matrix of inputs, with one instance per row.
+/// @param layers_outputs Outputs of every layer, with one instance per row.
+
+void MultilayerPerceptron::calculate_outputs(
+    const Matrix<double>& inputs,
+    Vector<Matrix<double> >& layers_outputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  const unsigned inputs_number = get_inputs_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+           << "void calculate_outputs(const Matrix<double>&, "
+              "Vector< Matrix<double> >&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned layers_number = get_layers_number();
+
+  layers_outputs.set(layers_number);
+
+  if (layers_number == 0) {
+    return;
+  }
+
+  layers[0].calculate_outputs(inputs, layers_outputs[0]);
+
+  for (unsigned i = 1; i < layers_number; i++) {
+    layers[i].calculate_outputs(layers_outputs[i - 1], layers_outputs[i]);
+  }
+}
+
+// Matrix<double> calculate_outputs(const Matrix<double>&) const method
+
+/// Returns the outputs of the multilayer perceptron for a block of instances.
+/// The number of rows is the number of instances and the number of columns is
+/// the number of outputs.
+/// @param inputs Matrix of inputs, with one instance per row.
+
+Matrix<double> MultilayerPerceptron::calculate_outputs(
+    const Matrix<double>& inputs) const {
+  const unsigned layers_number = get_layers_number();
+
+  if (layers_number == 0) {
+    return (Matrix<double>());
+  }
+
+  Vector<Matrix<double> > layers_outputs;
+
+  calculate_outputs(inputs, layers_outputs);
+
+  return (layers_outputs[layers_number - 1]);
+}
+
+// void calculate_outputs(const Matrix<double>&, const Vector<double>&,
+// Matrix<double>&) const method
+
+/// Calculates which would be the outputs of the multilayer perceptron for a
+/// block of instances and a given set of parameters.
+/// The parameters of each layer are read in place from the parameters vector,
+/// so that a whole data block can be evaluated at a trial point without
+/// copying any parameters.
+/// @param inputs Matrix of inputs, with one instance per row.
+/// @param parameters Vector of potential parameters for the multilayer
+/// perceptron.
+/// @param outputs Matrix to store the outputs, with one instance per row.
+/// It must not be the inputs matrix.
+
+void MultilayerPerceptron::calculate_outputs(const Matrix<double>& inputs,
+                                             const Vector<double>& parameters,
+                                             Matrix<double>& outputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  const unsigned inputs_number = get_inputs_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+           << "void calculate_outputs(const Matrix<double>&, const "
+              "Vector<double>&, Matrix<double>&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  const unsigned parameters_size = parameters.size();
+
+  const unsigned parameters_number = count_parameters_number();
+
+  if (parameters_size != parameters_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+           << "void calculate_outputs(const Matrix<double>&, const "
+              "Vector<double>&, Matrix<double>&) const method.\n"
+           << "Size of parameters (" << parameters_size
+           << ") must be equal to number of parameters (" << parameters_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned layers_number = get_layers_number();
+
+  if (layers_number == 0) {
+    outputs.set();
+    return;
+  }
+
+  Matrix<double> hidden_outputs[2];
+
+  const Matrix<double>* layer_inputs_pointer = &inputs;
+
+  const double* layer_parameters = parameters.empty() ? NULL : &parameters[0];
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    Matrix<double>& layer_outputs =
+        i == layers_number - 1 ? outputs : hidden_outputs[i % 2];
+
+    layers[i].calculate_outputs(*layer_inputs_pointer, layer_parameters,
+                                layer_outputs);
+
+    layer_parameters += layers[i].count_parameters_number();
+
+    layer_inputs_pointer = &layer_outputs;
+  }
+}
+
+// Matrix<double> calculate_outputs(const Matrix<double>&, const
+// Vector<double>&) const method
+
+/// Returns which would be the outputs of the multilayer perceptron for a block
+/// of instances and a given set of parameters.
+/// @param inputs Matrix of inputs, with one instance per row.
+/// @param parameters Vector of potential parameters for the multilayer
+/// perceptron.
+
+Matrix<double> MultilayerPerceptron::calculate_outputs(
+    const Matrix<double>& inputs, const Vector<double>& parameters) const {
+  Matrix<double> outputs;
+
+  calculate_outputs(inputs, parameters, outputs);
+
+  return (outputs);
+}
+
+// void calculate_outputs(const Matrix<float>&, const Vector<float>&, Vector<
+// Matrix<float> >&) const method
+
+/// Calculates the outputs of every layer for a block of instances in single
+/// precision.
+/// The parameters of each layer are read in place from a single precision
+/// parameters vector, such as the one returned by the
+/// arrange_single_precision_parameters method.
+/// On return, the last element contains the outputs of the multilayer
+/// perceptron.
+/// @param inputs Matrix of single precision inputs, with one instance per row.
+/// @param parameters Single precision parameters of the multilayer perceptron.
+/// @param layers_outputs Outputs of every layer, with one instance per row.
+
+void MultilayerPerceptron::calculate_outputs(
+    const Matrix<float>& inputs, const Vector<float>& parameters,
+    Vector<Matrix<float> >& layers_outputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned parameters_size = parameters.size();
+
+  const unsigned parameters_number = count_parameters_number();
+
+  if (parameters_size != parameters_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: MultilayerPerceptron class.\n"
+           << "void calculate_outputs(const Matrix<float>&, const "
+              "Vector<float>&, Vector< Matrix<float> >&) const method.\n"
+           << "Size of parameters (" << parameters_size
+           << ") must be equal to number of parameters (" << parameters_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned layers_number = get_layers_number();
+
+  layers_outputs.set(layers_number);
+
+  const float* layer_parameters = parameters.empty() ? NULL : &parameters[0];
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    const Matrix<float>& layer_inputs = i == 0 ? inputs : layers_outputs[i - 1];
+
+    layers[i].calculate_outputs(layer_inputs, layer_parameters,
+                                layers_outputs[i]);
+
+    layer_parameters += layers[i].count_parameters_number();
+  }
+}
+
+// unsigned count_workspace_size(void) const method
+
+/// Returns the number of doubles that the workspace for the outputs of the
+/// hidden layers must hold.
+/// That is twice the size of the largest hidden layer, since the outputs of
+/// consecutive hidden layers are stored in alternate halves.
+
+unsigned MultilayerPerceptron::count_workspace_size(void) const {
+  const unsigned layers_number = get_layers_number();
+
+  unsigned workspace_size = 0;
+
+  for (unsigned i = 0; i + 1 < layers_number; i++) {
+    const unsigned layer_perceptrons_number =
+        layers[i].get_perceptrons_number();
+
+    if (2 * layer_perceptrons_number > workspace_size) {
+      workspace_size = 2 * layer_perceptrons_number;
+    }
+  }
+
+  return (workspace_size);
+}
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current multilayer perceptron object.
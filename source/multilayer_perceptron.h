@@ -221,6 +221,7 @@ class MultilayerPerceptron {
 
   unsigned count_parameters_number(void) const;
   Vector<double> arrange_parameters(void) const;
+  Vector<float> arrange_single_precision_parameters(void) const;
 
   Vector<unsigned> count_layers_parameters_numbers(void) const;
 
@@ -303,6 +304,8 @@ class MultilayerPerceptron {
   void set_layer_activation_function(const unsigned&,
                                      const Perceptron::ActivationFunction&);
 
+  void set_layers_activation_accuracy(const Perceptron::ActivationAccuracy&);
+
   // Display messages
 
   void set_display(const bool&);
@@ -409,6 +412,14 @@ class MultilayerPerceptron {
   Vector<Vector<Vector<double> > > calculate_second_order_forward_propagation(
       const Vector<double>&) const;
 
+  void calculate_first_order_forward_propagation(
+      const Matrix<double>&, Vector<Matrix<double> >&,
+      Vector<Matrix<double> >&) const;
+
+  void calculate_first_order_forward_propagation(
+      const Matrix<float>&, const Vector<float>&, Vector<Matrix<float> >&,
+      Vector<Matrix<float> >&) const;
+
   // Output
 
   Vector<double> calculate_outputs(const Vector<double>&) const;
@@ -422,6 +433,20 @@ class MultilayerPerceptron {
   Vector<Matrix<double> > calculate_Hessian_form(const Vector<double>&,
                                                  const Vector<double>&) const;
 
+  void calculate_outputs(const Matrix<double>&,
+                         Vector<Matrix<double> >&) const;
+  Matrix<double> calculate_outputs(const Matrix<double>&) const;
+
+  void calculate_outputs(const Matrix<double>&, const Vector<double>&,
+                         Matrix<double>&) const;
+  Matrix<double> calculate_outputs(const Matrix<double>&,
+                                   const Vector<double>&) const;
+
+  void calculate_outputs(const Matrix<float>&, const Vector<float>&,
+                         Vector<Matrix<float> >&) const;
+
+  unsigned count_workspace_size(void) const;
+
   // Serialization methods
 
   tinyxml2::XMLDocument* to_XML(void) const;
@@ -2217,54 +2217,109 @@ Vector<double> NeuralNetwork::calculate_outputs(
   return (outputs);
 }
 
-// Matrix<double> calculate_output_data(const Matrix<double>&) const method
+// Matrix<double> calculate_outputs(const Matrix<double>&) const method
 
-/// Calculates a set of outputs from the neural network in response to a set of
-/// inputs.
-/// The format is a matrix, where each row contains the output for a single
-/// input.
-/// @param input_data Matrix of inputs to the neural network.
-
-Matrix<double> NeuralNetwork::calculate_output_data(
-    const Matrix<double>& input_data) const {
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
+/// Calculates the outputs from the neural network for a block of instances.
+/// The multilayer perceptron is evaluated for the whole block at once, with
+/// one matrix product per layer.
+/// The rest of layers are applied to each instance.
+/// @param inputs Matrix of inputs to the neural network, with one instance per
+/// row.
 
+Matrix<double> NeuralNetwork::calculate_outputs(
+    const Matrix<double>& inputs) const {
 // Control sentence (if debug)
 
 #ifndef NDEBUG
 
-  const unsigned columns_number = input_data.get_columns_number();
+  if (multilayer_perceptron_pointer) {
+    const unsigned columns_number = inputs.get_columns_number();
 
-  if (columns_number != inputs_number) {
-    std::ostringstream buffer;
+    const unsigned inputs_number =
+        multilayer_perceptron_pointer->get_inputs_number();
 
-    buffer << "OpenNN Exception: NeuralNetwork class.\n"
-           << "Matrix<double> calculate_output_data(const Matrix<double>&) "
-              "const method.\n"
-           << "Number of columns must be equal to number of inputs.\n";
+    if (columns_number != inputs_number) {
+      std::ostringstream buffer;
 
-    throw std::logic_error(buffer.str());
+      buffer << "OpenNN Exception: NeuralNetwork class.\n"
+             << "Matrix<double> calculate_outputs(const Matrix<double>&) const "
+                "method.\n"
+             << "Number of columns must be equal to number of inputs.\n";
+
+      throw std::logic_error(buffer.str());
+    }
   }
 
 #endif
 
-  const unsigned input_vectors_number = input_data.get_rows_number();
+  const unsigned instances_number = inputs.get_rows_number();
 
-  Matrix<double> output_data(input_vectors_number, outputs_number);
+  Matrix<double> outputs(inputs);
 
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
+  // Scaling layer
 
-  for (unsigned i = 0; i < input_vectors_number; i++) {
-    inputs = input_data.arrange_row(i);
-    outputs = calculate_outputs(inputs);
-    output_data.set_row(i, outputs);
+  if (scaling_layer_pointer) {
+    for (unsigned i = 0; i < instances_number; i++) {
+      outputs.set_row(
+          i, scaling_layer_pointer->calculate_outputs(inputs.arrange_row(i)));
+    }
+  }
+
+  // Multilayer perceptron
+
+  if (multilayer_perceptron_pointer) {
+    outputs = multilayer_perceptron_pointer->calculate_outputs(outputs);
+  }
+
+  if (!conditions_layer_pointer && !unscaling_layer_pointer &&
+      !probabilistic_layer_pointer && !bounding_layer_pointer) {
+    return (outputs);
+  }
+
+  // Conditions, unscaling, probabilistic and bounding layers
+
+  Vector<double> instance_outputs;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    instance_outputs = outputs.arrange_row(i);
+
+    if (conditions_layer_pointer) {
+      instance_outputs = conditions_layer_pointer->calculate_outputs(
+          inputs.arrange_row(i), instance_outputs);
+    }
+
+    if (unscaling_layer_pointer) {
+      instance_outputs =
+          unscaling_layer_pointer->calculate_outputs(instance_outputs);
+    }
+
+    if (probabilistic_layer_pointer) {
+      instance_outputs =
+          probabilistic_layer_pointer->calculate_outputs(instance_outputs);
+    }
+
+    if (bounding_layer_pointer) {
+      instance_outputs =
+          bounding_layer_pointer->calculate_outputs(instance_outputs);
+    }
+
+    outputs.set_row(i, instance_outputs);
   }
 
-  return (output_data);
+  return (outputs);
+}
+
+// Matrix<double> calculate_output_data(const Matrix<double>&) const method
+
+/// Calculates a set of outputs from the neural network in response to a set of
+/// inputs.
+/// The format is a matrix, where each row contains the output for a single
+/// input.
+/// @param input_data Matrix of inputs to the neural network.
+
+Matrix<double> NeuralNetwork::calculate_output_data(
+    const Matrix<double>& input_data) const {
+  return (calculate_outputs(input_data));
 }
 
 // Matrix<double> calculate_Jacobian(const Vector<double>&) const method
@@ -2438,6 +2493,132 @@ Vector<Matrix<double> > NeuralNetwork::calculate_Jacobian_data(
   return (Jacobian_data);
 }
 
+// InferencePlan compile_inference_plan(void) const method
+
+/// Returns a frozen inference plan of this neural network, with all its
+/// parameters in a single block and the scaling and unscaling folded into the
+/// multilayer perceptron where possible.
+/// The plan calculates the same outputs as calculate_outputs, up to rounding
+/// errors, without allocating memory.
+/// Serving the neural network from several threads is done by compiling a
+/// plan once and evaluating it from every thread, each one with its own
+/// workspace.
+/// It must be compiled again after the neural network changes.
+
+InferencePlan NeuralNetwork::compile_inference_plan(void) const {
+  return (InferencePlan(*this));
+}
+
+// QuantizedMultilayerPerceptron quantize_multilayer_perceptron(
+// const Matrix<double>&) const method
+
+/// Returns the multilayer perceptron of this neural network with its synaptic
+/// weights quantized to 8 bit integers.
+/// The inputs are scaled with the scaling layer before being used to calibrate
+/// the scales of the layer inputs.
+/// @param calibration_input_data Matrix of inputs to the neural network, with
+/// one representative instance per row.
+
+QuantizedMultilayerPerceptron NeuralNetwork::quantize_multilayer_perceptron(
+    const Matrix<double>& calibration_input_data) const {
+  if (!multilayer_perceptron_pointer) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: NeuralNetwork class.\n"
+           << "QuantizedMultilayerPerceptron quantize_multilayer_perceptron("
+              "const Matrix<double>&) const method.\n"
+           << "Pointer to multilayer perceptron is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  Matrix<double> scaled_calibration_input_data(calibration_input_data);
+
+  if (scaling_layer_pointer) {
+    const unsigned instances_number = calibration_input_data.get_rows_number();
+
+    for (unsigned i = 0; i < instances_number; i++) {
+      scaled_calibration_input_data.set_row(
+          i, scaling_layer_pointer->calculate_outputs(
+                 calibration_input_data.arrange_row(i)));
+    }
+  }
+
+  return (QuantizedMultilayerPerceptron(*multilayer_perceptron_pointer,
+                                        scaled_calibration_input_data));
+}
+
+// Matrix<double> calculate_quantized_outputs(
+// const QuantizedMultilayerPerceptron&, const Matrix<double>&) const method
+
+/// Calculates the outputs from the neural network for a block of instances,
+/// with a quantized multilayer perceptron in place of its own one.
+/// The rest of layers are applied as in calculate_outputs.
+/// @param quantized_multilayer_perceptron Quantized multilayer perceptron, as
+/// returned by quantize_multilayer_perceptron.
+/// @param inputs Matrix of inputs to the neural network, with one instance per
+/// row.
+
+Matrix<double> NeuralNetwork::calculate_quantized_outputs(
+    const QuantizedMultilayerPerceptron& quantized_multilayer_perceptron,
+    const Matrix<double>& inputs) const {
+  const unsigned instances_number = inputs.get_rows_number();
+
+  Matrix<double> scaled_inputs(inputs);
+
+  // Scaling layer
+
+  if (scaling_layer_pointer) {
+    for (unsigned i = 0; i < instances_number; i++) {
+      scaled_inputs.set_row(
+          i, scaling_layer_pointer->calculate_outputs(inputs.arrange_row(i)));
+    }
+  }
+
+  // Quantized multilayer perceptron
+
+  Matrix<double> outputs;
+
+  quantized_multilayer_perceptron.calculate_outputs(scaled_inputs, outputs);
+
+  if (!conditions_layer_pointer && !unscaling_layer_pointer &&
+      !probabilistic_layer_pointer && !bounding_layer_pointer) {
+    return (outputs);
+  }
+
+  // Conditions, unscaling, probabilistic and bounding layers
+
+  Vector<double> instance_outputs;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    instance_outputs = outputs.arrange_row(i);
+
+    if (conditions_layer_pointer) {
+      instance_outputs = conditions_layer_pointer->calculate_outputs(
+          inputs.arrange_row(i), instance_outputs);
+    }
+
+    if (unscaling_layer_pointer) {
+      instance_outputs =
+          unscaling_layer_pointer->calculate_outputs(instance_outputs);
+    }
+
+    if (probabilistic_layer_pointer) {
+      instance_outputs =
+          probabilistic_layer_pointer->calculate_outputs(instance_outputs);
+    }
+
+    if (bounding_layer_pointer) {
+      instance_outputs =
+          bounding_layer_pointer->calculate_outputs(instance_outputs);
+    }
+
+    outputs.set_row(i, instance_outputs);
+  }
+
+  return (outputs);
+}
+
 // Matrix<double> calculate_Jacobian(const Vector<double>&, const
 // Vector<double>&) const method
 
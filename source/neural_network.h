@@ -47,6 +47,8 @@
 #include "independent_parameters.h"
 #include "inputs.h"
 #include "outputs.h"
+#include "inference_plan.h"
+#include "quantized_multilayer_perceptron.h"
 
 // TinyXml includes#include
 
@@ -276,9 +278,21 @@ class NeuralNetwork {
   Vector<Matrix<double> > calculate_Hessian_form(const Vector<double>&,
                                                  const Vector<double>&) const;
 
+  Matrix<double> calculate_outputs(const Matrix<double>&) const;
+
   Matrix<double> calculate_output_data(const Matrix<double>&) const;
   Vector<Matrix<double> > calculate_Jacobian_data(const Matrix<double>&) const;
 
+  InferencePlan compile_inference_plan(void) const;
+
+  // Quantized output
+
+  QuantizedMultilayerPerceptron quantize_multilayer_perceptron(
+      const Matrix<double>&) const;
+
+  Matrix<double> calculate_quantized_outputs(
+      const QuantizedMultilayerPerceptron&, const Matrix<double>&) const;
+
   // Serialization methods
 
   std::string to_string(void) const;
@@ -103,6 +103,49 @@ double NormalizedSquaredError::calculate_normalization_coefficient(
   return (target_data.calculate_sum_squared_error(target_data_mean));
 }
 
+// double calculate_training_normalization_coefficient(void) const method
+
+/// Returns the sum squared error between the training targets and their mean.
+/// It throws an exception if that coefficient is zero.
+
+double NormalizedSquaredError::calculate_training_normalization_coefficient(
+    void) const {
+  const Instances& instances = data_set_pointer->get_instances();
+
+  const unsigned training_instances_number =
+      instances.count_training_instances_number();
+
+  const unsigned targets_number =
+      data_set_pointer->get_variables().count_targets_number();
+
+  const Vector<double> training_target_data_mean =
+      data_set_pointer->calculate_training_target_data_mean();
+
+  Vector<double> targets(targets_number);
+
+  double normalization_coefficient = 0.0;
+
+  for (unsigned i = 0; i < training_instances_number; i++) {
+    data_set_pointer->get_training_target_instance(i, targets);
+
+    normalization_coefficient +=
+        targets.calculate_sum_squared_error(training_target_data_mean);
+  }
+
+  if (normalization_coefficient < 1.0e-99) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
+           << "double calculate_training_normalization_coefficient(void) "
+              "const method.\n"
+           << "Normalization coefficient is zero.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  return (normalization_coefficient);
+}
+
 // void check(void) const method
 
 /// Checks that there are a neural network and a data set associated to the
@@ -202,7 +245,7 @@ void NormalizedSquaredError::check(void) const {
 /// normalized squared error on a data set.
 
 double NormalizedSquaredError::calculate_performance(void) const {
-// Control sentence
+// Control sentence (if debug)
 
 #ifndef NDEBUG
 
@@ -210,69 +253,8 @@ double NormalizedSquaredError::calculate_performance(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  // Data set stuff
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  const Vector<double> training_target_data_mean =
-      data_set_pointer->calculate_training_target_data_mean();
-
-  // Normalized squared error stuff
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
-
-  double sum_squared_error = 0.0;
-  double normalization_coefficient = 0.0;
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    // Output vector
-
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    // Target vector
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    // Sum squared error
-
-    sum_squared_error += outputs.calculate_sum_squared_error(targets);
-
-    // Normalization coefficient
-
-    normalization_coefficient +=
-        targets.calculate_sum_squared_error(training_target_data_mean);
-  }
-
-  if (normalization_coefficient < 1.0e-99) {
-    std::ostringstream buffer;
-
-    buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
-           << "double calculate_performance(void) const method.\n"
-           << "Normalization coefficient is zero.\n";
-
-    throw std::logic_error(buffer.str());
-  }
-
-  return (sum_squared_error / normalization_coefficient);
+  return (calculate_training_error() /
+          calculate_training_normalization_coefficient());
 }
 
 // double calculate_performance(const Vector<double>&) const method
@@ -345,7 +327,7 @@ double NormalizedSquaredError::calculate_performance(
   for (unsigned i = 0; i < training_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
     // Output vector
 
@@ -354,7 +336,7 @@ double NormalizedSquaredError::calculate_performance(
 
     // Target vector
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     // Sum squared error
 
@@ -380,6 +362,30 @@ double NormalizedSquaredError::calculate_performance(
   return (sum_squared_error / normalization_coefficient);
 }
 
+// Vector<double> calculate_performances(const Vector< Vector<double> >&) const
+// method
+
+/// Returns which would be the normalized squared error performances of a
+/// neural network for several hypothetical vectors of parameters.
+/// All the vectors are evaluated in a single pass over the training instances,
+/// and the errors are then divided by the normalization coefficient.
+/// @param parameters Vectors of potential parameters for the neural network
+/// associated to the performance term.
+
+Vector<double> NormalizedSquaredError::calculate_performances(
+    const Vector<Vector<double> >& parameters) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  return (calculate_training_errors(parameters) /
+          calculate_training_normalization_coefficient());
+}
+
 // double calculate_generalization_performance(void) const method
 
 double NormalizedSquaredError::calculate_generalization_performance(
@@ -424,7 +430,7 @@ double NormalizedSquaredError::calculate_generalization_performance(
   for (unsigned i = 0; i < generalization_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_generalization_input_instance(i);
+    data_set_pointer->get_generalization_input_instance(i, inputs);
 
     // Output vector
 
@@ -432,7 +438,7 @@ double NormalizedSquaredError::calculate_generalization_performance(
 
     // Target vector
 
-    targets = data_set_pointer->get_generalization_target_instance(i);
+    data_set_pointer->get_generalization_target_instance(i, targets);
 
     // Sum squared error
 
@@ -473,129 +479,88 @@ Vector<double> NormalizedSquaredError::calculate_gradient(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const unsigned parameters_number =
-      neural_network_pointer->count_parameters_number();
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
-
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
-
-  Vector<Vector<double> > layers_inputs(layers_number);
-
-  Vector<Matrix<double> > layers_combination_parameters_Jacobian;
-
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
-
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
-
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
-
-  // Data set stuff
+  return (calculate_training_gradient() /
+          calculate_training_normalization_coefficient());
+}
 
-  const Instances& instances = data_set_pointer->get_instances();
+// FirstOrderPerformance calculate_first_order_performance(void) const method
 
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
+/// Returns the normalized squared error and its gradient, which are calculated
+/// with a single forward and backward propagation of the training instances.
 
-  const Vector<double> training_target_data_mean =
-      data_set_pointer->calculate_training_target_data_mean();
+PerformanceTerm::FirstOrderPerformance
+NormalizedSquaredError::calculate_first_order_performance(void) const {
+// Control sentence (if debug)
 
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
+#ifndef NDEBUG
 
-  // Normalized squared error stuff
+  check();
 
-  Vector<double> output_objective_gradient(outputs_number);
+#endif
 
-  Vector<Vector<double> > layers_delta;
+  const double normalization_coefficient =
+      calculate_training_normalization_coefficient();
 
-  Vector<double> gradient(parameters_number, 0.0);
+  FirstOrderPerformance first_order_performance;
 
-  double normalization_coefficient = 0.0;
+  calculate_training_error_gradient(first_order_performance.performance,
+                                    first_order_performance.gradient);
 
-  // Main loop
+  first_order_performance.performance /= normalization_coefficient;
+  first_order_performance.gradient /= normalization_coefficient;
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Data set
+  return (first_order_performance);
+}
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+// void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+// Matrix<double>&) const method
 
-    targets = data_set_pointer->get_training_target_instance(i);
+/// Calculates the derivatives of the squared errors with respect to the outputs
+/// of the neural network, for a block of instances.
+/// The normalization is applied by the calculate_gradient method.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param output_gradient Matrix to store the outputs gradient.
 
-    // Multilayer perceptron
+void NormalizedSquaredError::calculate_output_gradient(
+    const Matrix<double>& outputs, const Matrix<double>& targets,
+    Matrix<double>& output_gradient) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
+  output_gradient.set(instances_number, outputs_number);
 
-    layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(
-        inputs, layers_activation);
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_gradient[i][j] = (outputs[i][j] - targets[i][j]) * 2.0;
+    }
+  }
+}
 
-    layers_combination_parameters_Jacobian = multilayer_perceptron_pointer
-        ->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+// double calculate_outputs_error(const Matrix<double>&, const Matrix<double>&)
+// const method
 
-    // Performance functional
+/// Returns the sum squared error between a block of outputs and targets.
+/// The normalization is applied by the calculate_performance method.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-    if (!has_conditions_layer) {
-      output_objective_gradient =
-          (layers_activation[layers_number - 1] - targets) * 2.0;
+double NormalizedSquaredError::calculate_outputs_error(
+    const Matrix<double>& outputs, const Matrix<double>& targets) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            output_objective_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+  double sum_squared_error = 0.0;
 
-      output_objective_gradient =
-          (particular_solution +
-           homogeneous_solution * layers_activation[layers_number - 1] -
-           targets) *
-          2.0;
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      const double error = outputs[i][j] - targets[i][j];
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            homogeneous_solution,
-                                            output_objective_gradient);
+      sum_squared_error += error * error;
     }
-
-    normalization_coefficient +=
-        targets.calculate_sum_squared_error(training_target_data_mean);
-
-    gradient += calculate_point_gradient(layers_combination_parameters_Jacobian,
-                                         layers_delta);
   }
 
-  if (normalization_coefficient < 1.0e-99) {
-    std::ostringstream buffer;
-
-    buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
-           << "Vector<double> calculate_gradient(void) const method.\n"
-           << "Normalization coefficient is zero.\n";
-
-    throw std::logic_error(buffer.str());
-  }
-
-  return (gradient / normalization_coefficient);
+  return (sum_squared_error);
 }
 
 // Matrix<double> calculate_Hessian(void) const method
@@ -611,85 +576,73 @@ Matrix<double> NormalizedSquaredError::calculate_Hessian(void) const {
   return (Hessian);
 }
 
-// Vector<double> calculate_terms(void) const method
+// void calculate_output_vector_dot_Hessian(const Matrix<double>&, const
+// Matrix<double>&, const Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates, for a block of instances, the product of the second derivatives
+/// of the squared errors with respect to the outputs of the neural network and
+/// a given direction of the outputs, which is twice that direction.
+/// The normalization is applied by the calculate_vector_dot_Hessian method.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param outputs_direction Direction of the outputs, with one instance per
+/// row.
+/// @param output_product Matrix to store the outputs Hessian product.
+
+void NormalizedSquaredError::calculate_output_vector_dot_Hessian(
+    const Matrix<double>& outputs, const Matrix<double>&,
+    const Matrix<double>& outputs_direction,
+    Matrix<double>& output_product) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
+
+  output_product.set(instances_number, outputs_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_product[i][j] = outputs_direction[i][j] * 2.0;
+    }
+  }
+}
 
-/// Returns performance vector of the objective terms function for the
-/// normalized squared error.
-/// It uses the error back-propagation method.
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const
+// method
 
-Vector<double> NormalizedSquaredError::calculate_terms(void) const {
-// Control sentence (if debug)
+/// Returns the exact product of the normalized squared error Hessian and a
+/// vector of parameters, which is calculated with the R-operator without
+/// forming the Hessian matrix.
+/// It is normalized with the same coefficient as the gradient.
+/// @param vector Vector of multilayer perceptron parameters in the product.
 
+Vector<double> NormalizedSquaredError::calculate_vector_dot_Hessian(
+    const Vector<double>& vector) const {
 #ifndef NDEBUG
 
   check();
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  // Data set stuff
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  const Vector<double> training_target_data_mean =
-      data_set_pointer->calculate_training_target_data_mean();
-
-  // Calculate
-
-  Vector<double> performance_terms(training_instances_number);
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
-
-  double normalization_coefficient = 0.0;
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    // Output vector
-
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    // Target vector
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    // Sum squared error
+  return (calculate_training_vector_dot_Hessian(vector) /
+          calculate_training_normalization_coefficient());
+}
 
-    performance_terms[i] = outputs.calculate_distance(targets);
+// Vector<double> calculate_terms(void) const method
 
-    // Normalization coefficient
+/// Returns performance vector of the objective terms function for the
+/// normalized squared error.
+/// It uses the error back-propagation method.
 
-    normalization_coefficient +=
-        targets.calculate_sum_squared_error(training_target_data_mean);
-  }
+Vector<double> NormalizedSquaredError::calculate_terms(void) const {
+// Control sentence (if debug)
 
-  if (normalization_coefficient < 1.0e-99) {
-    std::ostringstream buffer;
+#ifndef NDEBUG
 
-    buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
-           << "Vector<double> calculate_terms(void) const method.\n"
-           << "Normalization coefficient is zero.\n";
+  check();
 
-    throw std::logic_error(buffer.str());
-  }
+#endif
 
-  return (performance_terms / sqrt(normalization_coefficient));
+  return (calculate_training_terms() /
+          sqrt(calculate_training_normalization_coefficient()));
 }
 
 // Vector<double> calculate_terms(const Vector<double>&) const method
@@ -758,7 +711,7 @@ Vector<double> NormalizedSquaredError::calculate_terms(
 /// algorithm.
 
 Matrix<double> NormalizedSquaredError::calculate_terms_Jacobian(void) const {
-// Control sentence
+// Control sentence (if debug)
 
 #ifndef NDEBUG
 
@@ -766,172 +719,114 @@ Matrix<double> NormalizedSquaredError::calculate_terms_Jacobian(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
-
-  const unsigned parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
-
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
-
-  Vector<Matrix<double> > layers_combination_parameters_Jacobian;
-
-  Vector<Vector<double> > layers_inputs(layers_number);
-
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
-
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
-
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
-
-  // Data set stuff
-
-  // Normalized squared error
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  const Vector<double> training_target_data_mean =
-      data_set_pointer->calculate_training_target_data_mean();
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
-
-  // Normalized squared error
-
-  Vector<double> term(outputs_number);
-  double term_norm;
-
-  Vector<double> output_objective_gradient(outputs_number);
-
-  Vector<Vector<double> > layers_delta(layers_number);
-  Vector<double> point_gradient(parameters_number);
+  return (calculate_training_terms_Jacobian() /
+          sqrt(calculate_training_normalization_coefficient()));
+}
 
-  Matrix<double> terms_Jacobian(training_instances_number, parameters_number);
+// FirstOrderTerms calculate_first_order_terms(void) method
 
-  double normalization_coefficient = 0.0;
+/// Returns a first order objective terms performance structure, which contains
+/// the values and the Jacobian of the objective terms function.
+/// Both are calculated with a single forward and backward propagation of the
+/// training instances.
 
-  // Main loop
+PerformanceTerm::FirstOrderTerms
+NormalizedSquaredError::calculate_first_order_terms(void) const {
+// Control sentence (if debug)
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
+#ifndef NDEBUG
 
-    // Data set
+  check();
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+#endif
 
-    targets = data_set_pointer->get_training_target_instance(i);
+  const double scaling =
+      1.0 / sqrt(calculate_training_normalization_coefficient());
 
-    // Neural network
+  FirstOrderTerms first_order_terms;
 
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
+  calculate_training_terms_Jacobian(first_order_terms.terms,
+                                    first_order_terms.Jacobian);
 
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
+  first_order_terms.terms *= scaling;
+  first_order_terms.Jacobian *= scaling;
 
-    layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(
-        inputs, layers_activation);
+  return (first_order_terms);
+}
 
-    layers_combination_parameters_Jacobian = multilayer_perceptron_pointer
-        ->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+// TermsJacobianProducts calculate_terms_Jacobian_products(void) const method
 
-    // Performance functional
+/// Returns the normalized squared error and the products of the transposed
+/// terms Jacobian with the terms and with itself.
+/// They are accumulated over the training instances without forming the
+/// terms Jacobian, and then divided by the normalization coefficient.
 
-    if (!has_conditions_layer)  // No conditions
-        {
-      const Vector<double>& outputs = layers_activation[layers_number - 1];
+PerformanceTerm::TermsJacobianProducts
+NormalizedSquaredError::calculate_terms_Jacobian_products(void) const {
+// Control sentence (if debug)
 
-      term = outputs - targets;
-      term_norm = term.calculate_norm();
+#ifndef NDEBUG
 
-      if (term_norm == 0.0) {
-        output_objective_gradient.initialize(0.0);
-      } else {
-        output_objective_gradient = term / term_norm;
-      }
+  check();
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            output_objective_gradient);
-    } else  // Conditions
-        {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+#endif
 
-      const Vector<double>& output_layer_activation =
-          layers_activation[layers_number - 1];
+  const double scaling = 1.0 / calculate_training_normalization_coefficient();
 
-      term = (particular_solution +
-              homogeneous_solution * output_layer_activation - targets);
-      term_norm = term.calculate_norm();
+  TermsJacobianProducts terms_Jacobian_products =
+      calculate_training_terms_Jacobian_products();
 
-      if (term_norm == 0.0) {
-        output_objective_gradient.initialize(0.0);
-      } else {
-        output_objective_gradient = term / term_norm;
-      }
+  terms_Jacobian_products.terms_squared_sum *= scaling;
+  terms_Jacobian_products.JacobianT_dot_terms *= scaling;
+  terms_Jacobian_products.JacobianT_dot_Jacobian *= scaling;
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            homogeneous_solution,
-                                            output_objective_gradient);
-    }
+  return (terms_Jacobian_products);
+}
 
-    normalization_coefficient +=
-        targets.calculate_sum_squared_error(training_target_data_mean);
+// Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(const
+// Vector<double>&) const method
 
-    point_gradient = calculate_point_gradient(
-        layers_combination_parameters_Jacobian, layers_delta);
+/// Returns the product of the transposed terms Jacobian, the terms Jacobian
+/// and a vector of parameters, which is the product of the Gauss-Newton
+/// approximation of the normalized squared error Hessian and the vector.
+/// It is calculated over the training instances without forming the terms
+/// Jacobian, and then divided by the normalization coefficient.
+/// @param vector Vector of multilayer perceptron parameters in the product.
 
-    terms_Jacobian.set_row(i, point_gradient);
-  }
+Vector<double>
+NormalizedSquaredError::calculate_JacobianT_dot_Jacobian_dot_vector(
+    const Vector<double>& vector) const {
+// Control sentence (if debug)
 
-  if (normalization_coefficient < 1.0e-99) {
-    std::ostringstream buffer;
+#ifndef NDEBUG
 
-    buffer << "OpenNN Exception: NormalizedSquaredError class.\n"
-           << "Matrix<double> calculate_terms_Jacobian(void) const method.\n"
-           << "Normalization coefficient is zero.\n";
+  check();
 
-    throw std::logic_error(buffer.str());
-  }
+#endif
 
-  return (terms_Jacobian / sqrt(normalization_coefficient));
+  return (calculate_training_JacobianT_dot_Jacobian_dot_vector(vector) /
+          calculate_training_normalization_coefficient());
 }
 
-// FirstOrderTerms calculate_first_order_terms(void) method
+// Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const method
 
-/// Returns a first order objective terms performance structure, which contains
-/// the values and the Jacobian of the objective terms function.
-/// @todo
+/// Returns the diagonal of the product of the transposed terms Jacobian and
+/// the terms Jacobian.
+/// It is calculated over the training instances without forming the terms
+/// Jacobian, and then divided by the normalization coefficient.
 
-NormalizedSquaredError::FirstOrderTerms
-NormalizedSquaredError::calculate_first_order_terms(void) {
-  FirstOrderTerms first_order_terms;
+Vector<double>
+NormalizedSquaredError::calculate_JacobianT_dot_Jacobian_diagonal(void) const {
+// Control sentence (if debug)
 
-  first_order_terms.terms = calculate_terms();
+#ifndef NDEBUG
 
-  first_order_terms.Jacobian = calculate_terms_Jacobian();
+  check();
 
-  return (first_order_terms);
+#endif
+
+  return (calculate_training_JacobianT_dot_Jacobian_diagonal() /
+          calculate_training_normalization_coefficient());
 }
 
 // Vector<double> calculate_squared_errors(void) const method
@@ -975,7 +870,7 @@ Vector<double> NormalizedSquaredError::calculate_squared_errors(void) const {
   for (unsigned i = 0; i < training_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
     // Output vector
 
@@ -983,7 +878,7 @@ Vector<double> NormalizedSquaredError::calculate_squared_errors(void) const {
 
     // Target vector
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     // Error
 
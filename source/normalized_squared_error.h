@@ -88,6 +88,8 @@ class NormalizedSquaredError : public PerformanceTerm {
   double calculate_normalization_coefficient(const Matrix<double>&,
                                              const Vector<double>&) const;
 
+  double calculate_training_normalization_coefficient(void) const;
+
   // Checking methods
 
   void check(void) const;
@@ -96,10 +98,27 @@ class NormalizedSquaredError : public PerformanceTerm {
 
   double calculate_performance(void) const;
   Vector<double> calculate_gradient(void) const;
+
+  FirstOrderPerformance calculate_first_order_performance(void) const;
+
+  void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+                                 Matrix<double>&) const;
+
+  void calculate_output_vector_dot_Hessian(const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           Matrix<double>&) const;
+
+  double calculate_outputs_error(const Matrix<double>&,
+                                 const Matrix<double>&) const;
   Matrix<double> calculate_Hessian(void) const;
 
+  Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
   double calculate_performance(const Vector<double>&) const;
 
+  Vector<double> calculate_performances(const Vector<Vector<double> >&) const;
+
   double calculate_generalization_performance(void) const;
 
   // Objective terms methods
@@ -109,7 +128,14 @@ class NormalizedSquaredError : public PerformanceTerm {
 
   Matrix<double> calculate_terms_Jacobian(void) const;
 
-  PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void);
+  PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const;
+
+  PerformanceTerm::TermsJacobianProducts calculate_terms_Jacobian_products(
+      void) const;
+
+  Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(
+      const Vector<double>&) const;
+  Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const;
 
   // Squared errors methods
 
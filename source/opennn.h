@@ -50,6 +50,8 @@
 #include "scaling_layer.h"
 #include "unscaling_layer.h"
 #include "neural_network.h"
+#include "inference_plan.h"
+#include "quantized_multilayer_perceptron.h"
 
 // Performance functional
 
@@ -85,6 +87,7 @@
 #include "random_search.h"
 #include "training_algorithm.h"
 #include "training_rate_algorithm.h"
+#include "truncated_newton_method.h"
 
 // Utilities
 
@@ -873,6 +873,336 @@ double Perceptron::calculate_activation_second_derivative(
   }
 }
 
+// template <class Activation, class Type> void apply_activation(const Type*,
+// Type*, const unsigned&) method
+
+/// Calculates the activations for a buffer of combinations, with the
+/// activation function given as a type.
+/// The activations are always evaluated in double precision, and then stored
+/// in the type of the buffers.
+/// @param combinations Buffer of combinations.
+/// @param activations Buffer to store the activations.
+/// @param size Number of elements in the buffers.
+
+template <class Activation, class Type>
+void Perceptron::apply_activation(const Type* combinations, Type* activations,
+                                  const unsigned& size) {
+#pragma omp simd
+  for (unsigned i = 0; i < size; i++) {
+    activations[i] = Activation::calculate(combinations[i]);
+  }
+}
+
+// template <class Activation> void apply_activation_derivative(const double*,
+// double*, const unsigned&) method
+
+/// Calculates the activation derivatives for a buffer of combinations, with
+/// the activation function given as a type.
+/// @param combinations Buffer of combinations.
+/// @param activations_derivatives Buffer to store the activation derivatives.
+/// @param size Number of elements in the buffers.
+
+template <class Activation>
+void Perceptron::apply_activation_derivative(const double* combinations,
+                                             double* activations_derivatives,
+                                             const unsigned& size) {
+#pragma omp simd
+  for (unsigned i = 0; i < size; i++) {
+    activations_derivatives[i] =
+        Activation::calculate_derivative(combinations[i]);
+  }
+}
+
+// template <class Activation> void apply_activation_second_derivative(const
+// double*, double*, const unsigned&) method
+
+/// Calculates the activation second derivatives for a buffer of
+/// combinations, with the activation function given as a type.
+/// @param combinations Buffer of combinations.
+/// @param activations_second_derivatives Buffer to store the activation
+/// second derivatives.
+/// @param size Number of elements in the buffers.
+
+template <class Activation>
+void Perceptron::apply_activation_second_derivative(
+    const double* combinations, double* activations_second_derivatives,
+    const unsigned& size) {
+#pragma omp simd
+  for (unsigned i = 0; i < size; i++) {
+    activations_second_derivatives[i] =
+        Activation::calculate_second_derivative(combinations[i]);
+  }
+}
+
+// void calculate_activations(const ActivationFunction&, const
+// ActivationAccuracy&, const double*, double*, const unsigned&) method
+
+/// Calculates the activations for a buffer of combinations.
+/// The activation function is selected once for the whole buffer, so that
+/// the loop over the elements can be vectorized by the compiler.
+/// The activations buffer might be the same as the combinations buffer.
+/// @param activation_function Activation function to be applied.
+/// @param activation_accuracy Exact or fast evaluation of the exponentials.
+/// @param combinations Buffer of combinations.
+/// @param activations Buffer to store the activations.
+/// @param size Number of elements in the buffers.
+
+void Perceptron::calculate_activations(
+    const ActivationFunction& activation_function,
+    const ActivationAccuracy& activation_accuracy, const double* combinations,
+    double* activations, const unsigned& size) {
+  calculate_activations_kernel(activation_function, activation_accuracy,
+                               combinations, activations, size);
+}
+
+// void calculate_activations(const ActivationFunction&, const
+// ActivationAccuracy&, const float*, float*, const unsigned&) method
+
+/// Calculates the activations for a buffer of combinations in single
+/// precision.
+/// Each activation is evaluated in double precision and rounded to single
+/// precision when it is stored.
+/// The activations buffer might be the same as the combinations buffer.
+/// @param activation_function Activation function to be applied.
+/// @param activation_accuracy Exact or fast evaluation of the exponentials.
+/// @param combinations Buffer of combinations.
+/// @param activations Buffer to store the activations.
+/// @param size Number of elements in the buffers.
+
+void Perceptron::calculate_activations(
+    const ActivationFunction& activation_function,
+    const ActivationAccuracy& activation_accuracy, const float* combinations,
+    float* activations, const unsigned& size) {
+  calculate_activations_kernel(activation_function, activation_accuracy,
+                               combinations, activations, size);
+}
+
+// template <class Type> void calculate_activations_kernel(const
+// ActivationFunction&, const ActivationAccuracy&, const Type*, Type*, const
+// unsigned&) method
+
+/// Calculates the activations for a buffer of combinations of any floating
+/// point type.
+/// It selects the activation function once for the whole buffer.
+/// @param activation_function Activation function to be applied.
+/// @param activation_accuracy Exact or fast evaluation of the exponentials.
+/// @param combinations Buffer of combinations.
+/// @param activations Buffer to store the activations.
+/// @param size Number of elements in the buffers.
+
+template <class Type>
+void Perceptron::calculate_activations_kernel(
+    const ActivationFunction& activation_function,
+    const ActivationAccuracy& activation_accuracy, const Type* combinations,
+    Type* activations, const unsigned& size) {
+  switch (activation_function) {
+    case Perceptron::Logistic: {
+      if (activation_accuracy == Perceptron::Fast) {
+        apply_activation<LogisticActivation<Perceptron::Fast> >(
+            combinations, activations, size);
+      } else {
+        apply_activation<LogisticActivation<Perceptron::Exact> >(
+            combinations, activations, size);
+      }
+    } break;
+
+    case Perceptron::HyperbolicTangent: {
+      if (activation_accuracy == Perceptron::Fast) {
+        apply_activation<HyperbolicTangentActivation<Perceptron::Fast> >(
+            combinations, activations, size);
+      } else {
+        apply_activation<HyperbolicTangentActivation<Perceptron::Exact> >(
+            combinations, activations, size);
+      }
+    } break;
+
+    case Perceptron::Threshold: {
+      apply_activation<ThresholdActivation>(combinations, activations, size);
+    } break;
+
+    case Perceptron::SymmetricThreshold: {
+      apply_activation<SymmetricThresholdActivation>(combinations, activations,
+                                                     size);
+    } break;
+
+    case Perceptron::Linear: {
+      if (activations != combinations) {
+        apply_activation<LinearActivation>(combinations, activations, size);
+      }
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Perceptron class.\n"
+             << "template <class Type> void calculate_activations_kernel("
+                "const ActivationFunction&, const ActivationAccuracy&, const "
+                "Type*, Type*, const unsigned&) method.\n"
+             << "Unknown activation function.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+}
+
+// void calculate_activations_derivatives(const ActivationFunction&, const
+// ActivationAccuracy&, const double*, double*, const unsigned&) method
+
+/// Calculates the activation derivatives for a buffer of combinations.
+/// In fast mode the derivatives are obtained from the activations themselves.
+/// The derivatives buffer might be the same as the combinations buffer.
+/// @param activation_function Activation function to be differentiated.
+/// @param activation_accuracy Exact or fast evaluation of the exponentials.
+/// @param combinations Buffer of combinations.
+/// @param activations_derivatives Buffer to store the activation derivatives.
+/// @param size Number of elements in the buffers.
+
+void Perceptron::calculate_activations_derivatives(
+    const ActivationFunction& activation_function,
+    const ActivationAccuracy& activation_accuracy, const double* combinations,
+    double* activations_derivatives, const unsigned& size) {
+  switch (activation_function) {
+    case Perceptron::Logistic: {
+      if (activation_accuracy == Perceptron::Fast) {
+        apply_activation_derivative<LogisticActivation<Perceptron::Fast> >(
+            combinations, activations_derivatives, size);
+      } else {
+        apply_activation_derivative<LogisticActivation<Perceptron::Exact> >(
+            combinations, activations_derivatives, size);
+      }
+    } break;
+
+    case Perceptron::HyperbolicTangent: {
+      if (activation_accuracy == Perceptron::Fast) {
+        apply_activation_derivative<
+            HyperbolicTangentActivation<Perceptron::Fast> >(
+            combinations, activations_derivatives, size);
+      } else {
+        apply_activation_derivative<
+            HyperbolicTangentActivation<Perceptron::Exact> >(
+            combinations, activations_derivatives, size);
+      }
+    } break;
+
+    case Perceptron::Threshold:
+    case Perceptron::SymmetricThreshold: {
+      for (unsigned i = 0; i < size; i++) {
+        if (combinations[i] == 0.0) {
+          std::ostringstream buffer;
+
+          buffer << "OpenNN Exception: Perceptron class.\n"
+                 << "void calculate_activations_derivatives(const "
+                    "ActivationFunction&, const ActivationAccuracy&, const "
+                    "double*, double*, const unsigned&) method.\n"
+                 << "Threshold activation functions are not derivable.\n";
+
+          throw std::logic_error(buffer.str());
+        }
+
+        activations_derivatives[i] = 0.0;
+      }
+    } break;
+
+    case Perceptron::Linear: {
+      apply_activation_derivative<LinearActivation>(
+          combinations, activations_derivatives, size);
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Perceptron class.\n"
+             << "void calculate_activations_derivatives(const "
+                "ActivationFunction&, const ActivationAccuracy&, const "
+                "double*, double*, const unsigned&) method.\n"
+             << "Unknown activation function.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+}
+
+// void calculate_activations_second_derivatives(const ActivationFunction&,
+// const ActivationAccuracy&, const double*, double*, const unsigned&) method
+
+/// Calculates the activation second derivatives for a buffer of combinations.
+/// In fast mode the second derivatives are obtained from the activations
+/// themselves.
+/// The second derivatives buffer might be the same as the combinations buffer.
+/// @param activation_function Activation function to be differentiated.
+/// @param activation_accuracy Exact or fast evaluation of the exponentials.
+/// @param combinations Buffer of combinations.
+/// @param activations_second_derivatives Buffer to store the activation second
+/// derivatives.
+/// @param size Number of elements in the buffers.
+
+void Perceptron::calculate_activations_second_derivatives(
+    const ActivationFunction& activation_function,
+    const ActivationAccuracy& activation_accuracy, const double* combinations,
+    double* activations_second_derivatives, const unsigned& size) {
+  switch (activation_function) {
+    case Perceptron::Logistic: {
+      if (activation_accuracy == Perceptron::Fast) {
+        apply_activation_second_derivative<
+            LogisticActivation<Perceptron::Fast> >(
+            combinations, activations_second_derivatives, size);
+      } else {
+        apply_activation_second_derivative<
+            LogisticActivation<Perceptron::Exact> >(
+            combinations, activations_second_derivatives, size);
+      }
+    } break;
+
+    case Perceptron::HyperbolicTangent: {
+      if (activation_accuracy == Perceptron::Fast) {
+        apply_activation_second_derivative<
+            HyperbolicTangentActivation<Perceptron::Fast> >(
+            combinations, activations_second_derivatives, size);
+      } else {
+        apply_activation_second_derivative<
+            HyperbolicTangentActivation<Perceptron::Exact> >(
+            combinations, activations_second_derivatives, size);
+      }
+    } break;
+
+    case Perceptron::Threshold:
+    case Perceptron::SymmetricThreshold: {
+      for (unsigned i = 0; i < size; i++) {
+        if (combinations[i] == 0.0) {
+          std::ostringstream buffer;
+
+          buffer << "OpenNN Exception: Perceptron class.\n"
+                 << "void calculate_activations_second_derivatives(const "
+                    "ActivationFunction&, const ActivationAccuracy&, const "
+                    "double*, double*, const unsigned&) method.\n"
+                 << "Threshold activation functions are not derivable.\n";
+
+          throw std::logic_error(buffer.str());
+        }
+
+        activations_second_derivatives[i] = 0.0;
+      }
+    } break;
+
+    case Perceptron::Linear: {
+      apply_activation_second_derivative<LinearActivation>(
+          combinations, activations_second_derivatives, size);
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: Perceptron class.\n"
+             << "void calculate_activations_second_derivatives(const "
+                "ActivationFunction&, const ActivationAccuracy&, const "
+                "double*, double*, const unsigned&) method.\n"
+             << "Unknown activation function.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+}
+
 // double calculate_output(const Vector<double>&) const method
 
 /// Returns the output from the neuron for a set of inputs signals.
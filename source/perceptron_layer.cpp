@@ -75,7 +75,21 @@ PerceptronLayer::~PerceptronLayer(void) {}
 PerceptronLayer& PerceptronLayer::operator=(
     const PerceptronLayer& other_perceptron_layer) {
   if (this != &other_perceptron_layer) {
-    perceptrons = other_perceptron_layer.perceptrons;
+    parameters = other_perceptron_layer.parameters;
+
+    inputs_number = other_perceptron_layer.inputs_number;
+    perceptrons_number = other_perceptron_layer.perceptrons_number;
+
+    activation_function = other_perceptron_layer.activation_function;
+    activation_accuracy = other_perceptron_layer.activation_accuracy;
+
+    outputs_kernel = other_perceptron_layer.outputs_kernel;
+    forward_propagation_kernel =
+        other_perceptron_layer.forward_propagation_kernel;
+    single_precision_outputs_kernel =
+        other_perceptron_layer.single_precision_outputs_kernel;
+    single_precision_forward_propagation_kernel =
+        other_perceptron_layer.single_precision_forward_propagation_kernel;
 
     display = other_perceptron_layer.display;
   }
@@ -95,7 +109,11 @@ PerceptronLayer& PerceptronLayer::operator=(
 
 bool PerceptronLayer::operator==(
     const PerceptronLayer& other_perceptron_layer) const {
-  if (perceptrons == other_perceptron_layer.perceptrons &&
+  if (inputs_number == other_perceptron_layer.inputs_number &&
+      perceptrons_number == other_perceptron_layer.perceptrons_number &&
+      parameters == other_perceptron_layer.parameters &&
+      activation_function == other_perceptron_layer.activation_function &&
+      activation_accuracy == other_perceptron_layer.activation_accuracy &&
       display == other_perceptron_layer.display) {
     return (true);
   } else {
@@ -110,19 +128,26 @@ bool PerceptronLayer::operator==(
 /// Returns true if the size of the layer is zero, and false otherwise.
 
 bool PerceptronLayer::is_empty(void) const {
-  if (perceptrons.empty()) {
+  if (perceptrons_number == 0) {
     return (true);
   } else {
     return (false);
   }
 }
 
-// const Vector<Perceptron>& get_perceptrons(void) const method
+// Vector<Perceptron> get_perceptrons(void) const method
 
-/// Returns a constant reference to the vector of perceptrons defining the
-/// layer.
+/// Returns the vector of perceptrons defining the layer.
+/// The perceptrons are built from the parameters and the activation function
+/// of the layer, so that modifying them does not modify the layer.
+
+Vector<Perceptron> PerceptronLayer::get_perceptrons(void) const {
+  Vector<Perceptron> perceptrons(perceptrons_number);
+
+  for (unsigned i = 0; i < perceptrons_number; i++) {
+    perceptrons[i] = get_perceptron(i);
+  }
 
-const Vector<Perceptron>& PerceptronLayer::get_perceptrons(void) const {
   return (perceptrons);
 }
 
@@ -131,11 +156,7 @@ const Vector<Perceptron>& PerceptronLayer::get_perceptrons(void) const {
 /// Returns the number of inputs to the layer.
 
 unsigned PerceptronLayer::get_inputs_number(void) const {
-  if (is_empty()) {
-    return (0);
-  } else {
-    return (perceptrons[0].get_inputs_number());
-  }
+  return (inputs_number);
 }
 
 // const unsigned& get_perceptrons_number(void) const
@@ -143,37 +164,44 @@ unsigned PerceptronLayer::get_inputs_number(void) const {
 /// Returns the size of the perceptrons vector.
 
 unsigned PerceptronLayer::get_perceptrons_number(void) const {
-  const unsigned& perceptrons_number = perceptrons.size();
-
   return (perceptrons_number);
 }
 
-// const Perceptron& get_perceptron(const unsigned&) const method
+// Perceptron get_perceptron(const unsigned&) const method
 
-/// Returns a reference to a given element in the perceptrons vector.
+/// Returns a perceptron with the bias, the synaptic weights and the activation
+/// function of a given neuron in the layer.
 /// @param index Index of perceptron element.
 
-const Perceptron& PerceptronLayer::get_perceptron(const unsigned& index) const {
+Perceptron PerceptronLayer::get_perceptron(const unsigned& index) const {
 // Control sentence (if debug)
 
 #ifndef NDEBUG
 
-  const unsigned perceptrons_number = get_perceptrons_number();
-
   if (index >= perceptrons_number) {
     std::ostringstream buffer;
 
-    buffer
-        << "OpenNN Exception: PerceptronLayer class.\n"
-        << "const Perceptron& get_perceptron(const unsigned&) const method.\n"
-        << "Index of perceptron must be less than layer size.\n";
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "Perceptron get_perceptron(const unsigned&) const method.\n"
+           << "Index of perceptron must be less than layer size.\n";
 
     throw std::logic_error(buffer.str());
   }
 
 #endif
 
-  return (perceptrons[index]);
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  Perceptron perceptron(inputs_number, 0.0);
+
+  perceptron.set_parameters(parameters.take_out(
+      index * perceptron_parameters_number, perceptron_parameters_number));
+
+  perceptron.set_activation_function(activation_function);
+
+  perceptron.set_display(display);
+
+  return (perceptron);
 }
 
 // unsigned count_parameters_number(void) const method
@@ -181,15 +209,7 @@ const Perceptron& PerceptronLayer::get_perceptron(const unsigned& index) const {
 /// Returns the number of parameters (biases and synaptic weights) of the layer.
 
 unsigned PerceptronLayer::count_parameters_number(void) const {
-  const unsigned perceptrons_number = get_perceptrons_number();
-
-  unsigned parameters_number = 0;
-
-  for (unsigned i = 0; i < perceptrons_number; i++) {
-    parameters_number += perceptrons[i].count_parameters_number();
-  }
-
-  return (parameters_number);
+  return (parameters.size());
 }
 
 // Vector<unsigned> count_cumulative_parameters_number(void) const method
@@ -200,18 +220,12 @@ unsigned PerceptronLayer::count_parameters_number(void) const {
 
 Vector<unsigned> PerceptronLayer::count_cumulative_parameters_number(
     void) const {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
 
   Vector<unsigned> cumulative_parameters_number(perceptrons_number);
 
-  if (perceptrons_number > 0) {
-    cumulative_parameters_number[0] = perceptrons[0].count_parameters_number();
-
-    for (unsigned i = 1; i < perceptrons_number; i++) {
-      cumulative_parameters_number[i] =
-          cumulative_parameters_number[i - 1] +
-          perceptrons[i].count_parameters_number();
-    }
+  for (unsigned i = 0; i < perceptrons_number; i++) {
+    cumulative_parameters_number[i] = (i + 1) * perceptron_parameters_number;
   }
 
   return (cumulative_parameters_number);
@@ -224,12 +238,12 @@ Vector<unsigned> PerceptronLayer::count_cumulative_parameters_number(
 /// The size of this vector is the number of neurons in the layer.
 
 Vector<double> PerceptronLayer::arrange_biases(void) const {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
 
   Vector<double> biases(perceptrons_number);
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    biases[i] = perceptrons[i].get_bias();
+    biases[i] = parameters[i * perceptron_parameters_number];
   }
 
   return (biases);
@@ -243,21 +257,29 @@ Vector<double> PerceptronLayer::arrange_biases(void) const {
 /// The number of columns is the number of inputs to the layer.
 
 Matrix<double> PerceptronLayer::arrange_synaptic_weights(void) const {
-  const unsigned perceptrons_number = get_perceptrons_number();
-
-  const unsigned inputs_number = get_inputs_number();
-
   Matrix<double> synaptic_weights(perceptrons_number, inputs_number);
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
+    const double* perceptron_synaptic_weights = get_synaptic_weights_pointer(i);
+
     for (unsigned j = 0; j < inputs_number; j++) {
-      synaptic_weights[i][j] = perceptrons[i].get_synaptic_weight(j);
+      synaptic_weights[i][j] = perceptron_synaptic_weights[j];
     }
   }
 
   return (synaptic_weights);
 }
 
+// const Vector<double>& get_parameters(void) const method
+
+/// Returns a constant reference to the vector with all the layer parameters,
+/// without copying them.
+/// The bias of each perceptron is followed by its synaptic weights.
+
+const Vector<double>& PerceptronLayer::get_parameters(void) const {
+  return (parameters);
+}
+
 // Vector<double> arrange_parameters(void) const method
 
 /// Returns a single vector with all the layer parameters.
@@ -265,32 +287,37 @@ Matrix<double> PerceptronLayer::arrange_synaptic_weights(void) const {
 /// The size is the number of parameters in the layer.
 
 Vector<double> PerceptronLayer::arrange_parameters(void) const {
-  const unsigned perceptrons_number = get_perceptrons_number();
-
-  if (perceptrons_number == 0) {
-    Vector<double> parameters;
+  return (parameters);
+}
 
-    return (parameters);
-  } else {
-    const unsigned parameters_number = count_parameters_number();
+// const double* get_synaptic_weights_pointer(const unsigned&) const method
 
-    Vector<double> parameters(parameters_number);
+/// Returns a pointer to the synaptic weights of a given perceptron in the
+/// layer.
+/// They are contiguous in memory, and remain valid until the architecture or
+/// the parameters of the layer are set again.
+/// @param index Index of perceptron.
 
-    const unsigned perceptron_parameters_number =
-        perceptrons[0].count_parameters_number();
+const double* PerceptronLayer::get_synaptic_weights_pointer(
+    const unsigned& index) const {
+// Control sentence (if debug)
 
-    Vector<double> perceptron_parameters(perceptron_parameters_number);
+#ifndef NDEBUG
 
-    unsigned position = 0;
+  if (index >= perceptrons_number) {
+    std::ostringstream buffer;
 
-    for (unsigned i = 0; i < perceptrons_number; i++) {
-      perceptron_parameters = perceptrons[i].arrange_parameters();
-      parameters.tuck_in(position, perceptron_parameters);
-      position += perceptron_parameters_number;
-    }
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "const double* get_synaptic_weights_pointer(const unsigned&) "
+              "const method.\n"
+           << "Index of perceptron must be less than layer size.\n";
 
-    return (parameters);
+    throw std::logic_error(buffer.str());
   }
+
+#endif
+
+  return (&parameters[0] + index * (1 + inputs_number) + 1);
 }
 
 // unsigned count_perceptron_parameters_number(void) const method
@@ -314,12 +341,13 @@ unsigned PerceptronLayer::count_perceptron_parameters_number(void) const {
 
 Vector<Vector<double> > PerceptronLayer::arrange_perceptrons_parameters(
     void) const {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
 
   Vector<Vector<double> > perceptrons_parameters(perceptrons_number);
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons_parameters[i] = perceptrons[i].arrange_parameters();
+    perceptrons_parameters[i] = parameters.take_out(
+        i * perceptron_parameters_number, perceptron_parameters_number);
   }
 
   return (perceptrons_parameters);
@@ -334,10 +362,8 @@ Vector<Vector<double> > PerceptronLayer::arrange_perceptrons_parameters(
 
 const Perceptron::ActivationFunction& PerceptronLayer::get_activation_function(
     void) const {
-  const unsigned perceptrons_number = get_perceptrons_number();
-
   if (perceptrons_number > 0) {
-    return (perceptrons[0].get_activation_function());
+    return (activation_function);
   } else {
     std::ostringstream buffer;
 
@@ -394,6 +420,19 @@ std::string PerceptronLayer::write_activation_function(void) const {
   }
 }
 
+// const Perceptron::ActivationAccuracy& get_activation_accuracy(void) const
+// method
+
+/// Returns the accuracy with which the activations of the layer are
+/// calculated.
+/// Exact mode uses the standard library exponential, and fast mode a
+/// polynomial approximation to it.
+
+const Perceptron::ActivationAccuracy&
+PerceptronLayer::get_activation_accuracy(void) const {
+  return (activation_accuracy);
+}
+
 // const bool& get_display(void) const method
 
 /// Returns true if messages from this class are to be displayed on the screen,
@@ -407,7 +446,12 @@ const bool& PerceptronLayer::get_display(void) const { return (display); }
 /// It also sets the rest of members to their default values.
 
 void PerceptronLayer::set(void) {
-  perceptrons.set();
+  parameters.set();
+
+  inputs_number = 0;
+  perceptrons_number = 0;
+
+  activation_function = Perceptron::HyperbolicTangent;
 
   set_default();
 }
@@ -418,7 +462,9 @@ void PerceptronLayer::set(void) {
 /// The rest of members of this class are given their defaul values.
 
 void PerceptronLayer::set(const Vector<Perceptron>& new_perceptrons) {
-  perceptrons = new_perceptrons;
+  activation_function = Perceptron::HyperbolicTangent;
+
+  set_perceptrons(new_perceptrons);
 
   set_default();
 }
@@ -432,12 +478,19 @@ void PerceptronLayer::set(const Vector<Perceptron>& new_perceptrons) {
 
 void PerceptronLayer::set(const unsigned& new_inputs_number,
                           const unsigned& new_perceptrons_number) {
-  perceptrons.set(new_perceptrons_number);
+  perceptrons_number = new_perceptrons_number;
 
-  for (unsigned i = 0; i < new_perceptrons_number; i++) {
-    perceptrons[i].set_inputs_number(new_inputs_number);
+  if (perceptrons_number == 0) {
+    inputs_number = 0;
+  } else {
+    inputs_number = new_inputs_number;
   }
 
+  parameters.set(perceptrons_number * (1 + inputs_number));
+  parameters.randomize_normal();
+
+  activation_function = Perceptron::HyperbolicTangent;
+
   set_default();
 }
 
@@ -448,7 +501,21 @@ void PerceptronLayer::set(const unsigned& new_inputs_number,
 /// @param other_perceptron_layer PerceptronLayer object to be copied.
 
 void PerceptronLayer::set(const PerceptronLayer& other_perceptron_layer) {
-  perceptrons = other_perceptron_layer.perceptrons;
+  parameters = other_perceptron_layer.parameters;
+
+  inputs_number = other_perceptron_layer.inputs_number;
+  perceptrons_number = other_perceptron_layer.perceptrons_number;
+
+  activation_function = other_perceptron_layer.activation_function;
+  activation_accuracy = other_perceptron_layer.activation_accuracy;
+
+  outputs_kernel = other_perceptron_layer.outputs_kernel;
+  forward_propagation_kernel =
+      other_perceptron_layer.forward_propagation_kernel;
+  single_precision_outputs_kernel =
+      other_perceptron_layer.single_precision_outputs_kernel;
+  single_precision_forward_propagation_kernel =
+      other_perceptron_layer.single_precision_forward_propagation_kernel;
 
   display = other_perceptron_layer.display;
 }
@@ -456,22 +523,91 @@ void PerceptronLayer::set(const PerceptronLayer& other_perceptron_layer) {
 // void set_perceptrons(const Vector<Perceptron>&) method
 
 /// Sets a new vector of percpetrons in the layer.
+/// All the perceptrons must have the same number of inputs.
+/// The activation function of the layer is that of the first perceptron.
 /// @param new_perceptrons Perceptrons vector.
 
 void PerceptronLayer::set_perceptrons(
     const Vector<Perceptron>& new_perceptrons) {
-  perceptrons = new_perceptrons;
+  perceptrons_number = new_perceptrons.size();
+
+  if (perceptrons_number == 0) {
+    inputs_number = 0;
+  } else {
+    inputs_number = new_perceptrons[0].get_inputs_number();
+
+    activation_function = new_perceptrons[0].get_activation_function();
+  }
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  for (unsigned i = 1; i < perceptrons_number; i++) {
+    if (new_perceptrons[i].get_inputs_number() != inputs_number) {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "void set_perceptrons(const Vector<Perceptron>&) method.\n"
+             << "All perceptrons must have the same number of inputs.\n";
+
+      throw std::logic_error(buffer.str());
+    }
+  }
+
+#endif
+
+  set_kernels();
+
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  parameters.set(perceptrons_number * perceptron_parameters_number);
+
+  for (unsigned i = 0; i < perceptrons_number; i++) {
+    parameters.tuck_in(i * perceptron_parameters_number,
+                       new_perceptrons[i].arrange_parameters());
+  }
 }
 
 // void set_perceptron(const unsigned&, const Perceptron&) method
 
-/// Sets a single perceptron in the layer.
+/// Sets the bias and the synaptic weights of a single perceptron in the layer.
+/// The activation function is shared by all the perceptrons, and it is not
+/// modified.
 /// @param i Index of perceptron.
 /// @param new_perceptron Perceptron neuron to be set.
 
 void PerceptronLayer::set_perceptron(const unsigned& i,
                                      const Perceptron& new_perceptron) {
-  perceptrons[i] = new_perceptron;
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (i >= perceptrons_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void set_perceptron(const unsigned&, const Perceptron&) "
+              "method.\n"
+           << "Index of perceptron must be less than layer size.\n";
+
+    throw std::logic_error(buffer.str());
+  } else if (new_perceptron.get_inputs_number() != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void set_perceptron(const unsigned&, const Perceptron&) "
+              "method.\n"
+           << "Number of perceptron inputs must be equal to number of layer "
+              "inputs.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  parameters.tuck_in(i * (1 + inputs_number),
+                     new_perceptron.arrange_parameters());
 }
 
 // void set_default(void) method
@@ -479,10 +615,17 @@ void PerceptronLayer::set_perceptron(const unsigned& i,
 /// Sets those members not related to the vector of perceptrons to their default
 /// value.
 /// <ul>
+/// <li> Activation accuracy: Exact.
 /// <li> Display: True.
 /// </ul>
 
-void PerceptronLayer::set_default(void) { display = true; }
+void PerceptronLayer::set_default(void) {
+  activation_accuracy = Perceptron::Exact;
+
+  set_kernels();
+
+  display = true;
+}
 
 // void set_inputs_number(const unsigned&) method
 
@@ -491,11 +634,14 @@ void PerceptronLayer::set_default(void) { display = true; }
 /// @param new_inputs_number Number of layer inputs.
 
 void PerceptronLayer::set_inputs_number(const unsigned& new_inputs_number) {
-  const unsigned perceptrons_number = get_perceptrons_number();
-
-  for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].set_inputs_number(new_inputs_number);
+  if (perceptrons_number == 0) {
+    return;
   }
+
+  inputs_number = new_inputs_number;
+
+  parameters.set(perceptrons_number * (1 + inputs_number));
+  parameters.randomize_normal();
 }
 
 // void set_perceptrons_number(const unsigned&) method
@@ -506,19 +652,14 @@ void PerceptronLayer::set_inputs_number(const unsigned& new_inputs_number) {
 
 void PerceptronLayer::set_perceptrons_number(
     const unsigned& new_perceptrons_number) {
-  const unsigned perceptrons_number = get_perceptrons_number();
-  const unsigned inputs_number = get_inputs_number();
+  perceptrons_number = new_perceptrons_number;
 
-  if (perceptrons_number > 0) {
-    const Perceptron::ActivationFunction& activation_function =
-        get_activation_function();
-    perceptrons.set(new_perceptrons_number);
-    set_activation_function(activation_function);
-  } else {
-    perceptrons.set(new_perceptrons_number);
+  if (perceptrons_number == 0) {
+    inputs_number = 0;
   }
 
-  set_inputs_number(inputs_number);
+  parameters.set(perceptrons_number * (1 + inputs_number));
+  parameters.randomize_normal();
 }
 
 // void set_biases(const Vector<double>&) method
@@ -549,8 +690,10 @@ void PerceptronLayer::set_biases(const Vector<double>& new_biases) {
 
   // Set layer biases
 
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].set_bias(new_biases[i]);
+    parameters[i * perceptron_parameters_number] = new_biases[i];
   }
 }
 
@@ -564,9 +707,6 @@ void PerceptronLayer::set_biases(const Vector<double>& new_biases) {
 
 void PerceptronLayer::set_synaptic_weights(
     const Matrix<double>& new_synaptic_weights) {
-  const unsigned inputs_number = get_inputs_number();
-  const unsigned perceptrons_number = get_perceptrons_number();
-
 // Control sentence (if debug)
 
 #ifndef NDEBUG
@@ -594,9 +734,14 @@ void PerceptronLayer::set_synaptic_weights(
 
 #endif
 
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
   for (unsigned i = 0; i < perceptrons_number; i++) {
+    double* perceptron_synaptic_weights =
+        &parameters[0] + i * perceptron_parameters_number + 1;
+
     for (unsigned j = 0; j < inputs_number; j++) {
-      perceptrons[i].set_synaptic_weight(j, new_synaptic_weights[i][j]);
+      perceptron_synaptic_weights[j] = new_synaptic_weights[i][j];
     }
   }
 }
@@ -604,11 +749,10 @@ void PerceptronLayer::set_synaptic_weights(
 // void set_parameters(const Vector<double>&) method
 
 /// Sets the parameters of this layer.
+/// They are copied in a single block, as they are stored in the same order.
 /// @param new_parameters Parameters vector for that layer.
 
 void PerceptronLayer::set_parameters(const Vector<double>& new_parameters) {
-  const unsigned perceptrons_number = get_perceptrons_number();
-
 // Control sentence (if debug)
 
 #ifndef NDEBUG
@@ -630,21 +774,7 @@ void PerceptronLayer::set_parameters(const Vector<double>& new_parameters) {
 
 #endif
 
-  if (perceptrons_number != 0) {
-    const unsigned perceptron_parameters_number =
-        perceptrons[0].count_parameters_number();
-
-    Vector<double> perceptron_parameters(perceptron_parameters_number);
-
-    unsigned position = 0;
-
-    for (unsigned i = 0; i < perceptrons_number; i++) {
-      perceptron_parameters =
-          new_parameters.take_out(position, perceptron_parameters_number);
-      perceptrons[i].set_parameters(perceptron_parameters);
-      position += perceptron_parameters_number;
-    }
-  }
+  parameters = new_parameters;
 }
 
 // void set_activation_function(const Perceptron::ActivationFunction&) method
@@ -654,11 +784,9 @@ void PerceptronLayer::set_parameters(const Vector<double>& new_parameters) {
 
 void PerceptronLayer::set_activation_function(
     const Perceptron::ActivationFunction& new_activation_function) {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  activation_function = new_activation_function;
 
-  for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].set_activation_function(new_activation_function);
-  }
+  set_kernels();
 }
 
 // void set_activation_function(const std::string&) method
@@ -670,10 +798,238 @@ void PerceptronLayer::set_activation_function(
 
 void PerceptronLayer::set_activation_function(
     const std::string& new_activation_function) {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  if (new_activation_function == "Logistic") {
+    activation_function = Perceptron::Logistic;
+  } else if (new_activation_function == "HyperbolicTangent") {
+    activation_function = Perceptron::HyperbolicTangent;
+  } else if (new_activation_function == "Threshold") {
+    activation_function = Perceptron::Threshold;
+  } else if (new_activation_function == "SymmetricThreshold") {
+    activation_function = Perceptron::SymmetricThreshold;
+  } else if (new_activation_function == "Linear") {
+    activation_function = Perceptron::Linear;
+  } else {
+    std::ostringstream buffer;
 
-  for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].set_activation_function(new_activation_function);
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void set_activation_function(const std::string&) method.\n"
+           << "Unknown activation function: " << new_activation_function
+           << ".\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  set_kernels();
+}
+
+// void set_activation_accuracy(const Perceptron::ActivationAccuracy&) method
+
+/// Sets the accuracy with which the activations of the layer are calculated.
+/// The fast mode is well suited for inference, where the small error of the
+/// approximation is not significant.
+/// @param new_activation_accuracy Exact or fast activation kernels.
+
+void PerceptronLayer::set_activation_accuracy(
+    const Perceptron::ActivationAccuracy& new_activation_accuracy) {
+  activation_accuracy = new_activation_accuracy;
+
+  set_kernels();
+}
+
+// template <class Activation, class Type> void calculate_outputs_kernel(const
+// Type*, const unsigned&, const unsigned&, const unsigned&, const Type*, Type*)
+// method
+
+/// Calculates the outputs of a layer for a block of instances, with the
+/// activation function and the floating point type given as types.
+/// For every instance, the combinations of all the perceptrons are computed
+/// first, and then the activation is applied to the whole row, in a loop that
+/// the compiler can inline and vectorize.
+/// The combinations are always accumulated in double precision, so that a
+/// single precision layer only rounds its inputs, parameters and outputs.
+/// The kernel only reads and writes the given arrays, and it does not allocate
+/// memory.
+/// @param parameters Array with the parameters of the layer, with the bias of
+/// each perceptron followed by its synaptic weights.
+/// @param perceptrons_number Number of perceptrons in the layer.
+/// @param inputs_number Number of inputs to the layer.
+/// @param instances_number Number of instances in the block.
+/// @param inputs Row-major array of inputs, with one instance per row.
+/// @param outputs Row-major array to store the outputs, with one instance per
+/// row.
+
+template <class Activation, class Type>
+void PerceptronLayer::calculate_outputs_kernel(
+    const Type* parameters, const unsigned& perceptrons_number,
+    const unsigned& inputs_number, const unsigned& instances_number,
+    const Type* inputs, Type* outputs) {
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    const Type* instance_inputs = inputs + i * inputs_number;
+    Type* instance_outputs = outputs + i * perceptrons_number;
+
+    for (unsigned j = 0; j < perceptrons_number; j++) {
+      const Type* perceptron_parameters =
+          parameters + j * perceptron_parameters_number;
+
+      double combination = perceptron_parameters[0];
+
+      for (unsigned k = 0; k < inputs_number; k++) {
+        combination += perceptron_parameters[1 + k] * instance_inputs[k];
+      }
+
+      instance_outputs[j] = (Type)combination;
+    }
+
+#pragma omp simd
+    for (unsigned j = 0; j < perceptrons_number; j++) {
+      instance_outputs[j] = (Type)Activation::calculate(instance_outputs[j]);
+    }
+  }
+}
+
+// template <class Activation, class Type> void
+// calculate_forward_propagation_kernel(const Type*, const unsigned&, const
+// Matrix<Type>&, Matrix<Type>&, Matrix<Type>&) method
+
+/// Calculates the activations and the activation derivatives of a layer for a
+/// block of instances, with the activation function and the floating point
+/// type given as types.
+/// The combinations are accumulated in double precision and only kept in
+/// registers, and the activations and their derivatives are computed from them
+/// in a single pass.
+/// @param parameters Array with the parameters of the layer, with the bias of
+/// each perceptron followed by its synaptic weights.
+/// @param perceptrons_number Number of perceptrons in the layer.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+/// @param activations Matrix to store the layer activations.
+/// @param activations_derivatives Matrix to store the layer activation
+/// derivatives.
+
+template <class Activation, class Type>
+void PerceptronLayer::calculate_forward_propagation_kernel(
+    const Type* parameters, const unsigned& perceptrons_number,
+    const Matrix<Type>& inputs, Matrix<Type>& activations,
+    Matrix<Type>& activations_derivatives) {
+  const unsigned instances_number = inputs.get_rows_number();
+  const unsigned inputs_number = inputs.get_columns_number();
+
+  if (instances_number == 0) {
+    activations.set();
+    activations_derivatives.set();
+    return;
+  }
+
+  activations.set(instances_number, perceptrons_number);
+  activations_derivatives.set(instances_number, perceptrons_number);
+
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    const Type* instance_inputs = inputs[i];
+    Type* instance_activations = activations[i];
+    Type* instance_activations_derivatives = activations_derivatives[i];
+
+    for (unsigned j = 0; j < perceptrons_number; j++) {
+      const Type* perceptron_parameters =
+          parameters + j * perceptron_parameters_number;
+
+      double combination = perceptron_parameters[0];
+
+      for (unsigned k = 0; k < inputs_number; k++) {
+        combination += perceptron_parameters[1 + k] * instance_inputs[k];
+      }
+
+      if (!Activation::derivable && combination == 0.0) {
+        std::ostringstream buffer;
+
+        buffer << "OpenNN Exception: PerceptronLayer class.\n"
+               << "void calculate_first_order_forward_propagation(const "
+                  "Matrix<double>&, Matrix<double>&, Matrix<double>&) const "
+                  "method.\n"
+               << "Threshold activation functions are not derivable.\n";
+
+        throw std::logic_error(buffer.str());
+      }
+
+      instance_activations_derivatives[j] = (Type)combination;
+    }
+
+#pragma omp simd
+    for (unsigned j = 0; j < perceptrons_number; j++) {
+      const double combination = instance_activations_derivatives[j];
+
+      instance_activations[j] = (Type)Activation::calculate(combination);
+      instance_activations_derivatives[j] =
+          (Type)Activation::calculate_derivative(combination);
+    }
+  }
+}
+
+// template <class Activation> void set_activation_kernels(void) method
+
+/// Sets the double and the single precision kernels of the layer to the ones
+/// specialized for the given activation function.
+
+template <class Activation>
+void PerceptronLayer::set_activation_kernels(void) {
+  outputs_kernel = calculate_outputs_kernel<Activation, double>;
+  forward_propagation_kernel =
+      calculate_forward_propagation_kernel<Activation, double>;
+  single_precision_outputs_kernel = calculate_outputs_kernel<Activation, float>;
+  single_precision_forward_propagation_kernel =
+      calculate_forward_propagation_kernel<Activation, float>;
+}
+
+// void set_kernels(void) method
+
+/// Selects the layer kernels specialized for the activation function and the
+/// activation accuracy of the layer.
+/// This is done once whenever any of them changes, so that evaluating the
+/// layer does not branch on the activation function.
+
+void PerceptronLayer::set_kernels(void) {
+  switch (activation_function) {
+    case Perceptron::Logistic: {
+      if (activation_accuracy == Perceptron::Fast) {
+        set_activation_kernels<LogisticActivation<Perceptron::Fast> >();
+      } else {
+        set_activation_kernels<LogisticActivation<Perceptron::Exact> >();
+      }
+    } break;
+
+    case Perceptron::HyperbolicTangent: {
+      if (activation_accuracy == Perceptron::Fast) {
+        set_activation_kernels<
+            HyperbolicTangentActivation<Perceptron::Fast> >();
+      } else {
+        set_activation_kernels<
+            HyperbolicTangentActivation<Perceptron::Exact> >();
+      }
+    } break;
+
+    case Perceptron::Threshold: {
+      set_activation_kernels<ThresholdActivation>();
+    } break;
+
+    case Perceptron::SymmetricThreshold: {
+      set_activation_kernels<SymmetricThresholdActivation>();
+    } break;
+
+    case Perceptron::Linear: {
+      set_activation_kernels<LinearActivation>();
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerceptronLayer class.\n"
+             << "void set_kernels(void) method.\n"
+             << "Unknown activation function.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
   }
 }
 
@@ -695,11 +1051,25 @@ void PerceptronLayer::set_display(const bool& new_display) {
 /// Makes the perceptron layer to have one more input.
 
 void PerceptronLayer::grow_input(void) {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  if (perceptrons_number == 0) {
+    return;
+  }
+
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  Vector<double> new_parameters(
+      perceptrons_number * (perceptron_parameters_number + 1), 0.0);
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].grow_input();
+    for (unsigned j = 0; j < perceptron_parameters_number; j++) {
+      new_parameters[i * (perceptron_parameters_number + 1) + j] =
+          parameters[i * perceptron_parameters_number + j];
+    }
   }
+
+  parameters.swap(new_parameters);
+
+  inputs_number++;
 }
 
 // void grow_perceptron(void) method
@@ -707,13 +1077,9 @@ void PerceptronLayer::grow_input(void) {
 /// Makes the perceptron layer to have one more perceptron.
 
 void PerceptronLayer::grow_perceptron(void) {
-  const unsigned inputs_number = get_inputs_number();
-
-  Perceptron perceptron(inputs_number);
-
-  perceptron.initialize_parameters(0.0);
+  parameters.resize(parameters.size() + 1 + inputs_number, 0.0);
 
-  perceptrons.push_back(perceptron);
+  perceptrons_number++;
 }
 
 // void prune_input(const unsigned&) method
@@ -726,8 +1092,6 @@ void PerceptronLayer::prune_input(const unsigned& index) {
 
 #ifndef NDEBUG
 
-  const unsigned inputs_number = get_inputs_number();
-
   if (index >= inputs_number) {
     std::ostringstream buffer;
 
@@ -740,11 +1104,22 @@ void PerceptronLayer::prune_input(const unsigned& index) {
 
 #endif
 
-  const unsigned perceptrons_number = get_perceptrons_number();
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  unsigned position = 0;
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].prune_input(index);
+    for (unsigned j = 0; j < perceptron_parameters_number; j++) {
+      if (j != 1 + index) {
+        parameters[position] = parameters[i * perceptron_parameters_number + j];
+        position++;
+      }
+    }
   }
+
+  parameters.resize(position);
+
+  inputs_number--;
 }
 
 // void prune_perceptron(const unsigned&) method
@@ -757,8 +1132,6 @@ void PerceptronLayer::prune_perceptron(const unsigned& index) {
 
 #ifndef NDEBUG
 
-  const unsigned perceptrons_number = get_perceptrons_number();
-
   if (index >= perceptrons_number) {
     std::ostringstream buffer;
 
@@ -772,7 +1145,17 @@ void PerceptronLayer::prune_perceptron(const unsigned& index) {
 
 #endif
 
-  perceptrons.erase(perceptrons.begin() + index);
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  parameters.erase(
+      parameters.begin() + index * perceptron_parameters_number,
+      parameters.begin() + (index + 1) * perceptron_parameters_number);
+
+  perceptrons_number--;
+
+  if (perceptrons_number == 0) {
+    inputs_number = 0;
+  }
 }
 
 // void initialize_random(void) method
@@ -797,10 +1180,10 @@ void PerceptronLayer::initialize_random(void) {
 /// @param value Biases initialization value.
 
 void PerceptronLayer::initialize_biases(const double& value) {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].initialize_bias(value);
+    parameters[i * perceptron_parameters_number] = value;
   }
 }
 
@@ -811,10 +1194,12 @@ void PerceptronLayer::initialize_biases(const double& value) {
 /// @param value Synaptic weights initialization value.
 
 void PerceptronLayer::initialize_synaptic_weights(const double& value) {
-  const unsigned perceptrons_number = get_perceptrons_number();
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptrons[i].initialize_synaptic_weights(value);
+    for (unsigned j = 1; j < perceptron_parameters_number; j++) {
+      parameters[i * perceptron_parameters_number + j] = value;
+    }
   }
 }
 
@@ -825,11 +1210,7 @@ void PerceptronLayer::initialize_synaptic_weights(const double& value) {
 /// @param value Parameters initialization value.
 
 void PerceptronLayer::initialize_parameters(const double& value) {
-  const unsigned parameters_number = count_parameters_number();
-
-  const Vector<double> parameters(parameters_number, value);
-
-  set_parameters(parameters);
+  parameters.initialize(value);
 }
 
 // void randomize_parameters_uniform(void) method
@@ -999,7 +1380,7 @@ void PerceptronLayer::randomize_parameters_normal(
 /// Calculates the norm of a layer parameters vector.
 
 double PerceptronLayer::calculate_parameters_norm(void) const {
-  return (arrange_parameters().calculate_norm());
+  return (parameters.calculate_norm());
 }
 
 // Vector<double> calculate_combinations(const Vector<double>&) const method
@@ -1036,10 +1417,21 @@ Vector<double> PerceptronLayer::calculate_combinations(
 
   // Calculate combination to layer
 
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
   Vector<double> combination(perceptrons_number);
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    combination[i] = perceptrons[i].calculate_combination(inputs);
+    const double* perceptron_parameters =
+        &parameters[i * perceptron_parameters_number];
+
+    double perceptron_combination = perceptron_parameters[0];
+
+    for (unsigned j = 0; j < inputs_number; j++) {
+      perceptron_combination += perceptron_parameters[1 + j] * inputs[j];
+    }
+
+    combination[i] = perceptron_combination;
   }
 
   return (combination);
@@ -1139,14 +1531,17 @@ Vector<double> PerceptronLayer::calculate_combinations(
 
   Vector<double> combinations(perceptrons_number);
 
-  Vector<double> perceptron_parameters(perceptron_parameters_number);
-
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    perceptron_parameters = parameters.take_out(
-        i * perceptron_parameters_number, perceptron_parameters_number);
+    const double* perceptron_parameters =
+        &parameters[i * perceptron_parameters_number];
 
-    combinations[i] =
-        perceptrons[i].calculate_combination(inputs, perceptron_parameters);
+    double combination = perceptron_parameters[0];
+
+    for (unsigned j = 0; j < inputs_number; j++) {
+      combination += perceptron_parameters[1 + j] * inputs[j];
+    }
+
+    combinations[i] = combination;
   }
 
   return (combinations);
@@ -1214,6 +1609,145 @@ Vector<Matrix<double> > PerceptronLayer::calculate_combinations_Hessian_form(
   return (combination_parameters_Hessian_form);
 }
 
+// void calculate_combinations(const Matrix<double>&, Matrix<double>&) const
+// method
+
+/// Calculates the combinations of the layer for a block of instances.
+/// Each row of the inputs matrix is the input to the layer for a single
+/// instance, and the corresponding row of the combinations matrix is the
+/// combination of every perceptron for that instance.
+/// The combinations matrix is only reallocated when its size changes, so that
+/// it can be reused as a workspace between calls.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+/// @param combinations Matrix to store the layer combinations.
+
+void PerceptronLayer::calculate_combinations(
+    const Matrix<double>& inputs, Matrix<double>& combinations) const {
+  const unsigned inputs_number = get_inputs_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_combinations(const Matrix<double>&, "
+              "Matrix<double>&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of layer inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = inputs.get_rows_number();
+  const unsigned perceptrons_number = get_perceptrons_number();
+
+  if (instances_number == 0) {
+    combinations.set();
+    return;
+  }
+
+  combinations.set(instances_number, perceptrons_number);
+
+  // The parameters of the layer are a single block with one row per
+  // perceptron, and the rows of the inputs are contiguous too, so that the
+  // matrix product is made of unit-stride dot products.
+
+  const unsigned perceptron_parameters_number = 1 + inputs_number;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    const double* instance_inputs = inputs[i];
+    double* instance_combinations = combinations[i];
+
+    for (unsigned j = 0; j < perceptrons_number; j++) {
+      const double* perceptron_parameters =
+          &parameters[j * perceptron_parameters_number];
+      const double* synaptic_weights = perceptron_parameters + 1;
+
+      double combination = perceptron_parameters[0];
+
+      for (unsigned k = 0; k < inputs_number; k++) {
+        combination += synaptic_weights[k] * instance_inputs[k];
+      }
+
+      instance_combinations[j] = combination;
+    }
+  }
+}
+
+// Matrix<double> calculate_combinations(const Matrix<double>&) const method
+
+/// Returns the combinations of the layer for a block of instances.
+/// The number of rows is the number of instances and the number of columns is
+/// the number of perceptrons.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+
+Matrix<double> PerceptronLayer::calculate_combinations(
+    const Matrix<double>& inputs) const {
+  Matrix<double> combinations;
+
+  calculate_combinations(inputs, combinations);
+
+  return (combinations);
+}
+
+// double calculate_activation(const double&) const method
+
+/// Returns the activation of a perceptron in the layer for a combination.
+/// The outputs depends on the activation function and the activation accuracy
+/// of the layer.
+/// @param combination Combination of the perceptron.
+
+double PerceptronLayer::calculate_activation(const double& combination) const {
+  double activation;
+
+  Perceptron::calculate_activations(activation_function, activation_accuracy,
+                                    &combination, &activation, 1);
+
+  return (activation);
+}
+
+// double calculate_activation_derivative(const double&) const method
+
+/// Returns the activation derivative of a perceptron in the layer for a
+/// combination.
+/// @param combination Combination of the perceptron.
+
+double PerceptronLayer::calculate_activation_derivative(
+    const double& combination) const {
+  double activation_derivative;
+
+  Perceptron::calculate_activations_derivatives(
+      activation_function, activation_accuracy, &combination,
+      &activation_derivative, 1);
+
+  return (activation_derivative);
+}
+
+// double calculate_activation_second_derivative(const double&) const method
+
+/// Returns the activation second derivative of a perceptron in the layer for a
+/// combination.
+/// @param combination Combination of the perceptron.
+
+double PerceptronLayer::calculate_activation_second_derivative(
+    const double& combination) const {
+  double activation_second_derivative;
+
+  Perceptron::calculate_activations_second_derivatives(
+      activation_function, activation_accuracy, &combination,
+      &activation_second_derivative, 1);
+
+  return (activation_second_derivative);
+}
+
 // Vector<double> calculate_activations(const Vector<double>&) const method
 
 /// Returns the activations from every perceptron in a layer as a function of
@@ -1247,8 +1781,10 @@ Vector<double> PerceptronLayer::calculate_activations(
 
   Vector<double> activations(perceptrons_number);
 
-  for (unsigned i = 0; i < perceptrons_number; i++) {
-    activations[i] = perceptrons[i].calculate_activation(combinations[i]);
+  if (perceptrons_number > 0) {
+    Perceptron::calculate_activations(activation_function, activation_accuracy,
+                                      &combinations[0], &activations[0],
+                                      perceptrons_number);
   }
 
   return (activations);
@@ -1288,9 +1824,10 @@ Vector<double> PerceptronLayer::calculate_activations_derivatives(
 
   Vector<double> activation_derivatives(perceptrons_number);
 
-  for (unsigned i = 0; i < perceptrons_number; i++) {
-    activation_derivatives[i] =
-        perceptrons[i].calculate_activation_derivative(combination[i]);
+  if (perceptrons_number > 0) {
+    Perceptron::calculate_activations_derivatives(
+        activation_function, activation_accuracy, &combination[0],
+        &activation_derivatives[0], perceptrons_number);
   }
 
   return (activation_derivatives);
@@ -1330,9 +1867,10 @@ Vector<double> PerceptronLayer::calculate_activations_second_derivatives(
 
   Vector<double> activation_second_derivatives(perceptrons_number);
 
-  for (unsigned i = 0; i < perceptrons_number; i++) {
-    activation_second_derivatives[i] =
-        perceptrons[i].calculate_activation_second_derivative(combination[i]);
+  if (perceptrons_number > 0) {
+    Perceptron::calculate_activations_second_derivatives(
+        activation_function, activation_accuracy, &combination[0],
+        &activation_second_derivatives[0], perceptrons_number);
   }
 
   return (activation_second_derivatives);
@@ -1378,6 +1916,188 @@ Vector<Matrix<double> > PerceptronLayer::arrange_activations_Hessian_form(
   return (activation_Hessian_form);
 }
 
+// void calculate_activations(const Matrix<double>&, Matrix<double>&) const
+// method
+
+/// Calculates the activations of the layer for a block of combinations.
+/// The activation function of every perceptron is applied element-wise to
+/// the corresponding column of the combinations matrix.
+/// The activations matrix might be the same object as the combinations
+/// matrix, in which case the activations are computed in place.
+/// @param combinations Matrix of combinations, with one instance per row.
+/// @param activations Matrix to store the layer activations.
+
+void PerceptronLayer::calculate_activations(
+    const Matrix<double>& combinations, Matrix<double>& activations) const {
+  const unsigned perceptrons_number = get_perceptrons_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = combinations.get_columns_number();
+
+  if (columns_number != perceptrons_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_activations(const Matrix<double>&, "
+              "Matrix<double>&) const method.\n"
+           << "Number of columns of combinations must be equal to number of "
+              "neurons.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = combinations.get_rows_number();
+
+  if (instances_number == 0) {
+    activations.set();
+    return;
+  }
+
+  activations.set(instances_number, perceptrons_number);
+
+  // Both matrices are stored contiguously and all the perceptrons share the
+  // activation function, so that the whole block is done in a single pass.
+
+  Perceptron::calculate_activations(activation_function, activation_accuracy,
+                                    combinations[0], activations[0],
+                                    instances_number * perceptrons_number);
+}
+
+// Matrix<double> calculate_activations(const Matrix<double>&) const method
+
+/// Returns the activations of the layer for a block of combinations.
+/// @param combinations Matrix of combinations, with one instance per row.
+
+Matrix<double> PerceptronLayer::calculate_activations(
+    const Matrix<double>& combinations) const {
+  Matrix<double> activations;
+
+  calculate_activations(combinations, activations);
+
+  return (activations);
+}
+
+// void calculate_activations_derivatives(const Matrix<double>&,
+// Matrix<double>&) const method
+
+/// Calculates the activation derivatives of the layer for a block of
+/// combinations.
+/// The activations derivatives matrix might be the same object as the
+/// combinations matrix.
+/// @param combinations Matrix of combinations, with one instance per row.
+/// @param activations_derivatives Matrix to store the layer activation
+/// derivatives.
+
+void PerceptronLayer::calculate_activations_derivatives(
+    const Matrix<double>& combinations,
+    Matrix<double>& activations_derivatives) const {
+  const unsigned perceptrons_number = get_perceptrons_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = combinations.get_columns_number();
+
+  if (columns_number != perceptrons_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_activations_derivatives(const Matrix<double>&, "
+              "Matrix<double>&) const method.\n"
+           << "Number of columns of combinations must be equal to number of "
+              "neurons.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = combinations.get_rows_number();
+
+  if (instances_number == 0) {
+    activations_derivatives.set();
+    return;
+  }
+
+  activations_derivatives.set(instances_number, perceptrons_number);
+
+  Perceptron::calculate_activations_derivatives(
+      activation_function, activation_accuracy, combinations[0],
+      activations_derivatives[0], instances_number * perceptrons_number);
+}
+
+// Matrix<double> calculate_activations_derivatives(const Matrix<double>&)
+// const method
+
+/// Returns the activation derivatives of the layer for a block of
+/// combinations.
+/// @param combinations Matrix of combinations, with one instance per row.
+
+Matrix<double> PerceptronLayer::calculate_activations_derivatives(
+    const Matrix<double>& combinations) const {
+  Matrix<double> activations_derivatives;
+
+  calculate_activations_derivatives(combinations, activations_derivatives);
+
+  return (activations_derivatives);
+}
+
+// void calculate_activations_second_derivatives(const Matrix<double>&,
+// Matrix<double>&) const method
+
+/// Calculates the activation second derivatives of the layer for a block of
+/// combinations.
+/// The activations second derivatives matrix might be the same object as the
+/// combinations matrix.
+/// @param combinations Matrix of combinations, with one instance per row.
+/// @param activations_second_derivatives Matrix to store the layer activation
+/// second derivatives.
+
+void PerceptronLayer::calculate_activations_second_derivatives(
+    const Matrix<double>& combinations,
+    Matrix<double>& activations_second_derivatives) const {
+  const unsigned perceptrons_number = get_perceptrons_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = combinations.get_columns_number();
+
+  if (columns_number != perceptrons_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_activations_second_derivatives(const "
+              "Matrix<double>&, Matrix<double>&) const method.\n"
+           << "Number of columns of combinations must be equal to number of "
+              "neurons.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = combinations.get_rows_number();
+
+  if (instances_number == 0) {
+    activations_second_derivatives.set();
+    return;
+  }
+
+  activations_second_derivatives.set(instances_number, perceptrons_number);
+
+  Perceptron::calculate_activations_second_derivatives(
+      activation_function, activation_accuracy, combinations[0],
+      activations_second_derivatives[0], instances_number * perceptrons_number);
+}
+
 // Vector<double> calculate_outputs(const Vector<double>&) const method
 
 /// Returns the outputs from every perceptron in a layer as a function of their
@@ -1536,7 +2256,14 @@ Vector<double> PerceptronLayer::calculate_outputs(
 
 #endif
 
-  return (calculate_activations(calculate_combinations(inputs, parameters)));
+  Vector<double> outputs(perceptrons_number);
+
+  if (perceptrons_number != 0) {
+    outputs_kernel(&parameters[0], perceptrons_number, inputs_number, 1,
+                   inputs.empty() ? NULL : &inputs[0], &outputs[0]);
+  }
+
+  return (outputs);
 }
 
 // Matrix<double> calculate_Jacobian(const Vector<double>&, const
@@ -1646,6 +2373,284 @@ Vector<Matrix<double> > PerceptronLayer::calculate_Hessian_form(
   return (parameters_Hessian_form);
 }
 
+// void calculate_outputs(const Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates the outputs of the layer for a block of instances, as one
+/// matrix product followed by the element-wise activations.
+/// The kernel is specialized at compile time for the activation function of
+/// the layer.
+/// The outputs matrix is used both for the combinations and the activations,
+/// and it is only reallocated when its size changes.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+/// @param outputs Matrix to store the layer outputs.
+
+void PerceptronLayer::calculate_outputs(const Matrix<double>& inputs,
+                                        Matrix<double>& outputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_outputs(const Matrix<double>&, Matrix<double>&) "
+              "const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of layer inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = inputs.get_rows_number();
+
+  if (instances_number == 0) {
+    outputs.set();
+    return;
+  }
+
+  outputs.set(instances_number, perceptrons_number);
+
+  outputs_kernel(parameters.empty() ? NULL : &parameters[0],
+                 perceptrons_number, inputs_number, instances_number,
+                 inputs[0], outputs[0]);
+}
+
+// Matrix<double> calculate_outputs(const Matrix<double>&) const method
+
+/// Returns the outputs of the layer for a block of instances.
+/// The number of rows is the number of instances and the number of columns is
+/// the number of perceptrons.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+
+Matrix<double> PerceptronLayer::calculate_outputs(
+    const Matrix<double>& inputs) const {
+  Matrix<double> outputs;
+
+  calculate_outputs(inputs, outputs);
+
+  return (outputs);
+}
+
+// void calculate_outputs(const double*, const double*, double*) const method
+
+/// Calculates which would be the outputs of the layer for one instance and a
+/// given set of parameters, reading them in place from a caller provided
+/// array.
+/// This method does not allocate memory nor modify the layer.
+/// @param inputs Array of inputs to the layer, of size the number of inputs.
+/// @param layer_parameters Array with a set of parameters of the layer,
+/// arranged as the parameters of the layer.
+/// It might point into a larger parameters block.
+/// @param outputs Array to store the layer outputs, of size the number of
+/// perceptrons.
+/// It must not overlap with the inputs.
+
+void PerceptronLayer::calculate_outputs(const double* inputs,
+                                        const double* layer_parameters,
+                                        double* outputs) const {
+  outputs_kernel(layer_parameters, perceptrons_number, inputs_number, 1,
+                 inputs, outputs);
+}
+
+// void calculate_outputs(const Matrix<double>&, const double*,
+// Matrix<double>&) const method
+
+/// Calculates which would be the outputs of the layer for a block of instances
+/// and a given set of parameters, reading them in place from a caller
+/// provided array.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+/// @param layer_parameters Array with a set of parameters of the layer,
+/// arranged as the parameters of the layer.
+/// It might point into a larger parameters block.
+/// @param outputs Matrix to store the layer outputs, with one instance per
+/// row.
+/// It must not be the inputs matrix.
+
+void PerceptronLayer::calculate_outputs(const Matrix<double>& inputs,
+                                        const double* layer_parameters,
+                                        Matrix<double>& outputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_outputs(const Matrix<double>&, const double*, "
+              "Matrix<double>&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of layer inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = inputs.get_rows_number();
+
+  if (instances_number == 0) {
+    outputs.set();
+    return;
+  }
+
+  outputs.set(instances_number, perceptrons_number);
+
+  outputs_kernel(layer_parameters, perceptrons_number, inputs_number,
+                 instances_number, inputs[0], outputs[0]);
+}
+
+// void calculate_first_order_forward_propagation(const Matrix<double>&,
+// Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates the activations and the activation derivatives of the layer for
+/// a block of instances, in a single pass over the combinations.
+/// The kernel is specialized at compile time for the activation function of
+/// the layer.
+/// Both matrices are only reallocated when their sizes change.
+/// @param inputs Matrix of inputs to the layer, with one instance per row.
+/// @param activations Matrix to store the layer activations.
+/// @param activations_derivatives Matrix to store the layer activation
+/// derivatives.
+
+void PerceptronLayer::calculate_first_order_forward_propagation(
+    const Matrix<double>& inputs, Matrix<double>& activations,
+    Matrix<double>& activations_derivatives) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_first_order_forward_propagation(const "
+              "Matrix<double>&, Matrix<double>&, Matrix<double>&) const "
+              "method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of layer inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  forward_propagation_kernel(parameters.empty() ? NULL : &parameters[0],
+                             perceptrons_number, inputs, activations,
+                             activations_derivatives);
+}
+
+// void calculate_outputs(const Matrix<float>&, const float*, Matrix<float>&)
+// const method
+
+/// Calculates the outputs of the layer for a block of instances in single
+/// precision, with the parameters read from the provided array.
+/// The combinations are accumulated in double precision.
+/// @param inputs Matrix of single precision inputs to the layer, with one
+/// instance per row.
+/// @param layer_parameters Array with a set of single precision parameters of
+/// the layer, arranged as the parameters of the layer.
+/// It might point into a larger parameters block.
+/// @param outputs Matrix to store the layer outputs, with one instance per
+/// row.
+/// It must not be the inputs matrix.
+
+void PerceptronLayer::calculate_outputs(const Matrix<float>& inputs,
+                                        const float* layer_parameters,
+                                        Matrix<float>& outputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_outputs(const Matrix<float>&, const float*, "
+              "Matrix<float>&) const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of layer inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned instances_number = inputs.get_rows_number();
+
+  if (instances_number == 0) {
+    outputs.set();
+    return;
+  }
+
+  outputs.set(instances_number, perceptrons_number);
+
+  single_precision_outputs_kernel(layer_parameters, perceptrons_number,
+                                  inputs_number, instances_number, inputs[0],
+                                  outputs[0]);
+}
+
+// void calculate_first_order_forward_propagation(const Matrix<float>&, const
+// float*, Matrix<float>&, Matrix<float>&) const method
+
+/// Calculates the activations and the activation derivatives of the layer for
+/// a block of instances in single precision, with the parameters read from the
+/// provided array.
+/// The combinations are accumulated in double precision.
+/// @param inputs Matrix of single precision inputs to the layer, with one
+/// instance per row.
+/// @param layer_parameters Array with a set of single precision parameters of
+/// the layer, arranged as the parameters of the layer.
+/// @param activations Matrix to store the layer activations.
+/// @param activations_derivatives Matrix to store the layer activation
+/// derivatives.
+
+void PerceptronLayer::calculate_first_order_forward_propagation(
+    const Matrix<float>& inputs, const float* layer_parameters,
+    Matrix<float>& activations, Matrix<float>& activations_derivatives) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerceptronLayer class.\n"
+           << "void calculate_first_order_forward_propagation(const "
+              "Matrix<float>&, const float*, Matrix<float>&, Matrix<float>&) "
+              "const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of layer inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  single_precision_forward_propagation_kernel(layer_parameters,
+                                              perceptrons_number, inputs,
+                                              activations,
+                                              activations_derivatives);
+}
+
 // std::string write_expression(const Vector<std::string>&, const
 // Vector<std::string>&) const method
 
@@ -1695,7 +2700,7 @@ std::string PerceptronLayer::write_expression(
   std::ostringstream buffer;
 
   for (unsigned i = 0; i < perceptrons_number; i++) {
-    buffer << perceptrons[i].write_expression(inputs_name, outputs_name[i]);
+    buffer << get_perceptron(i).write_expression(inputs_name, outputs_name[i]);
   }
 
   return (buffer.str());
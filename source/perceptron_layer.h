@@ -40,6 +40,9 @@ namespace OpenNN {
 
 /// This class represents a layer of perceptrons.
 /// Layers of perceptrons will be used to construct multilayer perceptrons.
+/// The biases and synaptic weights of all the perceptrons are stored in a
+/// single contiguous block, and all of them share the same activation
+/// function.
 
 class PerceptronLayer {
 
@@ -73,8 +76,8 @@ class PerceptronLayer {
 
   bool is_empty(void) const;
 
-  const Vector<Perceptron>& get_perceptrons(void) const;
-  const Perceptron& get_perceptron(const unsigned&) const;
+  Vector<Perceptron> get_perceptrons(void) const;
+  Perceptron get_perceptron(const unsigned&) const;
 
   unsigned get_inputs_number(void) const;
   unsigned get_perceptrons_number(void) const;
@@ -85,8 +88,11 @@ class PerceptronLayer {
   Matrix<double> arrange_synaptic_weights(void) const;
 
   unsigned count_parameters_number(void) const;
+  const Vector<double>& get_parameters(void) const;
   Vector<double> arrange_parameters(void) const;
 
+  const double* get_synaptic_weights_pointer(const unsigned&) const;
+
   unsigned count_perceptron_parameters_number(void) const;
   Vector<Vector<double> > arrange_perceptrons_parameters(void) const;
 
@@ -98,6 +104,8 @@ class PerceptronLayer {
 
   std::string write_activation_function(void) const;
 
+  const Perceptron::ActivationAccuracy& get_activation_accuracy(void) const;
+
   // Display messages
 
   const bool& get_display(void) const;
@@ -131,6 +139,8 @@ class PerceptronLayer {
   void set_activation_function(const Perceptron::ActivationFunction&);
   void set_activation_function(const std::string&);
 
+  void set_activation_accuracy(const Perceptron::ActivationAccuracy&);
+
   // Display messages
 
   void set_display(const bool&);
@@ -184,8 +194,15 @@ class PerceptronLayer {
   Vector<Matrix<double> > calculate_combinations_Hessian_form(
       const Vector<double>&, const Vector<double>&) const;
 
+  void calculate_combinations(const Matrix<double>&, Matrix<double>&) const;
+  Matrix<double> calculate_combinations(const Matrix<double>&) const;
+
   // Perceptron layer activations
 
+  double calculate_activation(const double&) const;
+  double calculate_activation_derivative(const double&) const;
+  double calculate_activation_second_derivative(const double&) const;
+
   Vector<double> calculate_activations(const Vector<double>&) const;
   Vector<double> calculate_activations_derivatives(const Vector<double>&) const;
   Vector<double> calculate_activations_second_derivatives(
@@ -195,6 +212,17 @@ class PerceptronLayer {
   Vector<Matrix<double> > arrange_activations_Hessian_form(
       const Vector<double>&) const;
 
+  void calculate_activations(const Matrix<double>&, Matrix<double>&) const;
+  Matrix<double> calculate_activations(const Matrix<double>&) const;
+
+  void calculate_activations_derivatives(const Matrix<double>&,
+                                         Matrix<double>&) const;
+  Matrix<double> calculate_activations_derivatives(
+      const Matrix<double>&) const;
+
+  void calculate_activations_second_derivatives(const Matrix<double>&,
+                                                Matrix<double>&) const;
+
   // Perceptron layer outputs
 
   Vector<double> calculate_outputs(const Vector<double>&) const;
@@ -208,6 +236,24 @@ class PerceptronLayer {
   Vector<Matrix<double> > calculate_Hessian_form(const Vector<double>&,
                                                  const Vector<double>&) const;
 
+  void calculate_outputs(const Matrix<double>&, Matrix<double>&) const;
+  Matrix<double> calculate_outputs(const Matrix<double>&) const;
+
+  void calculate_outputs(const double*, const double*, double*) const;
+  void calculate_outputs(const Matrix<double>&, const double*,
+                         Matrix<double>&) const;
+
+  void calculate_first_order_forward_propagation(const Matrix<double>&,
+                                                 Matrix<double>&,
+                                                 Matrix<double>&) const;
+
+  void calculate_outputs(const Matrix<float>&, const float*,
+                         Matrix<float>&) const;
+
+  void calculate_first_order_forward_propagation(const Matrix<float>&,
+                                                 const float*, Matrix<float>&,
+                                                 Matrix<float>&) const;
+
   // Expression methods
 
   std::string write_expression(const Vector<std::string>&,
@@ -219,12 +265,99 @@ class PerceptronLayer {
 
  protected:
 
+  // Layer kernels
+
+  /// Pointer to a kernel calculating the outputs of the layer for a block of
+  /// instances.
+
+  typedef void (*OutputsKernel)(const double*, const unsigned&,
+                                const unsigned&, const unsigned&,
+                                const double*, double*);
+
+  /// Pointer to a kernel calculating the activations and the activation
+  /// derivatives of the layer for a block of instances.
+
+  typedef void (*ForwardPropagationKernel)(const double*, const unsigned&,
+                                           const Matrix<double>&,
+                                           Matrix<double>&, Matrix<double>&);
+
+  /// Pointer to a kernel calculating the outputs of the layer for a block of
+  /// instances in single precision.
+
+  typedef void (*SinglePrecisionOutputsKernel)(const float*, const unsigned&,
+                                               const unsigned&,
+                                               const unsigned&, const float*,
+                                               float*);
+
+  /// Pointer to a kernel calculating the activations and the activation
+  /// derivatives of the layer for a block of instances in single precision.
+
+  typedef void (*SinglePrecisionForwardPropagationKernel)(
+      const float*, const unsigned&, const Matrix<float>&, Matrix<float>&,
+      Matrix<float>&);
+
+  template <class Activation, class Type>
+  static void calculate_outputs_kernel(const Type*, const unsigned&,
+                                       const unsigned&, const unsigned&,
+                                       const Type*, Type*);
+
+  template <class Activation, class Type>
+  static void calculate_forward_propagation_kernel(const Type*,
+                                                   const unsigned&,
+                                                   const Matrix<Type>&,
+                                                   Matrix<Type>&,
+                                                   Matrix<Type>&);
+
+  template <class Activation>
+  void set_activation_kernels(void);
+
+  void set_kernels(void);
+
   // MEMBERS
 
-  /// Vectors of perceptrons which defines the layer.
-  /// The size of the vector is equal to the number of perceptrons in the layer.
+  /// Biases and synaptic weights of the layer, in the same order as they are
+  /// arranged: the bias of each perceptron followed by its synaptic weights.
+  /// Seen as a matrix with one row per perceptron, the first column contains
+  /// the biases and the rest of columns the synaptic weights.
+
+  Vector<double> parameters;
+
+  /// Number of inputs to the layer.
+
+  unsigned inputs_number;
+
+  /// Number of perceptrons in the layer.
+
+  unsigned perceptrons_number;
+
+  /// Activation function of all the perceptrons in the layer.
+
+  Perceptron::ActivationFunction activation_function;
+
+  /// Accuracy of the activation kernels, exact or fast.
+
+  Perceptron::ActivationAccuracy activation_accuracy;
+
+  /// Outputs kernel specialized for the activation function and the
+  /// activation accuracy of the layer.
+
+  OutputsKernel outputs_kernel;
+
+  /// Forward propagation kernel specialized for the activation function and
+  /// the activation accuracy of the layer.
+
+  ForwardPropagationKernel forward_propagation_kernel;
+
+  /// Single precision outputs kernel for the activation function and the
+  /// activation accuracy of the layer.
+
+  SinglePrecisionOutputsKernel single_precision_outputs_kernel;
+
+  /// Single precision forward propagation kernel for the activation function
+  /// and the activation accuracy of the layer.
 
-  Vector<Perceptron> perceptrons;
+  SinglePrecisionForwardPropagationKernel
+      single_precision_forward_propagation_kernel;
 
   /// Display messages to screen.
 
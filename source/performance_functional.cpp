@@ -1107,6 +1107,80 @@ PerformanceFunctional::get_outputs_integrals_regularization_pointer(
   return (outputs_integrals_regularization_pointer);
 }
 
+// PerformanceTerm* get_objective_term_pointer(void) const method
+
+/// Returns a pointer to the performance term used as objective, whatever its
+/// type.
+/// If there is no objective term, it returns NULL.
+
+PerformanceTerm* PerformanceFunctional::get_objective_term_pointer(
+    void) const {
+  switch (objective_type) {
+    case NO_OBJECTIVE: {
+      return (NULL);
+    } break;
+
+    case SUM_SQUARED_ERROR_OBJECTIVE: {
+      return (sum_squared_error_objective_pointer);
+    } break;
+
+    case MEAN_SQUARED_ERROR_OBJECTIVE: {
+      return (mean_squared_error_objective_pointer);
+    } break;
+
+    case ROOT_MEAN_SQUARED_ERROR_OBJECTIVE: {
+      return (root_mean_squared_error_objective_pointer);
+    } break;
+
+    case NORMALIZED_SQUARED_ERROR_OBJECTIVE: {
+      return (normalized_squared_error_objective_pointer);
+    } break;
+
+    case MINKOWSKI_ERROR_OBJECTIVE: {
+      return (Minkowski_error_objective_pointer);
+    } break;
+
+    case CROSS_ENTROPY_ERROR_OBJECTIVE: {
+      return (cross_entropy_error_objective_pointer);
+    } break;
+
+    case OUTPUTS_INTEGRALS_OBJECTIVE: {
+      return (outputs_integrals_objective_pointer);
+    } break;
+
+    case SOLUTIONS_ERROR_OBJECTIVE: {
+      return (solutions_error_objective_pointer);
+    } break;
+
+    case FINAL_SOLUTIONS_ERROR_OBJECTIVE: {
+      return (final_solutions_error_objective_pointer);
+    } break;
+
+    case INDEPENDENT_PARAMETERS_ERROR_OBJECTIVE: {
+      return (independent_parameters_error_objective_pointer);
+    } break;
+
+    case INVERSE_SUM_SQUARED_ERROR_OBJECTIVE: {
+      return (inverse_sum_squared_error_objective_pointer);
+    } break;
+
+    case USER_OBJECTIVE: {
+      return (user_objective_pointer);
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: PerformanceFunctional class.\n"
+             << "PerformanceTerm* get_objective_term_pointer(void) const "
+                "method.\n"
+             << "Unknown objective type.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+}
+
 // PerformanceTerm* get_user_regularization_pointer(void) const method
 
 /// Returns a pointer to the user regularization functional.
@@ -2165,6 +2239,58 @@ void PerformanceFunctional::set_display(const bool& new_display) {
   display = new_display;
 }
 
+// void set_threads_number(const unsigned&) method
+
+/// Sets the number of threads used by the objective term to evaluate the
+/// performance, the gradient, the terms and the terms Jacobian over the
+/// training instances.
+/// Regularization and constraints terms do not depend on the data set and are
+/// always evaluated sequentially.
+/// @param new_threads_number Number of threads.
+
+void PerformanceFunctional::set_threads_number(
+    const unsigned& new_threads_number) {
+  PerformanceTerm* objective_term_pointer = get_objective_term_pointer();
+
+  if (objective_term_pointer) {
+    objective_term_pointer->set_threads_number(new_threads_number);
+  }
+}
+
+// void set_deterministic_reduction(const bool&) method
+
+/// Sets whether the objective term sums the contributions of the training
+/// instances in a fixed order, so that results do not depend on the number of
+/// threads.
+/// @param new_deterministic_reduction True for a fixed order reduction, false
+/// otherwise.
+
+void PerformanceFunctional::set_deterministic_reduction(
+    const bool& new_deterministic_reduction) {
+  PerformanceTerm* objective_term_pointer = get_objective_term_pointer();
+
+  if (objective_term_pointer) {
+    objective_term_pointer->set_deterministic_reduction(
+        new_deterministic_reduction);
+  }
+}
+
+// void set_single_precision(const bool&) method
+
+/// Sets whether the objective term calculates the training error and gradient
+/// in single precision.
+/// @param new_single_precision True for single precision, false for double
+/// precision.
+
+void PerformanceFunctional::set_single_precision(
+    const bool& new_single_precision) {
+  PerformanceTerm* objective_term_pointer = get_objective_term_pointer();
+
+  if (objective_term_pointer) {
+    objective_term_pointer->set_single_precision(new_single_precision);
+  }
+}
+
 // void set_objective_type(const ObjectiveType&) method
 
 /// Creates a new objective term inside the performance functional of a given
@@ -4354,6 +4480,74 @@ double PerformanceFunctional::calculate_performance(
           calculate_constraints(parameters));
 }
 
+// Vector<double> calculate_performances(const Vector< Vector<double> >&) const
+// method
+
+/// Returns the performances of a neural network for several vectors of
+/// parameters, none of which is set to the neural network.
+/// For the sum squared, mean squared and normalized squared errors the
+/// objective is calculated for all the vectors in a single pass over the
+/// training instances.
+/// The regularization and constraints terms, if any, are evaluated for each
+/// vector in turn.
+/// @param parameters Vectors of parameters for the neural network associated
+/// to the performance functional.
+
+Vector<double> PerformanceFunctional::calculate_performances(
+    const Vector<Vector<double> >& parameters) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check_neural_network();
+
+  check_performance_terms();
+
+#endif
+
+  const unsigned points_number = parameters.size();
+
+  Vector<double> performances;
+
+  switch (objective_type) {
+    case SUM_SQUARED_ERROR_OBJECTIVE: {
+      performances =
+          sum_squared_error_objective_pointer->calculate_performances(
+              parameters);
+    } break;
+
+    case MEAN_SQUARED_ERROR_OBJECTIVE: {
+      performances =
+          mean_squared_error_objective_pointer->calculate_performances(
+              parameters);
+    } break;
+
+    case NORMALIZED_SQUARED_ERROR_OBJECTIVE: {
+      performances =
+          normalized_squared_error_objective_pointer->calculate_performances(
+              parameters);
+    } break;
+
+    default: {
+      performances.set(points_number);
+
+      for (unsigned i = 0; i < points_number; i++) {
+        performances[i] = calculate_objective(parameters[i]);
+      }
+    } break;
+  }
+
+  if (regularization_type != NO_REGULARIZATION ||
+      constraints_type != NO_CONSTRAINTS) {
+    for (unsigned i = 0; i < points_number; i++) {
+      performances[i] += calculate_regularization(parameters[i]) +
+                         calculate_constraints(parameters[i]);
+    }
+  }
+
+  return (performances);
+}
+
 // double calculate_generalization_objective(void) const method
 
 /// Returns the evaluation of the objective term on the generalization instances
@@ -4749,21 +4943,296 @@ Matrix<double> PerformanceFunctional::calculate_terms_Jacobian(void) const {
   return (objective_terms_Jacobian);
 }
 
-// Matrix<double> calculate_inverse_Hessian(void) const method
+// PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const
+// method
 
-/// Returns inverse matrix of the Hessian.
-/// It first computes the Hessian matrix and then computes its inverse.
-/// @todo
+/// Returns the performance terms and the terms Jacobian, as calculate_terms and
+/// calculate_terms_Jacobian do.
+/// The objective terms and their Jacobian are calculated together, with a
+/// single propagation of the training instances.
 
-Matrix<double> PerformanceFunctional::calculate_inverse_Hessian(void) const {
-  std::ostringstream buffer;
+PerformanceTerm::FirstOrderTerms
+PerformanceFunctional::calculate_first_order_terms(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check_neural_network();
+
+  check_performance_terms();
+
+#endif
+
+  PerformanceTerm::FirstOrderTerms first_order_terms;
+
+  switch (objective_type) {
+    case SUM_SQUARED_ERROR_OBJECTIVE: {
+      first_order_terms =
+          sum_squared_error_objective_pointer->calculate_first_order_terms();
+    } break;
+
+    case MEAN_SQUARED_ERROR_OBJECTIVE: {
+      first_order_terms =
+          mean_squared_error_objective_pointer->calculate_first_order_terms();
+    } break;
+
+    case NORMALIZED_SQUARED_ERROR_OBJECTIVE: {
+      first_order_terms = normalized_squared_error_objective_pointer
+          ->calculate_first_order_terms();
+    } break;
+
+    default: {
+      first_order_terms.terms = calculate_objective_terms();
+      first_order_terms.Jacobian = calculate_objective_terms_Jacobian();
+    } break;
+  }
+
+  first_order_terms.terms = first_order_terms.terms.assemble(
+      calculate_regularization_terms()).assemble(calculate_constraints_terms());
+
+  return (first_order_terms);
+}
+
+// const PerformanceTerm* split_Gauss_Newton_terms(
+// PerformanceTerm::FirstOrderTerms&) const method
+
+/// Splits the performance terms for the Gauss-Newton products.
+/// Returns a pointer to the objective term if it is a sum squared, mean squared
+/// or normalized squared error, which accumulate their products over the
+/// training instances without forming the terms Jacobian, and NULL otherwise.
+/// @param explicit_first_order_terms Remaining terms and their Jacobian,
+/// stacked by rows: those of the objective if it is not streamed, followed by
+/// those of the regularization and constraints, if any.
+
+const PerformanceTerm* PerformanceFunctional::split_Gauss_Newton_terms(
+    PerformanceTerm::FirstOrderTerms& explicit_first_order_terms) const {
+  const PerformanceTerm* streamed_objective_pointer = NULL;
 
-  buffer << "OpenNN Exception: PerformanceFunctional class.\n"
-         << "Matrix<double> calculate_inverse_Hessian(void) const method.\n"
-         << "This method is not yet implemented.\n";
+  explicit_first_order_terms.terms.set();
+  explicit_first_order_terms.Jacobian.set();
 
-  throw std::logic_error(buffer.str());
+  switch (objective_type) {
+    case SUM_SQUARED_ERROR_OBJECTIVE: {
+      streamed_objective_pointer = sum_squared_error_objective_pointer;
+    } break;
+
+    case MEAN_SQUARED_ERROR_OBJECTIVE: {
+      streamed_objective_pointer = mean_squared_error_objective_pointer;
+    } break;
+
+    case NORMALIZED_SQUARED_ERROR_OBJECTIVE: {
+      streamed_objective_pointer = normalized_squared_error_objective_pointer;
+    } break;
+
+    default: {
+      explicit_first_order_terms.terms = calculate_objective_terms();
+      explicit_first_order_terms.Jacobian =
+          calculate_objective_terms_Jacobian();
+    } break;
+  }
+
+  if (regularization_type != NO_REGULARIZATION) {
+    const Matrix<double> regularization_terms_Jacobian =
+        calculate_regularization_terms_Jacobian();
+
+    explicit_first_order_terms.terms =
+        explicit_first_order_terms.terms.assemble(
+            calculate_regularization_terms());
+
+    if (explicit_first_order_terms.Jacobian.empty()) {
+      explicit_first_order_terms.Jacobian = regularization_terms_Jacobian;
+    } else {
+      explicit_first_order_terms.Jacobian =
+          explicit_first_order_terms.Jacobian.assemble_rows(
+              regularization_terms_Jacobian);
+    }
+  }
+
+  if (constraints_type != NO_CONSTRAINTS) {
+    const Matrix<double> constraints_terms_Jacobian =
+        calculate_constraints_terms_Jacobian();
+
+    explicit_first_order_terms.terms =
+        explicit_first_order_terms.terms.assemble(
+            calculate_constraints_terms());
+
+    if (explicit_first_order_terms.Jacobian.empty()) {
+      explicit_first_order_terms.Jacobian = constraints_terms_Jacobian;
+    } else {
+      explicit_first_order_terms.Jacobian =
+          explicit_first_order_terms.Jacobian.assemble_rows(
+              constraints_terms_Jacobian);
+    }
+  }
+
+  return (streamed_objective_pointer);
+}
+
+// TermsJacobianProducts calculate_terms_Jacobian_products(void) const method
+
+/// Returns the sum of the squared performance terms, and the products of the
+/// transposed terms Jacobian with the terms and with itself.
+/// For the sum squared, mean squared and normalized squared errors the
+/// objective products are accumulated over the training instances, and the
+/// terms Jacobian is never formed.
+/// The products of the other terms are added from their terms and Jacobians.
+
+PerformanceTerm::TermsJacobianProducts
+PerformanceFunctional::calculate_terms_Jacobian_products(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check_neural_network();
+
+  check_performance_terms();
+
+#endif
+
+  const unsigned parameters_number =
+      neural_network_pointer->count_parameters_number();
+
+  PerformanceTerm::FirstOrderTerms explicit_first_order_terms;
+
+  const PerformanceTerm* streamed_objective_pointer =
+      split_Gauss_Newton_terms(explicit_first_order_terms);
+
+  PerformanceTerm::TermsJacobianProducts terms_Jacobian_products;
+
+  if (streamed_objective_pointer != NULL) {
+    terms_Jacobian_products =
+        streamed_objective_pointer->calculate_terms_Jacobian_products();
+  } else {
+    terms_Jacobian_products.terms_squared_sum = 0.0;
+    terms_Jacobian_products.JacobianT_dot_terms.set(parameters_number, 0.0);
+    terms_Jacobian_products.JacobianT_dot_Jacobian.set(parameters_number,
+                                                       parameters_number, 0.0);
+  }
+
+  if (!explicit_first_order_terms.Jacobian.empty()) {
+    const Vector<double>& terms = explicit_first_order_terms.terms;
+
+    const Matrix<double> terms_JacobianT =
+        explicit_first_order_terms.Jacobian.calculate_transpose();
+
+    terms_Jacobian_products.terms_squared_sum += terms.dot(terms);
+
+    terms_Jacobian_products.JacobianT_dot_terms += terms_JacobianT.dot(terms);
+
+    terms_Jacobian_products.JacobianT_dot_Jacobian +=
+        terms_JacobianT.dot(explicit_first_order_terms.Jacobian);
+  }
+
+  return (terms_Jacobian_products);
+}
+
+// Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(const
+// Vector<double>&) const method
+
+/// Returns the product of the transposed terms Jacobian, the terms Jacobian
+/// and a vector of parameters, which is the product of the Gauss-Newton
+/// approximation of the Hessian and the vector.
+/// For the sum squared, mean squared and normalized squared errors the
+/// objective product is calculated over the training instances without forming
+/// the terms Jacobian.
+/// The products of the other terms are added from their terms Jacobians.
+/// @param vector Vector of parameters in the product.
+
+Vector<double>
+PerformanceFunctional::calculate_JacobianT_dot_Jacobian_dot_vector(
+    const Vector<double>& vector) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check_neural_network();
+
+  check_performance_terms();
+
+#endif
+
+  const unsigned parameters_number =
+      neural_network_pointer->count_parameters_number();
+
+  PerformanceTerm::FirstOrderTerms explicit_first_order_terms;
+
+  const PerformanceTerm* streamed_objective_pointer =
+      split_Gauss_Newton_terms(explicit_first_order_terms);
+
+  Vector<double> product(parameters_number, 0.0);
+
+  if (streamed_objective_pointer != NULL) {
+    product = streamed_objective_pointer
+                  ->calculate_JacobianT_dot_Jacobian_dot_vector(vector);
+  }
 
+  if (!explicit_first_order_terms.Jacobian.empty()) {
+    const Matrix<double>& terms_Jacobian = explicit_first_order_terms.Jacobian;
+
+    product += terms_Jacobian.calculate_transpose().dot(
+        terms_Jacobian.dot(vector));
+  }
+
+  return (product);
+}
+
+// Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const method
+
+/// Returns the diagonal of the product of the transposed terms Jacobian and
+/// the terms Jacobian.
+/// Each element is the squared norm of a column of the terms Jacobian, so that
+/// the product itself is never formed.
+/// For the sum squared, mean squared and normalized squared errors the
+/// objective diagonal is calculated over the training instances without
+/// forming the terms Jacobian.
+
+Vector<double>
+PerformanceFunctional::calculate_JacobianT_dot_Jacobian_diagonal(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check_neural_network();
+
+  check_performance_terms();
+
+#endif
+
+  const unsigned parameters_number =
+      neural_network_pointer->count_parameters_number();
+
+  PerformanceTerm::FirstOrderTerms explicit_first_order_terms;
+
+  const PerformanceTerm* streamed_objective_pointer =
+      split_Gauss_Newton_terms(explicit_first_order_terms);
+
+  Vector<double> diagonal(parameters_number, 0.0);
+
+  if (streamed_objective_pointer != NULL) {
+    diagonal =
+        streamed_objective_pointer->calculate_JacobianT_dot_Jacobian_diagonal();
+  }
+
+  const Matrix<double>& terms_Jacobian = explicit_first_order_terms.Jacobian;
+
+  const unsigned terms_number = terms_Jacobian.get_rows_number();
+
+  for (unsigned i = 0; i < terms_number; i++) {
+    for (unsigned j = 0; j < parameters_number; j++) {
+      diagonal[j] += terms_Jacobian[i][j] * terms_Jacobian[i][j];
+    }
+  }
+
+  return (diagonal);
+}
+
+// Matrix<double> calculate_inverse_Hessian(void) const method
+
+/// Returns inverse matrix of the Hessian.
+/// It first computes the Hessian matrix and then computes its inverse, by
+/// means of the LU factorization.
+
+Matrix<double> PerformanceFunctional::calculate_inverse_Hessian(void) const {
 // Control sentence (if debug)
 
 #ifndef NDEBUG
@@ -4774,18 +5243,21 @@ Matrix<double> PerformanceFunctional::calculate_inverse_Hessian(void) const {
 
 #endif
 
-  //   const Matrix<double> Hessian = calculate_Hessian();
+  const Matrix<double> Hessian = calculate_Hessian();
 
-  //   return(Hessian.calculate_inverse());
+  return (Hessian.calculate_inverse());
 }
 
 // Vector<double> calculate_vector_dot_Hessian(Vector<double>) const method
 
-/// Returns the default product of some vector with the objective function
-/// Hessian matrix, which is
-/// computed using numerical differentiation.
+/// Returns the product of the performance functional Hessian and a given
+/// vector of parameters.
+/// The objective term contribution is calculated by the objective term itself,
+/// which for the sum squared, mean squared, normalized squared and cross
+/// entropy errors is exact and does not form the Hessian matrix.
+/// The regularization and constraints contributions are the products of their
+/// Hessian matrices and the vector.
 /// @param vector Vector in the dot product.
-/// @todo
 
 Vector<double> PerformanceFunctional::calculate_vector_dot_Hessian(
     const Vector<double>& vector) const {
@@ -4819,7 +5291,26 @@ Vector<double> PerformanceFunctional::calculate_vector_dot_Hessian(
 
   // Calculate vector Hessian product
 
-  Vector<double> vector_Hessian_product(parameters_number);
+  Vector<double> vector_Hessian_product(parameters_number, 0.0);
+
+  const PerformanceTerm* objective_term_pointer = get_objective_term_pointer();
+
+  if (objective_term_pointer) {
+    if (!neural_network_pointer->has_independent_parameters()) {
+      vector_Hessian_product +=
+          objective_term_pointer->calculate_vector_dot_Hessian(vector);
+    } else {
+      vector_Hessian_product += calculate_objective_Hessian().dot(vector);
+    }
+  }
+
+  if (regularization_type != NO_REGULARIZATION) {
+    vector_Hessian_product += calculate_regularization_Hessian().dot(vector);
+  }
+
+  if (constraints_type != NO_CONSTRAINTS) {
+    vector_Hessian_product += calculate_constraints_Hessian().dot(vector);
+  }
 
   return (vector_Hessian_product);
 }
@@ -4842,13 +5333,43 @@ PerformanceFunctional::calculate_zero_order_performance(void) const {
 
 /// Returns a first order performance structure, which contains the value and
 /// the gradient of the performance function.
+/// The objective term calculates both with a single propagation of the training
+/// instances when it can, so this is cheaper than calling calculate_performance
+/// and calculate_gradient separately.
 
 PerformanceFunctional::FirstOrderperformance
 PerformanceFunctional::calculate_first_order_performance(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check_neural_network();
+
+  check_performance_terms();
+
+#endif
+
   FirstOrderperformance first_order_performance;
 
-  first_order_performance.performance = calculate_performance();
-  first_order_performance.gradient = calculate_gradient();
+  const PerformanceTerm* objective_term_pointer = get_objective_term_pointer();
+
+  if (objective_term_pointer) {
+    const PerformanceTerm::FirstOrderPerformance objective_first_order =
+        objective_term_pointer->calculate_first_order_performance();
+
+    first_order_performance.performance = objective_first_order.performance;
+    first_order_performance.gradient = objective_first_order.gradient;
+  } else {
+    first_order_performance.performance = 0.0;
+    first_order_performance.gradient.set(
+        neural_network_pointer->count_parameters_number(), 0.0);
+  }
+
+  first_order_performance.performance +=
+      calculate_regularization() + calculate_constraints();
+
+  first_order_performance.gradient +=
+      calculate_regularization_gradient() + calculate_constraints_gradient();
 
   return (first_order_performance);
 }
@@ -4996,6 +5517,31 @@ double PerformanceFunctional::calculate_performance(
   return (calculate_performance(parameters + increment));
 }
 
+// Vector<double> calculate_performances(const Vector<double>&, const
+// Vector<double>&) const method
+
+/// Returns the values of the performance function at several steps along some
+/// direction, which are all evaluated in a single pass over the data when the
+/// objective term allows it.
+/// @param direction Direction vector.
+/// @param rates Step values.
+
+Vector<double> PerformanceFunctional::calculate_performances(
+    const Vector<double>& direction, const Vector<double>& rates) const {
+  const Vector<double> parameters =
+      neural_network_pointer->arrange_parameters();
+
+  const unsigned points_number = rates.size();
+
+  Vector<Vector<double> > points_parameters(points_number);
+
+  for (unsigned i = 0; i < points_number; i++) {
+    points_parameters[i] = parameters + direction * rates[i];
+  }
+
+  return (calculate_performances(points_parameters));
+}
+
 // double calculate_performance_derivative(const Vector<double>&, const double&)
 // const method
 
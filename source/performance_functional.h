@@ -296,6 +296,8 @@ class PerformanceFunctional {
       void) const;
   PerformanceTerm* get_user_objective_pointer(void) const;
 
+  PerformanceTerm* get_objective_term_pointer(void) const;
+
   // Regularization terms
 
   NeuralParametersNorm* get_neural_parameters_norm_regularization_pointer(
@@ -362,6 +364,10 @@ class PerformanceFunctional {
 
   void set_display(const bool&);
 
+  void set_threads_number(const unsigned&);
+  void set_deterministic_reduction(const bool&);
+  void set_single_precision(const bool&);
+
   // Performance functional methods
 
   double calculate_objective(void) const;
@@ -404,6 +410,8 @@ class PerformanceFunctional {
   Vector<double> calculate_gradient(const Vector<double>&) const;
   Matrix<double> calculate_Hessian(const Vector<double>&) const;
 
+  Vector<double> calculate_performances(const Vector<Vector<double> >&) const;
+
   virtual Matrix<double> calculate_inverse_Hessian(void) const;
 
   virtual Vector<double> calculate_vector_dot_Hessian(
@@ -412,6 +420,18 @@ class PerformanceFunctional {
   Vector<double> calculate_terms(void) const;
   Matrix<double> calculate_terms_Jacobian(void) const;
 
+  PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const;
+
+  const PerformanceTerm* split_Gauss_Newton_terms(
+      PerformanceTerm::FirstOrderTerms&) const;
+
+  PerformanceTerm::TermsJacobianProducts calculate_terms_Jacobian_products(
+      void) const;
+
+  Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(
+      const Vector<double>&) const;
+  Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const;
+
   virtual ZeroOrderperformance calculate_zero_order_performance(void) const;
   virtual FirstOrderperformance calculate_first_order_performance(void) const;
   virtual SecondOrderperformance calculate_second_order_performance(void) const;
@@ -433,6 +453,8 @@ class PerformanceFunctional {
   // Directional performance
 
   double calculate_performance(const Vector<double>&, const double&) const;
+  Vector<double> calculate_performances(const Vector<double>&,
+                                        const Vector<double>&) const;
   double calculate_performance_derivative(const Vector<double>&,
                                           const double&) const;
   double calculate_performance_second_derivative(const Vector<double>&,
@@ -194,6 +194,14 @@ PerformanceTerm::PerformanceTerm(const PerformanceTerm& other_performance_term)
         *other_performance_term.numerical_differentiation_pointer);
   }
 
+  batch_instances_number = other_performance_term.batch_instances_number;
+
+  threads_number = other_performance_term.threads_number;
+
+  deterministic_reduction = other_performance_term.deterministic_reduction;
+
+  single_precision = other_performance_term.single_precision;
+
   display = other_performance_term.display;
 }
 
@@ -235,6 +243,14 @@ PerformanceTerm& PerformanceTerm::operator=(
           *other_performance_term.numerical_differentiation_pointer);
     }
 
+    batch_instances_number = other_performance_term.batch_instances_number;
+
+    threads_number = other_performance_term.threads_number;
+
+    deterministic_reduction = other_performance_term.deterministic_reduction;
+
+    single_precision = other_performance_term.single_precision;
+
     display = other_performance_term.display;
   }
 
@@ -272,7 +288,13 @@ bool PerformanceTerm::operator==(
       //   {
       //       return(false);
       //   }
-      else if (display != other_performance_term.display) {
+      else if (display != other_performance_term.display ||
+               batch_instances_number !=
+                   other_performance_term.batch_instances_number ||
+               threads_number != other_performance_term.threads_number ||
+               deterministic_reduction !=
+                   other_performance_term.deterministic_reduction ||
+               single_precision != other_performance_term.single_precision) {
     return (false);
   } else {
     return (true);
@@ -289,6 +311,42 @@ bool PerformanceTerm::operator==(
 
 const bool& PerformanceTerm::get_display(void) const { return (display); }
 
+// const unsigned& get_batch_instances_number(void) const method
+
+/// Returns the number of training instances which are processed together by
+/// the batch back-propagation algorithm.
+
+const unsigned& PerformanceTerm::get_batch_instances_number(void) const {
+  return (batch_instances_number);
+}
+
+// const unsigned& get_threads_number(void) const method
+
+/// Returns the number of threads used to evaluate the performance term over the
+/// training instances.
+
+const unsigned& PerformanceTerm::get_threads_number(void) const {
+  return (threads_number);
+}
+
+// const bool& get_deterministic_reduction(void) const method
+
+/// Returns true if the results of the parallel evaluation do not depend on the
+/// number of threads, and false otherwise.
+
+const bool& PerformanceTerm::get_deterministic_reduction(void) const {
+  return (deterministic_reduction);
+}
+
+// const bool& get_single_precision(void) const method
+
+/// Returns true if the training error and gradient are calculated in single
+/// precision, and false if they are calculated in double precision.
+
+const bool& PerformanceTerm::get_single_precision(void) const {
+  return (single_precision);
+}
+
 // bool has_neural_network(void) const method
 
 /// Returns true if this performance term has a neural network associated,
@@ -484,6 +542,14 @@ void PerformanceTerm::set(const PerformanceTerm& other_performance_term) {
         *other_performance_term.numerical_differentiation_pointer);
   }
 
+  batch_instances_number = other_performance_term.batch_instances_number;
+
+  threads_number = other_performance_term.threads_number;
+
+  deterministic_reduction = other_performance_term.deterministic_reduction;
+
+  single_precision = other_performance_term.single_precision;
+
   display = other_performance_term.display;
 }
 
@@ -533,10 +599,24 @@ void PerformanceTerm::set_numerical_differentiation_pointer(
 
 /// Sets the members of the performance term to their default values:
 /// <ul>
+/// <li> Batch instances number: 64.
+/// <li> Threads number: 1.
+/// <li> Deterministic reduction: false.
+/// <li> Single precision: false.
 /// <li> Display: true.
 /// </ul>
 
-void PerformanceTerm::set_default(void) { display = true; }
+void PerformanceTerm::set_default(void) {
+  batch_instances_number = 64;
+
+  threads_number = 1;
+
+  deterministic_reduction = false;
+
+  single_precision = false;
+
+  display = true;
+}
 
 // void set_display(const bool&) method
 
@@ -551,6 +631,95 @@ void PerformanceTerm::set_display(const bool& new_display) {
   display = new_display;
 }
 
+// void set_batch_instances_number(const unsigned&) method
+
+/// Sets the number of training instances which are processed together by the
+/// batch back-propagation algorithm.
+/// Larger blocks make a better use of the cache in the matrix products, at the
+/// cost of larger workspaces.
+/// @param new_batch_instances_number Number of instances in a block.
+
+void PerformanceTerm::set_batch_instances_number(
+    const unsigned& new_batch_instances_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_batch_instances_number == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "void set_batch_instances_number(const unsigned&) method.\n"
+           << "Number of batch instances must be greater than zero.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  batch_instances_number = new_batch_instances_number;
+}
+
+// void set_threads_number(const unsigned&) method
+
+/// Sets the number of threads among which the training instances are shared
+/// when evaluating the performance term, its gradient, its terms and its terms
+/// Jacobian.
+/// It has no effect if the library has been built without OpenMP.
+/// @param new_threads_number Number of threads.
+
+void PerformanceTerm::set_threads_number(const unsigned& new_threads_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_threads_number == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "void set_threads_number(const unsigned&) method.\n"
+           << "Number of threads must be greater than zero.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  threads_number = new_threads_number;
+}
+
+// void set_deterministic_reduction(const bool&) method
+
+/// Sets whether the partial results of the threads are to be added in an order
+/// which does not depend on the number of threads.
+/// If true, the training instances are always split in the same chunks, and the
+/// chunk results are added pairwise in a fixed tree, so that the results are
+/// the same bit for bit with any number of threads.
+/// If false, there is one chunk per thread, which needs less memory.
+/// @param new_deterministic_reduction Deterministic reduction value.
+
+void PerformanceTerm::set_deterministic_reduction(
+    const bool& new_deterministic_reduction) {
+  deterministic_reduction = new_deterministic_reduction;
+}
+
+// void set_single_precision(const bool&) method
+
+/// Sets whether the training error and gradient are to be calculated in single
+/// precision.
+/// If true, the data blocks, the parameters and the layers activations and
+/// delta are stored as floats, which halves the memory traffic of each block.
+/// The combinations and the gradient are still accumulated in double
+/// precision, and the gradient is returned as doubles.
+/// Neural networks with a conditions layer, and the rest of the evaluation
+/// methods, such as the terms Jacobian or the Hessian products, always use
+/// double precision.
+/// @param new_single_precision Single precision value.
+
+void PerformanceTerm::set_single_precision(const bool& new_single_precision) {
+  single_precision = new_single_precision;
+}
+
 // void construct_numerical_differentiation(void) method
 
 /// This method constructs the numerical differentiation object which composes
@@ -933,8 +1102,6 @@ Vector<double> PerformanceTerm::calculate_point_gradient(
   }
 
   if (layers_number != 0) {
-    Vector<double> synaptic_weights;
-
     unsigned index = 0;
 
     // First layer
@@ -947,9 +1114,6 @@ Vector<double> PerformanceTerm::calculate_point_gradient(
 
       // Synaptic weights
 
-      synaptic_weights = multilayer_perceptron_pointer->get_layer(0)
-          .get_perceptron(i).arrange_synaptic_weights();
-
       for (unsigned j = 0; j < inputs_number; j++) {
         point_gradient[index] = layers_delta[0][i] * inputs[j];
         index++;
@@ -967,9 +1131,6 @@ Vector<double> PerformanceTerm::calculate_point_gradient(
 
         // Synaptic weights
 
-        synaptic_weights = multilayer_perceptron_pointer->get_layer(h)
-            .get_perceptron(i).arrange_synaptic_weights();
-
         for (unsigned j = 0; j < layers_perceptrons_number[h - 1]; j++) {
           point_gradient[index] =
               layers_delta[h][i] * layers_activation[h - 1][j];
@@ -1382,175 +1543,2826 @@ Matrix<double> PerformanceTerm::calculate_point_Hessian(
   return (point_Hessian);
 }
 
-// Vector<double> calculate_gradient(void) const method
+// void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+// Matrix<double>&) const method
+
+/// Calculates the gradient of the performance term with respect to the outputs
+/// of the neural network, for a block of instances.
+/// This is the only quantity which the batch back-propagation algorithm needs
+/// from a given performance term.
+/// Constant factors common to all the instances, such as the mean over the
+/// training instances, might be left to the caller.
+/// Performance terms which use it must override this method.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param output_gradient Matrix to store the outputs gradient.
+
+void PerformanceTerm::calculate_output_gradient(const Matrix<double>&,
+                                                const Matrix<double>&,
+                                                Matrix<double>&) const {
+  std::ostringstream buffer;
 
-/// Returns the default gradient vector of the performance term.
-/// It uses numerical differentiation.
+  buffer << "OpenNN Exception: PerformanceTerm class.\n"
+         << "void calculate_output_gradient(const Matrix<double>&, const "
+            "Matrix<double>&, Matrix<double>&) const method.\n"
+         << "This method is not implemented for the "
+         << write_performance_term_type() << " performance term.\n";
 
-Vector<double> PerformanceTerm::calculate_gradient(void) const {
-// Neural network stuff
+  throw std::logic_error(buffer.str());
+}
 
-#ifndef NDEBUG
+// void calculate_output_vector_dot_Hessian(const Matrix<double>&, const
+// Matrix<double>&, const Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates, for a block of instances, the product of the Hessian of the
+/// performance term with respect to the outputs of the neural network and a
+/// given direction in the outputs space.
+/// This is the directional derivative of the outputs gradient, which the
+/// R-operator back-propagation needs from a given performance term.
+/// Constant factors common to all the instances are left to the caller, as in
+/// the calculate_output_gradient method.
+/// Performance terms which use it must override this method.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param outputs_direction Direction of the outputs, with one instance per
+/// row.
+/// @param output_product Matrix to store the outputs Hessian product.
+
+void PerformanceTerm::calculate_output_vector_dot_Hessian(
+    const Matrix<double>&, const Matrix<double>&, const Matrix<double>&,
+    Matrix<double>&) const {
+  std::ostringstream buffer;
 
-  check();
+  buffer << "OpenNN Exception: PerformanceTerm class.\n"
+         << "void calculate_output_vector_dot_Hessian(const Matrix<double>&, "
+            "const Matrix<double>&, const Matrix<double>&, Matrix<double>&) "
+            "const method.\n"
+         << "This method is not implemented for the "
+         << write_performance_term_type() << " performance term.\n";
 
-#endif
+  throw std::logic_error(buffer.str());
+}
 
-// Performance functional stuff
+// void calculate_layers_delta(const Vector< Matrix<double> >&, const
+// Matrix<double>&, Vector< Matrix<double> >&) const method
+
+/// Calculates the delta of all the layers in the multilayer perceptron for a
+/// block of instances.
+/// Each delta matrix has one instance per row and one perceptron per column.
+/// The hidden layers delta is obtained as the product of the next layer delta
+/// and its synaptic weights, scaled by the activation derivatives.
+/// @param layers_activation_derivative Activation derivatives of every layer.
+/// @param output_gradient Gradient of the performance term with respect to the
+/// outputs of the last layer.
+/// @param layers_delta Vector of matrices to store the layers delta.
+
+void PerformanceTerm::calculate_layers_delta(
+    const Vector<Matrix<double> >& layers_activation_derivative,
+    const Matrix<double>& output_gradient,
+    Vector<Matrix<double> >& layers_delta) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+// Control sentence (if debug)
 
 #ifndef NDEBUG
 
-  std::ostringstream buffer;
+  if (layers_activation_derivative.size() != layers_number) {
+    std::ostringstream buffer;
 
-  if (!numerical_differentiation_pointer) {
     buffer << "OpenNN Exception: PerformanceTerm class.\n"
-           << "Vector<double> calculate_gradient(void) const method.\n"
-           << "Numerical differentiation pointer is NULL.\n";
+           << "void calculate_layers_delta(const Vector< Matrix<double> >&, "
+              "const Matrix<double>&, Vector< Matrix<double> >&) const "
+              "method.\n"
+           << "Size of activation derivatives must be equal to number of "
+              "layers.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  if (layers_number > 0 &&
+      (output_gradient.get_rows_number() !=
+           layers_activation_derivative[layers_number - 1].get_rows_number() ||
+       output_gradient.get_columns_number() !=
+           layers_activation_derivative[layers_number - 1]
+               .get_columns_number())) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "void calculate_layers_delta(const Vector< Matrix<double> >&, "
+              "const Matrix<double>&, Vector< Matrix<double> >&) const "
+              "method.\n"
+           << "Size of output gradient must be equal to size of output layer "
+              "activation derivatives.\n";
 
     throw std::logic_error(buffer.str());
   }
 
 #endif
 
-  const Vector<double> parameters =
-      neural_network_pointer->arrange_parameters();
+  layers_delta.set(layers_number);
 
-  return (numerical_differentiation_pointer->calculate_gradient(
-      *this, &PerformanceTerm::calculate_performance, parameters));
-}
+  if (layers_number == 0) {
+    return;
+  }
 
-// Vector<double> calculate_gradient(const Vector<double>&) const method
+  // Output layer
 
-/// Returns the default gradient vector of the performance term.
-/// It uses numerical differentiation.
+  calculate_output_layer_delta(layers_activation_derivative[layers_number - 1],
+                               output_gradient,
+                               layers_delta[layers_number - 1]);
 
-Vector<double> PerformanceTerm::calculate_gradient(
-    const Vector<double>& parameters) const {
-// Neural network stuff
+  // Rest of hidden layers
 
-#ifndef NDEBUG
+  for (int h = layers_number - 2; h >= 0; h--) {
+    const Vector<double>& next_layer_parameters =
+        multilayer_perceptron_pointer->get_layer(h + 1).get_parameters();
 
-  check();
+    calculate_hidden_layer_delta(layers_delta[h + 1], &next_layer_parameters[0],
+                                 layers_activation_derivative[h],
+                                 layers_delta[h]);
+  }
+}
 
-#endif
+// void calculate_layers_delta(const Vector< Matrix<float> >&, const
+// Matrix<double>&, const Vector<float>&, Vector< Matrix<float> >&) const method
+
+/// Calculates the delta of all the layers in the multilayer perceptron for a
+/// block of instances in single precision.
+/// The synaptic weights are read from a single precision parameters vector,
+/// and the products of each delta are accumulated in double precision.
+/// @param layers_activation_derivative Single precision activation
+/// derivatives of every layer.
+/// @param output_gradient Gradient of the performance term with respect to the
+/// outputs of the last layer.
+/// @param parameters Single precision parameters of the multilayer perceptron,
+/// as given by its arrange_single_precision_parameters method.
+/// @param layers_delta Vector of matrices to store the layers delta.
+
+void PerformanceTerm::calculate_layers_delta(
+    const Vector<Matrix<float> >& layers_activation_derivative,
+    const Matrix<double>& output_gradient, const Vector<float>& parameters,
+    Vector<Matrix<float> >& layers_delta) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
 
-// Performance functional stuff
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+// Control sentence (if debug)
 
 #ifndef NDEBUG
 
-  std::ostringstream buffer;
+  if (layers_activation_derivative.size() != layers_number ||
+      parameters.size() !=
+          multilayer_perceptron_pointer->count_parameters_number()) {
+    std::ostringstream buffer;
 
-  if (!numerical_differentiation_pointer) {
     buffer << "OpenNN Exception: PerformanceTerm class.\n"
-           << "Vector<double> calculate_gradient(const Vector<double>&) const "
-              "method.\n"
-           << "Numerical differentiation pointer is NULL.\n";
+           << "void calculate_layers_delta(const Vector< Matrix<float> >&, "
+              "const Matrix<double>&, const Vector<float>&, Vector< "
+              "Matrix<float> >&) const method.\n"
+           << "Sizes of activation derivatives and parameters must match the "
+              "multilayer perceptron.\n";
 
     throw std::logic_error(buffer.str());
   }
 
 #endif
 
-  return (numerical_differentiation_pointer->calculate_gradient(
-      *this, &PerformanceTerm::calculate_performance, parameters));
-}
+  layers_delta.set(layers_number);
 
-// Matrix<double> calculate_Hessian(void) const method
+  if (layers_number == 0) {
+    return;
+  }
 
-/// @todo
+  // Output layer
 
-Matrix<double> PerformanceTerm::calculate_Hessian(void) const {
-// Neural network stuff
+  calculate_output_layer_delta(layers_activation_derivative[layers_number - 1],
+                               output_gradient,
+                               layers_delta[layers_number - 1]);
 
-#ifndef NDEBUG
+  // Rest of hidden layers
 
-  check();
+  unsigned position = parameters.size();
 
-#endif
+  for (int h = layers_number - 2; h >= 0; h--) {
+    const PerceptronLayer& next_layer =
+        multilayer_perceptron_pointer->get_layer(h + 1);
 
-  const Vector<double> parameters =
-      neural_network_pointer->arrange_parameters();
+    position -= next_layer.count_parameters_number();
 
-  return (numerical_differentiation_pointer->calculate_Hessian(
-      *this, &PerformanceTerm::calculate_performance, parameters));
+    calculate_hidden_layer_delta(layers_delta[h + 1], &parameters[position],
+                                 layers_activation_derivative[h],
+                                 layers_delta[h]);
+  }
 }
 
-// Matrix<double> calculate_Hessian(const Vector<double>&) const method
+// template <class Type> void calculate_output_layer_delta(const
+// Matrix<Type>&, const Matrix<double>&, Matrix<Type>&) method
+
+/// Calculates the delta of the output layer for a block of instances, as the
+/// product of the activation derivatives and the outputs gradient.
+/// @param activation_derivative Activation derivatives of the output layer.
+/// @param output_gradient Gradient of the performance term with respect to the
+/// outputs of the last layer.
+/// @param layer_delta Matrix to store the output layer delta.
+
+template <class Type>
+void PerformanceTerm::calculate_output_layer_delta(
+    const Matrix<Type>& activation_derivative,
+    const Matrix<double>& output_gradient, Matrix<Type>& layer_delta) {
+  const unsigned instances_number = output_gradient.get_rows_number();
+  const unsigned outputs_number = output_gradient.get_columns_number();
+
+  layer_delta.set(instances_number, outputs_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    const Type* instance_activation_derivative = activation_derivative[i];
+    const double* instance_output_gradient = output_gradient[i];
+    Type* delta = layer_delta[i];
+
+    for (unsigned j = 0; j < outputs_number; j++) {
+      delta[j] = (Type)(instance_activation_derivative[j] *
+                        instance_output_gradient[j]);
+    }
+  }
+}
 
-/// @todo
+// template <class Type> void calculate_hidden_layer_delta(const
+// Matrix<Type>&, const Type*, const Matrix<Type>&, Matrix<Type>&) method
+
+/// Calculates the delta of a hidden layer for a block of instances, as the
+/// product of the next layer delta and its synaptic weights, scaled by the
+/// activation derivatives.
+/// The products are accumulated in double precision.
+/// @param next_layer_delta Delta of the next layer.
+/// @param next_layer_parameters Array with the parameters of the next layer,
+/// with the bias of each perceptron followed by its synaptic weights.
+/// @param activation_derivative Activation derivatives of the layer.
+/// @param layer_delta Matrix to store the layer delta.
+
+template <class Type>
+void PerformanceTerm::calculate_hidden_layer_delta(
+    const Matrix<Type>& next_layer_delta, const Type* next_layer_parameters,
+    const Matrix<Type>& activation_derivative, Matrix<Type>& layer_delta) {
+  const unsigned instances_number = next_layer_delta.get_rows_number();
+  const unsigned next_layer_perceptrons_number =
+      next_layer_delta.get_columns_number();
+  const unsigned layer_perceptrons_number =
+      activation_derivative.get_columns_number();
+
+  const unsigned next_perceptron_parameters_number =
+      1 + layer_perceptrons_number;
+
+  layer_delta.set(instances_number, layer_perceptrons_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    const Type* next_delta = next_layer_delta[i];
+    const Type* instance_activation_derivative = activation_derivative[i];
+    Type* delta = layer_delta[i];
+
+    for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+      const Type* synaptic_weights = next_layer_parameters + 1 + j;
+
+      double sum = 0.0;
+
+      for (unsigned k = 0; k < next_layer_perceptrons_number; k++) {
+        sum += (double)next_delta[k] *
+               synaptic_weights[k * next_perceptron_parameters_number];
+      }
 
-Matrix<double> PerformanceTerm::calculate_Hessian(
-    const Vector<double>& parameters) const {
-// Neural network stuff
+      delta[j] = (Type)(sum * instance_activation_derivative[j]);
+    }
+  }
+}
+
+// void calculate_batch_gradient(const Matrix<double>&, const Vector<
+// Matrix<double> >&, const Vector< Matrix<double> >&, Vector<double>&) const
+// method
+
+/// Adds the gradient of a block of instances to a given gradient vector.
+/// The bias derivatives are the column sums of the layer delta, and the
+/// synaptic weight derivatives are the product of the transposed layer delta
+/// and the layer inputs.
+/// The parameters are arranged as in the multilayer perceptron: layer by
+/// layer, and within each perceptron the bias followed by the synaptic
+/// weights.
+/// @param inputs Inputs to the multilayer perceptron, with one instance per
+/// row.
+/// @param layers_activation Activations of every layer.
+/// @param layers_delta Delta of every layer.
+/// @param gradient Gradient vector to which the block contribution is added.
+
+void PerformanceTerm::calculate_batch_gradient(
+    const Matrix<double>& inputs,
+    const Vector<Matrix<double> >& layers_activation,
+    const Vector<Matrix<double> >& layers_delta,
+    Vector<double>& gradient) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+// Control sentence (if debug)
 
 #ifndef NDEBUG
 
-  check();
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+  if (gradient.size() != parameters_number ||
+      layers_activation.size() != layers_number ||
+      layers_delta.size() != layers_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "void calculate_batch_gradient(const Matrix<double>&, const "
+              "Vector< Matrix<double> >&, const Vector< Matrix<double> >&, "
+              "Vector<double>&) const method.\n"
+           << "Sizes of layers activation, layers delta and gradient must "
+              "match the multilayer perceptron.\n";
+
+    throw std::logic_error(buffer.str());
+  }
 
 #endif
 
-  return (numerical_differentiation_pointer->calculate_Hessian(
-      *this, &PerformanceTerm::calculate_performance, parameters));
+  add_batch_gradient(inputs, layers_activation, layers_delta, layers_number,
+                     gradient);
 }
 
-// Vector<double> calculate_terms(void) const method
+// void calculate_batch_gradient(const Matrix<float>&, const Vector<
+// Matrix<float> >&, const Vector< Matrix<float> >&, Vector<double>&) const
+// method
 
-/// Returns the performance of all the subterms composing the performance term.
+/// Adds the gradient of a block of instances in single precision to a given
+/// gradient vector.
+/// The derivatives are accumulated in double precision into the gradient.
+/// @param inputs Single precision inputs to the multilayer perceptron, with one
+/// instance per row.
+/// @param layers_activation Single precision activations of every layer.
+/// @param layers_delta Single precision delta of every layer.
+/// @param gradient Gradient vector to which the block contribution is added.
+
+void PerformanceTerm::calculate_batch_gradient(
+    const Matrix<float>& inputs,
+    const Vector<Matrix<float> >& layers_activation,
+    const Vector<Matrix<float> >& layers_delta,
+    Vector<double>& gradient) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
 
-Vector<double> PerformanceTerm::calculate_terms(void) const {
-  std::ostringstream buffer;
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
 
-  buffer << "OpenNN Exception: PerformanceTerm class.\n"
-         << "Vector<double> calculate_terms(void) const method.\n"
-         << "The terms function is not defined for this performance term.\n";
+// Control sentence (if debug)
 
-  throw std::logic_error(buffer.str());
-}
+#ifndef NDEBUG
 
-// Vector<double> calculate_terms(const Vector<double>&) const method
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
 
-/// Returns the performance of all the subterms composing the performance term.
+  if (gradient.size() != parameters_number ||
+      layers_activation.size() != layers_number ||
+      layers_delta.size() != layers_number) {
+    std::ostringstream buffer;
 
-Vector<double> PerformanceTerm::calculate_terms(const Vector<double>&) const {
-  std::ostringstream buffer;
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "void calculate_batch_gradient(const Matrix<float>&, const "
+              "Vector< Matrix<float> >&, const Vector< Matrix<float> >&, "
+              "Vector<double>&) const method.\n"
+           << "Sizes of layers activation, layers delta and gradient must "
+              "match the multilayer perceptron.\n";
 
-  buffer
-      << "OpenNN Exception: PerformanceTerm class.\n"
-      << "Vector<double> calculate_terms(const Vector<double>&) const method.\n"
-      << "The terms function is not defined for this performance term.\n";
+    throw std::logic_error(buffer.str());
+  }
 
-  throw std::logic_error(buffer.str());
+#endif
+
+  add_batch_gradient(inputs, layers_activation, layers_delta, layers_number,
+                     gradient);
 }
 
-// Matrix<double> calculate_terms_Jacobian(void) const method
+// template <class Type> void add_batch_gradient(const Matrix<Type>&, const
+// Vector< Matrix<Type> >&, const Vector< Matrix<Type> >&, const unsigned&,
+// Vector<double>&) method
+
+/// Adds the gradient of a block of instances to a given gradient vector, with
+/// the floating point type of the block given as a type.
+/// The bias derivatives are the column sums of the layer delta, and the
+/// synaptic weight derivatives are the product of the transposed layer delta
+/// and the layer inputs.
+/// Both are accumulated in double precision.
+/// @param inputs Inputs to the multilayer perceptron, with one instance per
+/// row.
+/// @param layers_activation Activations of every layer.
+/// @param layers_delta Delta of every layer.
+/// @param layers_number Number of layers in the multilayer perceptron.
+/// @param gradient Gradient vector to which the block contribution is added.
+
+template <class Type>
+void PerformanceTerm::add_batch_gradient(
+    const Matrix<Type>& inputs, const Vector<Matrix<Type> >& layers_activation,
+    const Vector<Matrix<Type> >& layers_delta, const unsigned& layers_number,
+    Vector<double>& gradient) {
+  const unsigned instances_number = inputs.get_rows_number();
 
-/// Returns the Jacobian matrix of the subterms composing the performance term.
+  unsigned index = 0;
 
-Matrix<double> PerformanceTerm::calculate_terms_Jacobian(void) const {
-  std::ostringstream buffer;
+  for (unsigned h = 0; h < layers_number; h++) {
+    const Matrix<Type>& layer_inputs =
+        h == 0 ? inputs : layers_activation[h - 1];
+    const Matrix<Type>& layer_delta = layers_delta[h];
 
-  buffer << "OpenNN Exception: PerformanceTerm class.\n"
-         << "Matrix<double> calculate_terms_Jacobian(void) const method.\n"
-         << "The terms function is not defined for this performance term.\n";
+    const unsigned layer_inputs_number = layer_inputs.get_columns_number();
+    const unsigned layer_perceptrons_number = layer_delta.get_columns_number();
 
-  throw std::logic_error(buffer.str());
-}
+    for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+      double& bias_derivative = gradient[index];
+      double* synaptic_weights_derivatives = &gradient[index + 1];
 
-// PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const
+      for (unsigned i = 0; i < instances_number; i++) {
+        const double delta = layer_delta[i][j];
+        const Type* instance_inputs = layer_inputs[i];
 
-/// Returns the performance of all the subterms composing the performance term.
+        bias_derivative += delta;
 
-PerformanceTerm::FirstOrderTerms PerformanceTerm::calculate_first_order_terms(
-    void) const {
-  std::ostringstream buffer;
+        for (unsigned k = 0; k < layer_inputs_number; k++) {
+          synaptic_weights_derivatives[k] += delta * instance_inputs[k];
+        }
+      }
 
-  buffer << "OpenNN Exception: PerformanceTerm class.\n"
-         << "Vector<double> calculate_terms(void) const method.\n"
-         << "The terms function is not defined for this performance term.\n";
+      index += 1 + layer_inputs_number;
+    }
+  }
+}
+
+// void calculate_conditioned_outputs(const Matrix<double>&, const
+// Matrix<double>&, Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates the outputs of the neural network for a block of instances when
+/// it has a conditions layer, together with the homogeneous solutions, which
+/// are the derivatives of those outputs with respect to the activations of the
+/// last layer.
+/// @param inputs Inputs to the multilayer perceptron, with one instance per
+/// row.
+/// @param activations Activations of the last layer of the multilayer
+/// perceptron.
+/// @param outputs Matrix to store the conditioned outputs.
+/// @param homogeneous_solutions Matrix to store the homogeneous solutions.
+
+void PerformanceTerm::calculate_conditioned_outputs(
+    const Matrix<double>& inputs, const Matrix<double>& activations,
+    Matrix<double>& outputs, Matrix<double>& homogeneous_solutions) const {
+  const ConditionsLayer* conditions_layer_pointer =
+      neural_network_pointer->get_conditions_layer_pointer();
+
+  const unsigned instances_number = activations.get_rows_number();
+  const unsigned outputs_number = activations.get_columns_number();
+
+  outputs.set(instances_number, outputs_number);
+  homogeneous_solutions.set(instances_number, outputs_number);
+
+  Vector<double> instance_inputs;
+  Vector<double> particular_solution;
+  Vector<double> homogeneous_solution;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    instance_inputs = inputs.arrange_row(i);
+
+    particular_solution =
+        conditions_layer_pointer->calculate_particular_solution(
+            instance_inputs);
+    homogeneous_solution =
+        conditions_layer_pointer->calculate_homogeneous_solution(
+            instance_inputs);
+
+    for (unsigned j = 0; j < outputs_number; j++) {
+      outputs[i][j] =
+          particular_solution[j] + homogeneous_solution[j] * activations[i][j];
+      homogeneous_solutions[i][j] = homogeneous_solution[j];
+    }
+  }
+}
+
+// void calculate_training_error_gradient(const unsigned&, const unsigned&,
+// double*, Vector<double>&) const method
+
+/// Adds to a given vector the gradient of the performance term over a range of
+/// training instances, by means of the back-propagation algorithm applied to
+/// blocks of instances.
+/// The forward propagation, the layers delta and the parameters derivatives of
+/// each block are computed with matrix operations into workspaces which are
+/// reused from block to block.
+/// The performance term supplies the outputs gradient through the
+/// calculate_output_gradient method.
+/// If the neural network has a conditions layer, the outputs gradient is taken
+/// with respect to the conditioned outputs, and then multiplied by the
+/// homogeneous solution.
+/// If an error pointer is given, the error of the same outputs, as given by
+/// the calculate_outputs_error method, is added to it, so that the performance
+/// does not need another forward propagation.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param error_pointer Pointer to the error to which the range contribution is
+/// added, or NULL if the error is not needed.
+/// @param gradient Gradient vector to which the range contribution is added.
+
+void PerformanceTerm::calculate_training_error_gradient(
+    const unsigned& first_instance, const unsigned& last_instance,
+    double* error_pointer, Vector<double>& gradient) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned outputs_number =
+      multilayer_perceptron_pointer->get_outputs_number();
+
+  const bool has_conditions_layer =
+      neural_network_pointer->has_conditions_layer();
+
+  Matrix<double> inputs;
+  Matrix<double> targets;
+
+  Vector<Matrix<double> > layers_activation;
+  Vector<Matrix<double> > layers_activation_derivative;
+  Vector<Matrix<double> > layers_delta;
+
+  Matrix<double> outputs;
+  Matrix<double> output_gradient;
+  Matrix<double> homogeneous_solutions;
+
+  unsigned block_instances_number;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    data_set_pointer->get_training_input_block(first, block_instances_number,
+                                               inputs);
+    data_set_pointer->get_training_target_block(first, block_instances_number,
+                                                targets);
+
+    multilayer_perceptron_pointer->calculate_first_order_forward_propagation(
+        inputs, layers_activation, layers_activation_derivative);
+
+    if (!has_conditions_layer) {
+      calculate_output_gradient(layers_activation[layers_number - 1], targets,
+                                output_gradient);
+
+      if (error_pointer) {
+        *error_pointer += calculate_outputs_error(
+            layers_activation[layers_number - 1], targets);
+      }
+    } else {
+      calculate_conditioned_outputs(inputs, layers_activation[layers_number - 1],
+                                    outputs, homogeneous_solutions);
+
+      calculate_output_gradient(outputs, targets, output_gradient);
+
+      if (error_pointer) {
+        *error_pointer += calculate_outputs_error(outputs, targets);
+      }
+
+      for (unsigned i = 0; i < block_instances_number; i++) {
+        for (unsigned j = 0; j < outputs_number; j++) {
+          output_gradient[i][j] *= homogeneous_solutions[i][j];
+        }
+      }
+    }
+
+    calculate_layers_delta(layers_activation_derivative, output_gradient,
+                           layers_delta);
+
+    calculate_batch_gradient(inputs, layers_activation, layers_delta,
+                             gradient);
+  }
+}
+
+// void calculate_single_precision_training_error_gradient(const unsigned&,
+// const unsigned&, const Vector<float>&, double*, Vector<double>&) const
+// method
+
+/// Adds to a given vector the gradient of the performance term over a range of
+/// training instances, with the back-propagation algorithm applied to single
+/// precision blocks of instances.
+/// The inputs, the parameters, the layers activations and the layers delta are
+/// stored as floats, while the combinations, the layers delta products and the
+/// gradient are accumulated in double precision.
+/// The outputs of each block are converted to double precision, so that the
+/// performance term supplies the outputs gradient and the error through the
+/// same methods as in double precision.
+/// The neural network must not have a conditions layer.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param parameters Single precision parameters of the multilayer perceptron,
+/// as given by its arrange_single_precision_parameters method.
+/// @param error_pointer Pointer to the error to which the range contribution is
+/// added, or NULL if the error is not needed.
+/// @param gradient Gradient vector to which the range contribution is added.
+
+void PerformanceTerm::calculate_single_precision_training_error_gradient(
+    const unsigned& first_instance, const unsigned& last_instance,
+    const Vector<float>& parameters, double* error_pointer,
+    Vector<double>& gradient) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  Matrix<float> inputs;
+  Matrix<double> targets;
+
+  Vector<Matrix<float> > layers_activation;
+  Vector<Matrix<float> > layers_activation_derivative;
+  Vector<Matrix<float> > layers_delta;
+
+  Matrix<double> outputs;
+  Matrix<double> output_gradient;
+
+  unsigned block_instances_number;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    data_set_pointer->get_training_input_block(first, block_instances_number,
+                                               inputs);
+    data_set_pointer->get_training_target_block(first, block_instances_number,
+                                                targets);
+
+    multilayer_perceptron_pointer->calculate_first_order_forward_propagation(
+        inputs, parameters, layers_activation, layers_activation_derivative);
+
+    convert_block(layers_activation[layers_number - 1], outputs);
+
+    calculate_output_gradient(outputs, targets, output_gradient);
+
+    if (error_pointer) {
+      *error_pointer += calculate_outputs_error(outputs, targets);
+    }
+
+    calculate_layers_delta(layers_activation_derivative, output_gradient,
+                           parameters, layers_delta);
+
+    calculate_batch_gradient(inputs, layers_activation, layers_delta,
+                             gradient);
+  }
+}
+
+// Vector<double> calculate_training_gradient(void) const method
+
+/// Returns the gradient of the performance term over the training instances.
+/// The training instances are split in chunks, whose gradients are calculated
+/// in parallel and then added pairwise.
+/// In single precision, and without a conditions layer, the parameters are
+/// rounded to floats once, before the chunks are evaluated.
+
+Vector<double> PerformanceTerm::calculate_training_gradient(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  if (chunks_number == 0) {
+    return (Vector<double>(parameters_number, 0.0));
+  }
+
+  const bool use_single_precision =
+      single_precision && !neural_network_pointer->has_conditions_layer();
+
+  const Vector<float> single_precision_parameters =
+      use_single_precision
+          ? multilayer_perceptron_pointer->arrange_single_precision_parameters()
+          : Vector<float>();
+
+  Vector<Vector<double> > chunks_gradient(chunks_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      const unsigned first_instance = get_chunk_first_instance(
+          chunk, chunks_number, training_instances_number);
+      const unsigned last_instance = get_chunk_first_instance(
+          chunk + 1, chunks_number, training_instances_number);
+
+      chunks_gradient[chunk].set(parameters_number, 0.0);
+
+      if (use_single_precision) {
+        calculate_single_precision_training_error_gradient(
+            first_instance, last_instance, single_precision_parameters, NULL,
+            chunks_gradient[chunk]);
+      } else {
+        calculate_training_error_gradient(first_instance, last_instance, NULL,
+                                          chunks_gradient[chunk]);
+      }
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  sum_chunks(chunks_gradient);
+
+  return (chunks_gradient[0]);
+}
+
+// void calculate_training_error_gradient(double&, Vector<double>&) const method
+
+/// Calculates both the error and the gradient of the performance term over the
+/// training instances, with a single forward and backward propagation of each
+/// instance.
+/// The training instances are split in chunks, which are processed in parallel
+/// and then added pairwise.
+/// If the neural network has a conditions layer, the error is measured on the
+/// conditioned outputs.
+/// In single precision, and without a conditions layer, the parameters are
+/// rounded to floats once, before the chunks are evaluated.
+/// @param error Reference to store the error, as given by the
+/// calculate_outputs_error method.
+/// @param gradient Vector to store the gradient.
+
+void PerformanceTerm::calculate_training_error_gradient(
+    double& error, Vector<double>& gradient) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  if (chunks_number == 0) {
+    error = 0.0;
+    gradient.set(parameters_number, 0.0);
+
+    return;
+  }
+
+  const bool use_single_precision =
+      single_precision && !neural_network_pointer->has_conditions_layer();
+
+  const Vector<float> single_precision_parameters =
+      use_single_precision
+          ? multilayer_perceptron_pointer->arrange_single_precision_parameters()
+          : Vector<float>();
+
+  Vector<double> chunks_error(chunks_number, 0.0);
+  Vector<Vector<double> > chunks_gradient(chunks_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      const unsigned first_instance = get_chunk_first_instance(
+          chunk, chunks_number, training_instances_number);
+      const unsigned last_instance = get_chunk_first_instance(
+          chunk + 1, chunks_number, training_instances_number);
+
+      chunks_gradient[chunk].set(parameters_number, 0.0);
+
+      if (use_single_precision) {
+        calculate_single_precision_training_error_gradient(
+            first_instance, last_instance, single_precision_parameters,
+            &chunks_error[chunk], chunks_gradient[chunk]);
+      } else {
+        calculate_training_error_gradient(first_instance, last_instance,
+                                          &chunks_error[chunk],
+                                          chunks_gradient[chunk]);
+      }
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  error = sum_chunks(chunks_error);
+
+  sum_chunks(chunks_gradient);
+
+  gradient.swap(chunks_gradient[0]);
+}
+
+// void calculate_training_vector_dot_Hessian(const unsigned&, const unsigned&,
+// const Vector<double>&, Vector<double>&) const method
+
+/// Adds to a given vector the product of the Hessian of the performance term
+/// over a range of training instances and a vector of multilayer perceptron
+/// parameters.
+/// The product is exact, and it is computed with the R-operator of Pearlmutter:
+/// a forward propagation of the directional derivatives of the combinations
+/// and activations, followed by a back-propagation of the directional
+/// derivatives of the layers delta.
+/// Its cost is about that of two gradients, and the Hessian matrix is never
+/// formed.
+/// The performance term supplies the outputs gradient and its directional
+/// derivative through the calculate_output_gradient and
+/// calculate_output_vector_dot_Hessian methods.
+/// If the neural network has a conditions layer, both are taken with respect
+/// to the conditioned outputs, and then multiplied by the homogeneous solution.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param vector Vector of multilayer perceptron parameters in the product.
+/// @param vector_Hessian_product Vector to which the range contribution is
+/// added.
+
+void PerformanceTerm::calculate_training_vector_dot_Hessian(
+    const unsigned& first_instance, const unsigned& last_instance,
+    const Vector<double>& vector,
+    Vector<double>& vector_Hessian_product) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned outputs_number =
+      multilayer_perceptron_pointer->get_outputs_number();
+
+  const bool has_conditions_layer =
+      neural_network_pointer->has_conditions_layer();
+
+  const Vector<unsigned> layers_perceptrons_number =
+      multilayer_perceptron_pointer->arrange_layers_perceptrons_numbers();
+
+  const Vector<unsigned> layers_cumulative_parameters_number =
+      multilayer_perceptron_pointer
+          ->arrange_layers_cumulative_parameters_number();
+
+  Matrix<double> inputs;
+  Matrix<double> targets;
+
+  Vector<Matrix<double> > layers_activation(layers_number);
+  Vector<Matrix<double> > layers_activation_derivative(layers_number);
+  Vector<Matrix<double> > layers_activation_second_derivative(layers_number);
+
+  Vector<Matrix<double> > layers_combination_direction(layers_number);
+  Vector<Matrix<double> > layers_activation_direction(layers_number);
+
+  Vector<Matrix<double> > layers_delta(layers_number);
+  Vector<Matrix<double> > layers_delta_direction(layers_number);
+
+  Matrix<double> combinations;
+
+  Matrix<double> outputs;
+  Matrix<double> outputs_direction;
+  Matrix<double> homogeneous_solutions;
+
+  Matrix<double> output_gradient;
+  Matrix<double> output_gradient_direction;
+
+  Vector<double> back_propagation;
+  Vector<double> back_propagation_direction;
+
+  unsigned block_instances_number;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    data_set_pointer->get_training_input_block(first, block_instances_number,
+                                               inputs);
+    data_set_pointer->get_training_target_block(first, block_instances_number,
+                                                targets);
+
+    // Forward propagation of the activations and of their directional
+    // derivatives
+
+    for (unsigned h = 0; h < layers_number; h++) {
+      const PerceptronLayer& layer =
+          multilayer_perceptron_pointer->get_layer(h);
+
+      const Matrix<double>& layer_inputs =
+          h == 0 ? inputs : layers_activation[h - 1];
+
+      const unsigned layer_inputs_number = layer_inputs.get_columns_number();
+      const unsigned layer_perceptrons_number = layers_perceptrons_number[h];
+
+      layer.calculate_combinations(layer_inputs, combinations);
+
+      layer.calculate_activations(combinations, layers_activation[h]);
+      layer.calculate_activations_derivatives(combinations,
+                                              layers_activation_derivative[h]);
+      layer.calculate_activations_second_derivatives(
+          combinations, layers_activation_second_derivative[h]);
+
+      const Vector<double>& layer_parameters = layer.get_parameters();
+      const double* layer_direction =
+          &vector[h == 0 ? 0 : layers_cumulative_parameters_number[h - 1]];
+
+      Matrix<double>& combination_direction = layers_combination_direction[h];
+
+      combination_direction.set(block_instances_number,
+                                layer_perceptrons_number);
+
+      for (unsigned i = 0; i < block_instances_number; i++) {
+        const double* instance_inputs = layer_inputs[i];
+        const double* instance_inputs_direction =
+            h == 0 ? NULL : layers_activation_direction[h - 1][i];
+
+        for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+          const double* perceptron_direction =
+              layer_direction + j * (1 + layer_inputs_number);
+          const double* synaptic_weights =
+              &layer_parameters[j * (1 + layer_inputs_number) + 1];
+
+          double direction = perceptron_direction[0];
+
+          for (unsigned k = 0; k < layer_inputs_number; k++) {
+            direction += perceptron_direction[k + 1] * instance_inputs[k];
+          }
+
+          if (instance_inputs_direction) {
+            for (unsigned k = 0; k < layer_inputs_number; k++) {
+              direction += synaptic_weights[k] * instance_inputs_direction[k];
+            }
+          }
+
+          combination_direction[i][j] = direction;
+        }
+      }
+
+      Matrix<double>& activation_direction = layers_activation_direction[h];
+
+      activation_direction.set(block_instances_number,
+                               layer_perceptrons_number);
+
+      for (unsigned i = 0; i < block_instances_number; i++) {
+        for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+          activation_direction[i][j] = layers_activation_derivative[h][i][j] *
+                                       combination_direction[i][j];
+        }
+      }
+    }
+
+    // Outputs gradient and its directional derivative
+
+    if (!has_conditions_layer) {
+      calculate_output_gradient(layers_activation[layers_number - 1], targets,
+                                output_gradient);
+
+      calculate_output_vector_dot_Hessian(
+          layers_activation[layers_number - 1], targets,
+          layers_activation_direction[layers_number - 1],
+          output_gradient_direction);
+    } else {
+      calculate_conditioned_outputs(inputs, layers_activation[layers_number - 1],
+                                    outputs, homogeneous_solutions);
+
+      outputs_direction = layers_activation_direction[layers_number - 1];
+
+      for (unsigned i = 0; i < block_instances_number; i++) {
+        for (unsigned j = 0; j < outputs_number; j++) {
+          outputs_direction[i][j] *= homogeneous_solutions[i][j];
+        }
+      }
+
+      calculate_output_gradient(outputs, targets, output_gradient);
+
+      calculate_output_vector_dot_Hessian(outputs, targets, outputs_direction,
+                                          output_gradient_direction);
+
+      for (unsigned i = 0; i < block_instances_number; i++) {
+        for (unsigned j = 0; j < outputs_number; j++) {
+          output_gradient[i][j] *= homogeneous_solutions[i][j];
+          output_gradient_direction[i][j] *= homogeneous_solutions[i][j];
+        }
+      }
+    }
+
+    // Back-propagation of the layers delta and of their directional
+    // derivatives
+
+    for (int h = layers_number - 1; h >= 0; h--) {
+      const unsigned layer_perceptrons_number = layers_perceptrons_number[h];
+
+      const Matrix<double>& activation_derivative =
+          layers_activation_derivative[h];
+      const Matrix<double>& activation_second_derivative =
+          layers_activation_second_derivative[h];
+      const Matrix<double>& combination_direction =
+          layers_combination_direction[h];
+
+      Matrix<double>& layer_delta = layers_delta[h];
+      Matrix<double>& layer_delta_direction = layers_delta_direction[h];
+
+      layer_delta.set(block_instances_number, layer_perceptrons_number);
+      layer_delta_direction.set(block_instances_number,
+                                layer_perceptrons_number);
+
+      back_propagation.set(layer_perceptrons_number);
+      back_propagation_direction.set(layer_perceptrons_number);
+
+      for (unsigned i = 0; i < block_instances_number; i++) {
+        if (h == (int)layers_number - 1) {
+          for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+            back_propagation[j] = output_gradient[i][j];
+            back_propagation_direction[j] = output_gradient_direction[i][j];
+          }
+        } else {
+          const PerceptronLayer& next_layer =
+              multilayer_perceptron_pointer->get_layer(h + 1);
+
+          const Vector<double>& next_layer_parameters =
+              next_layer.get_parameters();
+
+          const unsigned next_layer_perceptrons_number =
+              layers_perceptrons_number[h + 1];
+
+          const double* next_layer_direction =
+              &vector[layers_cumulative_parameters_number[h]];
+
+          back_propagation.initialize(0.0);
+          back_propagation_direction.initialize(0.0);
+
+          for (unsigned k = 0; k < next_layer_perceptrons_number; k++) {
+            const double* synaptic_weights =
+                &next_layer_parameters[k * (1 + layer_perceptrons_number) + 1];
+            const double* synaptic_weights_direction =
+                &next_layer_direction[k * (1 + layer_perceptrons_number) + 1];
+
+            const double next_delta = layers_delta[h + 1][i][k];
+            const double next_delta_direction =
+                layers_delta_direction[h + 1][i][k];
+
+            for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+              back_propagation[j] += next_delta * synaptic_weights[j];
+              back_propagation_direction[j] +=
+                  next_delta_direction * synaptic_weights[j] +
+                  next_delta * synaptic_weights_direction[j];
+            }
+          }
+        }
+
+        for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+          layer_delta[i][j] = activation_derivative[i][j] * back_propagation[j];
+          layer_delta_direction[i][j] =
+              activation_second_derivative[i][j] * combination_direction[i][j] *
+                  back_propagation[j] +
+              activation_derivative[i][j] * back_propagation_direction[j];
+        }
+      }
+    }
+
+    // Parameters derivatives of the gradient along the vector
+
+    calculate_batch_gradient(inputs, layers_activation, layers_delta_direction,
+                             vector_Hessian_product);
+
+    // The inputs to the first layer do not depend on the parameters, so that
+    // only the hidden layers have a contribution from the inputs direction
+
+    for (unsigned h = 1; h < layers_number; h++) {
+      const unsigned layer_inputs_number = layers_perceptrons_number[h - 1];
+      const unsigned layer_perceptrons_number = layers_perceptrons_number[h];
+
+      const Matrix<double>& layer_inputs_direction =
+          layers_activation_direction[h - 1];
+
+      double* layer_product =
+          &vector_Hessian_product[layers_cumulative_parameters_number[h - 1]];
+
+      for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+        double* synaptic_weights_product =
+            layer_product + j * (1 + layer_inputs_number) + 1;
+
+        for (unsigned i = 0; i < block_instances_number; i++) {
+          const double delta = layers_delta[h][i][j];
+          const double* instance_inputs_direction = layer_inputs_direction[i];
+
+          for (unsigned k = 0; k < layer_inputs_number; k++) {
+            synaptic_weights_product[k] += delta * instance_inputs_direction[k];
+          }
+        }
+      }
+    }
+  }
+}
+
+// Vector<double> calculate_training_vector_dot_Hessian(const Vector<double>&)
+// const method
+
+/// Returns the exact product of the Hessian of the performance term over the
+/// training instances and a vector of multilayer perceptron parameters.
+/// The training instances are split in chunks, whose products are calculated
+/// in parallel and then added pairwise.
+/// @param vector Vector of multilayer perceptron parameters in the product.
+
+Vector<double> PerformanceTerm::calculate_training_vector_dot_Hessian(
+    const Vector<double>& vector) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+  if (vector.size() != parameters_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> calculate_training_vector_dot_Hessian(const "
+              "Vector<double>&) const method.\n"
+           << "Size of vector must be equal to number of multilayer "
+              "perceptron parameters.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  if (chunks_number == 0) {
+    return (Vector<double>(parameters_number, 0.0));
+  }
+
+  Vector<Vector<double> > chunks_product(chunks_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      chunks_product[chunk].set(parameters_number, 0.0);
+
+      calculate_training_vector_dot_Hessian(
+          get_chunk_first_instance(chunk, chunks_number,
+                                   training_instances_number),
+          get_chunk_first_instance(chunk + 1, chunks_number,
+                                   training_instances_number),
+          vector, chunks_product[chunk]);
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  sum_chunks(chunks_product);
+
+  return (chunks_product[0]);
+}
+
+// double calculate_outputs_error(const Matrix<double>&, const Matrix<double>&)
+// const method
+
+/// Returns the error between a block of outputs and targets, added over the
+/// instances.
+/// Performance terms which measure an error over the training instances
+/// implement this method, and then calculate_training_error evaluates it over
+/// the whole data set.
+/// This base implementation throws an exception.
+
+double PerformanceTerm::calculate_outputs_error(const Matrix<double>&,
+                                                const Matrix<double>&) const {
+  std::ostringstream buffer;
+
+  buffer << "OpenNN Exception: PerformanceTerm class.\n"
+         << "double calculate_outputs_error(const Matrix<double>&, const "
+            "Matrix<double>&) const method.\n"
+         << "This method is not implemented for the "
+         << write_performance_term_type() << " performance term type.\n";
+
+  throw std::logic_error(buffer.str());
+}
+
+// double calculate_training_error(const unsigned&, const unsigned&) const
+// method
+
+/// Returns the error of the multilayer perceptron over a range of training
+/// instances, which are propagated in blocks.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+
+double PerformanceTerm::calculate_training_error(
+    const unsigned& first_instance, const unsigned& last_instance) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  Matrix<double> inputs;
+  Matrix<double> targets;
+
+  Vector<Matrix<double> > layers_activation;
+
+  unsigned block_instances_number;
+
+  double error = 0.0;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    data_set_pointer->get_training_input_block(first, block_instances_number,
+                                               inputs);
+    data_set_pointer->get_training_target_block(first, block_instances_number,
+                                                targets);
+
+    multilayer_perceptron_pointer->calculate_outputs(inputs,
+                                                     layers_activation);
+
+    error += calculate_outputs_error(layers_activation[layers_number - 1],
+                                     targets);
+  }
+
+  return (error);
+}
+
+// double calculate_single_precision_training_error(const unsigned&, const
+// unsigned&, const Vector<float>&) const method
+
+/// Returns the error of the multilayer perceptron over a range of training
+/// instances, which are propagated in single precision blocks.
+/// The combinations are accumulated in double precision, and the outputs of
+/// each block are converted to double precision before measuring the error.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param parameters Single precision parameters of the multilayer perceptron,
+/// as given by its arrange_single_precision_parameters method.
+
+double PerformanceTerm::calculate_single_precision_training_error(
+    const unsigned& first_instance, const unsigned& last_instance,
+    const Vector<float>& parameters) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  Matrix<float> inputs;
+  Matrix<double> targets;
+
+  Vector<Matrix<float> > layers_activation;
+
+  Matrix<double> outputs;
+
+  unsigned block_instances_number;
+
+  double error = 0.0;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    data_set_pointer->get_training_input_block(first, block_instances_number,
+                                               inputs);
+    data_set_pointer->get_training_target_block(first, block_instances_number,
+                                                targets);
+
+    multilayer_perceptron_pointer->calculate_outputs(inputs, parameters,
+                                                     layers_activation);
+
+    convert_block(layers_activation[layers_number - 1], outputs);
+
+    error += calculate_outputs_error(outputs, targets);
+  }
+
+  return (error);
+}
+
+// void convert_block(const Matrix<float>&, Matrix<double>&) method
+
+/// Copies a single precision block of instances into a double precision
+/// matrix, which is only reallocated when its size changes.
+/// @param block Single precision block, with one instance per row.
+/// @param double_block Matrix to store the block in double precision.
+
+void PerformanceTerm::convert_block(const Matrix<float>& block,
+                                    Matrix<double>& double_block) {
+  const unsigned rows_number = block.get_rows_number();
+  const unsigned columns_number = block.get_columns_number();
+
+  double_block.set(rows_number, columns_number);
+
+  for (unsigned i = 0; i < rows_number; i++) {
+    const float* row = block[i];
+    double* double_row = double_block[i];
+
+    for (unsigned j = 0; j < columns_number; j++) {
+      double_row[j] = row[j];
+    }
+  }
+}
+
+// double calculate_training_error(void) const method
+
+/// Returns the error of the multilayer perceptron over the training instances,
+/// as given by the calculate_outputs_error method.
+/// The training instances are split in chunks, whose errors are calculated in
+/// parallel and then added pairwise.
+/// In single precision, the parameters are rounded to floats once, before the
+/// chunks are evaluated.
+
+double PerformanceTerm::calculate_training_error(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  if (chunks_number == 0) {
+    return (0.0);
+  }
+
+  const Vector<float> single_precision_parameters =
+      single_precision
+          ? multilayer_perceptron_pointer->arrange_single_precision_parameters()
+          : Vector<float>();
+
+  Vector<double> chunks_error(chunks_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      const unsigned first_instance = get_chunk_first_instance(
+          chunk, chunks_number, training_instances_number);
+      const unsigned last_instance = get_chunk_first_instance(
+          chunk + 1, chunks_number, training_instances_number);
+
+      if (single_precision) {
+        chunks_error[chunk] = calculate_single_precision_training_error(
+            first_instance, last_instance, single_precision_parameters);
+      } else {
+        chunks_error[chunk] =
+            calculate_training_error(first_instance, last_instance);
+      }
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  return (sum_chunks(chunks_error));
+}
+
+// void calculate_training_errors(const unsigned&, const unsigned&, const
+// Vector< Vector<double> >&, Vector<double>&) const method
+
+/// Calculates the errors of the multilayer perceptron over a range of training
+/// instances for several vectors of parameters.
+/// Each block of instances is read once and propagated with every vector of
+/// parameters, which does not need to be set to the neural network.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param parameters Vectors of potential parameters for the neural network.
+/// @param errors Error for each vector of parameters.
+
+void PerformanceTerm::calculate_training_errors(
+    const unsigned& first_instance, const unsigned& last_instance,
+    const Vector<Vector<double> >& parameters, Vector<double>& errors) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned points_number = parameters.size();
+
+  Matrix<double> inputs;
+  Matrix<double> targets;
+  Matrix<double> outputs;
+
+  unsigned block_instances_number;
+
+  errors.set(points_number, 0.0);
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    data_set_pointer->get_training_input_block(first, block_instances_number,
+                                               inputs);
+    data_set_pointer->get_training_target_block(first, block_instances_number,
+                                                targets);
+
+    for (unsigned i = 0; i < points_number; i++) {
+      multilayer_perceptron_pointer->calculate_outputs(inputs, parameters[i],
+                                                       outputs);
+
+      errors[i] += calculate_outputs_error(outputs, targets);
+    }
+  }
+}
+
+// Vector<double> calculate_training_errors(const Vector< Vector<double> >&)
+// const method
+
+/// Returns the errors of the multilayer perceptron over the training instances
+/// for several vectors of parameters, in a single pass over the data.
+/// The training instances are split in chunks, which are processed in
+/// parallel.
+/// @param parameters Vectors of potential parameters for the neural network.
+
+Vector<double> PerformanceTerm::calculate_training_errors(
+    const Vector<Vector<double> >& parameters) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const unsigned layers_number = neural_network_pointer
+      ->get_multilayer_perceptron_pointer()->get_layers_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  if (chunks_number == 0) {
+    return (Vector<double>(parameters.size(), 0.0));
+  }
+
+  Vector<Vector<double> > chunks_errors(chunks_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      calculate_training_errors(
+          get_chunk_first_instance(chunk, chunks_number,
+                                   training_instances_number),
+          get_chunk_first_instance(chunk + 1, chunks_number,
+                                   training_instances_number),
+          parameters, chunks_errors[chunk]);
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  sum_chunks(chunks_errors);
+
+  return (chunks_errors[0]);
+}
+
+// Vector<double> calculate_training_terms(void) const method
+
+/// Returns the distances between the outputs of the multilayer perceptron and
+/// the targets, for each training instance.
+/// The instances are propagated in blocks, and the chunks of instances are
+/// processed in parallel.
+
+Vector<double> PerformanceTerm::calculate_training_terms(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  Vector<double> terms(training_instances_number, 0.0);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      const unsigned last_instance = get_chunk_first_instance(
+          chunk + 1, chunks_number, training_instances_number);
+
+      Matrix<double> inputs;
+      Matrix<double> targets;
+
+      Vector<Matrix<double> > layers_activation;
+
+      unsigned block_instances_number;
+
+      for (unsigned first = get_chunk_first_instance(chunk, chunks_number,
+                                                     training_instances_number);
+           first < last_instance; first += batch_instances_number) {
+        block_instances_number = last_instance - first;
+
+        if (block_instances_number > batch_instances_number) {
+          block_instances_number = batch_instances_number;
+        }
+
+        data_set_pointer->get_training_input_block(
+            first, block_instances_number, inputs);
+        data_set_pointer->get_training_target_block(
+            first, block_instances_number, targets);
+
+        multilayer_perceptron_pointer->calculate_outputs(inputs,
+                                                         layers_activation);
+
+        const Matrix<double>& outputs = layers_activation[layers_number - 1];
+
+        const unsigned outputs_number = outputs.get_columns_number();
+
+        for (unsigned i = 0; i < block_instances_number; i++) {
+          double sum_squared_error = 0.0;
+
+          for (unsigned j = 0; j < outputs_number; j++) {
+            const double error = outputs[i][j] - targets[i][j];
+
+            sum_squared_error += error * error;
+          }
+
+          terms[first + i] = sqrt(sum_squared_error);
+        }
+      }
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  return (terms);
+}
+
+// void calculate_batch_terms_Jacobian(const Matrix<double>&, const Vector<
+// Matrix<double> >&, const Vector< Matrix<double> >&, const unsigned&,
+// Matrix<double>&) const method
+
+/// Writes the parameters derivatives of a block of instances in consecutive
+/// rows of a terms Jacobian matrix.
+/// Each row holds the derivatives of one instance, arranged as in
+/// calculate_batch_gradient.
+/// @param inputs Inputs to the multilayer perceptron, with one instance per
+/// row.
+/// @param layers_activation Activations of every layer.
+/// @param layers_delta Delta of every layer.
+/// @param first_row Row of the terms Jacobian for the first instance of the
+/// block.
+/// @param terms_Jacobian Terms Jacobian matrix.
+
+void PerformanceTerm::calculate_batch_terms_Jacobian(
+    const Matrix<double>& inputs,
+    const Vector<Matrix<double> >& layers_activation,
+    const Vector<Matrix<double> >& layers_delta, const unsigned& first_row,
+    Matrix<double>& terms_Jacobian) const {
+  const unsigned layers_number = layers_delta.size();
+
+  const unsigned instances_number = inputs.get_rows_number();
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    double* row = terms_Jacobian[first_row + i];
+
+    unsigned index = 0;
+
+    for (unsigned h = 0; h < layers_number; h++) {
+      const double* layer_inputs =
+          h == 0 ? inputs[i] : layers_activation[h - 1][i];
+      const double* layer_delta = layers_delta[h][i];
+
+      const unsigned layer_inputs_number =
+          h == 0 ? inputs.get_columns_number()
+                 : layers_activation[h - 1].get_columns_number();
+      const unsigned layer_perceptrons_number =
+          layers_delta[h].get_columns_number();
+
+      for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+        const double delta = layer_delta[j];
+
+        row[index] = delta;
+
+        for (unsigned k = 0; k < layer_inputs_number; k++) {
+          row[index + 1 + k] = delta * layer_inputs[k];
+        }
+
+        index += 1 + layer_inputs_number;
+      }
+    }
+  }
+}
+
+// Matrix<double> calculate_training_terms_Jacobian(void) const method
+
+/// Returns the Jacobian of the distances between the outputs and the targets
+/// with respect to the multilayer perceptron parameters, with one row for each
+/// training instance.
+/// It uses the batch back-propagation algorithm, with the chunks of instances
+/// processed in parallel.
+/// If the neural network has a conditions layer, the distances are measured
+/// on the conditioned outputs.
+
+Matrix<double> PerformanceTerm::calculate_training_terms_Jacobian(void) const {
+  Vector<double> terms;
+  Matrix<double> terms_Jacobian;
+
+  calculate_training_terms_Jacobian(terms, terms_Jacobian);
+
+  return (terms_Jacobian);
+}
+
+// void calculate_training_terms_layers_delta(const unsigned&, const unsigned&,
+// Matrix<double>&, Vector< Matrix<double> >&, Vector< Matrix<double> >&,
+// Vector<double>&) const method
+
+/// Propagates a block of training instances forward and backward, and
+/// calculates the distances between their outputs and targets, together with
+/// the layers delta of those distances.
+/// The rows of the terms Jacobian for the block follow from the layers delta
+/// and the layers inputs, as in calculate_batch_terms_Jacobian.
+/// If the neural network has a conditions layer, the distances are measured
+/// on the conditioned outputs.
+/// @param first_instance Index of the first training instance in the block.
+/// @param instances_number Number of training instances in the block.
+/// @param inputs Matrix to store the inputs of the block.
+/// @param layers_activation Vector to store the activations of every layer.
+/// @param layers_delta Vector to store the delta of every layer.
+/// @param terms Vector to store the distances of the block.
+
+void PerformanceTerm::calculate_training_terms_layers_delta(
+    const unsigned& first_instance, const unsigned& instances_number,
+    Matrix<double>& inputs, Vector<Matrix<double> >& layers_activation,
+    Vector<Matrix<double> >& layers_delta, Vector<double>& terms) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned outputs_number =
+      multilayer_perceptron_pointer->get_outputs_number();
+
+  const bool has_conditions_layer =
+      neural_network_pointer->has_conditions_layer();
+
+  Matrix<double> targets;
+
+  Vector<Matrix<double> > layers_activation_derivative;
+
+  Matrix<double> outputs;
+  Matrix<double> output_gradient;
+  Matrix<double> homogeneous_solutions;
+
+  data_set_pointer->get_training_input_block(first_instance, instances_number,
+                                             inputs);
+  data_set_pointer->get_training_target_block(first_instance, instances_number,
+                                              targets);
+
+  multilayer_perceptron_pointer->calculate_first_order_forward_propagation(
+      inputs, layers_activation, layers_activation_derivative);
+
+  if (!has_conditions_layer) {
+    outputs = layers_activation[layers_number - 1];
+  } else {
+    calculate_conditioned_outputs(inputs, layers_activation[layers_number - 1],
+                                  outputs, homogeneous_solutions);
+  }
+
+  // Derivatives of the distances with respect to the outputs
+
+  terms.set(instances_number);
+
+  output_gradient.set(instances_number, outputs_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    double sum_squared_error = 0.0;
+
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_gradient[i][j] = outputs[i][j] - targets[i][j];
+
+      sum_squared_error += output_gradient[i][j] * output_gradient[i][j];
+    }
+
+    const double distance = sqrt(sum_squared_error);
+
+    terms[i] = distance;
+
+    for (unsigned j = 0; j < outputs_number; j++) {
+      if (distance == 0.0) {
+        output_gradient[i][j] = 0.0;
+      } else {
+        output_gradient[i][j] /= distance;
+      }
+
+      if (has_conditions_layer) {
+        output_gradient[i][j] *= homogeneous_solutions[i][j];
+      }
+    }
+  }
+
+  calculate_layers_delta(layers_activation_derivative, output_gradient,
+                         layers_delta);
+}
+
+// void calculate_training_terms_Jacobian(const unsigned&, const unsigned&,
+// const unsigned&, Vector<double>&, Matrix<double>&) const method
+
+/// Calculates the distances between the outputs and the targets for a range of
+/// training instances, together with their Jacobian, with a single forward and
+/// backward propagation of each instance.
+/// The instances are processed in blocks of the batch size, and each one is
+/// written in consecutive positions of the terms and rows of the Jacobian.
+/// If the neural network has a conditions layer, the distances are measured
+/// on the conditioned outputs.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param first_row Position of the first instance of the range in the terms
+/// and the terms Jacobian.
+/// @param terms Vector to store the distances.
+/// @param terms_Jacobian Matrix to store the Jacobian of the distances.
+
+void PerformanceTerm::calculate_training_terms_Jacobian(
+    const unsigned& first_instance, const unsigned& last_instance,
+    const unsigned& first_row, Vector<double>& terms,
+    Matrix<double>& terms_Jacobian) const {
+  Matrix<double> inputs;
+
+  Vector<Matrix<double> > layers_activation;
+  Vector<Matrix<double> > layers_delta;
+
+  Vector<double> block_terms;
+
+  unsigned block_instances_number;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    const unsigned block_first_row = first_row + first - first_instance;
+
+    calculate_training_terms_layers_delta(first, block_instances_number, inputs,
+                                          layers_activation, layers_delta,
+                                          block_terms);
+
+    for (unsigned i = 0; i < block_instances_number; i++) {
+      terms[block_first_row + i] = block_terms[i];
+    }
+
+    calculate_batch_terms_Jacobian(inputs, layers_activation, layers_delta,
+                                   block_first_row, terms_Jacobian);
+  }
+}
+
+// void calculate_training_terms_Jacobian(Vector<double>&, Matrix<double>&)
+// const method
+
+/// Calculates both the distances between the outputs and the targets for each
+/// training instance and their Jacobian, with a single forward and backward
+/// propagation of each instance.
+/// If the neural network has a conditions layer, the distances are measured
+/// on the conditioned outputs.
+/// @param terms Vector to store the distances.
+/// @param terms_Jacobian Matrix to store the Jacobian of the distances.
+
+void PerformanceTerm::calculate_training_terms_Jacobian(
+    Vector<double>& terms, Matrix<double>& terms_Jacobian) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  terms.set(training_instances_number, 0.0);
+
+  if (training_instances_number == 0 || parameters_number == 0) {
+    terms_Jacobian.set();
+
+    return;
+  }
+
+  terms_Jacobian.set(training_instances_number, parameters_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      const unsigned first_instance = get_chunk_first_instance(
+          chunk, chunks_number, training_instances_number);
+
+      calculate_training_terms_Jacobian(
+          first_instance, get_chunk_first_instance(chunk + 1, chunks_number,
+                                                   training_instances_number),
+          first_instance, terms, terms_Jacobian);
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+}
+
+// TermsJacobianProducts calculate_training_terms_Jacobian_products(void) const
+// method
+
+/// Returns the sum of the squared distances between the outputs and the
+/// targets of the training instances, and the products of the transposed
+/// Jacobian of the distances with the distances and with itself.
+/// The Jacobian is never formed: the training instances are propagated in
+/// slabs of a few blocks, whose rows are accumulated into the products before
+/// the next slab is calculated.
+/// Only the upper triangle is accumulated, and it is copied to the lower one
+/// at the end.
+/// Every element of the products is accumulated by a single thread, in the
+/// order of the instances, so that the result does not depend on the number
+/// of threads.
+
+PerformanceTerm::TermsJacobianProducts
+PerformanceTerm::calculate_training_terms_Jacobian_products(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  TermsJacobianProducts terms_Jacobian_products;
+
+  terms_Jacobian_products.terms_squared_sum = 0.0;
+  terms_Jacobian_products.JacobianT_dot_terms.set(parameters_number, 0.0);
+  terms_Jacobian_products.JacobianT_dot_Jacobian.set(parameters_number,
+                                                     parameters_number, 0.0);
+
+  if (training_instances_number == 0 || parameters_number == 0) {
+    return (terms_Jacobian_products);
+  }
+
+  Vector<double>& JacobianT_dot_terms =
+      terms_Jacobian_products.JacobianT_dot_terms;
+  Matrix<double>& JacobianT_dot_Jacobian =
+      terms_Jacobian_products.JacobianT_dot_Jacobian;
+
+  const unsigned slab_blocks_number = threads_number;
+
+  const unsigned slab_instances_number =
+      slab_blocks_number * batch_instances_number;
+
+  Vector<double> slab_terms(slab_instances_number);
+  Matrix<double> slab_terms_Jacobian(slab_instances_number, parameters_number);
+
+  for (unsigned slab_first = 0; slab_first < training_instances_number;
+       slab_first += slab_instances_number) {
+    const unsigned slab_last =
+        std::min(slab_first + slab_instances_number, training_instances_number);
+
+    const unsigned rows_number = slab_last - slab_first;
+
+    std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+    for (int block = 0; block < (int)slab_blocks_number; block++) {
+      try {
+        const unsigned first = slab_first + block * batch_instances_number;
+
+        if (first < slab_last) {
+          calculate_training_terms_Jacobian(
+              first, std::min(first + batch_instances_number, slab_last),
+              first - slab_first, slab_terms, slab_terms_Jacobian);
+        }
+      }
+      catch (const std::exception & e) {
+        catch_chunk_exception(e, exception_message);
+      }
+    }
+
+    throw_chunk_exception(exception_message);
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      terms_Jacobian_products.terms_squared_sum +=
+          slab_terms[i] * slab_terms[i];
+    }
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+    for (int j = 0; j < (int)parameters_number; j++) {
+      try {
+        double* JacobianT_dot_Jacobian_row = JacobianT_dot_Jacobian[j];
+
+        for (unsigned i = 0; i < rows_number; i++) {
+          const double* row = slab_terms_Jacobian[i];
+
+          const double derivative = row[j];
+
+          if (derivative == 0.0) {
+            continue;
+          }
+
+          JacobianT_dot_terms[j] += derivative * slab_terms[i];
+
+          for (unsigned k = j; k < parameters_number; k++) {
+            JacobianT_dot_Jacobian_row[k] += derivative * row[k];
+          }
+        }
+      }
+      catch (const std::exception & e) {
+        catch_chunk_exception(e, exception_message);
+      }
+    }
+
+    throw_chunk_exception(exception_message);
+  }
+
+  for (unsigned j = 0; j < parameters_number; j++) {
+    for (unsigned k = 0; k < j; k++) {
+      JacobianT_dot_Jacobian[j][k] = JacobianT_dot_Jacobian[k][j];
+    }
+  }
+
+  return (terms_Jacobian_products);
+}
+
+// void calculate_training_JacobianT_dot_Jacobian_dot_vector(const unsigned&,
+// const unsigned&, const Vector<double>&, Vector<double>&) const method
+
+/// Adds the product of the transposed terms Jacobian, the terms Jacobian and a
+/// vector for a range of training instances to a given vector.
+/// The terms Jacobian is never formed: each block of instances is propagated
+/// once, the product of its Jacobian rows with the vector is calculated from
+/// the layers delta, and the layers delta scaled by that product are then
+/// accumulated as a gradient.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param vector Vector of multilayer perceptron parameters in the product.
+/// @param product Vector to which the product of the range is added.
+
+void PerformanceTerm::calculate_training_JacobianT_dot_Jacobian_dot_vector(
+    const unsigned& first_instance, const unsigned& last_instance,
+    const Vector<double>& vector, Vector<double>& product) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  Matrix<double> inputs;
+
+  Vector<Matrix<double> > layers_activation;
+  Vector<Matrix<double> > layers_delta;
+
+  Vector<double> terms;
+  Vector<double> Jacobian_dot_vector;
+
+  unsigned block_instances_number;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    calculate_training_terms_layers_delta(first, block_instances_number, inputs,
+                                          layers_activation, layers_delta,
+                                          terms);
+
+    // Product of the Jacobian rows of the block with the vector
+
+    Jacobian_dot_vector.set(block_instances_number, 0.0);
+
+    unsigned index = 0;
+
+    for (unsigned h = 0; h < layers_number; h++) {
+      const Matrix<double>& layer_inputs =
+          h == 0 ? inputs : layers_activation[h - 1];
+      const Matrix<double>& layer_delta = layers_delta[h];
+
+      const unsigned layer_inputs_number = layer_inputs.get_columns_number();
+      const unsigned layer_perceptrons_number =
+          layer_delta.get_columns_number();
+
+      for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+        const double* perceptron_vector = &vector[index];
+
+        for (unsigned i = 0; i < block_instances_number; i++) {
+          const double* instance_inputs = layer_inputs[i];
+
+          double combination = perceptron_vector[0];
+
+          for (unsigned k = 0; k < layer_inputs_number; k++) {
+            combination += perceptron_vector[k + 1] * instance_inputs[k];
+          }
+
+          Jacobian_dot_vector[i] += layer_delta[i][j] * combination;
+        }
+
+        index += 1 + layer_inputs_number;
+      }
+    }
+
+    // Product of the transposed Jacobian rows with the previous product
+
+    for (unsigned h = 0; h < layers_number; h++) {
+      Matrix<double>& layer_delta = layers_delta[h];
+
+      const unsigned layer_perceptrons_number =
+          layer_delta.get_columns_number();
+
+      for (unsigned i = 0; i < block_instances_number; i++) {
+        for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+          layer_delta[i][j] *= Jacobian_dot_vector[i];
+        }
+      }
+    }
+
+    calculate_batch_gradient(inputs, layers_activation, layers_delta, product);
+  }
+}
+
+// Vector<double> calculate_training_JacobianT_dot_Jacobian_dot_vector(const
+// Vector<double>&) const method
+
+/// Returns the product of the transposed terms Jacobian, the terms Jacobian
+/// and a vector of multilayer perceptron parameters, over the training
+/// instances.
+/// This is the product of the Gauss-Newton approximation of the Hessian and
+/// the vector, and it is calculated without forming the terms Jacobian.
+/// The training instances are split in chunks, whose products are calculated
+/// in parallel and then added pairwise.
+/// @param vector Vector of multilayer perceptron parameters in the product.
+
+Vector<double>
+PerformanceTerm::calculate_training_JacobianT_dot_Jacobian_dot_vector(
+    const Vector<double>& vector) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+  if (vector.size() != parameters_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> "
+              "calculate_training_JacobianT_dot_Jacobian_dot_vector(const "
+              "Vector<double>&) const method.\n"
+           << "Size of vector must be equal to number of multilayer "
+              "perceptron parameters.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  if (chunks_number == 0) {
+    return (Vector<double>(parameters_number, 0.0));
+  }
+
+  Vector<Vector<double> > chunks_product(chunks_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      chunks_product[chunk].set(parameters_number, 0.0);
+
+      calculate_training_JacobianT_dot_Jacobian_dot_vector(
+          get_chunk_first_instance(chunk, chunks_number,
+                                   training_instances_number),
+          get_chunk_first_instance(chunk + 1, chunks_number,
+                                   training_instances_number),
+          vector, chunks_product[chunk]);
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  sum_chunks(chunks_product);
+
+  return (chunks_product[0]);
+}
+
+// void calculate_training_JacobianT_dot_Jacobian_diagonal(const unsigned&,
+// const unsigned&, Vector<double>&) const method
+
+/// Adds the diagonal of the product of the transposed terms Jacobian and the
+/// terms Jacobian for a range of training instances to a given vector.
+/// Each element is the sum of the squared derivatives of the distances with
+/// respect to one parameter, which are calculated from the layers delta
+/// without forming the terms Jacobian.
+/// @param first_instance Index of the first training instance in the range.
+/// @param last_instance Index one past the last training instance in the range.
+/// @param diagonal Vector to which the diagonal of the range is added.
+
+void PerformanceTerm::calculate_training_JacobianT_dot_Jacobian_diagonal(
+    const unsigned& first_instance, const unsigned& last_instance,
+    Vector<double>& diagonal) const {
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  Matrix<double> inputs;
+
+  Vector<Matrix<double> > layers_activation;
+  Vector<Matrix<double> > layers_delta;
+
+  Vector<double> terms;
+
+  unsigned block_instances_number;
+
+  for (unsigned first = first_instance; first < last_instance;
+       first += batch_instances_number) {
+    block_instances_number = last_instance - first;
+
+    if (block_instances_number > batch_instances_number) {
+      block_instances_number = batch_instances_number;
+    }
+
+    calculate_training_terms_layers_delta(first, block_instances_number, inputs,
+                                          layers_activation, layers_delta,
+                                          terms);
+
+    unsigned index = 0;
+
+    for (unsigned h = 0; h < layers_number; h++) {
+      const Matrix<double>& layer_inputs =
+          h == 0 ? inputs : layers_activation[h - 1];
+      const Matrix<double>& layer_delta = layers_delta[h];
+
+      const unsigned layer_inputs_number = layer_inputs.get_columns_number();
+      const unsigned layer_perceptrons_number =
+          layer_delta.get_columns_number();
+
+      for (unsigned j = 0; j < layer_perceptrons_number; j++) {
+        double& bias_diagonal = diagonal[index];
+        double* synaptic_weights_diagonal = &diagonal[index + 1];
+
+        for (unsigned i = 0; i < block_instances_number; i++) {
+          const double squared_delta = layer_delta[i][j] * layer_delta[i][j];
+          const double* instance_inputs = layer_inputs[i];
+
+          bias_diagonal += squared_delta;
+
+          for (unsigned k = 0; k < layer_inputs_number; k++) {
+            synaptic_weights_diagonal[k] +=
+                squared_delta * instance_inputs[k] * instance_inputs[k];
+          }
+        }
+
+        index += 1 + layer_inputs_number;
+      }
+    }
+  }
+}
+
+// Vector<double> calculate_training_JacobianT_dot_Jacobian_diagonal(void)
+// const method
+
+/// Returns the diagonal of the product of the transposed terms Jacobian and
+/// the terms Jacobian over the training instances, without forming the terms
+/// Jacobian.
+/// The training instances are split in chunks, whose diagonals are calculated
+/// in parallel and then added pairwise.
+
+Vector<double>
+PerformanceTerm::calculate_training_JacobianT_dot_Jacobian_diagonal(
+    void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned layers_number =
+      multilayer_perceptron_pointer->get_layers_number();
+
+  const unsigned parameters_number =
+      multilayer_perceptron_pointer->count_parameters_number();
+
+  const unsigned training_instances_number =
+      prepare_parallel_evaluation(layers_number);
+
+  const unsigned chunks_number = count_chunks_number(training_instances_number);
+
+  if (chunks_number == 0) {
+    return (Vector<double>(parameters_number, 0.0));
+  }
+
+  Vector<Vector<double> > chunks_diagonal(chunks_number);
+
+  std::string exception_message;
+
+#pragma omp parallel for num_threads(threads_number) schedule(dynamic)
+  for (int chunk = 0; chunk < (int)chunks_number; chunk++) {
+    try {
+      chunks_diagonal[chunk].set(parameters_number, 0.0);
+
+      calculate_training_JacobianT_dot_Jacobian_diagonal(
+          get_chunk_first_instance(chunk, chunks_number,
+                                   training_instances_number),
+          get_chunk_first_instance(chunk + 1, chunks_number,
+                                   training_instances_number),
+          chunks_diagonal[chunk]);
+    }
+    catch (const std::exception & e) {
+      catch_chunk_exception(e, exception_message);
+    }
+  }
+
+  throw_chunk_exception(exception_message);
+
+  sum_chunks(chunks_diagonal);
+
+  return (chunks_diagonal[0]);
+}
+
+// unsigned prepare_parallel_evaluation(const unsigned&) const method
+
+/// Prepares the data set for being read from several threads, and returns the
+/// number of training instances to be evaluated.
+/// The data set builds its tables of indices when they are first used, so they
+/// are built here, before any thread is started.
+/// In single precision, the single precision copy of the data is also built
+/// here.
+/// If the multilayer perceptron has no layers there is nothing to evaluate, and
+/// zero is returned.
+/// @param layers_number Number of layers in the multilayer perceptron.
+
+unsigned PerformanceTerm::prepare_parallel_evaluation(
+    const unsigned& layers_number) const {
+  if (layers_number == 0) {
+    return (0);
+  }
+
+  const Variables& variables = data_set_pointer->get_variables();
+
+  variables.get_inputs_indices();
+  variables.get_targets_indices();
+
+  if (single_precision) {
+    data_set_pointer->update_single_precision_data();
+  }
+
+  return (data_set_pointer->get_instances().get_training_indices().size());
+}
+
+// unsigned count_chunks_number(const unsigned&) const method
+
+/// Returns the number of chunks in which a number of training instances is to
+/// be split for the parallel evaluation.
+/// With deterministic reduction it does not depend on the number of threads,
+/// and otherwise there is one chunk per thread.
+/// Every chunk holds at least one block of instances.
+/// @param instances_number Number of training instances.
+
+unsigned PerformanceTerm::count_chunks_number(
+    const unsigned& instances_number) const {
+  const unsigned deterministic_chunks_number = 64;
+
+  const unsigned blocks_number =
+      (instances_number + batch_instances_number - 1) / batch_instances_number;
+
+  const unsigned chunks_number =
+      deterministic_reduction ? deterministic_chunks_number : threads_number;
+
+  return (std::min(chunks_number, blocks_number));
+}
+
+// unsigned get_chunk_first_instance(const unsigned&, const unsigned&, const
+// unsigned&) const method
+
+/// Returns the index of the first training instance in a chunk.
+/// The instances are split in chunks of contiguous instances of nearly the same
+/// size.
+/// @param chunk Index of the chunk. If it is equal to the number of chunks, the
+/// number of instances is returned.
+/// @param chunks_number Number of chunks.
+/// @param instances_number Number of training instances.
+
+unsigned PerformanceTerm::get_chunk_first_instance(
+    const unsigned& chunk, const unsigned& chunks_number,
+    const unsigned& instances_number) const {
+  return ((unsigned)(((unsigned long long)chunk * instances_number) /
+                     chunks_number));
+}
+
+// double sum_chunks(Vector<double>&) const method
+
+/// Adds the results of all the chunks in a fixed binary tree, so that the
+/// rounding errors only depend on the number of chunks.
+/// The vector is overwritten in the process.
+/// @param chunks_values Result of every chunk.
+
+double PerformanceTerm::sum_chunks(Vector<double>& chunks_values) const {
+  const unsigned chunks_number = chunks_values.size();
+
+  for (unsigned stride = 1; stride < chunks_number; stride *= 2) {
+    for (unsigned i = 0; i + stride < chunks_number; i += 2 * stride) {
+      chunks_values[i] += chunks_values[i + stride];
+    }
+  }
+
+  return (chunks_values[0]);
+}
+
+// void sum_chunks(Vector< Vector<double> >&) const method
+
+/// Adds the vectors of all the chunks in a fixed binary tree, and leaves the
+/// result in the first one.
+/// @param chunks_vectors Result of every chunk.
+
+void PerformanceTerm::sum_chunks(Vector<Vector<double> >& chunks_vectors) const {
+  const unsigned chunks_number = chunks_vectors.size();
+
+  for (unsigned stride = 1; stride < chunks_number; stride *= 2) {
+    for (unsigned i = 0; i + stride < chunks_number; i += 2 * stride) {
+      chunks_vectors[i] += chunks_vectors[i + stride];
+    }
+  }
+}
+
+// void catch_chunk_exception(const std::exception&, std::string&) const method
+
+/// Keeps the message of an exception thrown by a chunk inside a parallel
+/// region, where it cannot be let out without terminating the program.
+/// Only the first message is kept.
+/// @param exception Exception thrown by the chunk.
+/// @param exception_message Message of the first exception thrown in the
+/// region, shared by all the threads.
+
+void PerformanceTerm::catch_chunk_exception(
+    const std::exception& exception, std::string& exception_message) const {
+#pragma omp critical(PerformanceTerm_chunk_exception)
+  {
+    if (exception_message.empty()) {
+      exception_message = exception.what();
+    }
+  }
+}
+
+// void throw_chunk_exception(const std::string&) const method
+
+/// Throws again, once the parallel region has finished, the first exception
+/// kept by the catch_chunk_exception method, if any.
+/// @param exception_message Message of the first exception thrown in the
+/// region, or an empty string if none was thrown.
+
+void PerformanceTerm::throw_chunk_exception(
+    const std::string& exception_message) const {
+  if (!exception_message.empty()) {
+    throw std::logic_error(exception_message);
+  }
+}
+
+// Vector<double> calculate_gradient(void) const method
+
+/// Returns the default gradient vector of the performance term.
+/// It uses numerical differentiation.
+
+Vector<double> PerformanceTerm::calculate_gradient(void) const {
+// Neural network stuff
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+// Performance functional stuff
+
+#ifndef NDEBUG
+
+  std::ostringstream buffer;
+
+  if (!numerical_differentiation_pointer) {
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> calculate_gradient(void) const method.\n"
+           << "Numerical differentiation pointer is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const Vector<double> parameters =
+      neural_network_pointer->arrange_parameters();
+
+  return (numerical_differentiation_pointer->calculate_gradient(
+      *this, &PerformanceTerm::calculate_performance, parameters));
+}
+
+// Vector<double> calculate_gradient(const Vector<double>&) const method
+
+/// Returns the default gradient vector of the performance term.
+/// It uses numerical differentiation.
+
+Vector<double> PerformanceTerm::calculate_gradient(
+    const Vector<double>& parameters) const {
+// Neural network stuff
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+// Performance functional stuff
+
+#ifndef NDEBUG
+
+  std::ostringstream buffer;
+
+  if (!numerical_differentiation_pointer) {
+    buffer << "OpenNN Exception: PerformanceTerm class.\n"
+           << "Vector<double> calculate_gradient(const Vector<double>&) const "
+              "method.\n"
+           << "Numerical differentiation pointer is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  return (numerical_differentiation_pointer->calculate_gradient(
+      *this, &PerformanceTerm::calculate_performance, parameters));
+}
+
+// Matrix<double> calculate_Hessian(void) const method
+
+/// @todo
+
+Matrix<double> PerformanceTerm::calculate_Hessian(void) const {
+// Neural network stuff
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const Vector<double> parameters =
+      neural_network_pointer->arrange_parameters();
+
+  return (numerical_differentiation_pointer->calculate_Hessian(
+      *this, &PerformanceTerm::calculate_performance, parameters));
+}
+
+// Matrix<double> calculate_Hessian(const Vector<double>&) const method
+
+/// @todo
+
+Matrix<double> PerformanceTerm::calculate_Hessian(
+    const Vector<double>& parameters) const {
+// Neural network stuff
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  return (numerical_differentiation_pointer->calculate_Hessian(
+      *this, &PerformanceTerm::calculate_performance, parameters));
+}
+
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const
+// method
+
+/// Returns the product of the performance term Hessian and a given vector of
+/// parameters.
+/// This default implementation forms the Hessian matrix.
+/// Performance terms which can calculate that product directly, such as the
+/// error terms with the R-operator, override this method.
+/// @param vector Vector of parameters in the product.
+
+Vector<double> PerformanceTerm::calculate_vector_dot_Hessian(
+    const Vector<double>& vector) const {
+  return (calculate_Hessian().dot(vector));
+}
+
+// Vector<double> calculate_terms(void) const method
+
+/// Returns the performance of all the subterms composing the performance term.
+
+Vector<double> PerformanceTerm::calculate_terms(void) const {
+  std::ostringstream buffer;
+
+  buffer << "OpenNN Exception: PerformanceTerm class.\n"
+         << "Vector<double> calculate_terms(void) const method.\n"
+         << "The terms function is not defined for this performance term.\n";
+
+  throw std::logic_error(buffer.str());
+}
+
+// Vector<double> calculate_terms(const Vector<double>&) const method
+
+/// Returns the performance of all the subterms composing the performance term.
+
+Vector<double> PerformanceTerm::calculate_terms(const Vector<double>&) const {
+  std::ostringstream buffer;
+
+  buffer
+      << "OpenNN Exception: PerformanceTerm class.\n"
+      << "Vector<double> calculate_terms(const Vector<double>&) const method.\n"
+      << "The terms function is not defined for this performance term.\n";
+
+  throw std::logic_error(buffer.str());
+}
+
+// Matrix<double> calculate_terms_Jacobian(void) const method
+
+/// Returns the Jacobian matrix of the subterms composing the performance term.
+
+Matrix<double> PerformanceTerm::calculate_terms_Jacobian(void) const {
+  std::ostringstream buffer;
+
+  buffer << "OpenNN Exception: PerformanceTerm class.\n"
+         << "Matrix<double> calculate_terms_Jacobian(void) const method.\n"
+         << "The terms function is not defined for this performance term.\n";
+
+  throw std::logic_error(buffer.str());
+}
+
+// FirstOrderPerformance calculate_first_order_performance(void) const method
+
+/// Returns the performance and the gradient of the performance term.
+/// This default implementation calculates them separately.
+/// Performance terms which can obtain both from the same propagation of the
+/// training instances override it.
+
+PerformanceTerm::FirstOrderPerformance
+PerformanceTerm::calculate_first_order_performance(void) const {
+  FirstOrderPerformance first_order_performance;
+
+  first_order_performance.performance = calculate_performance();
+  first_order_performance.gradient = calculate_gradient();
+
+  return (first_order_performance);
+}
+
+// PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const
+
+/// Returns the performance of all the subterms composing the performance term.
+
+PerformanceTerm::FirstOrderTerms PerformanceTerm::calculate_first_order_terms(
+    void) const {
+  std::ostringstream buffer;
+
+  buffer << "OpenNN Exception: PerformanceTerm class.\n"
+         << "Vector<double> calculate_terms(void) const method.\n"
+         << "The terms function is not defined for this performance term.\n";
 
   throw std::logic_error(buffer.str());
 }
 
+// TermsJacobianProducts calculate_terms_Jacobian_products(void) const method
+
+/// Returns the sum of the squared subterms and the products of the transposed
+/// terms Jacobian with the subterms and with itself.
+/// By default they are calculated from the first order terms, so the terms
+/// Jacobian is formed.
+/// The squared error terms override this, so that the products are accumulated
+/// without forming the terms Jacobian.
+
+PerformanceTerm::TermsJacobianProducts
+PerformanceTerm::calculate_terms_Jacobian_products(void) const {
+  const FirstOrderTerms first_order_terms = calculate_first_order_terms();
+
+  const Matrix<double> JacobianT =
+      first_order_terms.Jacobian.calculate_transpose();
+
+  TermsJacobianProducts terms_Jacobian_products;
+
+  terms_Jacobian_products.terms_squared_sum =
+      first_order_terms.terms.dot(first_order_terms.terms);
+
+  terms_Jacobian_products.JacobianT_dot_terms =
+      JacobianT.dot(first_order_terms.terms);
+
+  terms_Jacobian_products.JacobianT_dot_Jacobian =
+      JacobianT.dot(first_order_terms.Jacobian);
+
+  return (terms_Jacobian_products);
+}
+
+// Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(const
+// Vector<double>&) const method
+
+/// Returns the product of the transposed terms Jacobian, the terms Jacobian
+/// and a vector of parameters.
+/// By default the terms Jacobian is formed.
+/// The squared error terms override this, so that the product is calculated
+/// without forming the terms Jacobian.
+/// @param vector Vector of parameters in the product.
+
+Vector<double> PerformanceTerm::calculate_JacobianT_dot_Jacobian_dot_vector(
+    const Vector<double>& vector) const {
+  const Matrix<double> terms_Jacobian = calculate_terms_Jacobian();
+
+  return (terms_Jacobian.calculate_transpose().dot(terms_Jacobian.dot(vector)));
+}
+
+// Vector<double> calculate_performances(const Vector< Vector<double> >&) const
+// method
+
+/// Returns the performances of the performance term for several vectors of
+/// parameters, which are not set to the neural network.
+/// By default the performance is calculated for each vector in turn.
+/// The squared error terms override this, so that all the vectors are
+/// evaluated in a single pass over the data.
+/// @param parameters Vectors of potential parameters for the neural network.
+
+Vector<double> PerformanceTerm::calculate_performances(
+    const Vector<Vector<double> >& parameters) const {
+  const unsigned points_number = parameters.size();
+
+  Vector<double> performances(points_number);
+
+  for (unsigned i = 0; i < points_number; i++) {
+    performances[i] = calculate_performance(parameters[i]);
+  }
+
+  return (performances);
+}
+
+// Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const method
+
+/// Returns the diagonal of the product of the transposed terms Jacobian and
+/// the terms Jacobian, which is the sum of the squares of each column of the
+/// terms Jacobian.
+/// By default the terms Jacobian is formed.
+/// The squared error terms override this, so that the diagonal is calculated
+/// without forming the terms Jacobian.
+
+Vector<double> PerformanceTerm::calculate_JacobianT_dot_Jacobian_diagonal(
+    void) const {
+  const Matrix<double> terms_Jacobian = calculate_terms_Jacobian();
+
+  const unsigned rows_number = terms_Jacobian.get_rows_number();
+  const unsigned columns_number = terms_Jacobian.get_columns_number();
+
+  Vector<double> diagonal(columns_number, 0.0);
+
+  for (unsigned i = 0; i < rows_number; i++) {
+    for (unsigned j = 0; j < columns_number; j++) {
+      diagonal[j] += terms_Jacobian[i][j] * terms_Jacobian[i][j];
+    }
+  }
+
+  return (diagonal);
+}
+
 // std::string write_performance_term_type(void) const method
 
 /// Returns a string with the default type of performance term,
@@ -26,6 +26,7 @@
 #include <sstream>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 // OpenNN includes
 
@@ -172,6 +173,25 @@ class PerformanceTerm {
     Matrix<double> Jacobian;
   };
 
+  /// Set of the sum of squared subterms and the products of the transposed
+  /// subterms Jacobian with the subterms and with itself.
+  /// They are all that the Gauss-Newton approximation needs, and their size
+  /// does not depend on the number of subterms.
+
+  struct TermsJacobianProducts {
+    /// Sum of the squares of the subterms.
+
+    double terms_squared_sum;
+
+    /// Product of the transposed subterms Jacobian and the subterms vector.
+
+    Vector<double> JacobianT_dot_terms;
+
+    /// Product of the transposed subterms Jacobian and the subterms Jacobian.
+
+    Matrix<double> JacobianT_dot_Jacobian;
+  };
+
   // METHODS
 
   // Get methods
@@ -266,6 +286,12 @@ class PerformanceTerm {
 
   const bool& get_display(void) const;
 
+  const unsigned& get_batch_instances_number(void) const;
+
+  const unsigned& get_threads_number(void) const;
+  const bool& get_deterministic_reduction(void) const;
+  const bool& get_single_precision(void) const;
+
   bool has_neural_network(void) const;
   bool has_mathematical_model(void) const;
   bool has_data_set(void) const;
@@ -293,6 +319,12 @@ class PerformanceTerm {
 
   void set_display(const bool&);
 
+  void set_batch_instances_number(const unsigned&);
+
+  void set_threads_number(const unsigned&);
+  void set_deterministic_reduction(const bool&);
+  void set_single_precision(const bool&);
+
   // Pointer methods
 
   void construct_numerical_differentiation(void);
@@ -330,6 +362,116 @@ class PerformanceTerm {
       const Matrix<Matrix<double> >&, const Vector<Vector<double> >&,
       const Matrix<Matrix<double> >&) const;
 
+  // Batch back-propagation methods
+
+  virtual void calculate_output_gradient(const Matrix<double>&,
+                                         const Matrix<double>&,
+                                         Matrix<double>&) const;
+
+  virtual void calculate_output_vector_dot_Hessian(const Matrix<double>&,
+                                                   const Matrix<double>&,
+                                                   const Matrix<double>&,
+                                                   Matrix<double>&) const;
+
+  void calculate_layers_delta(const Vector<Matrix<double> >&,
+                              const Matrix<double>&,
+                              Vector<Matrix<double> >&) const;
+
+  void calculate_batch_gradient(const Matrix<double>&,
+                                const Vector<Matrix<double> >&,
+                                const Vector<Matrix<double> >&,
+                                Vector<double>&) const;
+
+  void calculate_layers_delta(const Vector<Matrix<float> >&,
+                              const Matrix<double>&, const Vector<float>&,
+                              Vector<Matrix<float> >&) const;
+
+  void calculate_batch_gradient(const Matrix<float>&,
+                                const Vector<Matrix<float> >&,
+                                const Vector<Matrix<float> >&,
+                                Vector<double>&) const;
+
+  void calculate_conditioned_outputs(const Matrix<double>&,
+                                     const Matrix<double>&, Matrix<double>&,
+                                     Matrix<double>&) const;
+
+  void calculate_training_error_gradient(const unsigned&, const unsigned&,
+                                         double*, Vector<double>&) const;
+  void calculate_single_precision_training_error_gradient(
+      const unsigned&, const unsigned&, const Vector<float>&, double*,
+      Vector<double>&) const;
+  Vector<double> calculate_training_gradient(void) const;
+
+  void calculate_training_error_gradient(double&, Vector<double>&) const;
+
+  void calculate_training_vector_dot_Hessian(const unsigned&, const unsigned&,
+                                             const Vector<double>&,
+                                             Vector<double>&) const;
+  Vector<double> calculate_training_vector_dot_Hessian(
+      const Vector<double>&) const;
+
+  virtual double calculate_outputs_error(const Matrix<double>&,
+                                         const Matrix<double>&) const;
+
+  double calculate_training_error(const unsigned&, const unsigned&) const;
+  double calculate_training_error(void) const;
+
+  double calculate_single_precision_training_error(
+      const unsigned&, const unsigned&, const Vector<float>&) const;
+
+  void calculate_training_errors(const unsigned&, const unsigned&,
+                                 const Vector<Vector<double> >&,
+                                 Vector<double>&) const;
+  Vector<double> calculate_training_errors(
+      const Vector<Vector<double> >&) const;
+
+  Vector<double> calculate_training_terms(void) const;
+
+  void calculate_batch_terms_Jacobian(const Matrix<double>&,
+                                      const Vector<Matrix<double> >&,
+                                      const Vector<Matrix<double> >&,
+                                      const unsigned&, Matrix<double>&) const;
+
+  void calculate_training_terms_Jacobian(const unsigned&, const unsigned&,
+                                         const unsigned&, Vector<double>&,
+                                         Matrix<double>&) const;
+  Matrix<double> calculate_training_terms_Jacobian(void) const;
+  void calculate_training_terms_Jacobian(Vector<double>&,
+                                         Matrix<double>&) const;
+
+  TermsJacobianProducts calculate_training_terms_Jacobian_products(void) const;
+
+  void calculate_training_terms_layers_delta(const unsigned&, const unsigned&,
+                                             Matrix<double>&,
+                                             Vector<Matrix<double> >&,
+                                             Vector<Matrix<double> >&,
+                                             Vector<double>&) const;
+
+  void calculate_training_JacobianT_dot_Jacobian_dot_vector(
+      const unsigned&, const unsigned&, const Vector<double>&,
+      Vector<double>&) const;
+  Vector<double> calculate_training_JacobianT_dot_Jacobian_dot_vector(
+      const Vector<double>&) const;
+
+  void calculate_training_JacobianT_dot_Jacobian_diagonal(
+      const unsigned&, const unsigned&, Vector<double>&) const;
+  Vector<double> calculate_training_JacobianT_dot_Jacobian_diagonal(
+      void) const;
+
+  // Parallel evaluation methods
+
+  unsigned prepare_parallel_evaluation(const unsigned&) const;
+
+  unsigned count_chunks_number(const unsigned&) const;
+  unsigned get_chunk_first_instance(const unsigned&, const unsigned&,
+                                    const unsigned&) const;
+
+  double sum_chunks(Vector<double>&) const;
+  void sum_chunks(Vector<Vector<double> >&) const;
+
+  void catch_chunk_exception(const std::exception&, std::string&) const;
+  void throw_chunk_exception(const std::string&) const;
+
   // Objective methods
 
   /// Returns the performance value of the performance term.
@@ -341,6 +483,9 @@ class PerformanceTerm {
 
   virtual double calculate_performance(const Vector<double>&) const = 0;
 
+  virtual Vector<double> calculate_performances(
+      const Vector<Vector<double> >&) const;
+
   /// Returns an performance of the performance term for generalization
   /// purposes.
 
@@ -354,12 +499,18 @@ class PerformanceTerm {
 
   virtual Vector<double> calculate_gradient(const Vector<double>&) const;
 
+  virtual PerformanceTerm::FirstOrderPerformance
+      calculate_first_order_performance(void) const;
+
   /// Returns the performance term Hessian.
 
   virtual Matrix<double> calculate_Hessian(void) const;
 
   virtual Matrix<double> calculate_Hessian(const Vector<double>&) const;
 
+  virtual Vector<double> calculate_vector_dot_Hessian(
+      const Vector<double>&) const;
+
   virtual Vector<double> calculate_terms(void) const;
   virtual Vector<double> calculate_terms(const Vector<double>&) const;
 
@@ -368,6 +519,13 @@ class PerformanceTerm {
   virtual PerformanceTerm::FirstOrderTerms calculate_first_order_terms(
       void) const;
 
+  virtual PerformanceTerm::TermsJacobianProducts
+      calculate_terms_Jacobian_products(void) const;
+
+  virtual Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(
+      const Vector<double>&) const;
+  virtual Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const;
+
   virtual std::string write_performance_term_type(void) const;
 
   virtual std::string write_information(void) const;
@@ -383,6 +541,25 @@ class PerformanceTerm {
 
  protected:
 
+  // Batch back-propagation kernels
+
+  template <class Type>
+  static void calculate_output_layer_delta(const Matrix<Type>&,
+                                           const Matrix<double>&,
+                                           Matrix<Type>&);
+
+  template <class Type>
+  static void calculate_hidden_layer_delta(const Matrix<Type>&, const Type*,
+                                           const Matrix<Type>&, Matrix<Type>&);
+
+  template <class Type>
+  static void add_batch_gradient(const Matrix<Type>&,
+                                 const Vector<Matrix<Type> >&,
+                                 const Vector<Matrix<Type> >&,
+                                 const unsigned&, Vector<double>&);
+
+  static void convert_block(const Matrix<float>&, Matrix<double>&);
+
   /// Pointer to a multilayer perceptron object.
 
   NeuralNetwork* neural_network_pointer;
@@ -399,6 +576,24 @@ class PerformanceTerm {
 
   NumericalDifferentiation* numerical_differentiation_pointer;
 
+  /// Number of training instances processed together by the batch
+  /// back-propagation algorithm.
+
+  unsigned batch_instances_number;
+
+  /// Number of threads among which the training instances are shared.
+
+  unsigned threads_number;
+
+  /// True if the parallel results must not depend on the number of threads.
+
+  bool deterministic_reduction;
+
+  /// True if the training error and gradient are calculated in single
+  /// precision.
+
+  bool single_precision;
+
   /// Display messages to screen.
 
   bool display;
@@ -0,0 +1,466 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   Q U A N T I Z E D   M U L T I L A Y E R   P E R C E P T R O N   C L A S S
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "quantized_multilayer_perceptron.h"
+
+namespace OpenNN {
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates an empty quantized multilayer perceptron.
+
+QuantizedMultilayerPerceptron::QuantizedMultilayerPerceptron(void) { set(); }
+
+// MULTILAYER PERCEPTRON CONSTRUCTOR
+
+/// Multilayer perceptron constructor.
+/// It quantizes a trained multilayer perceptron.
+/// @param multilayer_perceptron Multilayer perceptron to be quantized.
+/// @param calibration_input_data Inputs to the multilayer perceptron used for
+/// calibrating the scales of the layer inputs, with one instance per row.
+
+QuantizedMultilayerPerceptron::QuantizedMultilayerPerceptron(
+    const MultilayerPerceptron& multilayer_perceptron,
+    const Matrix<double>& calibration_input_data) {
+  set(multilayer_perceptron, calibration_input_data);
+}
+
+// DESTRUCTOR
+
+/// Destructor.
+
+QuantizedMultilayerPerceptron::~QuantizedMultilayerPerceptron(void) {}
+
+// bool is_empty(void) const method
+
+/// Returns true if the quantized multilayer perceptron has no layers, and false
+/// otherwise.
+
+bool QuantizedMultilayerPerceptron::is_empty(void) const {
+  return (layers_perceptrons_number.empty());
+}
+
+// unsigned get_inputs_number(void) const method
+
+/// Returns the number of inputs to the quantized multilayer perceptron.
+
+unsigned QuantizedMultilayerPerceptron::get_inputs_number(void) const {
+  if (layers_inputs_number.empty()) {
+    return (0);
+  }
+
+  return (layers_inputs_number[0]);
+}
+
+// unsigned get_outputs_number(void) const method
+
+/// Returns the number of outputs from the quantized multilayer perceptron.
+
+unsigned QuantizedMultilayerPerceptron::get_outputs_number(void) const {
+  if (layers_perceptrons_number.empty()) {
+    return (0);
+  }
+
+  return (layers_perceptrons_number[layers_perceptrons_number.size() - 1]);
+}
+
+// unsigned get_layers_number(void) const method
+
+/// Returns the number of layers in the quantized multilayer perceptron.
+
+unsigned QuantizedMultilayerPerceptron::get_layers_number(void) const {
+  return (layers_perceptrons_number.size());
+}
+
+// const Vector<signed char>& get_layer_synaptic_weights(const unsigned&) const
+// method
+
+/// Returns the quantized synaptic weights of a layer, with the weights of each
+/// perceptron in a row.
+/// @param i Index of layer.
+
+const Vector<signed char>&
+QuantizedMultilayerPerceptron::get_layer_synaptic_weights(
+    const unsigned& i) const {
+  return (layers_synaptic_weights[i]);
+}
+
+// const Vector<double>& get_layer_synaptic_weights_scales(const unsigned&)
+// const method
+
+/// Returns the scales of the synaptic weights of each perceptron in a layer.
+/// A synaptic weight is approximated by its quantized value times the scale of
+/// its perceptron.
+/// @param i Index of layer.
+
+const Vector<double>&
+QuantizedMultilayerPerceptron::get_layer_synaptic_weights_scales(
+    const unsigned& i) const {
+  return (layers_synaptic_weights_scales[i]);
+}
+
+// const Vector<double>& get_layer_biases(const unsigned&) const method
+
+/// Returns the biases of a layer.
+/// @param i Index of layer.
+
+const Vector<double>& QuantizedMultilayerPerceptron::get_layer_biases(
+    const unsigned& i) const {
+  return (layers_biases[i]);
+}
+
+// const double& get_layer_inputs_scale(const unsigned&) const method
+
+/// Returns the scale of the inputs to a layer.
+/// @param i Index of layer.
+
+const double& QuantizedMultilayerPerceptron::get_layer_inputs_scale(
+    const unsigned& i) const {
+  return (layers_inputs_scale[i]);
+}
+
+// unsigned count_memory_size(void) const method
+
+/// Returns the number of bytes taken by the synaptic weights, the scales and
+/// the biases of all the layers.
+
+unsigned QuantizedMultilayerPerceptron::count_memory_size(void) const {
+  const unsigned layers_number = get_layers_number();
+
+  unsigned memory_size = layers_number * sizeof(double);
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    memory_size += layers_synaptic_weights[i].size() * sizeof(signed char);
+    memory_size += layers_synaptic_weights_scales[i].size() * sizeof(double);
+    memory_size += layers_biases[i].size() * sizeof(double);
+  }
+
+  return (memory_size);
+}
+
+// void set(void) method
+
+/// Sets an empty quantized multilayer perceptron.
+
+void QuantizedMultilayerPerceptron::set(void) {
+  layers_inputs_number.set();
+  layers_perceptrons_number.set();
+  layers_synaptic_weights.set();
+  layers_synaptic_weights_scales.set();
+  layers_biases.set();
+  layers_inputs_scale.set();
+  layers_activation_function.set();
+  layers_activation_accuracy.set();
+}
+
+// void set(const MultilayerPerceptron&, const Matrix<double>&) method
+
+/// Quantizes a trained multilayer perceptron.
+/// The synaptic weights of each perceptron are quantized symmetrically, with
+/// the scale which maps their largest absolute value to 127.
+/// The inputs to each layer are quantized in the same way, with the largest
+/// absolute value of that inputs over the calibration instances.
+/// @param multilayer_perceptron Multilayer perceptron to be quantized.
+/// @param calibration_input_data Inputs to the multilayer perceptron used for
+/// calibrating the scales of the layer inputs, with one instance per row.
+
+void QuantizedMultilayerPerceptron::set(
+    const MultilayerPerceptron& multilayer_perceptron,
+    const Matrix<double>& calibration_input_data) {
+  const unsigned layers_number = multilayer_perceptron.get_layers_number();
+
+  const unsigned calibration_instances_number =
+      calibration_input_data.get_rows_number();
+
+  if (layers_number == 0 || calibration_instances_number == 0 ||
+      calibration_input_data.get_columns_number() !=
+          multilayer_perceptron.get_inputs_number()) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: QuantizedMultilayerPerceptron class.\n"
+           << "void set(const MultilayerPerceptron&, const Matrix<double>&) "
+              "method.\n"
+           << "Multilayer perceptron must have layers and calibration input "
+              "data must have one column per input and at least one row.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  Vector<Matrix<double> > layers_outputs;
+
+  multilayer_perceptron.calculate_outputs(calibration_input_data,
+                                          layers_outputs);
+
+  layers_inputs_number.set(layers_number);
+  layers_perceptrons_number.set(layers_number);
+  layers_synaptic_weights.set(layers_number);
+  layers_synaptic_weights_scales.set(layers_number);
+  layers_biases.set(layers_number);
+  layers_inputs_scale.set(layers_number);
+  layers_activation_function.set(layers_number);
+  layers_activation_accuracy.set(layers_number);
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    const PerceptronLayer& layer = multilayer_perceptron.get_layer(i);
+
+    const unsigned inputs_number = layer.get_inputs_number();
+    const unsigned perceptrons_number = layer.get_perceptrons_number();
+
+    layers_inputs_number[i] = inputs_number;
+    layers_perceptrons_number[i] = perceptrons_number;
+    layers_activation_function[i] = layer.get_activation_function();
+    layers_activation_accuracy[i] = layer.get_activation_accuracy();
+
+    // Synaptic weights and biases
+
+    const Vector<double>& parameters = layer.get_parameters();
+
+    layers_synaptic_weights[i].set(perceptrons_number * inputs_number);
+    layers_synaptic_weights_scales[i].set(perceptrons_number);
+    layers_biases[i].set(perceptrons_number);
+
+    for (unsigned j = 0; j < perceptrons_number; j++) {
+      const double* perceptron_parameters =
+          &parameters[j * (1 + inputs_number)];
+
+      layers_biases[i][j] = perceptron_parameters[0];
+
+      double maximum_absolute_value = 0.0;
+
+      for (unsigned k = 0; k < inputs_number; k++) {
+        if (fabs(perceptron_parameters[1 + k]) > maximum_absolute_value) {
+          maximum_absolute_value = fabs(perceptron_parameters[1 + k]);
+        }
+      }
+
+      const double scale = calculate_scale(maximum_absolute_value);
+
+      layers_synaptic_weights_scales[i][j] = scale;
+
+      for (unsigned k = 0; k < inputs_number; k++) {
+        layers_synaptic_weights[i][j * inputs_number + k] =
+            quantize(perceptron_parameters[1 + k], scale);
+      }
+    }
+
+    // Inputs scale
+
+    const Matrix<double>& layer_inputs =
+        i == 0 ? calibration_input_data : layers_outputs[i - 1];
+
+    const double* layer_inputs_data = layer_inputs[0];
+
+    const unsigned layer_inputs_size =
+        calibration_instances_number * inputs_number;
+
+    double maximum_absolute_value = 0.0;
+
+    for (unsigned k = 0; k < layer_inputs_size; k++) {
+      if (fabs(layer_inputs_data[k]) > maximum_absolute_value) {
+        maximum_absolute_value = fabs(layer_inputs_data[k]);
+      }
+    }
+
+    layers_inputs_scale[i] = calculate_scale(maximum_absolute_value);
+  }
+}
+
+// static double calculate_scale(const double&) method
+
+/// Returns the scale which maps a given absolute value to 127, the largest 8
+/// bit integer used.
+/// If that value is zero, the scale is one.
+/// @param maximum_absolute_value Largest absolute value to be represented.
+
+double QuantizedMultilayerPerceptron::calculate_scale(
+    const double& maximum_absolute_value) {
+  if (maximum_absolute_value == 0.0) {
+    return (1.0);
+  }
+
+  return (maximum_absolute_value / 127.0);
+}
+
+// void calculate_outputs(const Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates the outputs of the quantized multilayer perceptron for a block of
+/// instances.
+/// For each layer, the inputs of the whole block are quantized first, and then
+/// the combinations are computed as products of 8 bit integers accumulated in
+/// 32 bit integers.
+/// The accumulated values are scaled back to double precision before adding
+/// the biases and applying the activation function.
+/// @param inputs Matrix of inputs, with one instance per row.
+/// @param outputs Matrix to store the outputs, with one instance per row.
+/// It must not be the inputs matrix.
+
+void QuantizedMultilayerPerceptron::calculate_outputs(
+    const Matrix<double>& inputs, Matrix<double>& outputs) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  const unsigned columns_number = inputs.get_columns_number();
+
+  const unsigned inputs_number = get_inputs_number();
+
+  if (columns_number != inputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: QuantizedMultilayerPerceptron class.\n"
+           << "void calculate_outputs(const Matrix<double>&, Matrix<double>&) "
+              "const method.\n"
+           << "Number of columns of inputs (" << columns_number
+           << ") must be equal to number of inputs (" << inputs_number
+           << ").\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned layers_number = get_layers_number();
+
+  const unsigned instances_number = inputs.get_rows_number();
+
+  if (layers_number == 0 || instances_number == 0) {
+    outputs.set();
+    return;
+  }
+
+  Vector<signed char> quantized_inputs;
+
+  Matrix<double> hidden_outputs[2];
+
+  const Matrix<double>* layer_inputs_pointer = &inputs;
+
+  for (unsigned i = 0; i < layers_number; i++) {
+    const unsigned inputs_number = layers_inputs_number[i];
+    const unsigned perceptrons_number = layers_perceptrons_number[i];
+
+    const double inputs_scale = layers_inputs_scale[i];
+
+    const signed char* synaptic_weights = layers_synaptic_weights[i].data();
+    const double* synaptic_weights_scales =
+        layers_synaptic_weights_scales[i].data();
+    const double* biases = layers_biases[i].data();
+
+    Matrix<double>& layer_outputs =
+        i == layers_number - 1 ? outputs : hidden_outputs[i % 2];
+
+    layer_outputs.set(instances_number, perceptrons_number);
+
+    // Quantize inputs
+
+    const unsigned layer_inputs_size = instances_number * inputs_number;
+
+    quantized_inputs.set(layer_inputs_size);
+
+    const double* layer_inputs_data = (*layer_inputs_pointer)[0];
+
+    for (unsigned k = 0; k < layer_inputs_size; k++) {
+      quantized_inputs[k] = quantize(layer_inputs_data[k], inputs_scale);
+    }
+
+    // Combinations
+
+    for (unsigned m = 0; m < instances_number; m++) {
+      const signed char* instance_inputs =
+          quantized_inputs.data() + m * inputs_number;
+
+      double* instance_outputs = layer_outputs[m];
+
+      for (unsigned j = 0; j < perceptrons_number; j++) {
+        const signed char* perceptron_synaptic_weights =
+            synaptic_weights + j * inputs_number;
+
+        int accumulator = 0;
+
+#pragma omp simd reduction(+ : accumulator)
+        for (unsigned k = 0; k < inputs_number; k++) {
+          accumulator +=
+              (int)instance_inputs[k] * (int)perceptron_synaptic_weights[k];
+        }
+
+        instance_outputs[j] = biases[j] + inputs_scale *
+                                              synaptic_weights_scales[j] *
+                                              accumulator;
+      }
+    }
+
+    // Activations
+
+    Perceptron::calculate_activations(
+        layers_activation_function[i], layers_activation_accuracy[i],
+        layer_outputs[0], layer_outputs[0],
+        instances_number * perceptrons_number);
+
+    layer_inputs_pointer = &layer_outputs;
+  }
+}
+
+// Matrix<double> calculate_outputs(const Matrix<double>&) const method
+
+/// Returns the outputs of the quantized multilayer perceptron for a block of
+/// instances.
+/// @param inputs Matrix of inputs, with one instance per row.
+
+Matrix<double> QuantizedMultilayerPerceptron::calculate_outputs(
+    const Matrix<double>& inputs) const {
+  Matrix<double> outputs;
+
+  calculate_outputs(inputs, outputs);
+
+  return (outputs);
+}
+
+// Vector<double> calculate_outputs(const Vector<double>&) const method
+
+/// Returns the outputs of the quantized multilayer perceptron for one instance.
+/// @param inputs Vector of inputs.
+
+Vector<double> QuantizedMultilayerPerceptron::calculate_outputs(
+    const Vector<double>& inputs) const {
+  Matrix<double> input_data(1, inputs.size());
+
+  input_data.set_row(0, inputs);
+
+  return (calculate_outputs(input_data).arrange_row(0));
+}
+}
+
+// OpenNN: Open Neural Networks Library.
+// Neural Designer Copyright © 2013 Roberto López and Ismael Santana (Intelnics)
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,178 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   Q U A N T I Z E D   M U L T I L A Y E R   P E R C E P T R O N   C L A S S   H E A D E R
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __QUANTIZEDMULTILAYERPERCEPTRON_H__
+#define __QUANTIZEDMULTILAYERPERCEPTRON_H__
+
+// System includes
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sstream>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+#include "perceptron.h"
+#include "multilayer_perceptron.h"
+
+namespace OpenNN {
+
+/// This class represents a multilayer perceptron whose synaptic weights have
+/// been quantized to 8 bit integers after training.
+/// The synaptic weights of each perceptron have their own scale, and the
+/// inputs to each layer are quantized with a single scale, which is calibrated
+/// on a set of representative instances.
+/// The combinations are computed as products of 8 bit integers accumulated in
+/// 32 bit integers, and the biases are kept in double precision.
+
+class QuantizedMultilayerPerceptron {
+
+ public:
+
+  // DEFAULT CONSTRUCTOR
+
+  explicit QuantizedMultilayerPerceptron(void);
+
+  // MULTILAYER PERCEPTRON CONSTRUCTOR
+
+  explicit QuantizedMultilayerPerceptron(const MultilayerPerceptron&,
+                                         const Matrix<double>&);
+
+  // DESTRUCTOR
+
+  virtual ~QuantizedMultilayerPerceptron(void);
+
+  // GET METHODS
+
+  bool is_empty(void) const;
+
+  unsigned get_inputs_number(void) const;
+  unsigned get_outputs_number(void) const;
+
+  unsigned get_layers_number(void) const;
+
+  const Vector<signed char>& get_layer_synaptic_weights(const unsigned&) const;
+  const Vector<double>& get_layer_synaptic_weights_scales(
+      const unsigned&) const;
+  const Vector<double>& get_layer_biases(const unsigned&) const;
+  const double& get_layer_inputs_scale(const unsigned&) const;
+
+  unsigned count_memory_size(void) const;
+
+  // SET METHODS
+
+  void set(void);
+  void set(const MultilayerPerceptron&, const Matrix<double>&);
+
+  // Quantization methods
+
+  static double calculate_scale(const double&);
+  static signed char quantize(const double&, const double&);
+
+  // Output methods
+
+  void calculate_outputs(const Matrix<double>&, Matrix<double>&) const;
+  Matrix<double> calculate_outputs(const Matrix<double>&) const;
+
+  Vector<double> calculate_outputs(const Vector<double>&) const;
+
+ protected:
+
+  // MEMBERS
+
+  /// Number of inputs to each layer.
+
+  Vector<unsigned> layers_inputs_number;
+
+  /// Number of perceptrons in each layer.
+
+  Vector<unsigned> layers_perceptrons_number;
+
+  /// Quantized synaptic weights of each layer, with the weights of each
+  /// perceptron in a row.
+
+  Vector<Vector<signed char> > layers_synaptic_weights;
+
+  /// Scale of the synaptic weights of each perceptron in each layer.
+
+  Vector<Vector<double> > layers_synaptic_weights_scales;
+
+  /// Biases of each layer, which are not quantized.
+
+  Vector<Vector<double> > layers_biases;
+
+  /// Scale of the inputs to each layer.
+
+  Vector<double> layers_inputs_scale;
+
+  /// Activation function of each layer.
+
+  Vector<Perceptron::ActivationFunction> layers_activation_function;
+
+  /// Activation accuracy of each layer.
+
+  Vector<Perceptron::ActivationAccuracy> layers_activation_accuracy;
+};
+
+// static signed char quantize(const double&, const double&) method
+
+/// Returns the 8 bit integer nearest to a value divided by a scale, saturated
+/// to the range [-127, 127].
+/// It is defined here so that it can be inlined in the quantization loops.
+/// @param value Value to be quantized.
+/// @param scale Scale of the quantized values.
+
+inline signed char QuantizedMultilayerPerceptron::quantize(
+    const double& value, const double& scale) {
+  const double quantized_value = floor(value / scale + 0.5);
+
+  if (quantized_value > 127.0) {
+    return (127);
+  } else if (quantized_value < -127.0) {
+    return (-127);
+  } else {
+    return ((signed char)quantized_value);
+  }
+}
+}
+
+#endif
+
+// OpenNN: Open Neural Networks Library.
+// Neural Designer Copyright © 2013 Roberto López and Ismael Santana (Intelnics)
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
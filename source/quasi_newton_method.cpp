@@ -121,6 +121,10 @@ std::string QuasiNewtonMethod::write_inverse_Hessian_approximation_method(
       return ("BFGS");
     } break;
 
+    case L_BFGS: {
+      return ("L_BFGS");
+    } break;
+
     default: {
       std::ostringstream buffer;
 
@@ -134,6 +138,15 @@ std::string QuasiNewtonMethod::write_inverse_Hessian_approximation_method(
   }
 }
 
+// const unsigned& get_L_BFGS_history_length(void) const method
+
+/// Returns the number of parameters and gradient difference pairs stored by the
+/// limited-memory BFGS method.
+
+const unsigned& QuasiNewtonMethod::get_L_BFGS_history_length(void) const {
+  return (L_BFGS_history_length);
+}
+
 // const double& get_warning_parameters_norm(void) const method
 
 /// Returns the minimum value for the norm of the parameters vector at wich a
@@ -392,6 +405,7 @@ void QuasiNewtonMethod::set_inverse_Hessian_approximation_method(
 /// <ul>
 /// <li> "DFP"
 /// <li> "BFGS"
+/// <li> "L_BFGS"
 /// </ul>
 /// @param new_inverse_Hessian_approximation_method_name Name of inverse Hessian
 /// approximation method.
@@ -402,6 +416,8 @@ void QuasiNewtonMethod::set_inverse_Hessian_approximation_method(
     inverse_Hessian_approximation_method = DFP;
   } else if (new_inverse_Hessian_approximation_method_name == "BFGS") {
     inverse_Hessian_approximation_method = BFGS;
+  } else if (new_inverse_Hessian_approximation_method_name == "L_BFGS") {
+    inverse_Hessian_approximation_method = L_BFGS;
   } else {
     std::ostringstream buffer;
 
@@ -415,6 +431,34 @@ void QuasiNewtonMethod::set_inverse_Hessian_approximation_method(
   }
 }
 
+// void set_L_BFGS_history_length(const unsigned&) method
+
+/// Sets the number of parameters and gradient difference pairs to be stored by
+/// the limited-memory BFGS method.
+/// Memory and time per iteration both grow linearly with this value.
+/// @param new_L_BFGS_history_length History length.
+
+void QuasiNewtonMethod::set_L_BFGS_history_length(
+    const unsigned& new_L_BFGS_history_length) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_L_BFGS_history_length == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+           << "void set_L_BFGS_history_length(const unsigned&) method.\n"
+           << "L-BFGS history length must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  L_BFGS_history_length = new_L_BFGS_history_length;
+}
+
 // void set_reserve_all_training_history(bool) method
 
 /// Makes the training history of all variables to reseved or not in memory.
@@ -439,6 +483,8 @@ void QuasiNewtonMethod::set_reserve_all_training_history(
 void QuasiNewtonMethod::set_default(void) {
   inverse_Hessian_approximation_method = BFGS;
 
+  L_BFGS_history_length = 10;
+
   training_rate_algorithm.set_default();
 
   // TRAINING PARAMETERS
@@ -997,6 +1043,19 @@ Matrix<double> QuasiNewtonMethod::calculate_inverse_Hessian_approximation(
                                              old_inverse_Hessian));
     } break;
 
+    case L_BFGS: {
+      std::ostringstream buffer;
+
+      buffer
+          << "OpenNN Exception: QuasiNewtonMethod class.\n"
+          << "Vector<double> calculate_inverse_Hessian_approximation(const "
+             "Vector<double>&, const Vector<double>&, const Vector<double>&, "
+             "const Vector<double>&, const Matrix<double>&) method.\n"
+          << "Limited-memory BFGS method does not form the inverse Hessian.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+
     default: {
       std::ostringstream buffer;
 
@@ -1031,6 +1090,143 @@ Vector<double> QuasiNewtonMethod::calculate_training_direction(
   return (training_direction / training_direction_norm);
 }
 
+// void update_L_BFGS_history(const Vector<double>&, const Vector<double>&,
+// Vector< Vector<double> >&, Vector< Vector<double> >&) const method
+
+/// Appends a new pair of parameters and gradient differences to the
+/// limited-memory BFGS history, discarding the oldest pair when the history
+/// length is reached.
+/// Pairs which do not satisfy the curvature condition are skipped, so that the
+/// implicit inverse Hessian approximation remains positive definite.
+/// @param parameters_difference Increment of the parameters in the last
+/// iteration.
+/// @param gradient_difference Increment of the gradient in the last iteration.
+/// @param parameters_differences Stored parameters increments, from the oldest
+/// to the newest.
+/// @param gradient_differences Stored gradient increments, from the oldest to
+/// the newest.
+
+void QuasiNewtonMethod::update_L_BFGS_history(
+    const Vector<double>& parameters_difference,
+    const Vector<double>& gradient_difference,
+    Vector<Vector<double> >& parameters_differences,
+    Vector<Vector<double> >& gradient_differences) const {
+  const double curvature = parameters_difference.dot(gradient_difference);
+
+  if (curvature <= 1.0e-12 * gradient_difference.dot(gradient_difference)) {
+    return;
+  }
+
+  const unsigned pairs_number = parameters_differences.size();
+
+  if (pairs_number < L_BFGS_history_length) {
+    parameters_differences.push_back(parameters_difference);
+    gradient_differences.push_back(gradient_difference);
+
+    return;
+  }
+
+  // Rotate the stored vectors without copying them and reuse the oldest one
+
+  for (unsigned k = 1; k < pairs_number; k++) {
+    parameters_differences[k - 1].swap(parameters_differences[k]);
+    gradient_differences[k - 1].swap(gradient_differences[k]);
+  }
+
+  parameters_differences[pairs_number - 1] = parameters_difference;
+  gradient_differences[pairs_number - 1] = gradient_difference;
+}
+
+// Vector<double> calculate_L_BFGS_training_direction(const Vector<double>&,
+// const Vector< Vector<double> >&, const Vector< Vector<double> >&) const
+// method
+
+/// Returns the limited-memory BFGS training direction, which has been
+/// previously normalized.
+/// The inverse Hessian approximation is applied to the gradient with the
+/// two-loop recursion, so that neither memory nor time grow with the square of
+/// the number of parameters.
+/// If there are no stored pairs the gradient descent direction is returned.
+/// @param gradient Gradient vector.
+/// @param parameters_differences Parameters increments of the last iterations,
+/// from the oldest to the newest.
+/// @param gradient_differences Gradient increments of the last iterations,
+/// from the oldest to the newest.
+
+Vector<double> QuasiNewtonMethod::calculate_L_BFGS_training_direction(
+    const Vector<double>& gradient,
+    const Vector<Vector<double> >& parameters_differences,
+    const Vector<Vector<double> >& gradient_differences) const {
+  const unsigned parameters_number = gradient.size();
+
+  const unsigned pairs_number = parameters_differences.size();
+
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (gradient_differences.size() != pairs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+           << "Vector<double> calculate_L_BFGS_training_direction(const "
+              "Vector<double>&, const Vector< Vector<double> >&, const "
+              "Vector< Vector<double> >&) const method.\n"
+           << "Number of parameters and gradient differences must be equal.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  if (pairs_number == 0) {
+    return (gradient / (-gradient.calculate_norm()));
+  }
+
+  Vector<double> training_direction(gradient);
+
+  Vector<double> rho(pairs_number);
+  Vector<double> alpha(pairs_number);
+
+  // First loop, from the newest to the oldest pair
+
+  for (unsigned k = pairs_number; k-- > 0;) {
+    const Vector<double>& s = parameters_differences[k];
+    const Vector<double>& y = gradient_differences[k];
+
+    rho[k] = 1.0 / y.dot(s);
+    alpha[k] = rho[k] * s.dot(training_direction);
+
+    for (unsigned i = 0; i < parameters_number; i++) {
+      training_direction[i] -= alpha[k] * y[i];
+    }
+  }
+
+  // Initial inverse Hessian scaling
+
+  const Vector<double>& newest_s = parameters_differences[pairs_number - 1];
+  const Vector<double>& newest_y = gradient_differences[pairs_number - 1];
+
+  training_direction *= newest_s.dot(newest_y) / newest_y.dot(newest_y);
+
+  // Second loop, from the oldest to the newest pair
+
+  for (unsigned k = 0; k < pairs_number; k++) {
+    const Vector<double>& s = parameters_differences[k];
+    const Vector<double>& y = gradient_differences[k];
+
+    const double beta = rho[k] * y.dot(training_direction);
+
+    for (unsigned i = 0; i < parameters_number; i++) {
+      training_direction[i] += (alpha[k] - beta) * s[i];
+    }
+  }
+
+  const double training_direction_norm = training_direction.calculate_norm();
+
+  return (training_direction / (-training_direction_norm));
+}
+
 // Vector<double> calculate_gradient_descent_training_direction(const
 // Vector<double>&) const method
 
@@ -1248,13 +1444,10 @@ Matrix<double> QuasiNewtonMethod::calculate_DFP_inverse_Hessian(
     throw std::logic_error(buffer.str());
   }
 
-  const Matrix<double> DFP_inverse_Hessian =
-      old_inverse_Hessian +
-      parameters_difference.direct(parameters_difference) /
-          parameters_difference.dot(gradient_difference) -
-      (old_inverse_Hessian.dot(gradient_difference))
-              .direct(old_inverse_Hessian.dot(gradient_difference)) /
-          gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference);
+  Matrix<double> DFP_inverse_Hessian(old_inverse_Hessian);
+
+  update_DFP_inverse_Hessian(parameters_difference, gradient_difference,
+                             DFP_inverse_Hessian);
 
   return (DFP_inverse_Hessian);
 }
@@ -1404,29 +1597,179 @@ Matrix<double> QuasiNewtonMethod::calculate_BFGS_inverse_Hessian(
     throw std::logic_error(buffer.str());
   }
 
-  // BGFS Vector
-
-  const Vector<double> BFGS =
-      parameters_difference / parameters_difference.dot(gradient_difference) -
-      old_inverse_Hessian.dot(gradient_difference) /
-          gradient_difference.dot(old_inverse_Hessian).dot(gradient_difference);
-
   // Calculate inverse Hessian approximation
 
-  const Matrix<double> BFGS_inverse_Hessian =
-      old_inverse_Hessian +
-      parameters_difference.direct(parameters_difference) /
-          parameters_difference.dot(gradient_difference) -
-      (old_inverse_Hessian.dot(gradient_difference))
-              .direct(gradient_difference.dot(old_inverse_Hessian)) /
-          gradient_difference.dot(old_inverse_Hessian)
-              .dot(gradient_difference) +
-      (BFGS.direct(BFGS)) * (gradient_difference.dot(old_inverse_Hessian)
-                                 .dot(gradient_difference));
+  Matrix<double> BFGS_inverse_Hessian(old_inverse_Hessian);
+
+  update_BFGS_inverse_Hessian(parameters_difference, gradient_difference,
+                              BFGS_inverse_Hessian);
 
   return (BFGS_inverse_Hessian);
 }
 
+// void update_DFP_inverse_Hessian(const Vector<double>&, const
+// Vector<double>&, Matrix<double>&) const method
+
+/// Updates in place an approximation of the inverse Hessian matrix according to
+/// the Davidon-Fletcher-Powel (DFP) algorithm.
+/// The update is skipped if any of its denominators is zero.
+/// @param parameters_difference Increment of the parameters in the last
+/// iteration.
+/// @param gradient_difference Increment of the gradient in the last iteration.
+/// @param inverse_Hessian Inverse Hessian approximation, which is overwritten.
+
+void QuasiNewtonMethod::update_DFP_inverse_Hessian(
+    const Vector<double>& parameters_difference,
+    const Vector<double>& gradient_difference,
+    Matrix<double>& inverse_Hessian) const {
+  const Vector<double> inverse_Hessian_gradient_difference =
+      inverse_Hessian.dot(gradient_difference);
+
+  const double parameters_gradient_difference =
+      parameters_difference.dot(gradient_difference);
+
+  const double gradient_inverse_Hessian_gradient_difference =
+      gradient_difference.dot(inverse_Hessian_gradient_difference);
+
+  if (fabs(parameters_gradient_difference) < 1.0e-50 ||
+      fabs(gradient_inverse_Hessian_gradient_difference) < 1.0e-50) {
+    return;
+  }
+
+  // H + s*s'/(s'*y) - H*y*y'*H/(y'*H*y)
+
+  perform_symmetric_rank_two_update(
+      parameters_difference, inverse_Hessian_gradient_difference,
+      1.0 / parameters_gradient_difference,
+      -1.0 / gradient_inverse_Hessian_gradient_difference, 0.0,
+      inverse_Hessian);
+}
+
+// void update_BFGS_inverse_Hessian(const Vector<double>&, const
+// Vector<double>&, Matrix<double>&) const method
+
+/// Updates in place an approximation of the inverse Hessian matrix according to
+/// the Broyden-Fletcher-Goldfarb-Shanno (BGFS) algorithm.
+/// The update is skipped if any of its denominators is zero.
+/// @param parameters_difference Increment of the parameters in the last
+/// iteration.
+/// @param gradient_difference Increment of the gradient in the last iteration.
+/// @param inverse_Hessian Inverse Hessian approximation, which is overwritten.
+
+void QuasiNewtonMethod::update_BFGS_inverse_Hessian(
+    const Vector<double>& parameters_difference,
+    const Vector<double>& gradient_difference,
+    Matrix<double>& inverse_Hessian) const {
+  const Vector<double> inverse_Hessian_gradient_difference =
+      inverse_Hessian.dot(gradient_difference);
+
+  const double parameters_gradient_difference =
+      parameters_difference.dot(gradient_difference);
+
+  const double gradient_inverse_Hessian_gradient_difference =
+      gradient_difference.dot(inverse_Hessian_gradient_difference);
+
+  if (fabs(parameters_gradient_difference) < 1.0e-50 ||
+      fabs(gradient_inverse_Hessian_gradient_difference) < 1.0e-50) {
+    return;
+  }
+
+  // H + (1 + y'*H*y/(s'*y))*s*s'/(s'*y) - (s*y'*H + H*y*s')/(s'*y)
+
+  perform_symmetric_rank_two_update(
+      parameters_difference, inverse_Hessian_gradient_difference,
+      (1.0 + gradient_inverse_Hessian_gradient_difference /
+                 parameters_gradient_difference) /
+          parameters_gradient_difference,
+      0.0, -1.0 / parameters_gradient_difference, inverse_Hessian);
+}
+
+// void update_inverse_Hessian_approximation(const Vector<double>&, const
+// Vector<double>&, Matrix<double>&) const method
+
+/// Updates in place an approximation of the inverse Hessian, according to the
+/// method used.
+/// @param parameters_difference Increment of the parameters in the last
+/// iteration.
+/// @param gradient_difference Increment of the gradient in the last iteration.
+/// @param inverse_Hessian Inverse Hessian approximation, which is overwritten.
+
+void QuasiNewtonMethod::update_inverse_Hessian_approximation(
+    const Vector<double>& parameters_difference,
+    const Vector<double>& gradient_difference,
+    Matrix<double>& inverse_Hessian) const {
+  switch (inverse_Hessian_approximation_method) {
+    case DFP: {
+      update_DFP_inverse_Hessian(parameters_difference, gradient_difference,
+                                 inverse_Hessian);
+    } break;
+
+    case BFGS: {
+      update_BFGS_inverse_Hessian(parameters_difference, gradient_difference,
+                                  inverse_Hessian);
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "void update_inverse_Hessian_approximation(const "
+                "Vector<double>&, const Vector<double>&, Matrix<double>&) "
+                "const method.\n"
+             << "Unknown dense inverse Hessian approximation method.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+}
+
+// void perform_symmetric_rank_two_update(const Vector<double>&, const
+// Vector<double>&, const double&, const double&, const double&,
+// Matrix<double>&) const method
+
+/// Adds a*u*u' + b*v*v' + c*(u*v' + v*u') to a symmetric matrix in a single
+/// pass.
+/// Only the upper triangle is computed, block by block, and each block is
+/// mirrored while it is still in cache.
+/// @param u First vector.
+/// @param v Second vector.
+/// @param uu_coefficient Coefficient a of u*u'.
+/// @param vv_coefficient Coefficient b of v*v'.
+/// @param uv_coefficient Coefficient c of u*v' + v*u'.
+/// @param matrix Symmetric matrix to be updated.
+
+void QuasiNewtonMethod::perform_symmetric_rank_two_update(
+    const Vector<double>& u, const Vector<double>& v,
+    const double& uu_coefficient, const double& vv_coefficient,
+    const double& uv_coefficient, Matrix<double>& matrix) const {
+  const unsigned size = matrix.get_rows_number();
+
+  const unsigned block_size = 64;
+
+  for (unsigned ii = 0; ii < size; ii += block_size) {
+    const unsigned i_end = std::min(ii + block_size, size);
+
+    for (unsigned jj = ii; jj < size; jj += block_size) {
+      const unsigned j_end = std::min(jj + block_size, size);
+
+      for (unsigned i = ii; i < i_end; i++) {
+        const double u_coefficient =
+            uu_coefficient * u[i] + uv_coefficient * v[i];
+        const double v_coefficient =
+            vv_coefficient * v[i] + uv_coefficient * u[i];
+
+        double* row = matrix[i];
+
+        for (unsigned j = std::max(i, jj); j < j_end; j++) {
+          row[j] += u_coefficient * u[j] + v_coefficient * v[j];
+
+          matrix[j][i] = row[j];
+        }
+      }
+    }
+  }
+}
+
 // void resize_training_history(const unsigned&) method
 
 /// Resizes all the training history variables.
@@ -1646,6 +1989,15 @@ QuasiNewtonMethod::QuasiNewtonMethodResults::write_final_results(
 
   values.push_back(buffer.str());
 
+  // Training rate evaluations number
+
+  names.push_back("Training rate evaluations number");
+
+  buffer.str("");
+  buffer << training_rate_evaluations_number;
+
+  values.push_back(buffer.str());
+
   // Elapsed time
 
   names.push_back("Elapsed time");
@@ -1719,8 +2071,19 @@ QuasiNewtonMethod::perform_training(void) {
   Vector<double> old_gradient(parameters_number);
   double gradient_norm;
 
-  Matrix<double> inverse_Hessian(parameters_number, parameters_number);
-  Matrix<double> old_inverse_Hessian(parameters_number, parameters_number);
+  // The limited-memory method only stores the last parameters and gradient
+  // differences
+
+  const bool limited_memory = inverse_Hessian_approximation_method == L_BFGS;
+
+  Matrix<double> inverse_Hessian;
+
+  if (!limited_memory) {
+    inverse_Hessian.set(parameters_number, parameters_number);
+  }
+
+  Vector<Vector<double> > parameters_differences;
+  Vector<Vector<double> > gradient_differences;
 
   double generalization_performance = 0.0;
   double old_generalization_performance = 0.0;
@@ -1743,6 +2106,8 @@ QuasiNewtonMethod::perform_training(void) {
   directional_point[0] = 0.0;
   directional_point[1] = 0.0;
 
+  Vector<double> directional_gradient;
+
   bool stop_training = false;
 
   unsigned generalization_failures = 0;
@@ -1753,6 +2118,8 @@ QuasiNewtonMethod::perform_training(void) {
 
   unsigned iteration;
 
+  training_rate_algorithm.reset_evaluations_number();
+
   // Main loop
 
   for (iteration = 0; iteration <= maximum_iterations_number; iteration++) {
@@ -1770,14 +2137,25 @@ QuasiNewtonMethod::perform_training(void) {
     // Performance functional stuff
 
     if (iteration == 0) {
-      performance = performance_functional_pointer->calculate_performance();
+      const PerformanceFunctional::FirstOrderperformance
+          first_order_performance =
+              performance_functional_pointer
+                  ->calculate_first_order_performance();
+
+      performance = first_order_performance.performance;
+      gradient = first_order_performance.gradient;
+
       performance_increase = 0.0;
     } else {
       performance = directional_point[1];
       performance_increase = old_performance - performance;
-    }
 
-    gradient = performance_functional_pointer->calculate_gradient();
+      if (directional_gradient.empty()) {
+        gradient = performance_functional_pointer->calculate_gradient();
+      } else {
+        gradient = directional_gradient;
+      }
+    }
 
     gradient_norm = gradient.calculate_norm();
 
@@ -1786,12 +2164,18 @@ QuasiNewtonMethod::perform_training(void) {
                 << ".\n";
     }
 
-    if (iteration == 0) {
+    if (limited_memory) {
+      if (iteration != 0) {
+        update_L_BFGS_history(parameters - old_parameters,
+                              gradient - old_gradient, parameters_differences,
+                              gradient_differences);
+      }
+    } else if (iteration == 0) {
       inverse_Hessian.initialize_identity();
     } else {
-      inverse_Hessian = calculate_inverse_Hessian_approximation(
-          old_parameters, parameters, old_gradient, gradient,
-          old_inverse_Hessian);
+      update_inverse_Hessian_approximation(parameters - old_parameters,
+                                           gradient - old_gradient,
+                                           inverse_Hessian);
     }
 
     generalization_performance =
@@ -1804,8 +2188,13 @@ QuasiNewtonMethod::perform_training(void) {
 
     // Training algorithm
 
-    training_direction =
-        calculate_training_direction(gradient, inverse_Hessian);
+    if (limited_memory) {
+      training_direction = calculate_L_BFGS_training_direction(
+          gradient, parameters_differences, gradient_differences);
+    } else {
+      training_direction =
+          calculate_training_direction(gradient, inverse_Hessian);
+    }
 
     // Calculate performance training slope
 
@@ -1829,7 +2218,8 @@ QuasiNewtonMethod::perform_training(void) {
     }
 
     directional_point = training_rate_algorithm.calculate_directional_point(
-        performance, training_direction, initial_training_rate);
+        performance, gradient, training_direction, initial_training_rate,
+        directional_gradient);
 
     training_rate = directional_point[0];
 
@@ -1840,7 +2230,8 @@ QuasiNewtonMethod::perform_training(void) {
           calculate_gradient_descent_training_direction(gradient);
 
       directional_point = training_rate_algorithm.calculate_directional_point(
-          performance, training_direction, first_training_rate);
+          performance, gradient, training_direction, first_training_rate,
+          directional_gradient);
 
       training_rate = directional_point[0];
     }
@@ -2023,8 +2414,6 @@ QuasiNewtonMethod::perform_training(void) {
 
     old_gradient = gradient;
 
-    old_inverse_Hessian = inverse_Hessian;
-
     old_generalization_performance = generalization_performance;
 
     old_training_rate = training_rate;
@@ -2048,6 +2437,8 @@ QuasiNewtonMethod::perform_training(void) {
 
   results_pointer->final_training_direction = training_direction;
   results_pointer->final_training_rate = training_rate;
+  results_pointer->training_rate_evaluations_number =
+      training_rate_algorithm.get_evaluations_number();
   results_pointer->elapsed_time = elapsed_time;
 
   results_pointer->iterations_number = iteration;
@@ -2109,6 +2500,18 @@ tinyxml2::XMLDocument* QuasiNewtonMethod::to_XML(void) const {
     element->LinkEndChild(text);
   }
 
+  // L-BFGS history length
+  {
+    element = document->NewElement("LBFGSHistoryLength");
+    root_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << L_BFGS_history_length;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
   // Training rate algorithm
   {
     tinyxml2::XMLElement* element =
@@ -2471,6 +2874,17 @@ Matrix<std::string> QuasiNewtonMethod::to_string_matrix(void) const {
 
   values.push_back(inverse_Hessian_approximation_method_string);
 
+  // L-BFGS history length
+
+  if (inverse_Hessian_approximation_method == L_BFGS) {
+    labels.push_back("L-BFGS history length");
+
+    buffer.str("");
+    buffer << L_BFGS_history_length;
+
+    values.push_back(buffer.str());
+  }
+
   // Training rate method
 
   labels.push_back("Training rate method");
@@ -2678,6 +3092,23 @@ void QuasiNewtonMethod::from_XML(const tinyxml2::XMLDocument& document) {
     }
   }
 
+  // L-BFGS history length
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("LBFGSHistoryLength");
+
+    if (element) {
+      const unsigned new_L_BFGS_history_length = atoi(element->GetText());
+
+      try {
+        set_L_BFGS_history_length(new_L_BFGS_history_length);
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
   // Training rate algorithm
   {
     const tinyxml2::XMLElement* element =
@@ -63,7 +63,8 @@ class QuasiNewtonMethod : public TrainingAlgorithm {
 
   enum InverseHessianApproximationMethod {
     DFP,
-    BFGS
+    BFGS,
+    L_BFGS
   };
 
   // DEFAULT CONSTRUCTOR
@@ -193,6 +194,11 @@ class QuasiNewtonMethod : public TrainingAlgorithm {
 
     double final_training_rate;
 
+    /// Number of performance evaluations made by the training rate algorithm
+    /// during the training process.
+
+    unsigned training_rate_evaluations_number;
+
     /// Elapsed time of the training process.
 
     double elapsed_time;
@@ -220,6 +226,8 @@ class QuasiNewtonMethod : public TrainingAlgorithm {
       get_inverse_Hessian_approximation_method(void) const;
   std::string write_inverse_Hessian_approximation_method(void) const;
 
+  const unsigned& get_L_BFGS_history_length(void) const;
+
   // Training parameters
 
   const double& get_warning_parameters_norm(void) const;
@@ -269,6 +277,8 @@ class QuasiNewtonMethod : public TrainingAlgorithm {
       const InverseHessianApproximationMethod&);
   void set_inverse_Hessian_approximation_method(const std::string&);
 
+  void set_L_BFGS_history_length(const unsigned&);
+
   void set_default(void);
 
   // Training parameters
@@ -333,9 +343,28 @@ class QuasiNewtonMethod : public TrainingAlgorithm {
       const Vector<double>&, const Vector<double>&, const Vector<double>&,
       const Vector<double>&, const Matrix<double>&) const;
 
+  void update_DFP_inverse_Hessian(const Vector<double>&, const Vector<double>&,
+                                  Matrix<double>&) const;
+
+  void update_BFGS_inverse_Hessian(const Vector<double>&,
+                                   const Vector<double>&,
+                                   Matrix<double>&) const;
+
+  void update_inverse_Hessian_approximation(const Vector<double>&,
+                                            const Vector<double>&,
+                                            Matrix<double>&) const;
+
   Vector<double> calculate_training_direction(const Vector<double>&,
                                               const Matrix<double>&) const;
 
+  void update_L_BFGS_history(const Vector<double>&, const Vector<double>&,
+                             Vector<Vector<double> >&,
+                             Vector<Vector<double> >&) const;
+
+  Vector<double> calculate_L_BFGS_training_direction(
+      const Vector<double>&, const Vector<Vector<double> >&,
+      const Vector<Vector<double> >&) const;
+
   QuasiNewtonMethodResults* perform_training(void);
 
   // Training history methods
@@ -355,6 +384,11 @@ class QuasiNewtonMethod : public TrainingAlgorithm {
 
  private:
 
+  void perform_symmetric_rank_two_update(const Vector<double>&,
+                                         const Vector<double>&, const double&,
+                                         const double&, const double&,
+                                         Matrix<double>&) const;
+
   /// Training rate algorithm object.
   /// It is used to calculate the step for the quasi-Newton training direction.
 
@@ -365,6 +399,11 @@ class QuasiNewtonMethod : public TrainingAlgorithm {
 
   InverseHessianApproximationMethod inverse_Hessian_approximation_method;
 
+  /// Number of parameters and gradient difference pairs kept by the
+  /// limited-memory BFGS method.
+
+  unsigned L_BFGS_history_length;
+
   /// Value for the parameters norm at which a warning message is written to the
   /// screen.
 
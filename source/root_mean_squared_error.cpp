@@ -193,50 +193,11 @@ double RootMeanSquaredError::calculate_performance(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  // Data set stuff
-
-  const Instances& instances = data_set_pointer->get_instances();
-
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  // Root mean squared error
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
+      data_set_pointer->get_instances().count_training_instances_number();
 
-  double sum_squared_error = 0.0;
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    // Output vector
-
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    // Target vector
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    // Sum squaresd error
-
-    sum_squared_error += outputs.calculate_sum_squared_error(targets);
-  }
-
-  return (sqrt(sum_squared_error / (double)training_instances_number));
+  return (
+      sqrt(calculate_training_error() / (double)training_instances_number));
 }
 
 // double calculate_performance(const Vector<double>&) const method
@@ -308,7 +269,7 @@ double RootMeanSquaredError::calculate_performance(
   for (unsigned i = 0; i < training_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
     // Output vector
 
@@ -317,7 +278,7 @@ double RootMeanSquaredError::calculate_performance(
 
     // Target vector
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     // Sum squaresd error
 
@@ -341,104 +302,66 @@ Vector<double> RootMeanSquaredError::calculate_gradient(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
-
-  const unsigned parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
-
-  // Data set stuff
+  return (calculate_first_order_performance().gradient);
+}
 
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
+// FirstOrderPerformance calculate_first_order_performance(void) const method
 
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
+/// Returns the root mean squared error and its gradient.
+/// The gradient depends on the error itself, so both are calculated with a
+/// single forward and backward propagation of the training instances.
 
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
+PerformanceTerm::FirstOrderPerformance
+RootMeanSquaredError::calculate_first_order_performance(void) const {
+// Control sentence
 
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
+#ifndef NDEBUG
 
-  // Data set stuff
+  check();
 
-  const Instances& instances = data_set_pointer->get_instances();
+#endif
 
   const unsigned training_instances_number =
-      instances.count_training_instances_number();
+      data_set_pointer->get_instances().count_training_instances_number();
 
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
+  FirstOrderPerformance first_order_performance;
+
+  calculate_training_error_gradient(first_order_performance.performance,
+                                    first_order_performance.gradient);
 
-  // Performance functional stuff
+  first_order_performance.performance = sqrt(
+      first_order_performance.performance / (double)training_instances_number);
 
-  const double objective = calculate_performance();
+  first_order_performance.gradient /=
+      training_instances_number * first_order_performance.performance;
 
-  Vector<Vector<double> > layers_delta;
+  return (first_order_performance);
+}
 
-  Vector<double> output_objective_gradient(outputs_number);
+// void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+// Matrix<double>&) const method
 
-  Vector<double> point_gradient(parameters_number, 0.0);
+/// Calculates the errors of the neural network outputs for a block of
+/// instances.
+/// The calculate_gradient method scales the resulting gradient by the number of
+/// training instances and the root mean squared error.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param output_gradient Matrix to store the outputs gradient.
 
-  Vector<double> objective_gradient(parameters_number, 0.0);
+void RootMeanSquaredError::calculate_output_gradient(
+    const Matrix<double>& outputs, const Matrix<double>& targets,
+    Matrix<double>& output_gradient) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-  // Main loop
+  output_gradient.set(instances_number, outputs_number);
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
-
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
-
-    if (!has_conditions_layer) {
-      output_objective_gradient =
-          (layers_activation[layers_number - 1] - targets) /
-          (training_instances_number * objective);
-
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            output_objective_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
-
-      output_objective_gradient =
-          (particular_solution +
-           homogeneous_solution * layers_activation[layers_number - 1] -
-           targets) /
-          (training_instances_number * objective);
-
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            homogeneous_solution,
-                                            output_objective_gradient);
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_gradient[i][j] = (outputs[i][j] - targets[i][j]);
     }
-
-    point_gradient =
-        calculate_point_gradient(inputs, layers_activation, layers_delta);
-    objective_gradient += point_gradient;
   }
-
-  return (objective_gradient);
 }
 
 // double calculate_generalization_performance(void) const method
@@ -480,7 +403,7 @@ double RootMeanSquaredError::calculate_generalization_performance(void) const {
   for (unsigned i = 0; i < generalization_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_generalization_input_instance(i);
+    data_set_pointer->get_generalization_input_instance(i, inputs);
 
     // Output vector
 
@@ -488,7 +411,7 @@ double RootMeanSquaredError::calculate_generalization_performance(void) const {
 
     // Target vector
 
-    targets = data_set_pointer->get_generalization_target_instance(i);
+    data_set_pointer->get_generalization_target_instance(i, targets);
 
     // Sum of squares error
 
@@ -499,6 +422,31 @@ double RootMeanSquaredError::calculate_generalization_performance(void) const {
       sqrt(generalization_objective / (double)generalization_instances_number));
 }
 
+// double calculate_outputs_error(const Matrix<double>&, const Matrix<double>&)
+// const method
+
+/// Returns the sum squared error between a block of outputs and targets.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+
+double RootMeanSquaredError::calculate_outputs_error(
+    const Matrix<double>& outputs, const Matrix<double>& targets) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
+
+  double sum_squared_error = 0.0;
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      const double error = outputs[i][j] - targets[i][j];
+
+      sum_squared_error += error * error;
+    }
+  }
+
+  return (sum_squared_error);
+}
+
 // Matrix<double> calculate_Hessian(void) const method
 
 /// @todo
@@ -93,6 +93,14 @@ class RootMeanSquaredError : public PerformanceTerm {
 
   Vector<double> calculate_gradient(void) const;
 
+  FirstOrderPerformance calculate_first_order_performance(void) const;
+
+  void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+                                 Matrix<double>&) const;
+
+  double calculate_outputs_error(const Matrix<double>&,
+                                 const Matrix<double>&) const;
+
   Matrix<double> calculate_Hessian(void) const;
 
   std::string write_performance_term_type(void) const;
@@ -34,6 +34,8 @@ HEADERS += \
     perceptron_layer.h \
     perceptron.h \
     neural_network.h \
+    inference_plan.h \
+    quantized_multilayer_perceptron.h \
     multilayer_perceptron.h \
     independent_parameters.h \
     conditions_layer.h \
@@ -57,6 +59,7 @@ HEADERS += \
     random_search.h \
     quasi_newton_method.h \
     newton_method.h \
+    truncated_newton_method.h \
     levenberg_marquardt_algorithm.h \
     gradient_descent.h \
     evolutionary_algorithm.h \
@@ -86,6 +89,8 @@ SOURCES += \
     perceptron_layer.cpp \
     perceptron.cpp \
     neural_network.cpp \
+    inference_plan.cpp \
+    quantized_multilayer_perceptron.cpp \
     multilayer_perceptron.cpp \
     independent_parameters.cpp \
     conditions_layer.cpp \
@@ -109,6 +114,7 @@ SOURCES += \
     random_search.cpp \
     quasi_newton_method.cpp \
     newton_method.cpp \
+    truncated_newton_method.cpp \
     levenberg_marquardt_algorithm.cpp \
     gradient_descent.cpp \
     evolutionary_algorithm.cpp \
@@ -183,50 +183,7 @@ double SumSquaredError::calculate_performance(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  // Data set stuff
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  // Sum squared error stuff
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
-
-  double sum_squared_error = 0.0;
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
-
-    // Output vector
-
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    // Target vector
-
-    targets = data_set_pointer->get_training_target_instance(i);
-
-    // Sum squared error
-
-    sum_squared_error += outputs.calculate_sum_squared_error(targets);
-  }
-
-  return (sum_squared_error);
+  return (calculate_training_error());
 }
 
 // double calculate_performance(const Vector<double>&) const method
@@ -299,7 +256,7 @@ double SumSquaredError::calculate_performance(
   for (unsigned i = 0; i < training_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
     // Output vector
 
@@ -308,7 +265,7 @@ double SumSquaredError::calculate_performance(
 
     // Target vector
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     // Sum squared error
 
@@ -318,6 +275,29 @@ double SumSquaredError::calculate_performance(
   return (sum_squared_error);
 }
 
+// Vector<double> calculate_performances(const Vector< Vector<double> >&) const
+// method
+
+/// Returns which would be the sum squared error performances of a neural
+/// network for several hypothetical vectors of parameters.
+/// All the vectors are evaluated in a single pass over the training instances,
+/// and none of them is set to the neural network.
+/// @param parameters Vectors of potential parameters for the neural network
+/// associated to the performance term.
+
+Vector<double> SumSquaredError::calculate_performances(
+    const Vector<Vector<double> >& parameters) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  return (calculate_training_errors(parameters));
+}
+
 // double calculate_generalization_performance(void) const method
 
 /// Returns the sum squared error of the neural network measured on the
@@ -357,7 +337,7 @@ double SumSquaredError::calculate_generalization_performance(void) const {
   for (unsigned i = 0; i < generalization_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_generalization_input_instance(i);
+    data_set_pointer->get_generalization_input_instance(i, inputs);
 
     // Output vector
 
@@ -365,7 +345,7 @@ double SumSquaredError::calculate_generalization_performance(void) const {
 
     // Target vector
 
-    targets = data_set_pointer->get_generalization_target_instance(i);
+    data_set_pointer->get_generalization_target_instance(i, targets);
 
     // Sum of squares error
 
@@ -389,107 +369,77 @@ Vector<double> SumSquaredError::calculate_gradient(void) const {
 
 #endif
 
-  // Neural network stuff
-
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  // Neural network stuff
-
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
-
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
-
-  const unsigned neural_parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
-
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
-
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
+  return (calculate_training_gradient());
+}
 
-  // Data set stuff
+// FirstOrderPerformance calculate_first_order_performance(void) const method
 
-  const Instances& instances = data_set_pointer->get_instances();
+/// Returns the sum squared error and its gradient, which are calculated with a
+/// single forward and backward propagation of the training instances.
 
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
+PerformanceTerm::FirstOrderPerformance
+SumSquaredError::calculate_first_order_performance(void) const {
+#ifndef NDEBUG
 
-  // Sum squared error stuff
+  check();
 
-  Vector<double> output_gradient(outputs_number);
+#endif
 
-  Vector<Matrix<double> > layers_combination_parameters_Jacobian;
+  FirstOrderPerformance first_order_performance;
 
-  Vector<Vector<double> > layers_inputs(layers_number);
-  Vector<Vector<double> > layers_delta;
+  calculate_training_error_gradient(first_order_performance.performance,
+                                    first_order_performance.gradient);
 
-  Vector<double> point_gradient(neural_parameters_number, 0.0);
+  return (first_order_performance);
+}
 
-  Vector<double> gradient(neural_parameters_number, 0.0);
+// void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+// Matrix<double>&) const method
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    inputs = data_set_pointer->get_training_input_instance(i);
+/// Calculates the derivatives of the sum squared error with respect to the
+/// outputs of the neural network, for a block of instances.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param output_gradient Matrix to store the outputs gradient.
 
-    targets = data_set_pointer->get_training_target_instance(i);
+void SumSquaredError::calculate_output_gradient(
+    const Matrix<double>& outputs, const Matrix<double>& targets,
+    Matrix<double>& output_gradient) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
+  output_gradient.set(instances_number, outputs_number);
 
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_gradient[i][j] = (outputs[i][j] - targets[i][j]) * 2.0;
+    }
+  }
+}
 
-    layers_inputs = multilayer_perceptron_pointer->arrange_layers_input(
-        inputs, layers_activation);
+// double calculate_outputs_error(const Matrix<double>&, const Matrix<double>&)
+// const method
 
-    layers_combination_parameters_Jacobian = multilayer_perceptron_pointer
-        ->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+/// Returns the sum squared error between a block of outputs and targets.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
 
-    if (!has_conditions_layer) {
-      output_gradient = (layers_activation[layers_number - 1] - targets) * 2.0;
+double SumSquaredError::calculate_outputs_error(const Matrix<double>& outputs,
+                                                const Matrix<double>& targets) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
 
-      layers_delta =
-          calculate_layers_delta(layers_activation_derivative, output_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+  double sum_squared_error = 0.0;
 
-      output_gradient =
-          (particular_solution +
-           homogeneous_solution * layers_activation[layers_number - 1] -
-           targets) *
-          2.0;
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      const double error = outputs[i][j] - targets[i][j];
 
-      layers_delta = calculate_layers_delta(
-          layers_activation_derivative, homogeneous_solution, output_gradient);
+      sum_squared_error += error * error;
     }
-
-    point_gradient = calculate_point_gradient(
-        layers_combination_parameters_Jacobian, layers_delta);
-
-    gradient += point_gradient;
   }
 
-  return (gradient);
+  return (sum_squared_error);
 }
 
 // Matrix<double> calculate_Hessian(void) const method
@@ -562,9 +512,9 @@ Matrix<double> SumSquaredError::calculate_Hessian(void) const {
   Matrix<double> objective_Hessian(parameters_number, parameters_number, 0.0);
 
   for (unsigned i = 0; i < training_instances_number; i++) {
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     second_order_forward_propagation = multilayer_perceptron_pointer
         ->calculate_second_order_forward_propagation(inputs);
@@ -628,58 +578,68 @@ Matrix<double> SumSquaredError::calculate_Hessian(void) const {
   return (objective_Hessian);
 }
 
-// Vector<double> calculate_terms(void) const method
+// void calculate_output_vector_dot_Hessian(const Matrix<double>&, const
+// Matrix<double>&, const Matrix<double>&, Matrix<double>&) const method
+
+/// Calculates, for a block of instances, the product of the second derivatives
+/// of the squared errors with respect to the outputs of the neural network and
+/// a given direction of the outputs, which is twice that direction.
+/// @param outputs Outputs of the neural network, with one instance per row.
+/// @param targets Target values, with one instance per row.
+/// @param outputs_direction Direction of the outputs, with one instance per
+/// row.
+/// @param output_product Matrix to store the outputs Hessian product.
+
+void SumSquaredError::calculate_output_vector_dot_Hessian(
+    const Matrix<double>& outputs, const Matrix<double>&,
+    const Matrix<double>& outputs_direction,
+    Matrix<double>& output_product) const {
+  const unsigned instances_number = outputs.get_rows_number();
+  const unsigned outputs_number = outputs.get_columns_number();
+
+  output_product.set(instances_number, outputs_number);
+
+  for (unsigned i = 0; i < instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      output_product[i][j] = outputs_direction[i][j] * 2.0;
+    }
+  }
+}
 
-/// Calculates the squared error terms for each instance, and returns it in a
-/// vector of size the number training instances.
+// Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const
+// method
 
-Vector<double> SumSquaredError::calculate_terms(void) const {
-// Control sentence (if debug)
+/// Returns the exact product of the sum squared error Hessian and a vector of
+/// parameters, which is calculated with the R-operator without forming the
+/// Hessian matrix.
+/// @param vector Vector of multilayer perceptron parameters in the product.
 
+Vector<double> SumSquaredError::calculate_vector_dot_Hessian(
+    const Vector<double>& vector) const {
 #ifndef NDEBUG
 
   check();
 
 #endif
 
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  Vector<double> performance_terms(training_instances_number);
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> outputs(outputs_number);
-  Vector<double> targets(outputs_number);
-
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    // Input vector
-
-    inputs = data_set_pointer->get_training_input_instance(i);
+  return (calculate_training_vector_dot_Hessian(vector));
+}
 
-    // Output vector
+// Vector<double> calculate_terms(void) const method
 
-    outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+/// Calculates the squared error terms for each instance, and returns it in a
+/// vector of size the number training instances.
 
-    // Target vector
+Vector<double> SumSquaredError::calculate_terms(void) const {
+// Control sentence (if debug)
 
-    targets = data_set_pointer->get_training_target_instance(i);
+#ifndef NDEBUG
 
-    // Error
+  check();
 
-    performance_terms[i] = outputs.calculate_distance(targets);
-  }
+#endif
 
-  return (performance_terms);
+  return (calculate_training_terms());
 }
 
 // Vector<double> calculate_terms(const Vector<double>&) const method
@@ -746,144 +706,91 @@ Matrix<double> SumSquaredError::calculate_terms_Jacobian(void) const {
 
 #endif
 
-  const MultilayerPerceptron* multilayer_perceptron_pointer =
-      neural_network_pointer->get_multilayer_perceptron_pointer();
-
-  const unsigned inputs_number =
-      multilayer_perceptron_pointer->get_inputs_number();
-  const unsigned outputs_number =
-      multilayer_perceptron_pointer->get_outputs_number();
-  const unsigned layers_number =
-      multilayer_perceptron_pointer->get_layers_number();
-
-  const unsigned neural_parameters_number =
-      multilayer_perceptron_pointer->count_parameters_number();
-
-  Vector<Vector<Vector<double> > > first_order_forward_propagation(2);
-
-  Vector<Vector<double> > layers_inputs(layers_number);
-  Vector<Matrix<double> > layers_combination_parameters_Jacobian(layers_number);
-
-  Vector<double> particular_solution;
-  Vector<double> homogeneous_solution;
-
-  const bool has_conditions_layer =
-      neural_network_pointer->has_conditions_layer();
-
-  const ConditionsLayer* conditions_layer_pointer =
-      has_conditions_layer
-          ? neural_network_pointer->get_conditions_layer_pointer()
-          : NULL;
-
-  // Data set
-
-  const Instances& instances = data_set_pointer->get_instances();
-
-  const unsigned training_instances_number =
-      instances.count_training_instances_number();
-
-  Vector<double> inputs(inputs_number);
-  Vector<double> targets(outputs_number);
-
-  // Objective functional
-
-  Vector<double> term(outputs_number);
-  double term_norm;
-
-  Vector<double> output_objective_gradient(outputs_number);
+  return (calculate_training_terms_Jacobian());
+}
 
-  Vector<Vector<double> > layers_delta(layers_number);
-  Vector<double> point_gradient(neural_parameters_number);
+// FirstOrderTerms calculate_first_order_terms(void) const method
 
-  Matrix<double> terms_Jacobian(training_instances_number,
-                                neural_parameters_number);
+/// Returns the first order performance of the terms objective function.
+/// This is a structure containing the objective terms vector and the objective
+/// terms Jacobian, which are calculated with a single forward and backward
+/// propagation of the training instances.
 
-  // Main loop
+PerformanceTerm::FirstOrderTerms SumSquaredError::calculate_first_order_terms(
+    void) const {
+#ifndef NDEBUG
 
-  for (unsigned i = 0; i < training_instances_number; i++) {
-    inputs = data_set_pointer->get_training_input_instance(i);
+  check();
 
-    targets = data_set_pointer->get_training_target_instance(i);
+#endif
 
-    first_order_forward_propagation = multilayer_perceptron_pointer
-        ->calculate_first_order_forward_propagation(inputs);
+  FirstOrderTerms first_order_terms;
 
-    const Vector<Vector<double> >& layers_activation =
-        first_order_forward_propagation[0];
-    const Vector<Vector<double> >& layers_activation_derivative =
-        first_order_forward_propagation[1];
+  calculate_training_terms_Jacobian(first_order_terms.terms,
+                                    first_order_terms.Jacobian);
 
-    layers_inputs[0] = inputs;
+  return (first_order_terms);
+}
 
-    for (unsigned j = 1; j < layers_number; j++) {
-      layers_inputs[j] = layers_activation[j - 1];
-    }
+// TermsJacobianProducts calculate_terms_Jacobian_products(void) const method
 
-    layers_combination_parameters_Jacobian = multilayer_perceptron_pointer
-        ->calculate_layers_combination_parameters_Jacobian(layers_inputs);
+/// Returns the sum squared error and the products of the transposed terms
+/// Jacobian with the terms and with itself.
+/// They are accumulated over the training instances without forming the
+/// terms Jacobian, so that the memory does not depend on the number of
+/// instances.
 
-    if (!has_conditions_layer) {
-      const Vector<double>& outputs =
-          first_order_forward_propagation[0][layers_number - 1];
+PerformanceTerm::TermsJacobianProducts
+SumSquaredError::calculate_terms_Jacobian_products(void) const {
+#ifndef NDEBUG
 
-      term = outputs - targets;
-      term_norm = term.calculate_norm();
+  check();
 
-      if (term_norm == 0.0) {
-        output_objective_gradient.initialize(0.0);
-      } else {
-        output_objective_gradient = term / term_norm;
-      }
+#endif
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            output_objective_gradient);
-    } else {
-      particular_solution =
-          conditions_layer_pointer->calculate_particular_solution(inputs);
-      homogeneous_solution =
-          conditions_layer_pointer->calculate_homogeneous_solution(inputs);
+  return (calculate_training_terms_Jacobian_products());
+}
 
-      const Vector<double>& output_layer_activation =
-          first_order_forward_propagation[0][layers_number - 1];
+// Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(const
+// Vector<double>&) const method
 
-      term = (particular_solution +
-              homogeneous_solution * output_layer_activation - targets);
-      term_norm = term.calculate_norm();
+/// Returns the product of the transposed terms Jacobian, the terms Jacobian
+/// and a vector of parameters, which is the product of the Gauss-Newton
+/// approximation of the sum squared error Hessian and the vector.
+/// It is calculated over the training instances without forming the terms
+/// Jacobian.
+/// @param vector Vector of multilayer perceptron parameters in the product.
 
-      if (term_norm == 0.0) {
-        output_objective_gradient.initialize(0.0);
-      } else {
-        output_objective_gradient = term / term_norm;
-      }
+Vector<double> SumSquaredError::calculate_JacobianT_dot_Jacobian_dot_vector(
+    const Vector<double>& vector) const {
+// Control sentence (if debug)
 
-      layers_delta = calculate_layers_delta(layers_activation_derivative,
-                                            homogeneous_solution,
-                                            output_objective_gradient);
-    }
+#ifndef NDEBUG
 
-    point_gradient = calculate_point_gradient(
-        layers_combination_parameters_Jacobian, layers_delta);
+  check();
 
-    terms_Jacobian.set_row(i, point_gradient);
-  }
+#endif
 
-  return (terms_Jacobian);
+  return (calculate_training_JacobianT_dot_Jacobian_dot_vector(vector));
 }
 
-// FirstOrderTerms calculate_first_order_terms(void) const method
+// Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const method
 
-/// Returns the first order performance of the terms objective function.
-/// This is a structure containing the objective terms vector and the objective
-/// terms Jacobian.
+/// Returns the diagonal of the product of the transposed terms Jacobian and
+/// the terms Jacobian, which is calculated over the training instances without
+/// forming the terms Jacobian.
 
-PerformanceTerm::FirstOrderTerms SumSquaredError::calculate_first_order_terms(
+Vector<double> SumSquaredError::calculate_JacobianT_dot_Jacobian_diagonal(
     void) const {
-  FirstOrderTerms first_order_terms;
+// Control sentence (if debug)
 
-  first_order_terms.terms = calculate_terms();
-  first_order_terms.Jacobian = calculate_terms_Jacobian();
+#ifndef NDEBUG
 
-  return (first_order_terms);
+  check();
+
+#endif
+
+  return (calculate_training_JacobianT_dot_Jacobian_diagonal());
 }
 
 // Vector<double> calculate_squared_errors(void) const method
@@ -925,7 +832,7 @@ Vector<double> SumSquaredError::calculate_squared_errors(void) const {
   for (unsigned i = 0; i < training_instances_number; i++) {
     // Input vector
 
-    inputs = data_set_pointer->get_training_input_instance(i);
+    data_set_pointer->get_training_input_instance(i, inputs);
 
     // Output vector
 
@@ -933,7 +840,7 @@ Vector<double> SumSquaredError::calculate_squared_errors(void) const {
 
     // Target vector
 
-    targets = data_set_pointer->get_training_target_instance(i);
+    data_set_pointer->get_training_target_instance(i, targets);
 
     // Error
 
@@ -97,10 +97,27 @@ class SumSquaredError : public PerformanceTerm {
 
   Vector<double> calculate_gradient(void) const;
 
+  FirstOrderPerformance calculate_first_order_performance(void) const;
+
+  void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&,
+                                 Matrix<double>&) const;
+
+  void calculate_output_vector_dot_Hessian(const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           const Matrix<double>&,
+                                           Matrix<double>&) const;
+
+  double calculate_outputs_error(const Matrix<double>&,
+                                 const Matrix<double>&) const;
+
   Matrix<double> calculate_Hessian(void) const;
 
+  Vector<double> calculate_vector_dot_Hessian(const Vector<double>&) const;
+
   double calculate_performance(const Vector<double>&) const;
 
+  Vector<double> calculate_performances(const Vector<Vector<double> >&) const;
+
   Vector<double> calculate_gradient(const Vector<double>&) const;
 
   Matrix<double> calculate_Hessian(const Vector<double>&) const;
@@ -114,6 +131,13 @@ class SumSquaredError : public PerformanceTerm {
 
   PerformanceTerm::FirstOrderTerms calculate_first_order_terms(void) const;
 
+  PerformanceTerm::TermsJacobianProducts calculate_terms_Jacobian_products(
+      void) const;
+
+  Vector<double> calculate_JacobianT_dot_Jacobian_dot_vector(
+      const Vector<double>&) const;
+  Vector<double> calculate_JacobianT_dot_Jacobian_diagonal(void) const;
+
   // Squared errors methods
 
   Vector<double> calculate_squared_errors(void) const;
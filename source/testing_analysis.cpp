@@ -859,6 +859,202 @@ Matrix<unsigned> TestingAnalysis::calculate_confusion(void) const {
   }
 }
 
+// QuantizationResults perform_quantization_analysis(void) const method
+
+/// Quantizes the multilayer perceptron of the neural network to 8 bit
+/// integers, calibrating it on the training instances of the data set, and
+/// compares both on the testing instances.
+/// See perform_quantization_analysis(const QuantizedMultilayerPerceptron&).
+
+TestingAnalysis::QuantizationResults
+TestingAnalysis::perform_quantization_analysis(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const Matrix<double> training_input_data =
+      data_set_pointer->arrange_training_input_data();
+
+  return (perform_quantization_analysis(
+      neural_network_pointer->quantize_multilayer_perceptron(
+          training_input_data)));
+}
+
+// QuantizationResults perform_quantization_analysis(
+// const QuantizedMultilayerPerceptron&) const method
+
+/// Compares the neural network with the same neural network using a quantized
+/// multilayer perceptron, on the testing instances of the data set.
+/// It returns a quantization results structure, which consists on:
+/// <ul>
+/// <li> Mean absolute errors of both neural networks.
+/// <li> Largest difference between their outputs.
+/// <li> Classification accuracies of both neural networks, and their
+/// difference.
+/// <li> Memory sizes of both multilayer perceptrons.
+/// </ul>
+/// The classification accuracies are computed from the confusion matrices, as
+/// in calculate_confusion.
+/// @param quantized_multilayer_perceptron Quantized multilayer perceptron, as
+/// returned by NeuralNetwork::quantize_multilayer_perceptron.
+
+TestingAnalysis::QuantizationResults
+TestingAnalysis::perform_quantization_analysis(
+    const QuantizedMultilayerPerceptron& quantized_multilayer_perceptron)
+    const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const MultilayerPerceptron* multilayer_perceptron_pointer =
+      neural_network_pointer->get_multilayer_perceptron_pointer();
+
+  const unsigned outputs_number =
+      multilayer_perceptron_pointer->get_outputs_number();
+
+  if (quantized_multilayer_perceptron.get_inputs_number() !=
+          multilayer_perceptron_pointer->get_inputs_number() ||
+      quantized_multilayer_perceptron.get_outputs_number() != outputs_number) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TestingAnalysis class.\n"
+           << "QuantizationResults perform_quantization_analysis(const "
+              "QuantizedMultilayerPerceptron&) const method.\n"
+           << "Quantized multilayer perceptron must have the same inputs and "
+              "outputs as the multilayer perceptron.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  const Matrix<double> input_data =
+      data_set_pointer->arrange_testing_input_data();
+  const Matrix<double> target_data =
+      data_set_pointer->arrange_testing_target_data();
+
+  const unsigned testing_instances_number = input_data.get_rows_number();
+
+  const Matrix<double> output_data =
+      neural_network_pointer->calculate_output_data(input_data);
+
+  const Matrix<double> quantized_output_data =
+      neural_network_pointer->calculate_quantized_outputs(
+          quantized_multilayer_perceptron, input_data);
+
+  QuantizationResults quantization_results;
+
+  // Errors
+
+  quantization_results.mean_absolute_errors.set(outputs_number, 0.0);
+  quantization_results.quantized_mean_absolute_errors.set(outputs_number, 0.0);
+  quantization_results.maximum_outputs_difference = 0.0;
+
+  for (unsigned i = 0; i < testing_instances_number; i++) {
+    for (unsigned j = 0; j < outputs_number; j++) {
+      quantization_results.mean_absolute_errors[j] +=
+          fabs(output_data[i][j] - target_data[i][j]);
+      quantization_results.quantized_mean_absolute_errors[j] +=
+          fabs(quantized_output_data[i][j] - target_data[i][j]);
+
+      const double outputs_difference =
+          fabs(quantized_output_data[i][j] - output_data[i][j]);
+
+      if (outputs_difference >
+          quantization_results.maximum_outputs_difference) {
+        quantization_results.maximum_outputs_difference = outputs_difference;
+      }
+    }
+  }
+
+  if (testing_instances_number != 0) {
+    quantization_results.mean_absolute_errors /=
+        (double)testing_instances_number;
+    quantization_results.quantized_mean_absolute_errors /=
+        (double)testing_instances_number;
+  }
+
+  // Classification accuracies
+
+  Matrix<unsigned> confusion;
+  Matrix<unsigned> quantized_confusion;
+
+  if (outputs_number == 1) {
+    confusion =
+        calculate_confusion_binary_classification(target_data, output_data);
+    quantized_confusion = calculate_confusion_binary_classification(
+        target_data, quantized_output_data);
+  } else {
+    confusion =
+        calculate_confusion_multiple_classification(target_data, output_data);
+    quantized_confusion = calculate_confusion_multiple_classification(
+        target_data, quantized_output_data);
+  }
+
+  const unsigned confusion_size = confusion.get_rows_number();
+
+  unsigned correct_number = 0;
+  unsigned quantized_correct_number = 0;
+
+  for (unsigned i = 0; i < confusion_size; i++) {
+    correct_number += confusion[i][i];
+    quantized_correct_number += quantized_confusion[i][i];
+  }
+
+  if (testing_instances_number == 0) {
+    quantization_results.classification_accuracy = 0.0;
+    quantization_results.quantized_classification_accuracy = 0.0;
+  } else {
+    quantization_results.classification_accuracy =
+        (double)correct_number / (double)testing_instances_number;
+    quantization_results.quantized_classification_accuracy =
+        (double)quantized_correct_number / (double)testing_instances_number;
+  }
+
+  quantization_results.classification_accuracy_delta =
+      quantization_results.quantized_classification_accuracy -
+      quantization_results.classification_accuracy;
+
+  // Memory sizes
+
+  quantization_results.memory_size =
+      multilayer_perceptron_pointer->count_parameters_number() * sizeof(double);
+  quantization_results.quantized_memory_size =
+      quantized_multilayer_perceptron.count_memory_size();
+
+  return (quantization_results);
+}
+
+// void QuantizationResults::save(const std::string&) const method
+
+/// Saves a quantization analysis results structure to a data file.
+/// @param file_name Name of results data file.
+
+void TestingAnalysis::QuantizationResults::save(
+    const std::string& file_name) const {
+  std::ofstream file(file_name.c_str());
+
+  file << "Mean absolute errors:\n" << mean_absolute_errors << "\n"
+       << "Quantized mean absolute errors:\n" << quantized_mean_absolute_errors
+       << "\n"
+       << "Maximum outputs difference: " << maximum_outputs_difference << "\n"
+       << "Classification accuracy: " << classification_accuracy << "\n"
+       << "Quantized classification accuracy: "
+       << quantized_classification_accuracy << "\n"
+       << "Classification accuracy delta: " << classification_accuracy_delta
+       << "\n"
+       << "Memory size: " << memory_size << "\n"
+       << "Quantized memory size: " << quantized_memory_size << "\n";
+
+  file.close();
+}
+
 // Vector<double> calculate_binary_classification_tests(void) method
 
 /// Returns the results of a binary classification test in a single vector.
@@ -108,6 +108,51 @@ class TestingAnalysis {
     void save(const std::string&) const;
   };
 
+  ///
+  /// Structure with the results from comparing the neural network with its
+  /// multilayer perceptron quantized to 8 bit integers.
+  ///
+
+  struct QuantizationResults {
+    /// Mean absolute error of the neural network on the testing instances, for
+    /// each output variable.
+
+    Vector<double> mean_absolute_errors;
+
+    /// Mean absolute error of the quantized neural network on the testing
+    /// instances, for each output variable.
+
+    Vector<double> quantized_mean_absolute_errors;
+
+    /// Largest absolute difference between the outputs of the neural network
+    /// and the quantized outputs.
+
+    double maximum_outputs_difference;
+
+    /// Ratio of testing instances correctly classified by the neural network.
+
+    double classification_accuracy;
+
+    /// Ratio of testing instances correctly classified by the quantized neural
+    /// network.
+
+    double quantized_classification_accuracy;
+
+    /// Quantized classification accuracy minus classification accuracy.
+
+    double classification_accuracy_delta;
+
+    /// Number of bytes taken by the parameters of the multilayer perceptron.
+
+    unsigned memory_size;
+
+    /// Number of bytes taken by the quantized multilayer perceptron.
+
+    unsigned quantized_memory_size;
+
+    void save(const std::string&) const;
+  };
+
   // METHODS
 
   // Get methods
@@ -167,6 +212,12 @@ class TestingAnalysis {
 
   Matrix<unsigned> calculate_confusion(void) const;
 
+  // Quantization analysis methods
+
+  QuantizationResults perform_quantization_analysis(void) const;
+  QuantizationResults perform_quantization_analysis(
+      const QuantizedMultilayerPerceptron&) const;
+
   // Serialization methods
 
   std::string to_string(void) const;
@@ -139,6 +139,10 @@ std::string TrainingRateAlgorithm::write_training_rate_method(void) const {
       return ("BrentMethod");
     } break;
 
+    case WolfeMethod: {
+      return ("WolfeMethod");
+    } break;
+
     default: {
       std::ostringstream buffer;
 
@@ -187,6 +191,56 @@ const double& TrainingRateAlgorithm::get_error_training_rate(void) const {
   return (error_training_rate);
 }
 
+// const double& get_sufficient_decrease_parameter(void) const method
+
+/// Returns the constant of the sufficient decrease condition in the Wolfe line
+/// search.
+
+const double& TrainingRateAlgorithm::get_sufficient_decrease_parameter(void)
+    const {
+  return (sufficient_decrease_parameter);
+}
+
+// const double& get_curvature_parameter(void) const method
+
+/// Returns the constant of the strong curvature condition in the Wolfe line
+/// search.
+
+const double& TrainingRateAlgorithm::get_curvature_parameter(void) const {
+  return (curvature_parameter);
+}
+
+// const unsigned& get_maximum_evaluations_number(void) const method
+
+/// Returns the maximum number of evaluations of the performance and its
+/// gradient in each Wolfe line search.
+
+const unsigned& TrainingRateAlgorithm::get_maximum_evaluations_number(void)
+    const {
+  return (maximum_evaluations_number);
+}
+
+// const unsigned& get_evaluation_points_number(void) const method
+
+/// Returns the number of training rates which the bracketing and golden
+/// section methods evaluate together, in a single pass over the data.
+
+const unsigned& TrainingRateAlgorithm::get_evaluation_points_number(void)
+    const {
+  return (evaluation_points_number);
+}
+
+// const unsigned& get_evaluations_number(void) const method
+
+/// Returns the number of performance evaluations made by the line minimization
+/// methods since the counter was last reset.
+/// An evaluation of the performance together with its gradient counts as one
+/// evaluation.
+
+const unsigned& TrainingRateAlgorithm::get_evaluations_number(void) const {
+  return (evaluations_number);
+}
+
 // const bool& get_display(void) const method
 
 /// Returns true if messages from this class can be displayed on the screen, or
@@ -237,6 +291,16 @@ void TrainingRateAlgorithm::set_default(void) {
 
   error_training_rate = 1.0e6;
 
+  sufficient_decrease_parameter = 1.0e-4;
+
+  curvature_parameter = 0.1;
+
+  maximum_evaluations_number = 20;
+
+  evaluation_points_number = 1;
+
+  evaluations_number = 0;
+
   // UTILITIES
 
   display = true;
@@ -269,7 +333,7 @@ void TrainingRateAlgorithm::set_training_rate_method(
 /// Sets the method for obtaining the training rate from a string with the name
 /// of the method.
 /// @param new_training_rate_method Name of training rate method ("Fixed",
-/// "GoldenSection", "BrentMethod" or "UserTrainingRate").
+/// "GoldenSection", "BrentMethod" or "WolfeMethod").
 
 void TrainingRateAlgorithm::set_training_rate_method(
     const std::string& new_training_rate_method) {
@@ -279,6 +343,8 @@ void TrainingRateAlgorithm::set_training_rate_method(
     training_rate_method = GoldenSection;
   } else if (new_training_rate_method == "BrentMethod") {
     training_rate_method = BrentMethod;
+  } else if (new_training_rate_method == "WolfeMethod") {
+    training_rate_method = WolfeMethod;
   } else {
     std::ostringstream buffer;
 
@@ -404,6 +470,130 @@ void TrainingRateAlgorithm::set_error_training_rate(
   error_training_rate = new_error_training_rate;
 }
 
+// void set_sufficient_decrease_parameter(const double&) method
+
+/// Sets a new constant for the sufficient decrease condition in the Wolfe line
+/// search.
+/// @param new_sufficient_decrease_parameter Sufficient decrease parameter
+/// value. It must be in the interval (0,1).
+
+void TrainingRateAlgorithm::set_sufficient_decrease_parameter(
+    const double& new_sufficient_decrease_parameter) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_sufficient_decrease_parameter <= 0.0 ||
+      new_sufficient_decrease_parameter >= 1.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+           << "void set_sufficient_decrease_parameter(const double&) method.\n"
+           << "Sufficient decrease parameter must be between 0 and 1.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  sufficient_decrease_parameter = new_sufficient_decrease_parameter;
+}
+
+// void set_curvature_parameter(const double&) method
+
+/// Sets a new constant for the strong curvature condition in the Wolfe line
+/// search.
+/// Small values give a more accurate line minimization at the cost of more
+/// evaluations.
+/// @param new_curvature_parameter Curvature parameter value. It must be in the
+/// interval (0,1).
+
+void TrainingRateAlgorithm::set_curvature_parameter(
+    const double& new_curvature_parameter) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_curvature_parameter <= 0.0 || new_curvature_parameter >= 1.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+           << "void set_curvature_parameter(const double&) method.\n"
+           << "Curvature parameter must be between 0 and 1.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  curvature_parameter = new_curvature_parameter;
+}
+
+// void set_maximum_evaluations_number(const unsigned&) method
+
+/// Sets a new maximum number of evaluations of the performance and its
+/// gradient in each Wolfe line search.
+/// @param new_maximum_evaluations_number Maximum number of evaluations.
+
+void TrainingRateAlgorithm::set_maximum_evaluations_number(
+    const unsigned& new_maximum_evaluations_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_maximum_evaluations_number == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+           << "void set_maximum_evaluations_number(const unsigned&) method.\n"
+           << "Maximum evaluations number must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  maximum_evaluations_number = new_maximum_evaluations_number;
+}
+
+// void set_evaluation_points_number(const unsigned&) method
+
+/// Sets the number of training rates which the bracketing and golden section
+/// methods evaluate together, in a single pass over the data.
+/// With more than one point, the golden section method is replaced by a
+/// reduction of the interval over a uniform grid of that many points.
+/// @param new_evaluation_points_number Number of evaluation points.
+
+void TrainingRateAlgorithm::set_evaluation_points_number(
+    const unsigned& new_evaluation_points_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_evaluation_points_number == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+           << "void set_evaluation_points_number(const unsigned&) method.\n"
+           << "Number of evaluation points must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  evaluation_points_number = new_evaluation_points_number;
+}
+
+// void reset_evaluations_number(void) method
+
+/// Sets the counter of performance evaluations made by the line minimization
+/// methods to zero.
+
+void TrainingRateAlgorithm::reset_evaluations_number(void) {
+  evaluations_number = 0;
+}
+
 // void set_display(const bool&) method
 
 /// Sets a new display value.
@@ -417,6 +607,76 @@ void TrainingRateAlgorithm::set_display(const bool& new_display) {
   display = new_display;
 }
 
+// double calculate_directional_performance(const Vector<double>&, const
+// double&) const method
+
+/// Returns the performance for some training rate along a training direction,
+/// and counts that evaluation.
+/// The parameters of the neural network are not changed.
+/// @param training_direction Training direction vector.
+/// @param training_rate Training rate.
+
+double TrainingRateAlgorithm::calculate_directional_performance(
+    const Vector<double>& training_direction,
+    const double& training_rate) const {
+  evaluations_number++;
+
+  return (performance_functional_pointer->calculate_performance(
+      training_direction, training_rate));
+}
+
+// Vector<double> calculate_directional_performances(const Vector<double>&,
+// const Vector<double>&) const method
+
+/// Returns the performances for several training rates along a training
+/// direction, which are evaluated in a single pass over the data, and counts
+/// each of them as an evaluation.
+/// The parameters of the neural network are not changed.
+/// @param training_direction Training direction vector.
+/// @param training_rates Training rates.
+
+Vector<double> TrainingRateAlgorithm::calculate_directional_performances(
+    const Vector<double>& training_direction,
+    const Vector<double>& training_rates) const {
+  evaluations_number += training_rates.size();
+
+  return (performance_functional_pointer->calculate_performances(
+      training_direction, training_rates));
+}
+
+// double calculate_directional_first_order_performance(const Vector<double>&,
+// const Vector<double>&, const double&, Vector<double>&) const method
+
+/// Returns the performance for some training rate along a training direction,
+/// and computes the performance gradient at that point in the same pass over
+/// the data.
+/// The parameters of the neural network are restored before returning.
+/// @param parameters Current parameters of the neural network.
+/// @param training_direction Training direction vector.
+/// @param training_rate Training rate.
+/// @param gradient Performance gradient at the new point.
+
+double TrainingRateAlgorithm::calculate_directional_first_order_performance(
+    const Vector<double>& parameters, const Vector<double>& training_direction,
+    const double& training_rate, Vector<double>& gradient) const {
+  NeuralNetwork* neural_network_pointer =
+      performance_functional_pointer->get_neural_network_pointer();
+
+  neural_network_pointer->set_parameters(parameters +
+                                         training_direction * training_rate);
+
+  const PerformanceFunctional::FirstOrderperformance first_order_performance =
+      performance_functional_pointer->calculate_first_order_performance();
+
+  neural_network_pointer->set_parameters(parameters);
+
+  evaluations_number++;
+
+  gradient = first_order_performance.gradient;
+
+  return (first_order_performance.performance);
+}
+
 // Vector<double> calculate_directional_point(const double&, const
 // Vector<double>&, const double&) const method
 
@@ -480,6 +740,21 @@ Vector<double> TrainingRateAlgorithm::calculate_directional_point(
           performance, training_direction, initial_training_rate));
     } break;
 
+    case TrainingRateAlgorithm::WolfeMethod: {
+      const PerformanceFunctional::FirstOrderperformance
+          first_order_performance =
+              performance_functional_pointer
+                  ->calculate_first_order_performance();
+
+      evaluations_number++;
+
+      Vector<double> directional_gradient;
+
+      return (calculate_Wolfe_directional_point(
+          performance, first_order_performance.gradient, training_direction,
+          initial_training_rate, directional_gradient));
+    } break;
+
     default: {
       std::ostringstream buffer;
 
@@ -493,6 +768,42 @@ Vector<double> TrainingRateAlgorithm::calculate_directional_point(
   }
 }
 
+// Vector<double> calculate_directional_point(const double&, const
+// Vector<double>&, const Vector<double>&, const double&, Vector<double>&)
+// const method
+
+/// Returns a vector with two elements:
+/// (i) the training rate calculated by means of the corresponding algorithm,
+/// and
+/// (ii) the performance for that training rate.
+/// The Wolfe method uses the given gradient instead of evaluating it again,
+/// and also returns the gradient at the new point.
+/// The rest of methods return an empty directional gradient.
+/// @param performance Initial performance function performance.
+/// @param gradient Initial performance function gradient.
+/// @param training_direction Initial training direction.
+/// @param initial_training_rate Initial training rate to start the algorithm.
+/// @param directional_gradient Performance gradient for the training rate
+/// found, if the method computes it.
+
+Vector<double> TrainingRateAlgorithm::calculate_directional_point(
+    const double& performance, const Vector<double>& gradient,
+    const Vector<double>& training_direction,
+    const double& initial_training_rate,
+    Vector<double>& directional_gradient) const {
+  if (training_rate_method == WolfeMethod) {
+    return (calculate_Wolfe_directional_point(performance, gradient,
+                                              training_direction,
+                                              initial_training_rate,
+                                              directional_gradient));
+  }
+
+  directional_gradient.set();
+
+  return (calculate_directional_point(performance, training_direction,
+                                      initial_training_rate));
+}
+
 // Triplet calculate_bracketing_triplet(const double&, const Vector<double>&,
 // const double&) const method
 
@@ -530,6 +841,11 @@ TrainingRateAlgorithm::calculate_bracketing_triplet(
     return (triplet);
   }
 
+  if (evaluation_points_number > 1) {
+    return (calculate_multipoint_bracketing_triplet(
+        performance, training_direction, initial_training_rate));
+  }
+
   // Left point
 
   triplet.A[0] = 0.0;
@@ -538,15 +854,15 @@ TrainingRateAlgorithm::calculate_bracketing_triplet(
   // Right point
 
   triplet.B[0] = initial_training_rate;
-  triplet.B[1] = performance_functional_pointer
-      ->calculate_performance(training_direction, triplet.B[0]);
+  triplet.B[1] =
+      calculate_directional_performance(training_direction, triplet.B[0]);
 
   while (triplet.A[1] > triplet.B[1]) {
     triplet.A = triplet.B;
 
     triplet.B[0] *= bracketing_factor;
-    triplet.B[1] = performance_functional_pointer
-        ->calculate_performance(training_direction, triplet.B[0]);
+    triplet.B[1] =
+        calculate_directional_performance(training_direction, triplet.B[0]);
 
     if (triplet.B[0] > error_training_rate) {
       std::ostringstream buffer;
@@ -569,14 +885,14 @@ TrainingRateAlgorithm::calculate_bracketing_triplet(
   // Interior point
 
   triplet.U[0] = triplet.A[0] + (triplet.B[0] - triplet.A[0]) / 2.0;
-  triplet.U[1] = performance_functional_pointer
-      ->calculate_performance(training_direction, triplet.U[0]);
+  triplet.U[1] =
+      calculate_directional_performance(training_direction, triplet.U[0]);
 
   while (triplet.A[1] < triplet.U[1]) {
     triplet.U[0] =
         triplet.A[0] + (triplet.U[0] - triplet.A[0]) / bracketing_factor;
-    triplet.U[1] = performance_functional_pointer
-        ->calculate_performance(training_direction, triplet.U[0]);
+    triplet.U[1] =
+        calculate_directional_performance(training_direction, triplet.U[0]);
 
     if (triplet.U[0] - triplet.A[0] <= training_rate_tolerance) {
       triplet.U = triplet.A;
@@ -593,6 +909,118 @@ TrainingRateAlgorithm::calculate_bracketing_triplet(
   return (triplet);
 }
 
+// Triplet calculate_multipoint_bracketing_triplet(const double&, const
+// Vector<double>&, const double&) const method
+
+/// Returns bracketing triplet, evaluating several training rates together in
+/// each pass over the data.
+/// The training rate is increased by the bracketing factor until the
+/// performance does not decrease, so that the last three points define the
+/// triplet.
+/// If the performance does not decrease for the initial training rate, it is
+/// decreased instead until it does.
+/// @param performance Initial performance function performance.
+/// @param training_direction Initial training direction.
+/// @param initial_training_rate Initial training rate to start the algorithm.
+
+TrainingRateAlgorithm::Triplet
+TrainingRateAlgorithm::calculate_multipoint_bracketing_triplet(
+    const double& performance, const Vector<double>& training_direction,
+    const double& initial_training_rate) const {
+  Triplet triplet;
+
+  Vector<double> training_rates(evaluation_points_number);
+  Vector<double> performances;
+
+  double training_rate = initial_training_rate;
+
+  // Left point
+
+  triplet.A[0] = 0.0;
+  triplet.A[1] = performance;
+
+  triplet.U = triplet.A;
+
+  // Right point
+
+  bool increasing = true;
+
+  while (increasing) {
+    for (unsigned i = 0; i < evaluation_points_number; i++) {
+      training_rates[i] = training_rate;
+      training_rate *= bracketing_factor;
+    }
+
+    performances =
+        calculate_directional_performances(training_direction, training_rates);
+
+    for (unsigned i = 0; i < evaluation_points_number && increasing; i++) {
+      triplet.B[0] = training_rates[i];
+      triplet.B[1] = performances[i];
+
+      if (triplet.B[1] >= triplet.U[1]) {
+        increasing = false;
+      } else {
+        triplet.A = triplet.U;
+        triplet.U = triplet.B;
+
+        if (triplet.B[0] > error_training_rate) {
+          std::ostringstream buffer;
+
+          buffer << "OpenNN Warning: TrainingRateAlgorithm class.\n"
+                 << "Triplet calculate_multipoint_bracketing_triplet(const "
+                    "double&, const Vector<double>&, const double&) const "
+                    "method\n."
+                 << "Right point is " << triplet.B[0] << "." << std::endl;
+
+          throw std::logic_error(buffer.str());
+        }
+      }
+    }
+  }
+
+  if (triplet.U[0] > 0.0) {
+    triplet.check();
+
+    return (triplet);
+  }
+
+  // Interior point
+
+  training_rate = triplet.B[0] / 2.0;
+
+  while (true) {
+    for (unsigned i = 0; i < evaluation_points_number; i++) {
+      training_rates[i] = training_rate;
+      training_rate /= bracketing_factor;
+    }
+
+    performances =
+        calculate_directional_performances(training_direction, training_rates);
+
+    for (unsigned i = 0; i < evaluation_points_number; i++) {
+      if (training_rates[i] <= training_rate_tolerance) {
+        triplet.U = triplet.A;
+        triplet.B = triplet.A;
+
+        return (triplet);
+      }
+
+      if (performances[i] <= triplet.A[1]) {
+        triplet.U[0] = training_rates[i];
+        triplet.U[1] = performances[i];
+
+        triplet.check();
+
+        return (triplet);
+      }
+
+      triplet.B[0] = training_rates[i];
+      triplet.B[1] = performances[i];
+    }
+  }
+}
+
 // Vector<double> calculate_fixed_directional_point(const double&, const
 // Vector<double>&, const double&) const method
 
@@ -607,7 +1035,7 @@ Vector<double> TrainingRateAlgorithm::calculate_fixed_directional_point(
   Vector<double> directional_point(2);
 
   directional_point[0] = initial_training_rate;
-  directional_point[1] = performance_functional_pointer->calculate_performance(
+  directional_point[1] = calculate_directional_performance(
       training_direction, initial_training_rate);
 
   return (directional_point);
@@ -639,14 +1067,68 @@ TrainingRateAlgorithm::calculate_golden_section_directional_point(
       return (triplet.A);
     }
 
+    // Reduce the interval over a grid of points evaluated together
+
+    if (evaluation_points_number > 1) {
+      Vector<double> training_rates(evaluation_points_number);
+      Vector<double> performances;
+
+      Vector<double> point(2);
+
+      while (triplet.B[0] - triplet.A[0] > training_rate_tolerance) {
+        const double step = (triplet.B[0] - triplet.A[0]) /
+                            (double)(evaluation_points_number + 1);
+
+        for (unsigned i = 0; i < evaluation_points_number; i++) {
+          training_rates[i] = triplet.A[0] + step * (double)(i + 1);
+        }
+
+        performances = calculate_directional_performances(training_direction,
+                                                          training_rates);
+
+        // The new interior point is the best point, and the new left and right
+        // points are its neighbours
+
+        Triplet new_triplet = triplet;
+
+        for (unsigned i = 0; i < evaluation_points_number; i++) {
+          if (performances[i] < new_triplet.U[1]) {
+            new_triplet.U[0] = training_rates[i];
+            new_triplet.U[1] = performances[i];
+          }
+        }
+
+        for (unsigned i = 0; i <= evaluation_points_number; i++) {
+          if (i == evaluation_points_number) {
+            point = triplet.U;
+          } else {
+            point[0] = training_rates[i];
+            point[1] = performances[i];
+          }
+
+          if (point[0] < new_triplet.U[0] && point[0] > new_triplet.A[0]) {
+            new_triplet.A = point;
+          } else if (point[0] > new_triplet.U[0] &&
+                     point[0] < new_triplet.B[0]) {
+            new_triplet.B = point;
+          }
+        }
+
+        triplet = new_triplet;
+
+        triplet.check();
+      }
+
+      return (triplet.U);
+    }
+
     Vector<double> V(2);
 
     // Reduce the interval
 
     do {
       V[0] = calculate_golden_section_training_rate(triplet);
-      V[1] = performance_functional_pointer->calculate_performance(
-          training_direction, V[0]);
+      V[1] = calculate_directional_performance(training_direction, V[0]);
 
       // Update points
 
@@ -703,8 +1185,7 @@ TrainingRateAlgorithm::calculate_golden_section_directional_point(
 
     Vector<double> X(2);
     X[0] = initial_training_rate;
-    X[1] = performance_functional_pointer->calculate_performance(
-        training_direction, X[0]);
+    X[1] = calculate_directional_performance(training_direction, X[0]);
 
     if (X[1] > performance) {
       X[0] = 0.0;
@@ -754,8 +1235,7 @@ Vector<double> TrainingRateAlgorithm::calculate_Brent_method_directional_point(
 
       // Calculate performance for V
 
-      V[1] = performance_functional_pointer->calculate_performance(
-          training_direction, V[0]);
+      V[1] = calculate_directional_performance(training_direction, V[0]);
 
       // Update points
 
@@ -819,8 +1299,7 @@ Vector<double> TrainingRateAlgorithm::calculate_Brent_method_directional_point(
 
     Vector<double> X(2);
     X[0] = initial_training_rate;
-    X[1] = performance_functional_pointer->calculate_performance(
-        training_direction, X[0]);
+    X[1] = calculate_directional_performance(training_direction, X[0]);
 
     if (X[1] > performance) {
       X[0] = 0.0;
@@ -831,6 +1310,190 @@ Vector<double> TrainingRateAlgorithm::calculate_Brent_method_directional_point(
   }
 }
 
+// Vector<double> calculate_Wolfe_directional_point(const double&, const
+// Vector<double>&, const Vector<double>&, const double&, Vector<double>&)
+// const method
+
+/// Returns the training rate by searching in a given direction for a point
+/// which satisfies the strong Wolfe conditions, together with the performance
+/// for that training rate.
+/// Each trial point is evaluated with the performance and its gradient in a
+/// single pass, and new trial points are obtained by cubic or quadratic
+/// interpolation of the directional derivatives.
+/// If no such point is found within the maximum number of evaluations, the
+/// best point found is returned.
+/// @param performance Neural network performance value.
+/// @param gradient Neural network performance gradient.
+/// @param training_direction Training direction vector.
+/// @param initial_training_rate Initial training rate in line minimization.
+/// @param directional_gradient Performance gradient for the training rate
+/// found.
+
+Vector<double> TrainingRateAlgorithm::calculate_Wolfe_directional_point(
+    const double& performance, const Vector<double>& gradient,
+    const Vector<double>& training_direction,
+    const double& initial_training_rate,
+    Vector<double>& directional_gradient) const {
+  Vector<double> directional_point(2);
+  directional_point[0] = 0.0;
+  directional_point[1] = performance;
+
+  directional_gradient = gradient;
+
+  const double slope = gradient.dot(training_direction);
+
+  if (training_direction == 0.0 || initial_training_rate == 0.0 ||
+      slope >= 0.0) {
+    return (directional_point);
+  }
+
+  const NeuralNetwork* neural_network_pointer =
+      performance_functional_pointer->get_neural_network_pointer();
+
+  const Vector<double> parameters =
+      neural_network_pointer->arrange_parameters();
+
+  const double sufficient_decrease_slope =
+      sufficient_decrease_parameter * slope;
+  const double curvature_slope = -curvature_parameter * slope;
+
+  // Points are (training rate, performance, directional derivative)
+
+  Vector<double> low(3);
+  low[0] = 0.0;
+  low[1] = performance;
+  low[2] = slope;
+
+  Vector<double> high(3, 0.0);
+  Vector<double> trial(3, 0.0);
+  Vector<double> previous(3, 0.0);
+
+  Vector<double> trial_gradient;
+
+  trial[0] = initial_training_rate;
+
+  unsigned count = 0;
+
+  bool bracketed = false;
+
+  // Bracket an interval which contains acceptable points
+
+  while (!bracketed) {
+    trial[1] = calculate_directional_first_order_performance(
+        parameters, training_direction, trial[0], trial_gradient);
+    trial[2] = trial_gradient.dot(training_direction);
+
+    count++;
+
+    if (trial[1] > performance + sufficient_decrease_slope * trial[0] ||
+        trial[1] >= low[1]) {
+      high = trial;
+
+      bracketed = true;
+    } else if (fabs(trial[2]) <= curvature_slope) {
+      directional_gradient = trial_gradient;
+
+      directional_point[0] = trial[0];
+      directional_point[1] = trial[1];
+
+      return (directional_point);
+    } else if (trial[2] >= 0.0) {
+      high = low;
+      low = trial;
+
+      directional_gradient = trial_gradient;
+
+      bracketed = true;
+    } else {
+      previous = low;
+      low = trial;
+
+      directional_gradient = trial_gradient;
+
+      if (count >= maximum_evaluations_number ||
+          low[0] >= error_training_rate) {
+        directional_point[0] = low[0];
+        directional_point[1] = low[1];
+
+        return (directional_point);
+      }
+
+      // Extrapolate, increasing the training rate at least by the bracketing
+      // factor and at most by four
+
+      try {
+        trial[0] = calculate_cubic_interpolation_training_rate(previous, low);
+      }
+      catch (const std::logic_error&) {
+        trial[0] = 0.0;
+      }
+
+      if (trial[0] > 4.0 * low[0]) {
+        trial[0] = 4.0 * low[0];
+      }
+
+      if (trial[0] < bracketing_factor * low[0]) {
+        trial[0] = bracketing_factor * low[0];
+      }
+    }
+  }
+
+  // Reduce the interval, keeping in low the best point found
+
+  while (count < maximum_evaluations_number &&
+         fabs(high[0] - low[0]) > training_rate_tolerance) {
+    const double margin = 0.1 * fabs(high[0] - low[0]);
+
+    const double minimum_training_rate = std::min(low[0], high[0]) + margin;
+    const double maximum_training_rate = std::max(low[0], high[0]) - margin;
+
+    try {
+      trial[0] = calculate_cubic_interpolation_training_rate(low, high);
+
+      if (trial[0] < minimum_training_rate ||
+          trial[0] > maximum_training_rate) {
+        trial[0] = calculate_quadratic_interpolation_training_rate(low, high);
+      }
+
+      if (trial[0] < minimum_training_rate ||
+          trial[0] > maximum_training_rate) {
+        trial[0] = (low[0] + high[0]) / 2.0;
+      }
+    }
+    catch (const std::logic_error&) {
+      trial[0] = (low[0] + high[0]) / 2.0;
+    }
+
+    trial[1] = calculate_directional_first_order_performance(
+        parameters, training_direction, trial[0], trial_gradient);
+    trial[2] = trial_gradient.dot(training_direction);
+
+    count++;
+
+    if (trial[1] > performance + sufficient_decrease_slope * trial[0] ||
+        trial[1] >= low[1]) {
+      high = trial;
+    } else {
+      if (trial[2] * (high[0] - low[0]) >= 0.0) {
+        high = low;
+      }
+
+      low = trial;
+
+      directional_gradient = trial_gradient;
+
+      if (fabs(trial[2]) <= curvature_slope) {
+        break;
+      }
+    }
+  }
+
+  directional_point[0] = low[0];
+  directional_point[1] = low[1];
+
+  return (directional_point);
+}
+
 // double calculate_golden_section_training_rate(const Triplet&) const method
 
 /// Calculates the golden section point within a minimum interval defined by
@@ -947,6 +1610,82 @@ double TrainingRateAlgorithm::calculate_Brent_method_training_rate(
   return (Brent_method_training_rate);
 }
 
+// double calculate_cubic_interpolation_training_rate(const Vector<double>&,
+// const Vector<double>&) const method
+
+/// Returns the minimal training rate of the cubic which interpolates the
+/// performance and the directional derivative at two points.
+/// Each point is a vector with the training rate, the performance and the
+/// directional derivative.
+/// @param A First directional point.
+/// @param B Second directional point.
+
+double TrainingRateAlgorithm::calculate_cubic_interpolation_training_rate(
+    const Vector<double>& A, const Vector<double>& B) const {
+  const double d1 = A[2] + B[2] - 3.0 * (A[1] - B[1]) / (A[0] - B[0]);
+
+  const double discriminant = d1 * d1 - A[2] * B[2];
+
+  if (A[0] == B[0] || discriminant < 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+           << "double calculate_cubic_interpolation_training_rate(const "
+              "Vector<double>&, const Vector<double>&) const method.\n"
+           << "Cubic does not have a minimum.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  const double d2 = (B[0] > A[0] ? 1.0 : -1.0) * sqrt(discriminant);
+
+  const double denominator = B[2] - A[2] + 2.0 * d2;
+
+  if (denominator == 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+           << "double calculate_cubic_interpolation_training_rate(const "
+              "Vector<double>&, const Vector<double>&) const method.\n"
+           << "Cubic cannot be constructed.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  return (B[0] - (B[0] - A[0]) * (B[2] + d2 - d1) / denominator);
+}
+
+// double calculate_quadratic_interpolation_training_rate(const
+// Vector<double>&, const Vector<double>&) const method
+
+/// Returns the minimal training rate of the parabola which interpolates the
+/// performance and the directional derivative at a first point, and the
+/// performance at a second point.
+/// Each point is a vector with the training rate, the performance and the
+/// directional derivative.
+/// @param A First directional point.
+/// @param B Second directional point.
+
+double TrainingRateAlgorithm::calculate_quadratic_interpolation_training_rate(
+    const Vector<double>& A, const Vector<double>& B) const {
+  const double interval = B[0] - A[0];
+
+  const double curvature = B[1] - A[1] - A[2] * interval;
+
+  if (interval == 0.0 || curvature <= 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+           << "double calculate_quadratic_interpolation_training_rate(const "
+              "Vector<double>&, const Vector<double>&) const method.\n"
+           << "Parabola does not have a minimum but a maximum.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  return (A[0] - A[2] * interval * interval / (2.0 * curvature));
+}
+
 // tinyxml2::XMLDocument* to_XML(void) const method
 
 /// Returns a default string representation in XML-type format of the training
@@ -1026,6 +1765,54 @@ tinyxml2::XMLDocument* TrainingRateAlgorithm::to_XML(void) const {
     element->LinkEndChild(text);
   }
 
+  // Sufficient decrease parameter
+  {
+    element = document->NewElement("SufficientDecreaseParameter");
+    root_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << sufficient_decrease_parameter;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
+  // Curvature parameter
+  {
+    element = document->NewElement("CurvatureParameter");
+    root_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << curvature_parameter;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
+  // Maximum evaluations number
+  {
+    element = document->NewElement("MaximumEvaluationsNumber");
+    root_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << maximum_evaluations_number;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
+  // Evaluation points number
+  {
+    element = document->NewElement("EvaluationPointsNumber");
+    root_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << evaluation_points_number;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
   // Display warnings
   {
     element = document->NewElement("Display");
@@ -1166,6 +1953,75 @@ void TrainingRateAlgorithm::from_XML(const tinyxml2::XMLDocument& document) {
     }
   }
 
+  // Sufficient decrease parameter
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("SufficientDecreaseParameter");
+
+    if (element) {
+      const double new_sufficient_decrease_parameter =
+          atof(element->GetText());
+
+      try {
+        set_sufficient_decrease_parameter(new_sufficient_decrease_parameter);
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
+  // Curvature parameter
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("CurvatureParameter");
+
+    if (element) {
+      const double new_curvature_parameter = atof(element->GetText());
+
+      try {
+        set_curvature_parameter(new_curvature_parameter);
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
+  // Maximum evaluations number
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("MaximumEvaluationsNumber");
+
+    if (element) {
+      const unsigned new_maximum_evaluations_number = atoi(element->GetText());
+
+      try {
+        set_maximum_evaluations_number(new_maximum_evaluations_number);
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
+  // Evaluation points number
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("EvaluationPointsNumber");
+
+    if (element) {
+      const unsigned new_evaluation_points_number = atoi(element->GetText());
+
+      try {
+        set_evaluation_points_number(new_evaluation_points_number);
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
   // Display warnings
   {
     const tinyxml2::XMLElement* element =
@@ -45,7 +45,9 @@ namespace OpenNN {
 
 /// This class is used by many different training algorithms to calculate the
 /// training rate given a training direction.
-/// It implements the golden section method and the Brent's methods.
+/// It implements the golden section method and the Brent's methods, which only
+/// evaluate the performance, and a strong Wolfe line search, which also uses
+/// the performance gradient.
 
 class TrainingRateAlgorithm {
 
@@ -58,7 +60,8 @@ class TrainingRateAlgorithm {
   enum TrainingRateMethod {
     Fixed,
     GoldenSection,
-    BrentMethod
+    BrentMethod,
+    WolfeMethod
   };
 
   // DEFAULT CONSTRUCTOR
@@ -197,6 +200,15 @@ class TrainingRateAlgorithm {
 
   const double& get_error_training_rate(void) const;
 
+  const double& get_sufficient_decrease_parameter(void) const;
+  const double& get_curvature_parameter(void) const;
+
+  const unsigned& get_maximum_evaluations_number(void) const;
+
+  const unsigned& get_evaluation_points_number(void) const;
+
+  const unsigned& get_evaluations_number(void) const;
+
   // Utilities
 
   const bool& get_display(void) const;
@@ -222,6 +234,15 @@ class TrainingRateAlgorithm {
 
   void set_error_training_rate(const double&);
 
+  void set_sufficient_decrease_parameter(const double&);
+  void set_curvature_parameter(const double&);
+
+  void set_maximum_evaluations_number(const unsigned&);
+
+  void set_evaluation_points_number(const unsigned&);
+
+  void reset_evaluations_number(void);
+
   // Utilities
 
   void set_display(const bool&);
@@ -233,8 +254,25 @@ class TrainingRateAlgorithm {
   double calculate_golden_section_training_rate(const Triplet&) const;
   double calculate_Brent_method_training_rate(const Triplet&) const;
 
+  double calculate_cubic_interpolation_training_rate(
+      const Vector<double>&, const Vector<double>&) const;
+  double calculate_quadratic_interpolation_training_rate(
+      const Vector<double>&, const Vector<double>&) const;
+
+  double calculate_directional_performance(const Vector<double>&,
+                                           const double&) const;
+  Vector<double> calculate_directional_performances(
+      const Vector<double>&, const Vector<double>&) const;
+  double calculate_directional_first_order_performance(const Vector<double>&,
+                                                       const Vector<double>&,
+                                                       const double&,
+                                                       Vector<double>&) const;
+
   Triplet calculate_bracketing_triplet(const double&, const Vector<double>&,
                                        const double&) const;
+  Triplet calculate_multipoint_bracketing_triplet(const double&,
+                                                  const Vector<double>&,
+                                                  const double&) const;
 
   Vector<double> calculate_fixed_directional_point(const double&,
                                                    const Vector<double>&,
@@ -244,10 +282,20 @@ class TrainingRateAlgorithm {
   Vector<double> calculate_Brent_method_directional_point(const double&,
                                                           const Vector<double>&,
                                                           const double&) const;
+  Vector<double> calculate_Wolfe_directional_point(const double&,
+                                                   const Vector<double>&,
+                                                   const Vector<double>&,
+                                                   const double&,
+                                                   Vector<double>&) const;
 
   Vector<double> calculate_directional_point(const double&,
                                              const Vector<double>&,
                                              const double&) const;
+  Vector<double> calculate_directional_point(const double&,
+                                             const Vector<double>&,
+                                             const Vector<double>&,
+                                             const double&,
+                                             Vector<double>&) const;
 
   // Serialization methods
 
@@ -285,6 +333,32 @@ class TrainingRateAlgorithm {
 
   double error_training_rate;
 
+  /// Constant of the sufficient decrease condition in the Wolfe line search.
+
+  double sufficient_decrease_parameter;
+
+  /// Constant of the strong curvature condition in the Wolfe line search.
+  /// It must be greater than the sufficient decrease parameter and less than
+  /// one.
+
+  double curvature_parameter;
+
+  /// Maximum number of evaluations of the performance and its gradient in each
+  /// Wolfe line search.
+
+  unsigned maximum_evaluations_number;
+
+  /// Number of training rates which the bracketing and golden section methods
+  /// evaluate together, in a single pass over the data.
+  /// If it is one, the training rates are evaluated one at a time.
+
+  unsigned evaluation_points_number;
+
+  /// Number of performance evaluations made by the line minimization methods
+  /// since the counter was last reset.
+
+  mutable unsigned evaluations_number;
+
   // UTILITIES
 
   /// Display messages to screen.
@@ -38,7 +38,8 @@ TrainingStrategy::TrainingStrategy(void)
       conjugate_gradient_pointer(NULL),
       quasi_Newton_method_pointer(NULL),
       Levenberg_Marquardt_algorithm_pointer(NULL),
-      Newton_method_pointer(NULL) {
+      Newton_method_pointer(NULL),
+      truncated_Newton_method_pointer(NULL) {
   set_initialization_type(NO_INITIALIZATION);
   set_main_type(QUASI_NEWTON_METHOD);
   set_refinement_type(NO_REFINEMENT);
@@ -64,7 +65,8 @@ TrainingStrategy::TrainingStrategy(
       conjugate_gradient_pointer(NULL),
       quasi_Newton_method_pointer(NULL),
       Levenberg_Marquardt_algorithm_pointer(NULL),
-      Newton_method_pointer(NULL) {
+      Newton_method_pointer(NULL),
+      truncated_Newton_method_pointer(NULL) {
   set_initialization_type(NO_INITIALIZATION);
   set_main_type(QUASI_NEWTON_METHOD);
   set_refinement_type(NO_REFINEMENT);
@@ -88,7 +90,8 @@ TrainingStrategy::TrainingStrategy(const tinyxml2::XMLDocument& document)
       conjugate_gradient_pointer(NULL),
       quasi_Newton_method_pointer(NULL),
       Levenberg_Marquardt_algorithm_pointer(NULL),
-      Newton_method_pointer(NULL) {
+      Newton_method_pointer(NULL),
+      truncated_Newton_method_pointer(NULL) {
   set_initialization_type(NO_INITIALIZATION);
   set_main_type(QUASI_NEWTON_METHOD);
   set_refinement_type(NO_REFINEMENT);
@@ -114,7 +117,8 @@ TrainingStrategy::TrainingStrategy(const std::string& file_name)
       conjugate_gradient_pointer(NULL),
       quasi_Newton_method_pointer(NULL),
       Levenberg_Marquardt_algorithm_pointer(NULL),
-      Newton_method_pointer(NULL) {
+      Newton_method_pointer(NULL),
+      truncated_Newton_method_pointer(NULL) {
   set_initialization_type(NO_INITIALIZATION);
   set_main_type(QUASI_NEWTON_METHOD);
   set_refinement_type(NO_REFINEMENT);
@@ -140,6 +144,7 @@ TrainingStrategy::~TrainingStrategy(void) {
   delete Levenberg_Marquardt_algorithm_pointer;
 
   delete Newton_method_pointer;
+  delete truncated_Newton_method_pointer;
 }
 
 // METHODS
@@ -388,6 +393,27 @@ NewtonMethod* TrainingStrategy::get_Newton_method_pointer(void) const {
   return (Newton_method_pointer);
 }
 
+// TruncatedNewtonMethod* get_truncated_Newton_method_pointer(void) const method
+
+/// Returns a pointer to the truncated Newton method refinement algorithm.
+/// It also throws an exception if that pointer is NULL.
+
+TruncatedNewtonMethod* TrainingStrategy::get_truncated_Newton_method_pointer(
+    void) const {
+  if (!truncated_Newton_method_pointer) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingStrategy class.\n"
+           << "TruncatedNewtonMethod* get_truncated_Newton_method_pointer("
+              "void) const method.\n"
+           << "Truncated Newton method pointer is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  return (truncated_Newton_method_pointer);
+}
+
 // const TrainingAlgorithmType& get_initialization_type(void) const method
 
 /// Returns the type of the initialization training algorithm composing this
@@ -481,6 +507,8 @@ std::string TrainingStrategy::write_refinement_type(void) const {
     return ("NO_REFINEMENT");
   } else if (refinement_type == NEWTON_METHOD) {
     return ("NEWTON_METHOD");
+  } else if (refinement_type == TRUNCATED_NEWTON_METHOD) {
+    return ("TRUNCATED_NEWTON_METHOD");
   } else if (refinement_type == USER_REFINEMENT) {
     return ("USER_REFINEMENT");
   } else {
@@ -555,6 +583,8 @@ std::string TrainingStrategy::write_refinement_type_text(void) const {
     return ("none");
   } else if (refinement_type == NEWTON_METHOD) {
     return ("Newton method");
+  } else if (refinement_type == TRUNCATED_NEWTON_METHOD) {
+    return ("truncated Newton method");
   } else if (refinement_type == USER_REFINEMENT) {
     return ("user defined");
   } else {
@@ -576,6 +606,33 @@ std::string TrainingStrategy::write_refinement_type_text(void) const {
 
 const bool& TrainingStrategy::get_display(void) const { return (display); }
 
+// const unsigned& get_threads_number(void) const method
+
+/// Returns the number of threads used by the objective term to evaluate the
+/// performance and its derivatives over the training instances.
+
+const unsigned& TrainingStrategy::get_threads_number(void) const {
+  return (threads_number);
+}
+
+// const bool& get_deterministic_reduction(void) const method
+
+/// Returns true if the objective term sums the contributions of the training
+/// instances in a fixed order, and false otherwise.
+
+const bool& TrainingStrategy::get_deterministic_reduction(void) const {
+  return (deterministic_reduction);
+}
+
+// const bool& get_single_precision(void) const method
+
+/// Returns true if the objective term calculates the training error and
+/// gradient in single precision, and false otherwise.
+
+const bool& TrainingStrategy::get_single_precision(void) const {
+  return (single_precision);
+}
+
 // void set(void) method
 
 /// Sets the performance functional pointer to NULL.
@@ -728,6 +785,11 @@ void TrainingStrategy::set_refinement_type(
       Newton_method_pointer = new NewtonMethod(performance_functional_pointer);
     } break;
 
+    case TRUNCATED_NEWTON_METHOD: {
+      truncated_Newton_method_pointer =
+          new TruncatedNewtonMethod(performance_functional_pointer);
+    } break;
+
     case USER_REFINEMENT: {
       // do nothing
     } break;
@@ -814,6 +876,8 @@ void TrainingStrategy::set_refinement_type(
     set_refinement_type(NO_REFINEMENT);
   } else if (new_refinement_type == "NEWTON_METHOD") {
     set_refinement_type(NEWTON_METHOD);
+  } else if (new_refinement_type == "TRUNCATED_NEWTON_METHOD") {
+    set_refinement_type(TRUNCATED_NEWTON_METHOD);
   } else if (new_refinement_type == "USER_REFINEMENT") {
     set_refinement_type(USER_REFINEMENT);
   } else {
@@ -928,6 +992,11 @@ void TrainingStrategy::set_performance_functional_pointer(
           new_performance_functional_pointer);
     } break;
 
+    case TRUNCATED_NEWTON_METHOD: {
+      truncated_Newton_method_pointer->set_performance_functional_pointer(
+          new_performance_functional_pointer);
+    } break;
+
     case USER_REFINEMENT: {
       // do nothing
     } break;
@@ -959,14 +1028,89 @@ void TrainingStrategy::set_display(const bool& new_display) {
   display = new_display;
 }
 
+// void set_threads_number(const unsigned&) method
+
+/// Sets the number of threads used by the objective term to evaluate the
+/// performance and its derivatives over the training instances.
+/// The value is passed to the performance functional, if any.
+/// @param new_threads_number Number of threads.
+
+void TrainingStrategy::set_threads_number(const unsigned& new_threads_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_threads_number == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingStrategy class.\n"
+           << "void set_threads_number(const unsigned&) method.\n"
+           << "Number of threads must be greater than zero.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  threads_number = new_threads_number;
+
+  if (performance_functional_pointer) {
+    performance_functional_pointer->set_threads_number(threads_number);
+  }
+}
+
+// void set_deterministic_reduction(const bool&) method
+
+/// Sets whether the objective term sums the contributions of the training
+/// instances in a fixed order, so that results do not depend on the number of
+/// threads.
+/// The value is passed to the performance functional, if any.
+/// @param new_deterministic_reduction True for a fixed order reduction, false
+/// otherwise.
+
+void TrainingStrategy::set_deterministic_reduction(
+    const bool& new_deterministic_reduction) {
+  deterministic_reduction = new_deterministic_reduction;
+
+  if (performance_functional_pointer) {
+    performance_functional_pointer->set_deterministic_reduction(
+        deterministic_reduction);
+  }
+}
+
+// void set_single_precision(const bool&) method
+
+/// Sets whether the objective term calculates the training error and gradient
+/// in single precision.
+/// The value is passed to the performance functional, if any.
+/// @param new_single_precision True for single precision, false for double
+/// precision.
+
+void TrainingStrategy::set_single_precision(const bool& new_single_precision) {
+  single_precision = new_single_precision;
+
+  if (performance_functional_pointer) {
+    performance_functional_pointer->set_single_precision(single_precision);
+  }
+}
+
 // void set_default(void) method
 
 /// Sets the members of the training strategy object to their default values:
 /// <ul>
+/// <li> Threads number: 1.
+/// <li> Deterministic reduction: false.
+/// <li> Single precision: false.
 /// <li> Display: true.
 /// </ul>
 
-void TrainingStrategy::set_default(void) { display = true; }
+void TrainingStrategy::set_default(void) {
+  threads_number = 1;
+  deterministic_reduction = false;
+  single_precision = false;
+
+  display = true;
+}
 
 // void destruct_initialization(void) method
 
@@ -1009,8 +1153,10 @@ void TrainingStrategy::destruct_main(void) {
 
 void TrainingStrategy::destruct_refinement(void) {
   delete Newton_method_pointer;
+  delete truncated_Newton_method_pointer;
 
   Newton_method_pointer = NULL;
+  truncated_Newton_method_pointer = NULL;
 
   refinement_type = NO_REFINEMENT;
 }
@@ -1032,6 +1178,13 @@ TrainingStrategy::Results TrainingStrategy::perform_training(void) {
 
 #endif
 
+  // The objective term might have been created after the threads were set
+
+  performance_functional_pointer->set_threads_number(threads_number);
+  performance_functional_pointer->set_deterministic_reduction(
+      deterministic_reduction);
+  performance_functional_pointer->set_single_precision(single_precision);
+
   Results training_strategy_results;
 
   // Initialization
@@ -1121,6 +1274,11 @@ TrainingStrategy::Results TrainingStrategy::perform_training(void) {
           Newton_method_pointer->perform_training();
     } break;
 
+    case TRUNCATED_NEWTON_METHOD: {
+      training_strategy_results.truncated_Newton_method_results_pointer =
+          truncated_Newton_method_pointer->perform_training();
+    } break;
+
     case USER_REFINEMENT: {
       // do nothing
     } break;
@@ -1235,6 +1393,10 @@ std::string TrainingStrategy::to_string(void) const {
       buffer << Newton_method_pointer->to_string();
     } break;
 
+    case TRUNCATED_NEWTON_METHOD: {
+      buffer << truncated_Newton_method_pointer->to_string();
+    } break;
+
     case USER_REFINEMENT: {
       // do nothing
     } break;
@@ -1464,6 +1626,26 @@ tinyxml2::XMLDocument* TrainingStrategy::to_XML(void) const {
       delete Newton_method_document;
     } break;
 
+    case TRUNCATED_NEWTON_METHOD: {
+      tinyxml2::XMLElement* refinement_element =
+          document->NewElement("Refinement");
+      training_strategy_element->LinkEndChild(refinement_element);
+
+      refinement_element->SetAttribute("Type", "TRUNCATED_NEWTON_METHOD");
+
+      const tinyxml2::XMLDocument* truncated_Newton_method_document =
+          truncated_Newton_method_pointer->to_XML();
+
+      const tinyxml2::XMLElement* truncated_Newton_method_element =
+          truncated_Newton_method_document->FirstChildElement(
+              "TruncatedNewtonMethod");
+
+      DeepClone(refinement_element, truncated_Newton_method_element, document,
+                NULL);
+
+      delete truncated_Newton_method_document;
+    } break;
+
     case USER_REFINEMENT: {
       // do nothing
     } break;
@@ -1479,6 +1661,42 @@ tinyxml2::XMLDocument* TrainingStrategy::to_XML(void) const {
     } break;
   }
 
+  // Threads number
+  {
+    element = document->NewElement("ThreadsNumber");
+    training_strategy_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << threads_number;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
+  // Deterministic reduction
+  {
+    element = document->NewElement("DeterministicReduction");
+    training_strategy_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << deterministic_reduction;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
+  // Single precision
+  {
+    element = document->NewElement("SinglePrecision");
+    training_strategy_element->LinkEndChild(element);
+
+    buffer.str("");
+    buffer << single_precision;
+
+    text = document->NewText(buffer.str().c_str());
+    element->LinkEndChild(text);
+  }
+
   // Display
   {
     element = document->NewElement("Display");
@@ -1676,6 +1894,18 @@ void TrainingStrategy::from_XML(const tinyxml2::XMLDocument& document) {
           Newton_method_pointer->from_XML(new_document);
         } break;
 
+        case TRUNCATED_NEWTON_METHOD: {
+          tinyxml2::XMLDocument new_document;
+
+          tinyxml2::XMLElement* element_clone =
+              new_document.NewElement("TruncatedNewtonMethod");
+          new_document.InsertFirstChild(element_clone);
+
+          DeepClone(element_clone, element, &new_document, NULL);
+
+          truncated_Newton_method_pointer->from_XML(new_document);
+        } break;
+
         case USER_REFINEMENT: {
           // do nothing
         } break;
@@ -1693,6 +1923,57 @@ void TrainingStrategy::from_XML(const tinyxml2::XMLDocument& document) {
     }
   }
 
+  // Threads number
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("ThreadsNumber");
+
+    if (element) {
+      const unsigned new_threads_number = atoi(element->GetText());
+
+      try {
+        set_threads_number(new_threads_number);
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
+  // Deterministic reduction
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("DeterministicReduction");
+
+    if (element) {
+      const std::string new_deterministic_reduction = element->GetText();
+
+      try {
+        set_deterministic_reduction(new_deterministic_reduction != "0");
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
+  // Single precision
+  {
+    const tinyxml2::XMLElement* element =
+        root_element->FirstChildElement("SinglePrecision");
+
+    if (element) {
+      const std::string new_single_precision = element->GetText();
+
+      try {
+        set_single_precision(new_single_precision != "0");
+      }
+      catch (const std::logic_error & e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+
   // Display
   {
     const tinyxml2::XMLElement* element =
@@ -1764,6 +2045,8 @@ TrainingStrategy::Results::Results(void) {
   Levenberg_Marquardt_algorithm_results_pointer = NULL;
 
   Newton_method_results_pointer = NULL;
+
+  truncated_Newton_method_results_pointer = NULL;
 }
 
 // Results destructor
@@ -1782,6 +2065,8 @@ TrainingStrategy::Results::~Results(void) {
   delete Levenberg_Marquardt_algorithm_results_pointer;
 
   delete Newton_method_results_pointer;
+
+  delete truncated_Newton_method_results_pointer;
 }
 
 // void Results::save(const std::string&) const method
@@ -1820,6 +2105,10 @@ void TrainingStrategy::Results::save(const std::string& file_name) const {
     file << Newton_method_results_pointer->to_string();
   }
 
+  if (truncated_Newton_method_results_pointer) {
+    file << truncated_Newton_method_results_pointer->to_string();
+  }
+
   file.close();
 }
 }
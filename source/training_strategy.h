@@ -45,6 +45,7 @@
 #include "levenberg_marquardt_algorithm.h"
 
 #include "newton_method.h"
+#include "truncated_newton_method.h"
 
 // TinyXml includes#include
 
@@ -113,6 +114,7 @@ class TrainingStrategy {
   enum RefinementType {
     NO_REFINEMENT,
     NEWTON_METHOD,
+    TRUNCATED_NEWTON_METHOD,
     USER_REFINEMENT
   };
 
@@ -171,6 +173,12 @@ class TrainingStrategy {
     /// algorithm.
 
     NewtonMethod::NewtonMethodResults* Newton_method_results_pointer;
+
+    /// Pointer to a structure with results from the truncated Newton method
+    /// training algorithm.
+
+    TruncatedNewtonMethod::TruncatedNewtonMethodResults*
+        truncated_Newton_method_results_pointer;
   };
 
   // METHODS
@@ -200,6 +208,7 @@ class TrainingStrategy {
       void) const;
 
   NewtonMethod* get_Newton_method_pointer(void) const;
+  TruncatedNewtonMethod* get_truncated_Newton_method_pointer(void) const;
 
   const InitializationType& get_initialization_type(void) const;
   const MainType& get_main_type(void) const;
@@ -213,6 +222,10 @@ class TrainingStrategy {
   std::string write_main_type_text(void) const;
   std::string write_refinement_type_text(void) const;
 
+  const unsigned& get_threads_number(void) const;
+  const bool& get_deterministic_reduction(void) const;
+  const bool& get_single_precision(void) const;
+
   const bool& get_display(void) const;
 
   // Set methods
@@ -231,6 +244,10 @@ class TrainingStrategy {
   void set_main_type(const std::string&);
   void set_refinement_type(const std::string&);
 
+  void set_threads_number(const unsigned&);
+  void set_deterministic_reduction(const bool&);
+  void set_single_precision(const bool&);
+
   void set_display(const bool&);
 
   // Pointer methods
@@ -299,6 +316,11 @@ class TrainingStrategy {
 
   NewtonMethod* Newton_method_pointer;
 
+  /// Pointer to a truncated Newton method object to be used for refinement in
+  /// the training strategy.
+
+  TruncatedNewtonMethod* truncated_Newton_method_pointer;
+
   /// Type of initialization training algorithm.
 
   InitializationType initialization_type;
@@ -311,6 +333,21 @@ class TrainingStrategy {
 
   RefinementType refinement_type;
 
+  /// Number of threads used to evaluate the objective over the training
+  /// instances.
+
+  unsigned threads_number;
+
+  /// True if the objective sums the contributions of the training instances in
+  /// a fixed order, so that results do not depend on the number of threads.
+
+  bool deterministic_reduction;
+
+  /// True if the objective calculates the training error and gradient in
+  /// single precision.
+
+  bool single_precision;
+
   /// Display messages to screen.
 
   bool display;
@@ -0,0 +1,2741 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   T R U N C A T E D   N E W T O N   M E T H O D   C L A S S
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "truncated_newton_method.h"
+
+namespace OpenNN {
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a truncated Newton method training algorithm object not
+/// associated to any performance functional object.
+/// It also initializes the class members to their default values.
+
+TruncatedNewtonMethod::TruncatedNewtonMethod(void) : TrainingAlgorithm() {
+  set_default();
+}
+
+// PERFORMANCE FUNCTIONAL CONSTRUCTOR
+
+/// Performance functional constructor.
+/// It creates a truncated Newton method training algorithm object associated
+/// with a given performance functional object.
+/// It also initializes the class members to their default values.
+/// @param new_performance_functional_pointer Pointer to an external performance
+/// functional object.
+
+TruncatedNewtonMethod::TruncatedNewtonMethod(
+    PerformanceFunctional* new_performance_functional_pointer)
+    : TrainingAlgorithm(new_performance_functional_pointer) {
+  set_default();
+}
+
+// XML CONSTRUCTOR
+
+/// XML Constructor.
+/// Creates a truncated Newton method object, and loads its members from a XML
+/// document.
+/// @param document TinyXML document containing the truncated Newton method
+/// data.
+
+TruncatedNewtonMethod::TruncatedNewtonMethod(
+    const tinyxml2::XMLDocument& document)
+    : TrainingAlgorithm(document) {
+  set_default();
+
+  from_XML(document);
+}
+
+// DESTRUCTOR
+
+/// Destructor.
+/// This destructor does not delete any object.
+
+TruncatedNewtonMethod::~TruncatedNewtonMethod(void) {}
+
+// const double& get_warning_parameters_norm(void) const method
+
+/// Returns the minimum value for the norm of the parameters vector at wich a
+/// warning message is written to the screen.
+
+const double& TruncatedNewtonMethod::get_warning_parameters_norm(void) const {
+  return (warning_parameters_norm);
+}
+
+// const double& get_warning_gradient_norm(void) const method
+
+/// Returns the minimum value for the norm of the gradient vector at wich a
+/// warning message is written to the screen.
+
+const double& TruncatedNewtonMethod::get_warning_gradient_norm(void) const {
+  return (warning_gradient_norm);
+}
+
+// const double& get_trust_region_radius(void) const method
+
+/// Returns the radius of the trust region for the first training iteration.
+
+const double& TruncatedNewtonMethod::get_trust_region_radius(void) const {
+  return (trust_region_radius);
+}
+
+// const double& get_minimum_trust_region_radius(void) const method
+
+/// Returns the smallest trust region radius allowed by the algorithm.
+
+const double& TruncatedNewtonMethod::get_minimum_trust_region_radius(
+    void) const {
+  return (minimum_trust_region_radius);
+}
+
+// const double& get_maximum_trust_region_radius(void) const method
+
+/// Returns the largest trust region radius allowed by the algorithm.
+
+const double& TruncatedNewtonMethod::get_maximum_trust_region_radius(
+    void) const {
+  return (maximum_trust_region_radius);
+}
+
+// const double& get_minimum_reduction_ratio(void) const method
+
+/// Returns the smallest ratio between the actual and the predicted performance
+/// reductions for a step to be accepted.
+
+const double& TruncatedNewtonMethod::get_minimum_reduction_ratio(void) const {
+  return (minimum_reduction_ratio);
+}
+
+// const unsigned& get_maximum_conjugate_gradient_iterations_number(void) const
+// method
+
+/// Returns the maximum number of conjugate gradient iterations for each
+/// training direction.
+
+const unsigned&
+TruncatedNewtonMethod::get_maximum_conjugate_gradient_iterations_number(
+    void) const {
+  return (maximum_conjugate_gradient_iterations_number);
+}
+
+// const PreconditionerType& get_preconditioner_type(void) const method
+
+/// Returns the type of diagonal preconditioner of the conjugate gradient
+/// iterations.
+
+const TruncatedNewtonMethod::PreconditionerType&
+TruncatedNewtonMethod::get_preconditioner_type(void) const {
+  return (preconditioner_type);
+}
+
+// std::string write_preconditioner_type(void) const method
+
+/// Returns a string with the name of the preconditioner type.
+
+std::string TruncatedNewtonMethod::write_preconditioner_type(void) const {
+  switch (preconditioner_type) {
+    case NO_PRECONDITIONER: {
+      return ("NO_PRECONDITIONER");
+    } break;
+
+    case HESSIAN_DIAGONAL_PRECONDITIONER: {
+      return ("HESSIAN_DIAGONAL_PRECONDITIONER");
+    } break;
+
+    case GAUSS_NEWTON_DIAGONAL_PRECONDITIONER: {
+      return ("GAUSS_NEWTON_DIAGONAL_PRECONDITIONER");
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+             << "std::string write_preconditioner_type(void) const method.\n"
+             << "Unknown preconditioner type.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+}
+
+// const unsigned& get_preconditioner_samples_number(void) const method
+
+/// Returns the number of Hessian-vector products used to estimate the Hessian
+/// diagonal preconditioner.
+
+const unsigned& TruncatedNewtonMethod::get_preconditioner_samples_number(
+    void) const {
+  return (preconditioner_samples_number);
+}
+
+// const unsigned& get_preconditioner_seed(void) const method
+
+/// Returns the seed of the random number generator used to estimate the
+/// Hessian diagonal preconditioner.
+
+const unsigned& TruncatedNewtonMethod::get_preconditioner_seed(void) const {
+  return (preconditioner_seed);
+}
+
+// const double& get_minimum_parameters_increment_norm(void) const method
+
+/// Returns the minimum norm of the parameter increment vector used as a
+/// stopping criteria when training.
+
+const double& TruncatedNewtonMethod::get_minimum_parameters_increment_norm(
+    void) const {
+  return (minimum_parameters_increment_norm);
+}
+
+// const double& get_minimum_performance_increase(void) const method
+
+/// Returns the minimum performance improvement during training.
+
+const double& TruncatedNewtonMethod::get_minimum_performance_increase(
+    void) const {
+  return (minimum_performance_increase);
+}
+
+// const double& get_performance_goal(void) const method
+
+/// Returns the goal value for the performance.
+/// This is used as a stopping criterion when training a multilayer perceptron.
+
+const double& TruncatedNewtonMethod::get_performance_goal(void) const {
+  return (performance_goal);
+}
+
+// const double& get_gradient_norm_goal(void) const method
+
+/// Returns the goal value for the norm of the objective function gradient.
+/// This is used as a stopping criterion when training a multilayer perceptron.
+
+const double& TruncatedNewtonMethod::get_gradient_norm_goal(void) const {
+  return (gradient_norm_goal);
+}
+
+// const unsigned& get_maximum_generalization_performance_decreases(void) const
+// method
+
+/// Returns the maximum number of generalization failures during the training
+/// process.
+
+const unsigned&
+TruncatedNewtonMethod::get_maximum_generalization_performance_decreases(
+    void) const {
+  return (maximum_generalization_performance_decreases);
+}
+
+// const unsigned& get_maximum_iterations_number(void) const method
+
+/// Returns the maximum number of iterations for training.
+
+const unsigned& TruncatedNewtonMethod::get_maximum_iterations_number(
+    void) const {
+  return (maximum_iterations_number);
+}
+
+// const double& get_maximum_time(void) const method
+
+/// Returns the maximum training time.
+
+const double& TruncatedNewtonMethod::get_maximum_time(void) const {
+  return (maximum_time);
+}
+
+// const bool& get_reserve_parameters_norm_history(void) const method
+
+/// Returns true if the parameters norm history vector is to be reserved, and
+/// false otherwise.
+
+const bool& TruncatedNewtonMethod::get_reserve_parameters_norm_history(
+    void) const {
+  return (reserve_parameters_norm_history);
+}
+
+// const bool& get_reserve_performance_history(void) const method
+
+/// Returns true if the performance history vector is to be reserved, and false
+/// otherwise.
+
+const bool& TruncatedNewtonMethod::get_reserve_performance_history(void) const {
+  return (reserve_performance_history);
+}
+
+// const bool& get_reserve_generalization_performance_history(void) const method
+
+/// Returns true if the generalization performance history vector is to be
+/// reserved, and false otherwise.
+
+const bool&
+TruncatedNewtonMethod::get_reserve_generalization_performance_history(
+    void) const {
+  return (reserve_generalization_performance_history);
+}
+
+// const bool& get_reserve_gradient_norm_history(void) const method
+
+/// Returns true if the gradient norm history vector is to be reserved, and
+/// false otherwise.
+
+const bool& TruncatedNewtonMethod::get_reserve_gradient_norm_history(
+    void) const {
+  return (reserve_gradient_norm_history);
+}
+
+// const bool& get_reserve_trust_region_radius_history(void) const method
+
+/// Returns true if the trust region radius history vector is to be reserved,
+/// and false otherwise.
+
+const bool& TruncatedNewtonMethod::get_reserve_trust_region_radius_history(
+    void) const {
+  return (reserve_trust_region_radius_history);
+}
+
+// const bool& get_reserve_conjugate_gradient_iterations_history(void) const
+// method
+
+/// Returns true if the conjugate gradient iterations history vector is to be
+/// reserved, and false otherwise.
+
+const bool&
+TruncatedNewtonMethod::get_reserve_conjugate_gradient_iterations_history(
+    void) const {
+  return (reserve_conjugate_gradient_iterations_history);
+}
+
+// const bool& get_reserve_elapsed_time_history(void) const method
+
+/// Returns true if the elapsed time history vector is to be reserved, and false
+/// otherwise.
+
+const bool& TruncatedNewtonMethod::get_reserve_elapsed_time_history(
+    void) const {
+  return (reserve_elapsed_time_history);
+}
+
+// const unsigned& get_display_period(void) const method
+
+/// Returns the number of iterations between the training showing progress.
+
+const unsigned& TruncatedNewtonMethod::get_display_period(void) const {
+  return (display_period);
+}
+
+// void set_default(void) method
+
+/// Sets the following default values for the truncated Newton method:
+/// Training parameters:
+/// <ul>
+/// <li> Trust region radius: 1.0.
+/// <li> Minimum trust region radius: 1.0e-9.
+/// <li> Maximum trust region radius: 1.0e3.
+/// <li> Minimum reduction ratio: 1.0e-3.
+/// <li> Maximum conjugate gradient iterations number: 100.
+/// <li> Preconditioner type: NO_PRECONDITIONER.
+/// </ul>
+/// Stopping criteria:
+/// <ul>
+/// <li> Performance goal: -1.0e99.
+/// <li> Gradient norm goal: 0.0.
+/// <li> Maximum training time: 1000.
+/// <li> Maximum number of iterations: 100.
+/// </ul>
+/// User stuff:
+/// <ul>
+/// <li> Iterations between showing progress: 10.
+/// </ul>
+
+void TruncatedNewtonMethod::set_default(void) {
+  // TRAINING PARAMETERS
+
+  warning_parameters_norm = 1.0e6;
+  warning_gradient_norm = 1.0e6;
+
+  trust_region_radius = 1.0;
+  minimum_trust_region_radius = 1.0e-9;
+  maximum_trust_region_radius = 1.0e3;
+
+  minimum_reduction_ratio = 1.0e-3;
+
+  maximum_conjugate_gradient_iterations_number = 100;
+
+  preconditioner_type = NO_PRECONDITIONER;
+  preconditioner_samples_number = 4;
+  set_preconditioner_seed(1);
+
+  // STOPPING CRITERIA
+
+  minimum_parameters_increment_norm = 0.0;
+
+  minimum_performance_increase = 0.0;
+  performance_goal = -1.0e99;
+  gradient_norm_goal = 0.0;
+  maximum_generalization_performance_decreases = 1000000;
+
+  maximum_iterations_number = 100;
+  maximum_time = 1000.0;
+
+  // TRAINING HISTORY
+
+  reserve_parameters_norm_history = false;
+
+  reserve_performance_history = true;
+  reserve_generalization_performance_history = false;
+  reserve_gradient_norm_history = false;
+
+  reserve_trust_region_radius_history = false;
+  reserve_conjugate_gradient_iterations_history = false;
+  reserve_elapsed_time_history = false;
+
+  // UTILITIES
+
+  display = true;
+  display_period = 10;
+}
+
+// void set_warning_parameters_norm(const double&) method
+
+/// Sets a new value for the parameters vector norm at which a warning message
+/// is written to the screen.
+/// @param new_warning_parameters_norm Warning parameters norm.
+
+void TruncatedNewtonMethod::set_warning_parameters_norm(
+    const double& new_warning_parameters_norm) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_warning_parameters_norm < 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_warning_parameters_norm(const double&) method.\n"
+           << "Warning parameters norm must be equal or greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  warning_parameters_norm = new_warning_parameters_norm;
+}
+
+// void set_warning_gradient_norm(const double&) method
+
+/// Sets a new value for the gradient vector norm at which a warning message is
+/// written to the screen.
+/// @param new_warning_gradient_norm Warning gradient norm.
+
+void TruncatedNewtonMethod::set_warning_gradient_norm(
+    const double& new_warning_gradient_norm) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_warning_gradient_norm < 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_warning_gradient_norm(const double&) method.\n"
+           << "Warning gradient norm must be equal or greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  warning_gradient_norm = new_warning_gradient_norm;
+}
+
+// void set_trust_region_radius(const double&) method
+
+/// Sets a new radius of the trust region for the first training iteration.
+/// @param new_trust_region_radius Trust region radius.
+
+void TruncatedNewtonMethod::set_trust_region_radius(
+    const double& new_trust_region_radius) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_trust_region_radius <= 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_trust_region_radius(const double&) method.\n"
+           << "Trust region radius must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  trust_region_radius = new_trust_region_radius;
+}
+
+// void set_minimum_trust_region_radius(const double&) method
+
+/// Sets a new smallest trust region radius allowed by the algorithm.
+/// Training stops when no step is accepted before the radius falls below it.
+/// @param new_minimum_trust_region_radius Minimum trust region radius.
+
+void TruncatedNewtonMethod::set_minimum_trust_region_radius(
+    const double& new_minimum_trust_region_radius) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_minimum_trust_region_radius <= 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_minimum_trust_region_radius(const double&) method.\n"
+           << "Minimum trust region radius must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  minimum_trust_region_radius = new_minimum_trust_region_radius;
+}
+
+// void set_maximum_trust_region_radius(const double&) method
+
+/// Sets a new largest trust region radius allowed by the algorithm.
+/// @param new_maximum_trust_region_radius Maximum trust region radius.
+
+void TruncatedNewtonMethod::set_maximum_trust_region_radius(
+    const double& new_maximum_trust_region_radius) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_maximum_trust_region_radius <= 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_maximum_trust_region_radius(const double&) method.\n"
+           << "Maximum trust region radius must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  maximum_trust_region_radius = new_maximum_trust_region_radius;
+}
+
+// void set_minimum_reduction_ratio(const double&) method
+
+/// Sets a new smallest ratio between the actual and the predicted performance
+/// reductions for a step to be accepted.
+/// @param new_minimum_reduction_ratio Minimum reduction ratio.
+
+void TruncatedNewtonMethod::set_minimum_reduction_ratio(
+    const double& new_minimum_reduction_ratio) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_minimum_reduction_ratio < 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_minimum_reduction_ratio(const double&) method.\n"
+           << "Minimum reduction ratio must be equal or greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  minimum_reduction_ratio = new_minimum_reduction_ratio;
+}
+
+// void set_maximum_conjugate_gradient_iterations_number(const unsigned&) method
+
+/// Sets a new maximum number of conjugate gradient iterations for each training
+/// direction.
+/// Each conjugate gradient iteration costs one Hessian-vector product.
+/// @param new_maximum_conjugate_gradient_iterations_number Maximum conjugate
+/// gradient iterations number.
+
+void TruncatedNewtonMethod::set_maximum_conjugate_gradient_iterations_number(
+    const unsigned& new_maximum_conjugate_gradient_iterations_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_maximum_conjugate_gradient_iterations_number == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_maximum_conjugate_gradient_iterations_number("
+              "const unsigned&) method.\n"
+           << "Maximum number of conjugate gradient iterations must be greater "
+              "than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  maximum_conjugate_gradient_iterations_number =
+      new_maximum_conjugate_gradient_iterations_number;
+}
+
+// void set_preconditioner_type(const PreconditionerType&) method
+
+/// Sets a new type of diagonal preconditioner for the conjugate gradient
+/// iterations.
+/// @param new_preconditioner_type Preconditioner type.
+
+void TruncatedNewtonMethod::set_preconditioner_type(
+    const PreconditionerType& new_preconditioner_type) {
+  preconditioner_type = new_preconditioner_type;
+}
+
+// void set_preconditioner_type(const std::string&) method
+
+/// Sets a new type of diagonal preconditioner from a string.
+/// The possible values are "NO_PRECONDITIONER",
+/// "HESSIAN_DIAGONAL_PRECONDITIONER" and
+/// "GAUSS_NEWTON_DIAGONAL_PRECONDITIONER".
+/// @param new_preconditioner_type String with the preconditioner type.
+
+void TruncatedNewtonMethod::set_preconditioner_type(
+    const std::string& new_preconditioner_type) {
+  if (new_preconditioner_type == "NO_PRECONDITIONER") {
+    set_preconditioner_type(NO_PRECONDITIONER);
+  } else if (new_preconditioner_type == "HESSIAN_DIAGONAL_PRECONDITIONER") {
+    set_preconditioner_type(HESSIAN_DIAGONAL_PRECONDITIONER);
+  } else if (new_preconditioner_type ==
+             "GAUSS_NEWTON_DIAGONAL_PRECONDITIONER") {
+    set_preconditioner_type(GAUSS_NEWTON_DIAGONAL_PRECONDITIONER);
+  } else {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_preconditioner_type(const std::string&) method.\n"
+           << "Unknown preconditioner type: " << new_preconditioner_type
+           << ".\n";
+
+    throw std::logic_error(buffer.str());
+  }
+}
+
+// void set_preconditioner_samples_number(const unsigned&) method
+
+/// Sets a new number of Hessian-vector products used to estimate the Hessian
+/// diagonal preconditioner.
+/// @param new_preconditioner_samples_number Preconditioner samples number.
+
+void TruncatedNewtonMethod::set_preconditioner_samples_number(
+    const unsigned& new_preconditioner_samples_number) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_preconditioner_samples_number == 0) {
+    std::ostringstream buffer;
+
+    buffer
+        << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+        << "void set_preconditioner_samples_number(const unsigned&) method.\n"
+        << "Number of preconditioner samples must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  preconditioner_samples_number = new_preconditioner_samples_number;
+}
+
+// void set_preconditioner_seed(const unsigned&) method
+
+/// Sets a new seed for the random number generator used to estimate the
+/// Hessian diagonal preconditioner, and restarts the generator from it.
+/// @param new_preconditioner_seed Preconditioner seed.
+
+void TruncatedNewtonMethod::set_preconditioner_seed(
+    const unsigned& new_preconditioner_seed) {
+  preconditioner_seed = new_preconditioner_seed;
+
+  preconditioner_random_state = preconditioner_seed;
+}
+
+// void set_minimum_parameters_increment_norm(const double&) method
+
+/// Sets a new value for the minimum parameters increment norm stopping
+/// criterion.
+/// @param new_minimum_parameters_increment_norm Minimum parameters increment
+/// norm.
+
+void TruncatedNewtonMethod::set_minimum_parameters_increment_norm(
+    const double& new_minimum_parameters_increment_norm) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_minimum_parameters_increment_norm < 0.0) {
+    std::ostringstream buffer;
+
+    buffer
+        << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+        << "void set_minimum_parameters_increment_norm(const double&) method.\n"
+        << "Minimum parameters increment norm must be equal or greater than "
+           "0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  minimum_parameters_increment_norm = new_minimum_parameters_increment_norm;
+}
+
+// void set_minimum_performance_increase(const double&) method
+
+/// Sets a new minimum performance improvement during training.
+/// @param new_minimum_performance_increase Minimum performance increase.
+
+void TruncatedNewtonMethod::set_minimum_performance_increase(
+    const double& new_minimum_performance_increase) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_minimum_performance_increase < 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_minimum_performance_increase(const double&) method.\n"
+           << "Minimum performance improvement must be equal or greater than "
+              "0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  minimum_performance_increase = new_minimum_performance_increase;
+}
+
+// void set_performance_goal(const double&) method
+
+/// Sets a new goal value for the performance.
+/// This is used as a stopping criterion when training a multilayer perceptron.
+/// @param new_performance_goal Performance goal.
+
+void TruncatedNewtonMethod::set_performance_goal(
+    const double& new_performance_goal) {
+  performance_goal = new_performance_goal;
+}
+
+// void set_gradient_norm_goal(const double&) method
+
+/// Sets a new the goal value for the norm of the objective function gradient.
+/// This is used as a stopping criterion when training a multilayer perceptron.
+/// @param new_gradient_norm_goal Gradient norm goal.
+
+void TruncatedNewtonMethod::set_gradient_norm_goal(
+    const double& new_gradient_norm_goal) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_gradient_norm_goal < 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_gradient_norm_goal(const double&) method.\n"
+           << "Gradient norm goal must be equal or greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  gradient_norm_goal = new_gradient_norm_goal;
+}
+
+// void set_maximum_generalization_performance_decreases(const unsigned&) method
+
+/// Sets a new maximum number of generalization failures.
+/// @param new_maximum_generalization_performance_decreases Maximum
+/// generalization performance decreases.
+
+void TruncatedNewtonMethod::set_maximum_generalization_performance_decreases(
+    const unsigned& new_maximum_generalization_performance_decreases) {
+  maximum_generalization_performance_decreases =
+      new_maximum_generalization_performance_decreases;
+}
+
+// void set_maximum_iterations_number(const unsigned&) method
+
+/// Sets a maximum number of iterations for training.
+/// @param new_maximum_iterations_number Maximum iterations number.
+
+void TruncatedNewtonMethod::set_maximum_iterations_number(
+    const unsigned& new_maximum_iterations_number) {
+  maximum_iterations_number = new_maximum_iterations_number;
+}
+
+// void set_maximum_time(const double&) method
+
+/// Sets a new maximum training time.
+/// @param new_maximum_time Maximum time.
+
+void TruncatedNewtonMethod::set_maximum_time(const double& new_maximum_time) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_maximum_time < 0.0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_maximum_time(const double&) method.\n"
+           << "Maximum time must be equal or greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  maximum_time = new_maximum_time;
+}
+
+// void set_reserve_parameters_norm_history(const bool&) method
+
+/// Makes the parameters norm history vector to be reseved or not in memory.
+/// @param new_reserve_parameters_norm_history True if the parameters norm
+/// history vector is to be reserved, false otherwise.
+
+void TruncatedNewtonMethod::set_reserve_parameters_norm_history(
+    const bool& new_reserve_parameters_norm_history) {
+  reserve_parameters_norm_history = new_reserve_parameters_norm_history;
+}
+
+// void set_reserve_performance_history(const bool&) method
+
+/// Makes the performance history vector to be reseved or not in memory.
+/// @param new_reserve_performance_history True if the performance history
+/// vector is to be reserved, false otherwise.
+
+void TruncatedNewtonMethod::set_reserve_performance_history(
+    const bool& new_reserve_performance_history) {
+  reserve_performance_history = new_reserve_performance_history;
+}
+
+// void set_reserve_generalization_performance_history(const bool&) method
+
+/// Makes the generalization performance history vector to be reseved or not in
+/// memory.
+/// @param new_reserve_generalization_performance_history True if the
+/// generalization performance history vector is to be reserved, false
+/// otherwise.
+
+void TruncatedNewtonMethod::set_reserve_generalization_performance_history(
+    const bool& new_reserve_generalization_performance_history) {
+  reserve_generalization_performance_history =
+      new_reserve_generalization_performance_history;
+}
+
+// void set_reserve_gradient_norm_history(const bool&) method
+
+/// Makes the gradient norm history vector to be reseved or not in memory.
+/// @param new_reserve_gradient_norm_history True if the gradient norm history
+/// vector is to be reserved, false otherwise.
+
+void TruncatedNewtonMethod::set_reserve_gradient_norm_history(
+    const bool& new_reserve_gradient_norm_history) {
+  reserve_gradient_norm_history = new_reserve_gradient_norm_history;
+}
+
+// void set_reserve_trust_region_radius_history(const bool&) method
+
+/// Makes the trust region radius history vector to be reseved or not in memory.
+/// @param new_reserve_trust_region_radius_history True if the trust region
+/// radius history vector is to be reserved, false otherwise.
+
+void TruncatedNewtonMethod::set_reserve_trust_region_radius_history(
+    const bool& new_reserve_trust_region_radius_history) {
+  reserve_trust_region_radius_history = new_reserve_trust_region_radius_history;
+}
+
+// void set_reserve_conjugate_gradient_iterations_history(const bool&) method
+
+/// Makes the conjugate gradient iterations history vector to be reseved or not
+/// in memory.
+/// @param new_reserve_conjugate_gradient_iterations_history True if the
+/// conjugate gradient iterations history vector is to be reserved, false
+/// otherwise.
+
+void TruncatedNewtonMethod::set_reserve_conjugate_gradient_iterations_history(
+    const bool& new_reserve_conjugate_gradient_iterations_history) {
+  reserve_conjugate_gradient_iterations_history =
+      new_reserve_conjugate_gradient_iterations_history;
+}
+
+// void set_reserve_elapsed_time_history(const bool&) method
+
+/// Makes the elapsed time history vector to be reseved or not in memory.
+/// @param new_reserve_elapsed_time_history True if the elapsed time history
+/// vector is to be reserved, false otherwise.
+
+void TruncatedNewtonMethod::set_reserve_elapsed_time_history(
+    const bool& new_reserve_elapsed_time_history) {
+  reserve_elapsed_time_history = new_reserve_elapsed_time_history;
+}
+
+// void set_reserve_all_training_history(const bool&) method
+
+/// Makes the training history of all variables to be reseved or not in memory.
+/// @param new_reserve_all_training_history True if the training history of all
+/// variables is to be reserved, false otherwise.
+
+void TruncatedNewtonMethod::set_reserve_all_training_history(
+    const bool& new_reserve_all_training_history) {
+  reserve_parameters_norm_history = new_reserve_all_training_history;
+  reserve_performance_history = new_reserve_all_training_history;
+  reserve_generalization_performance_history = new_reserve_all_training_history;
+  reserve_gradient_norm_history = new_reserve_all_training_history;
+  reserve_trust_region_radius_history = new_reserve_all_training_history;
+  reserve_conjugate_gradient_iterations_history =
+      new_reserve_all_training_history;
+  reserve_elapsed_time_history = new_reserve_all_training_history;
+}
+
+// void set_display_period(const unsigned&) method
+
+/// Sets a new number of iterations between the training showing progress.
+/// @param new_display_period Display period.
+
+void TruncatedNewtonMethod::set_display_period(
+    const unsigned& new_display_period) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (new_display_period == 0) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void set_display_period(const unsigned&) method.\n"
+           << "Display period must be greater than 0.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  display_period = new_display_period;
+}
+
+// void check(void) const method
+
+/// Checks that the truncated Newton method object is ok for training.
+/// In particular, it checks that:
+/// <ul>
+/// <li> The performance functional pointer associated to the training algorithm
+/// is not NULL,
+/// <li> The neural network associated to that performance functional is neither
+/// NULL.
+/// </ul>
+/// If that checkings are not hold, an exception is thrown.
+
+void TruncatedNewtonMethod::check(void) const {
+  std::ostringstream buffer;
+
+  if (!performance_functional_pointer) {
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void check(void) const method.\n"
+           << "Pointer to performance functional is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  const NeuralNetwork* neural_network_pointer =
+      performance_functional_pointer->get_neural_network_pointer();
+
+  if (!neural_network_pointer) {
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void check(void) const method.\n"
+           << "Pointer to neural network is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+}
+
+// double calculate_preconditioner_random_sign(void) const method
+
+/// Returns plus or minus one with equal probability, and advances the random
+/// number generator of the preconditioner.
+/// The generator is a linear congruential one, and the sign is taken from its
+/// most significant bit, which is the one with the longest period.
+
+double TruncatedNewtonMethod::calculate_preconditioner_random_sign(
+    void) const {
+  preconditioner_random_state =
+      1664525u * preconditioner_random_state + 1013904223u;
+
+  return ((preconditioner_random_state & 0x80000000u) ? 1.0 : -1.0);
+}
+
+// Vector<double> calculate_preconditioner(void) const method
+
+/// Returns the diagonal preconditioner of the conjugate gradient iterations at
+/// the current parameters of the neural network.
+/// The Hessian diagonal is estimated from products of the Hessian with random
+/// vectors of plus and minus ones, so that the Hessian is never formed.
+/// These vectors are drawn from the random number generator of the algorithm,
+/// which is restarted from the preconditioner seed at the beginning of each
+/// training.
+/// The Gauss-Newton diagonal is twice the diagonal of the product of the
+/// transposed terms Jacobian and the terms Jacobian, which the performance
+/// functional accumulates over blocks of instances without forming the terms
+/// Jacobian.
+/// Small or negative entries are raised to a fraction of their mean, so that
+/// the preconditioner is always positive definite.
+
+Vector<double> TruncatedNewtonMethod::calculate_preconditioner(void) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  const NeuralNetwork* neural_network_pointer =
+      performance_functional_pointer->get_neural_network_pointer();
+
+  const unsigned parameters_number =
+      neural_network_pointer->count_parameters_number();
+
+  Vector<double> preconditioner(parameters_number, 1.0);
+
+  switch (preconditioner_type) {
+    case NO_PRECONDITIONER: {
+      return (preconditioner);
+    } break;
+
+    case HESSIAN_DIAGONAL_PRECONDITIONER: {
+      preconditioner.initialize(0.0);
+
+      Vector<double> random_vector(parameters_number);
+
+      for (unsigned i = 0; i < preconditioner_samples_number; i++) {
+        for (unsigned j = 0; j < parameters_number; j++) {
+          random_vector[j] = calculate_preconditioner_random_sign();
+        }
+
+        preconditioner +=
+            random_vector *
+            performance_functional_pointer->calculate_vector_dot_Hessian(
+                random_vector);
+      }
+
+      preconditioner /= (double)preconditioner_samples_number;
+    } break;
+
+    case GAUSS_NEWTON_DIAGONAL_PRECONDITIONER: {
+      preconditioner =
+          performance_functional_pointer
+              ->calculate_JacobianT_dot_Jacobian_diagonal() *
+          2.0;
+    } break;
+
+    default: {
+      std::ostringstream buffer;
+
+      buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+             << "Vector<double> calculate_preconditioner(void) const method.\n"
+             << "Unknown preconditioner type.\n";
+
+      throw std::logic_error(buffer.str());
+    } break;
+  }
+
+  preconditioner = preconditioner.calculate_absolute_value();
+
+  const double mean = preconditioner.calculate_mean();
+
+  if (mean <= 0.0) {
+    preconditioner.initialize(1.0);
+
+    return (preconditioner);
+  }
+
+  for (unsigned j = 0; j < parameters_number; j++) {
+    if (preconditioner[j] < 1.0e-3 * mean) {
+      preconditioner[j] = 1.0e-3 * mean;
+    }
+  }
+
+  return (preconditioner);
+}
+
+// unsigned calculate_training_direction(const Vector<double>&, const
+// Vector<double>&, const double&, Vector<double>&, double&) const method
+
+/// Approximately minimizes the quadratic model of the performance inside the
+/// trust region with the preconditioned conjugate gradient method of Steihaug.
+/// The iterations stop when the residual is small enough, when the model has
+/// negative curvature along the search direction or when the step reaches the
+/// boundary of the trust region.
+/// The trust region is measured in the norm induced by the preconditioner.
+/// Returns the number of conjugate gradient iterations, which is the number of
+/// Hessian-vector products.
+/// @param gradient Performance gradient at the current parameters.
+/// @param preconditioner Positive diagonal of the preconditioner.
+/// @param radius Trust region radius.
+/// @param direction Parameters increment which minimizes the model.
+/// @param predicted_reduction Decrease of the performance predicted by the
+/// model for that increment.
+
+unsigned TruncatedNewtonMethod::calculate_training_direction(
+    const Vector<double>& gradient, const Vector<double>& preconditioner,
+    const double& radius, Vector<double>& direction,
+    double& predicted_reduction) const {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+  const unsigned gradient_size = gradient.size();
+
+  if (preconditioner.size() != gradient_size) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "unsigned calculate_training_direction(const Vector<double>&, "
+              "const Vector<double>&, const double&, Vector<double>&, "
+              "double&) const method.\n"
+           << "Size of preconditioner must be equal to size of gradient.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  const unsigned parameters_number = gradient.size();
+
+  direction.set(parameters_number, 0.0);
+
+  Vector<double> Hessian_dot_direction(parameters_number, 0.0);
+
+  Vector<double> residual(gradient);
+  Vector<double> preconditioned_residual = residual / preconditioner;
+
+  Vector<double> search_direction = preconditioned_residual * (-1.0);
+
+  double residual_dot_preconditioned_residual =
+      residual.dot(preconditioned_residual);
+
+  const double gradient_norm = gradient.calculate_norm();
+
+  const double tolerance =
+      std::min(0.5, sqrt(gradient_norm)) * gradient_norm;
+
+  unsigned iterations_number = 0;
+
+  while (iterations_number < maximum_conjugate_gradient_iterations_number &&
+         residual.calculate_norm() > tolerance) {
+    const Vector<double> Hessian_dot_search_direction =
+        performance_functional_pointer->calculate_vector_dot_Hessian(
+            search_direction);
+
+    iterations_number++;
+
+    const double curvature =
+        search_direction.dot(Hessian_dot_search_direction);
+
+    const double step =
+        curvature > 0.0 ? residual_dot_preconditioned_residual / curvature
+                        : 0.0;
+
+    const Vector<double> new_direction = direction + search_direction * step;
+
+    const double new_direction_norm =
+        sqrt((new_direction * new_direction).dot(preconditioner));
+
+    if (curvature <= 0.0 || new_direction_norm >= radius) {
+      // Move along the search direction up to the trust region boundary
+
+      const double a =
+          (search_direction * search_direction).dot(preconditioner);
+      const double b = (direction * search_direction).dot(preconditioner);
+      const double c = (direction * direction).dot(preconditioner) -
+                       radius * radius;
+
+      const double boundary_step = (-b + sqrt(b * b - a * c)) / a;
+
+      direction += search_direction * boundary_step;
+      Hessian_dot_direction += Hessian_dot_search_direction * boundary_step;
+
+      break;
+    }
+
+    direction = new_direction;
+    Hessian_dot_direction += Hessian_dot_search_direction * step;
+
+    residual += Hessian_dot_search_direction * step;
+    preconditioned_residual = residual / preconditioner;
+
+    const double new_residual_dot_preconditioned_residual =
+        residual.dot(preconditioned_residual);
+
+    const double beta = new_residual_dot_preconditioned_residual /
+                        residual_dot_preconditioned_residual;
+
+    search_direction = search_direction * beta - preconditioned_residual;
+
+    residual_dot_preconditioned_residual =
+        new_residual_dot_preconditioned_residual;
+  }
+
+  predicted_reduction = -gradient.dot(direction) -
+                        0.5 * direction.dot(Hessian_dot_direction);
+
+  return (iterations_number);
+}
+
+// void resize_training_history(const unsigned&) method
+
+/// Resizes all the training history variables.
+/// @param new_size Size of training history variables.
+
+void TruncatedNewtonMethod::TruncatedNewtonMethodResults::
+    resize_training_history(const unsigned& new_size) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  if (truncated_Newton_method_pointer == NULL) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethodResults structure.\n"
+           << "void resize_training_history(const unsigned&) method.\n"
+           << "Truncated Newton method pointer is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+#endif
+
+  if (truncated_Newton_method_pointer->get_reserve_parameters_norm_history()) {
+    parameters_norm_history.resize(new_size);
+  }
+
+  if (truncated_Newton_method_pointer->get_reserve_performance_history()) {
+    performance_history.resize(new_size);
+  }
+
+  if (truncated_Newton_method_pointer
+          ->get_reserve_generalization_performance_history()) {
+    generalization_performance_history.resize(new_size);
+  }
+
+  if (truncated_Newton_method_pointer->get_reserve_gradient_norm_history()) {
+    gradient_norm_history.resize(new_size);
+  }
+
+  if (truncated_Newton_method_pointer
+          ->get_reserve_trust_region_radius_history()) {
+    trust_region_radius_history.resize(new_size);
+  }
+
+  if (truncated_Newton_method_pointer
+          ->get_reserve_conjugate_gradient_iterations_history()) {
+    conjugate_gradient_iterations_history.resize(new_size);
+  }
+
+  if (truncated_Newton_method_pointer->get_reserve_elapsed_time_history()) {
+    elapsed_time_history.resize(new_size);
+  }
+}
+
+// std::string to_string(void) const method
+
+/// Returns a string representation of the current truncated Newton method
+/// results structure.
+
+std::string TruncatedNewtonMethod::TruncatedNewtonMethodResults::to_string(
+    void) const {
+  std::ostringstream buffer;
+
+  // Parameters norm history
+
+  if (!parameters_norm_history.empty()) {
+    buffer << "% Parameters norm history:\n" << parameters_norm_history << "\n";
+  }
+
+  // Performance history
+
+  if (!performance_history.empty()) {
+    buffer << "% Performance history:\n" << performance_history << "\n";
+  }
+
+  // Generalization performance history
+
+  if (!generalization_performance_history.empty()) {
+    buffer << "% Generalization performance history:\n"
+           << generalization_performance_history << "\n";
+  }
+
+  // Gradient norm history
+
+  if (!gradient_norm_history.empty()) {
+    buffer << "% Gradient norm history:\n" << gradient_norm_history << "\n";
+  }
+
+  // Trust region radius history
+
+  if (!trust_region_radius_history.empty()) {
+    buffer << "% Trust region radius history:\n"
+           << trust_region_radius_history << "\n";
+  }
+
+  // Conjugate gradient iterations history
+
+  if (!conjugate_gradient_iterations_history.empty()) {
+    buffer << "% Conjugate gradient iterations history:\n"
+           << conjugate_gradient_iterations_history << "\n";
+  }
+
+  // Elapsed time history
+
+  if (!elapsed_time_history.empty()) {
+    buffer << "% Elapsed time history:\n" << elapsed_time_history << "\n";
+  }
+
+  return (buffer.str());
+}
+
+// Matrix<std::string> write_final_results(const unsigned& precision) const
+// method
+
+Matrix<std::string>
+TruncatedNewtonMethod::TruncatedNewtonMethodResults::write_final_results(
+    const unsigned& precision) const {
+  std::ostringstream buffer;
+
+  Vector<std::string> names;
+  Vector<std::string> values;
+
+  // Final parameters norm
+
+  names.push_back("Final parameters norm");
+
+  buffer.str("");
+  buffer << std::setprecision(precision) << final_parameters_norm;
+
+  values.push_back(buffer.str());
+
+  // Final performance
+
+  names.push_back("Final performance");
+
+  buffer.str("");
+  buffer << std::setprecision(precision) << final_performance;
+
+  values.push_back(buffer.str());
+
+  // Final generalization performance
+
+  const PerformanceFunctional* performance_functional_pointer =
+      truncated_Newton_method_pointer->get_performance_functional_pointer();
+
+  if (performance_functional_pointer->has_generalization()) {
+    names.push_back("Final generalization performance");
+
+    buffer.str("");
+    buffer << std::setprecision(precision) << final_generalization_performance;
+
+    values.push_back(buffer.str());
+  }
+
+  // Final gradient norm
+
+  names.push_back("Final gradient norm");
+
+  buffer.str("");
+  buffer << std::setprecision(precision) << final_gradient_norm;
+
+  values.push_back(buffer.str());
+
+  // Final trust region radius
+
+  names.push_back("Final trust region radius");
+
+  buffer.str("");
+  buffer << std::setprecision(precision) << final_trust_region_radius;
+
+  values.push_back(buffer.str());
+
+  // Iterations number
+
+  names.push_back("Iterations number");
+
+  buffer.str("");
+  buffer << iterations_number;
+
+  values.push_back(buffer.str());
+
+  // Elapsed time
+
+  names.push_back("Elapsed time");
+
+  buffer.str("");
+  buffer << elapsed_time;
+
+  values.push_back(buffer.str());
+
+  const unsigned rows_number = names.size();
+  const unsigned columns_number = 2;
+
+  Matrix<std::string> final_results(rows_number, columns_number);
+
+  final_results.set_column(0, names);
+  final_results.set_column(1, values);
+
+  return (final_results);
+}
+
+// TruncatedNewtonMethodResults* perform_training(void) method
+
+/// Trains a neural network with an associated performance functional according
+/// to the truncated Newton method.
+/// Each iteration computes a training direction with the Steihaug conjugate
+/// gradient method, and accepts it when the actual performance reduction is a
+/// large enough fraction of the predicted one.
+/// The trust region radius is then adapted from that ratio, starting from the
+/// configured radius on every call, which is not modified.
+/// Training occurs according to the training parameters.
+
+TruncatedNewtonMethod::TruncatedNewtonMethodResults*
+TruncatedNewtonMethod::perform_training(void) {
+// Control sentence (if debug)
+
+#ifndef NDEBUG
+
+  check();
+
+#endif
+
+  // Start training
+
+  if (display) {
+    std::cout << "Training with truncated Newton method...\n";
+  }
+
+  TruncatedNewtonMethodResults* results_pointer =
+      new TruncatedNewtonMethodResults(this);
+
+  preconditioner_random_state = preconditioner_seed;
+
+  double current_trust_region_radius = trust_region_radius;
+
+  results_pointer->resize_training_history(1 + maximum_iterations_number);
+
+  // Neural network stuff
+
+  NeuralNetwork* neural_network_pointer =
+      performance_functional_pointer->get_neural_network_pointer();
+
+  const unsigned parameters_number =
+      neural_network_pointer->count_parameters_number();
+
+  Vector<double> parameters = neural_network_pointer->arrange_parameters();
+
+  double parameters_norm;
+
+  // Performance functional stuff
+
+  double performance = 0.0;
+  double old_performance = 0.0;
+  double performance_increase = 0.0;
+
+  double generalization_performance = 0.0;
+  double old_generalization_performance = 0.0;
+
+  unsigned generalization_failures = 0;
+
+  Vector<double> gradient(parameters_number);
+
+  double gradient_norm;
+
+  Vector<double> preconditioner(parameters_number);
+
+  // Training algorithm stuff
+
+  Vector<double> parameters_increment(parameters_number);
+  double parameters_increment_norm;
+
+  double predicted_reduction;
+  double reduction_ratio;
+
+  unsigned conjugate_gradient_iterations_number;
+
+  bool stop_training = false;
+
+  time_t beginning_time, current_time;
+  time(&beginning_time);
+  double elapsed_time;
+
+  // Main loop
+
+  for (unsigned iteration = 0; iteration <= maximum_iterations_number;
+       iteration++) {
+    // Neural network
+
+    parameters_norm = parameters.calculate_norm();
+
+    if (display && parameters_norm >= warning_parameters_norm) {
+      std::cout << "OpenNN Warning: Parameters norm is " << parameters_norm
+                << "." << std::endl;
+    }
+
+    // Performance functional
+
+    const PerformanceFunctional::FirstOrderperformance first_order_performance =
+        performance_functional_pointer->calculate_first_order_performance();
+
+    performance = first_order_performance.performance;
+    gradient = first_order_performance.gradient;
+
+    gradient_norm = gradient.calculate_norm();
+
+    if (display && gradient_norm >= warning_gradient_norm) {
+      std::cout << "OpenNN Warning: Gradient norm is " << gradient_norm << "."
+                << std::endl;
+    }
+
+    preconditioner = calculate_preconditioner();
+
+    // Training algorithm
+
+    conjugate_gradient_iterations_number = 0;
+
+    do {
+      conjugate_gradient_iterations_number += calculate_training_direction(
+          gradient, preconditioner, current_trust_region_radius,
+          parameters_increment, predicted_reduction);
+
+      const double new_performance =
+          performance_functional_pointer->calculate_performance(
+              parameters + parameters_increment);
+
+      const double parameters_increment_preconditioned_norm = sqrt(
+          (parameters_increment * parameters_increment).dot(preconditioner));
+
+      if (predicted_reduction > 0.0) {
+        reduction_ratio = (performance - new_performance) / predicted_reduction;
+      } else {
+        reduction_ratio = 0.0;
+      }
+
+      if (reduction_ratio < 0.25) {
+        current_trust_region_radius =
+            std::max(minimum_trust_region_radius,
+                     0.25 * parameters_increment_preconditioned_norm);
+      } else if (reduction_ratio > 0.75 &&
+                 parameters_increment_preconditioned_norm >=
+                     0.99 * current_trust_region_radius) {
+        current_trust_region_radius = std::min(
+            maximum_trust_region_radius, 2.0 * current_trust_region_radius);
+      }
+
+      if (reduction_ratio > minimum_reduction_ratio) {
+        parameters += parameters_increment;
+
+        performance = new_performance;
+
+        break;
+      }
+
+      parameters_increment.initialize(0.0);
+    } while (current_trust_region_radius > minimum_trust_region_radius);
+
+    parameters_increment_norm = parameters_increment.calculate_norm();
+
+    if (iteration == 0) {
+      performance_increase = 0.0;
+    } else {
+      performance_increase = old_performance - performance;
+    }
+
+    generalization_performance =
+        performance_functional_pointer->calculate_generalization_performance();
+
+    if (iteration != 0 &&
+        generalization_performance > old_generalization_performance) {
+      generalization_failures++;
+    }
+
+    // Elapsed time
+
+    time(&current_time);
+    elapsed_time = difftime(current_time, beginning_time);
+
+    // Training history neural network
+
+    if (reserve_parameters_norm_history) {
+      results_pointer->parameters_norm_history[iteration] = parameters_norm;
+    }
+
+    // Training history performance functional
+
+    if (reserve_performance_history) {
+      results_pointer->performance_history[iteration] = performance;
+    }
+
+    if (reserve_generalization_performance_history) {
+      results_pointer->generalization_performance_history[iteration] =
+          generalization_performance;
+    }
+
+    if (reserve_gradient_norm_history) {
+      results_pointer->gradient_norm_history[iteration] = gradient_norm;
+    }
+
+    // Training history training algorithm
+
+    if (reserve_trust_region_radius_history) {
+      results_pointer->trust_region_radius_history[iteration] =
+          current_trust_region_radius;
+    }
+
+    if (reserve_conjugate_gradient_iterations_history) {
+      results_pointer->conjugate_gradient_iterations_history[iteration] =
+          conjugate_gradient_iterations_number;
+    }
+
+    if (reserve_elapsed_time_history) {
+      results_pointer->elapsed_time_history[iteration] = elapsed_time;
+    }
+
+    // Stopping Criteria
+
+    if (parameters_increment_norm <= minimum_parameters_increment_norm) {
+      if (display) {
+        std::cout << "Iteration " << iteration
+                  << ": Minimum parameters increment norm reached.\n"
+                  << "Parameters increment norm: " << parameters_increment_norm
+                  << std::endl;
+      }
+
+      stop_training = true;
+    } else if (performance <= performance_goal) {
+      if (display) {
+        std::cout << "Iteration " << iteration
+                  << ": Performance goal reached.\n";
+      }
+
+      stop_training = true;
+    } else if (iteration != 0 &&
+               performance_increase <= minimum_performance_increase) {
+      if (display) {
+        std::cout
+            << "Iteration " << iteration << ": Minimum performance increase ("
+            << minimum_performance_increase << ") reached.\n"
+            << "Performance increase: " << performance_increase << std::endl;
+      }
+
+      stop_training = true;
+    } else if (gradient_norm <= gradient_norm_goal) {
+      if (display) {
+        std::cout << "Iteration " << iteration
+                  << ": Gradient norm goal reached." << std::endl;
+      }
+
+      stop_training = true;
+    } else if (generalization_failures >=
+               maximum_generalization_performance_decreases) {
+      if (display) {
+        std::cout << "Iteration " << iteration
+                  << ": Maximum generalization performance decreases reached.\n"
+                  << "Generalization performance decreases: "
+                  << generalization_failures << std::endl;
+      }
+
+      stop_training = true;
+    } else if (iteration == maximum_iterations_number) {
+      if (display) {
+        std::cout << "Iteration " << iteration
+                  << ": Maximum number of iterations reached." << std::endl;
+      }
+
+      stop_training = true;
+    } else if (elapsed_time >= maximum_time) {
+      if (display) {
+        std::cout << "Iteration " << iteration
+                  << ": Maximum training time reached." << std::endl;
+      }
+
+      stop_training = true;
+    }
+
+    if (stop_training) {
+      if (display) {
+        std::cout << "Parameters norm: " << parameters_norm << "\n"
+                  << "Performance: " << performance << "\n"
+                  << "Gradient norm: " << gradient_norm << "\n"
+                  << performance_functional_pointer->write_information()
+                  << "Trust region radius: " << current_trust_region_radius
+                  << "\n"
+                  << "Conjugate gradient iterations: "
+                  << conjugate_gradient_iterations_number << "\n"
+                  << "Elapsed time: " << elapsed_time << std::endl;
+
+        if (generalization_performance != 0) {
+          std::cout << "Generalization performance: "
+                    << generalization_performance << std::endl;
+        }
+      }
+
+      neural_network_pointer->set_parameters(parameters);
+
+      results_pointer->resize_training_history(1 + iteration);
+
+      results_pointer->final_parameters = parameters;
+      results_pointer->final_parameters_norm = parameters_norm;
+
+      results_pointer->final_performance = performance;
+      results_pointer->final_generalization_performance =
+          generalization_performance;
+
+      results_pointer->final_gradient = gradient;
+      results_pointer->final_gradient_norm = gradient_norm;
+
+      results_pointer->final_trust_region_radius =
+          current_trust_region_radius;
+
+      results_pointer->elapsed_time = elapsed_time;
+
+      results_pointer->iterations_number = iteration;
+
+      break;
+    } else if (display && iteration % display_period == 0) {
+      std::cout << "Iteration " << iteration << ";\n"
+                << "Parameters norm: " << parameters_norm << "\n"
+                << "Performance: " << performance << "\n"
+                << "Gradient norm: " << gradient_norm << "\n"
+                << performance_functional_pointer->write_information()
+                << "Trust region radius: " << current_trust_region_radius
+                << "\n"
+                << "Conjugate gradient iterations: "
+                << conjugate_gradient_iterations_number << "\n"
+                << "Elapsed time: " << elapsed_time << std::endl;
+
+      if (generalization_performance != 0) {
+        std::cout << "Generalization performance: "
+                  << generalization_performance << std::endl;
+      }
+    }
+
+    // Update stuff
+
+    old_performance = performance;
+    old_generalization_performance = generalization_performance;
+
+    // Set new parameters
+
+    neural_network_pointer->set_parameters(parameters);
+  }
+
+  return (results_pointer);
+}
+
+// std::string write_training_algorithm_type(void) const method
+
+std::string TruncatedNewtonMethod::write_training_algorithm_type(void) const {
+  return ("TRUNCATED_NEWTON_METHOD");
+}
+
+// Matrix<std::string> to_string_matrix(void) const method
+
+/// Returns a default string representation in XML-type format of the
+/// truncated Newton method object, with the most representative members.
+
+Matrix<std::string> TruncatedNewtonMethod::to_string_matrix(void) const {
+  std::ostringstream buffer;
+
+  Vector<std::string> labels;
+  Vector<std::string> values;
+
+  // Trust region radius
+
+  labels.push_back("Trust region radius");
+
+  buffer.str("");
+  buffer << trust_region_radius;
+
+  values.push_back(buffer.str());
+
+  // Maximum conjugate gradient iterations number
+
+  labels.push_back("Maximum conjugate gradient iterations number");
+
+  buffer.str("");
+  buffer << maximum_conjugate_gradient_iterations_number;
+
+  values.push_back(buffer.str());
+
+  // Preconditioner type
+
+  labels.push_back("Preconditioner type");
+
+  buffer.str("");
+  buffer << write_preconditioner_type();
+
+  values.push_back(buffer.str());
+
+  // Minimum parameters increment norm
+
+  labels.push_back("Minimum parameters increment norm");
+
+  buffer.str("");
+  buffer << minimum_parameters_increment_norm;
+
+  values.push_back(buffer.str());
+
+  // Minimum performance increase
+
+  labels.push_back("Minimum performance increase");
+
+  buffer.str("");
+  buffer << minimum_performance_increase;
+
+  values.push_back(buffer.str());
+
+  // Performance goal
+
+  labels.push_back("Performance goal");
+
+  buffer.str("");
+  buffer << performance_goal;
+
+  values.push_back(buffer.str());
+
+  // Gradient norm goal
+
+  labels.push_back("Gradient norm goal");
+
+  buffer.str("");
+  buffer << gradient_norm_goal;
+
+  values.push_back(buffer.str());
+
+  // Maximum generalization failures
+
+  labels.push_back("Maximum generalization failures");
+
+  buffer.str("");
+  buffer << maximum_generalization_performance_decreases;
+
+  values.push_back(buffer.str());
+
+  // Maximum iterations number
+
+  labels.push_back("Maximum iterations number");
+
+  buffer.str("");
+  buffer << maximum_iterations_number;
+
+  values.push_back(buffer.str());
+
+  // Maximum time
+
+  labels.push_back("Maximum time");
+
+  buffer.str("");
+  buffer << maximum_time;
+
+  values.push_back(buffer.str());
+
+  // Reserve parameters norm history
+
+  labels.push_back("Reserve parameters norm history");
+
+  buffer.str("");
+  buffer << reserve_parameters_norm_history;
+
+  values.push_back(buffer.str());
+
+  // Reserve performance history
+
+  labels.push_back("Reserve performance history");
+
+  buffer.str("");
+  buffer << reserve_performance_history;
+
+  values.push_back(buffer.str());
+
+  // Reserve generalization performance history
+
+  labels.push_back("Reserve generalization performance history");
+
+  buffer.str("");
+  buffer << reserve_generalization_performance_history;
+
+  values.push_back(buffer.str());
+
+  // Reserve gradient norm history
+
+  labels.push_back("Reserve gradient norm history");
+
+  buffer.str("");
+  buffer << reserve_gradient_norm_history;
+
+  values.push_back(buffer.str());
+
+  // Reserve elapsed time history
+
+  labels.push_back("Reserve elapsed time history");
+
+  buffer.str("");
+  buffer << reserve_elapsed_time_history;
+
+  values.push_back(buffer.str());
+
+  const unsigned rows_number = labels.size();
+  const unsigned columns_number = 2;
+
+  Matrix<std::string> string_matrix(rows_number, columns_number);
+
+  string_matrix.set_column(0, labels);
+  string_matrix.set_column(1, values);
+
+  return (string_matrix);
+}
+
+// tinyxml2::XMLDocument* to_XML(void) const method
+
+/// Serializes the truncated Newton method object into a XML document of the
+/// TinyXML library.
+/// See the OpenNN manual for more information about the format of this
+/// element.
+
+tinyxml2::XMLDocument* TruncatedNewtonMethod::to_XML(void) const {
+  std::ostringstream buffer;
+
+  tinyxml2::XMLDocument* document = new tinyxml2::XMLDocument;
+
+  // Training algorithm
+
+  tinyxml2::XMLElement* root_element =
+      document->NewElement("TruncatedNewtonMethod");
+  document->InsertFirstChild(root_element);
+
+  tinyxml2::XMLElement* element = NULL;
+  tinyxml2::XMLText* text = NULL;
+
+  // Warning parameters norm
+
+  element = document->NewElement("WarningParametersNorm");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << warning_parameters_norm;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Warning gradient norm
+
+  element = document->NewElement("WarningGradientNorm");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << warning_gradient_norm;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Trust region radius
+
+  element = document->NewElement("TrustRegionRadius");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << trust_region_radius;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Minimum trust region radius
+
+  element = document->NewElement("MinimumTrustRegionRadius");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << minimum_trust_region_radius;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Maximum trust region radius
+
+  element = document->NewElement("MaximumTrustRegionRadius");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << maximum_trust_region_radius;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Minimum reduction ratio
+
+  element = document->NewElement("MinimumReductionRatio");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << minimum_reduction_ratio;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Maximum conjugate gradient iterations number
+
+  element = document->NewElement("MaximumConjugateGradientIterationsNumber");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << maximum_conjugate_gradient_iterations_number;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Preconditioner type
+
+  element = document->NewElement("PreconditionerType");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << write_preconditioner_type();
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Preconditioner samples number
+
+  element = document->NewElement("PreconditionerSamplesNumber");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << preconditioner_samples_number;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Preconditioner seed
+
+  element = document->NewElement("PreconditionerSeed");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << preconditioner_seed;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Minimum parameters increment norm
+
+  element = document->NewElement("MinimumParametersIncrementNorm");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << minimum_parameters_increment_norm;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Minimum performance increase
+
+  element = document->NewElement("MinimumPerformanceIncrease");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << minimum_performance_increase;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Performance goal
+
+  element = document->NewElement("PerformanceGoal");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << performance_goal;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Gradient norm goal
+
+  element = document->NewElement("GradientNormGoal");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << gradient_norm_goal;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Maximum generalization failures
+
+  element = document->NewElement("MaximumGeneralizationPerformanceDecreases");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << maximum_generalization_performance_decreases;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Maximum iterations number
+
+  element = document->NewElement("MaximumIterationsNumber");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << maximum_iterations_number;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Maximum time
+
+  element = document->NewElement("MaximumTime");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << maximum_time;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Reserve parameters norm history
+
+  element = document->NewElement("ReserveParametersNormHistory");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << reserve_parameters_norm_history;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Reserve performance history
+
+  element = document->NewElement("ReservePerformanceHistory");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << reserve_performance_history;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Reserve generalization performance history
+
+  element = document->NewElement("ReserveGeneralizationPerformanceHistory");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << reserve_generalization_performance_history;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Reserve gradient norm history
+
+  element = document->NewElement("ReserveGradientNormHistory");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << reserve_gradient_norm_history;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Reserve trust region radius history
+
+  element = document->NewElement("ReserveTrustRegionRadiusHistory");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << reserve_trust_region_radius_history;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Reserve conjugate gradient iterations history
+
+  element = document->NewElement("ReserveConjugateGradientIterationsHistory");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << reserve_conjugate_gradient_iterations_history;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Reserve elapsed time history
+
+  element = document->NewElement("ReserveElapsedTimeHistory");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << reserve_elapsed_time_history;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Display period
+
+  element = document->NewElement("DisplayPeriod");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << display_period;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  // Display
+
+  element = document->NewElement("Display");
+  root_element->LinkEndChild(element);
+
+  buffer.str("");
+  buffer << display;
+
+  text = document->NewText(buffer.str().c_str());
+  element->LinkEndChild(text);
+
+  return (document);
+}
+
+// void from_XML(const tinyxml2::XMLDocument&) method
+
+/// Loads a truncated Newton method object from a XML document.
+/// Please mind about the format, wich is specified in the OpenNN manual.
+/// @param document TinyXML document containint the object data.
+
+void TruncatedNewtonMethod::from_XML(const tinyxml2::XMLDocument& document) {
+  const tinyxml2::XMLElement* root_element =
+      document.FirstChildElement("TruncatedNewtonMethod");
+
+  if (!root_element) {
+    std::ostringstream buffer;
+
+    buffer << "OpenNN Exception: TruncatedNewtonMethod class.\n"
+           << "void from_XML(const tinyxml2::XMLDocument&) method.\n"
+           << "Truncated Newton method element is NULL.\n";
+
+    throw std::logic_error(buffer.str());
+  }
+
+  // Warning parameters norm
+
+  const tinyxml2::XMLElement* warning_parameters_norm_element =
+      root_element->FirstChildElement("WarningParametersNorm");
+
+  if (warning_parameters_norm_element) {
+    const double new_warning_parameters_norm =
+        atof(warning_parameters_norm_element->GetText());
+
+    try {
+      set_warning_parameters_norm(new_warning_parameters_norm);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Warning gradient norm
+
+  const tinyxml2::XMLElement* warning_gradient_norm_element =
+      root_element->FirstChildElement("WarningGradientNorm");
+
+  if (warning_gradient_norm_element) {
+    const double new_warning_gradient_norm =
+        atof(warning_gradient_norm_element->GetText());
+
+    try {
+      set_warning_gradient_norm(new_warning_gradient_norm);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Trust region radius
+
+  const tinyxml2::XMLElement* trust_region_radius_element =
+      root_element->FirstChildElement("TrustRegionRadius");
+
+  if (trust_region_radius_element) {
+    const double new_trust_region_radius =
+        atof(trust_region_radius_element->GetText());
+
+    try {
+      set_trust_region_radius(new_trust_region_radius);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Minimum trust region radius
+
+  const tinyxml2::XMLElement* minimum_trust_region_radius_element =
+      root_element->FirstChildElement("MinimumTrustRegionRadius");
+
+  if (minimum_trust_region_radius_element) {
+    const double new_minimum_trust_region_radius =
+        atof(minimum_trust_region_radius_element->GetText());
+
+    try {
+      set_minimum_trust_region_radius(new_minimum_trust_region_radius);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Maximum trust region radius
+
+  const tinyxml2::XMLElement* maximum_trust_region_radius_element =
+      root_element->FirstChildElement("MaximumTrustRegionRadius");
+
+  if (maximum_trust_region_radius_element) {
+    const double new_maximum_trust_region_radius =
+        atof(maximum_trust_region_radius_element->GetText());
+
+    try {
+      set_maximum_trust_region_radius(new_maximum_trust_region_radius);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Minimum reduction ratio
+
+  const tinyxml2::XMLElement* minimum_reduction_ratio_element =
+      root_element->FirstChildElement("MinimumReductionRatio");
+
+  if (minimum_reduction_ratio_element) {
+    const double new_minimum_reduction_ratio =
+        atof(minimum_reduction_ratio_element->GetText());
+
+    try {
+      set_minimum_reduction_ratio(new_minimum_reduction_ratio);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Maximum conjugate gradient iterations number
+
+  const tinyxml2::XMLElement*
+      maximum_conjugate_gradient_iterations_number_element =
+          root_element->FirstChildElement(
+              "MaximumConjugateGradientIterationsNumber");
+
+  if (maximum_conjugate_gradient_iterations_number_element) {
+    const unsigned new_maximum_conjugate_gradient_iterations_number =
+        atoi(maximum_conjugate_gradient_iterations_number_element->GetText());
+
+    try {
+      set_maximum_conjugate_gradient_iterations_number(
+          new_maximum_conjugate_gradient_iterations_number);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Preconditioner type
+
+  const tinyxml2::XMLElement* preconditioner_type_element =
+      root_element->FirstChildElement("PreconditionerType");
+
+  if (preconditioner_type_element) {
+    const std::string new_preconditioner_type =
+        preconditioner_type_element->GetText();
+
+    try {
+      set_preconditioner_type(new_preconditioner_type);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Preconditioner samples number
+
+  const tinyxml2::XMLElement* preconditioner_samples_number_element =
+      root_element->FirstChildElement("PreconditionerSamplesNumber");
+
+  if (preconditioner_samples_number_element) {
+    const unsigned new_preconditioner_samples_number =
+        atoi(preconditioner_samples_number_element->GetText());
+
+    try {
+      set_preconditioner_samples_number(new_preconditioner_samples_number);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Preconditioner seed
+
+  const tinyxml2::XMLElement* preconditioner_seed_element =
+      root_element->FirstChildElement("PreconditionerSeed");
+
+  if (preconditioner_seed_element) {
+    const unsigned new_preconditioner_seed =
+        atoi(preconditioner_seed_element->GetText());
+
+    try {
+      set_preconditioner_seed(new_preconditioner_seed);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Minimum parameters increment norm
+
+  const tinyxml2::XMLElement* minimum_parameters_increment_norm_element =
+      root_element->FirstChildElement("MinimumParametersIncrementNorm");
+
+  if (minimum_parameters_increment_norm_element) {
+    const double new_minimum_parameters_increment_norm =
+        atof(minimum_parameters_increment_norm_element->GetText());
+
+    try {
+      set_minimum_parameters_increment_norm(
+          new_minimum_parameters_increment_norm);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Minimum performance increase
+
+  const tinyxml2::XMLElement* minimum_performance_increase_element =
+      root_element->FirstChildElement("MinimumPerformanceIncrease");
+
+  if (minimum_performance_increase_element) {
+    const double new_minimum_performance_increase =
+        atof(minimum_performance_increase_element->GetText());
+
+    try {
+      set_minimum_performance_increase(new_minimum_performance_increase);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Performance goal
+
+  const tinyxml2::XMLElement* performance_goal_element =
+      root_element->FirstChildElement("PerformanceGoal");
+
+  if (performance_goal_element) {
+    const double new_performance_goal =
+        atof(performance_goal_element->GetText());
+
+    try {
+      set_performance_goal(new_performance_goal);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Gradient norm goal
+
+  const tinyxml2::XMLElement* gradient_norm_goal_element =
+      root_element->FirstChildElement("GradientNormGoal");
+
+  if (gradient_norm_goal_element) {
+    const double new_gradient_norm_goal =
+        atof(gradient_norm_goal_element->GetText());
+
+    try {
+      set_gradient_norm_goal(new_gradient_norm_goal);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Maximum generalization failures
+
+  const tinyxml2::XMLElement*
+      maximum_generalization_performance_decreases_element =
+          root_element->FirstChildElement(
+              "MaximumGeneralizationPerformanceDecreases");
+
+  if (maximum_generalization_performance_decreases_element) {
+    const unsigned new_maximum_generalization_performance_decreases =
+        atoi(maximum_generalization_performance_decreases_element->GetText());
+
+    try {
+      set_maximum_generalization_performance_decreases(
+          new_maximum_generalization_performance_decreases);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Maximum iterations number
+
+  const tinyxml2::XMLElement* maximum_iterations_number_element =
+      root_element->FirstChildElement("MaximumIterationsNumber");
+
+  if (maximum_iterations_number_element) {
+    const unsigned new_maximum_iterations_number =
+        atoi(maximum_iterations_number_element->GetText());
+
+    try {
+      set_maximum_iterations_number(new_maximum_iterations_number);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Maximum time
+
+  const tinyxml2::XMLElement* maximum_time_element =
+      root_element->FirstChildElement("MaximumTime");
+
+  if (maximum_time_element) {
+    const double new_maximum_time = atof(maximum_time_element->GetText());
+
+    try {
+      set_maximum_time(new_maximum_time);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Reserve parameters norm history
+
+  const tinyxml2::XMLElement* reserve_parameters_norm_history_element =
+      root_element->FirstChildElement("ReserveParametersNormHistory");
+
+  if (reserve_parameters_norm_history_element) {
+    const std::string new_reserve_parameters_norm_history =
+        reserve_parameters_norm_history_element->GetText();
+
+    try {
+      set_reserve_parameters_norm_history(
+          new_reserve_parameters_norm_history != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Reserve performance history
+
+  const tinyxml2::XMLElement* reserve_performance_history_element =
+      root_element->FirstChildElement("ReservePerformanceHistory");
+
+  if (reserve_performance_history_element) {
+    const std::string new_reserve_performance_history =
+        reserve_performance_history_element->GetText();
+
+    try {
+      set_reserve_performance_history(new_reserve_performance_history != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Reserve generalization performance history
+
+  const tinyxml2::XMLElement*
+      reserve_generalization_performance_history_element =
+          root_element->FirstChildElement(
+              "ReserveGeneralizationPerformanceHistory");
+
+  if (reserve_generalization_performance_history_element) {
+    const std::string new_reserve_generalization_performance_history =
+        reserve_generalization_performance_history_element->GetText();
+
+    try {
+      set_reserve_generalization_performance_history(
+          new_reserve_generalization_performance_history != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Reserve gradient norm history
+
+  const tinyxml2::XMLElement* reserve_gradient_norm_history_element =
+      root_element->FirstChildElement("ReserveGradientNormHistory");
+
+  if (reserve_gradient_norm_history_element) {
+    const std::string new_reserve_gradient_norm_history =
+        reserve_gradient_norm_history_element->GetText();
+
+    try {
+      set_reserve_gradient_norm_history(
+          new_reserve_gradient_norm_history != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Reserve trust region radius history
+
+  const tinyxml2::XMLElement* reserve_trust_region_radius_history_element =
+      root_element->FirstChildElement("ReserveTrustRegionRadiusHistory");
+
+  if (reserve_trust_region_radius_history_element) {
+    const std::string new_reserve_trust_region_radius_history =
+        reserve_trust_region_radius_history_element->GetText();
+
+    try {
+      set_reserve_trust_region_radius_history(
+          new_reserve_trust_region_radius_history != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Reserve conjugate gradient iterations history
+
+  const tinyxml2::XMLElement*
+      reserve_conjugate_gradient_iterations_history_element =
+          root_element->FirstChildElement(
+              "ReserveConjugateGradientIterationsHistory");
+
+  if (reserve_conjugate_gradient_iterations_history_element) {
+    const std::string new_reserve_conjugate_gradient_iterations_history =
+        reserve_conjugate_gradient_iterations_history_element->GetText();
+
+    try {
+      set_reserve_conjugate_gradient_iterations_history(
+          new_reserve_conjugate_gradient_iterations_history != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Reserve elapsed time history
+
+  const tinyxml2::XMLElement* reserve_elapsed_time_history_element =
+      root_element->FirstChildElement("ReserveElapsedTimeHistory");
+
+  if (reserve_elapsed_time_history_element) {
+    const std::string new_reserve_elapsed_time_history =
+        reserve_elapsed_time_history_element->GetText();
+
+    try {
+      set_reserve_elapsed_time_history(new_reserve_elapsed_time_history != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Display period
+
+  const tinyxml2::XMLElement* display_period_element =
+      root_element->FirstChildElement("DisplayPeriod");
+
+  if (display_period_element) {
+    const unsigned new_display_period = atoi(display_period_element->GetText());
+
+    try {
+      set_display_period(new_display_period);
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+
+  // Display
+
+  const tinyxml2::XMLElement* display_element =
+      root_element->FirstChildElement("Display");
+
+  if (display_element) {
+    const std::string new_display = display_element->GetText();
+
+    try {
+      set_display(new_display != "0");
+    }
+    catch (const std::logic_error & e) {
+      std::cout << e.what() << std::endl;
+    }
+  }
+}
+}
+
+// OpenNN: Open Neural Networks Library.
+// Neural Designer Copyright © 2013 Roberto López and Ismael Santana (Intelnics)
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,471 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   T R U N C A T E D   N E W T O N   M E T H O D   C L A S S   H E A D E R
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __TRUNCATEDNEWTONMETHOD_H__
+#define __TRUNCATEDNEWTONMETHOD_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+
+// OpenNN includes
+
+#include "performance_functional.h"
+
+#include "training_algorithm.h"
+
+// TinyXml includes
+
+#include "tinyxml2_ext.h"
+
+namespace OpenNN {
+
+/// This concrete class represents the truncated Newton method training
+/// algorithm for a performance functional of a neural network.
+/// Each iteration approximately minimizes the quadratic model of the
+/// performance inside a trust region with the conjugate gradient method of
+/// Steihaug.
+/// The Hessian matrix is never formed: the conjugate gradient iterations only
+/// need products of the Hessian and a vector, which are supplied by the
+/// performance functional.
+
+class TruncatedNewtonMethod : public TrainingAlgorithm {
+
+ public:
+
+  // DEFAULT CONSTRUCTOR
+
+  explicit TruncatedNewtonMethod(void);
+
+  // PERFORMANCE FUNCTIONAL CONSTRUCTOR
+
+  explicit TruncatedNewtonMethod(PerformanceFunctional*);
+
+  // XML CONSTRUCTOR
+
+  explicit TruncatedNewtonMethod(const tinyxml2::XMLDocument&);
+
+  // DESTRUCTOR
+
+  virtual ~TruncatedNewtonMethod(void);
+
+  // ENUMERATIONS
+
+  /// Enumeration of the available preconditioners for the conjugate gradient
+  /// iterations.
+
+  enum PreconditionerType {
+    NO_PRECONDITIONER,
+    HESSIAN_DIAGONAL_PRECONDITIONER,
+    GAUSS_NEWTON_DIAGONAL_PRECONDITIONER
+  };
+
+  // STRUCTURES
+
+  ///
+  /// This structure contains the training results for the truncated Newton
+  /// method.
+  ///
+
+  struct TruncatedNewtonMethodResults : public TrainingAlgorithm::Results {
+    /// Default constructor.
+
+    TruncatedNewtonMethodResults(void) {
+      truncated_Newton_method_pointer = NULL;
+    }
+
+    /// Truncated Newton method constructor.
+
+    TruncatedNewtonMethodResults(
+        TruncatedNewtonMethod* new_truncated_Newton_method_pointer) {
+      truncated_Newton_method_pointer = new_truncated_Newton_method_pointer;
+    }
+
+    /// Destructor.
+
+    virtual ~TruncatedNewtonMethodResults(void) {}
+
+    /// Pointer to the truncated Newton method object for which the training
+    /// results are to be stored.
+
+    TruncatedNewtonMethod* truncated_Newton_method_pointer;
+
+    // Training history
+
+    /// History of the parameters norm over the training iterations.
+
+    Vector<double> parameters_norm_history;
+
+    /// History of the performance function performance over the training
+    /// iterations.
+
+    Vector<double> performance_history;
+
+    /// History of the generalization performance over the training iterations.
+
+    Vector<double> generalization_performance_history;
+
+    /// History of the gradient norm over the training iterations.
+
+    Vector<double> gradient_norm_history;
+
+    /// History of the trust region radius over the training iterations.
+
+    Vector<double> trust_region_radius_history;
+
+    /// History of the number of conjugate gradient iterations over the
+    /// training iterations.
+
+    Vector<unsigned> conjugate_gradient_iterations_history;
+
+    /// History of the elapsed time over the training iterations.
+
+    Vector<double> elapsed_time_history;
+
+    // Final values
+
+    /// Final neural network parameters vector.
+
+    Vector<double> final_parameters;
+
+    /// Final neural network parameters norm.
+
+    double final_parameters_norm;
+
+    /// Final performance function evaluation.
+
+    double final_performance;
+
+    /// Final generalization performance.
+
+    double final_generalization_performance;
+
+    /// Final performance function gradient.
+
+    Vector<double> final_gradient;
+
+    /// Final gradient norm.
+
+    double final_gradient_norm;
+
+    /// Final trust region radius.
+
+    double final_trust_region_radius;
+
+    /// Elapsed time of the training process.
+
+    double elapsed_time;
+
+    /// Maximum number of training iterations.
+
+    unsigned iterations_number;
+
+    void resize_training_history(const unsigned&);
+    std::string to_string(void) const;
+
+    Matrix<std::string> write_final_results(const unsigned& precision =
+                                                3) const;
+  };
+
+  // METHODS
+
+  // Get methods
+
+  // Training parameters
+
+  const double& get_warning_parameters_norm(void) const;
+  const double& get_warning_gradient_norm(void) const;
+
+  const double& get_trust_region_radius(void) const;
+  const double& get_minimum_trust_region_radius(void) const;
+  const double& get_maximum_trust_region_radius(void) const;
+
+  const double& get_minimum_reduction_ratio(void) const;
+
+  const unsigned& get_maximum_conjugate_gradient_iterations_number(void) const;
+
+  const PreconditionerType& get_preconditioner_type(void) const;
+  std::string write_preconditioner_type(void) const;
+
+  const unsigned& get_preconditioner_samples_number(void) const;
+  const unsigned& get_preconditioner_seed(void) const;
+
+  // Stopping criteria
+
+  const double& get_minimum_parameters_increment_norm(void) const;
+
+  const double& get_minimum_performance_increase(void) const;
+  const double& get_performance_goal(void) const;
+  const double& get_gradient_norm_goal(void) const;
+  const unsigned& get_maximum_generalization_performance_decreases(void) const;
+
+  const unsigned& get_maximum_iterations_number(void) const;
+  const double& get_maximum_time(void) const;
+
+  // Reserve training history
+
+  const bool& get_reserve_parameters_norm_history(void) const;
+
+  const bool& get_reserve_performance_history(void) const;
+  const bool& get_reserve_generalization_performance_history(void) const;
+  const bool& get_reserve_gradient_norm_history(void) const;
+
+  const bool& get_reserve_trust_region_radius_history(void) const;
+  const bool& get_reserve_conjugate_gradient_iterations_history(void) const;
+  const bool& get_reserve_elapsed_time_history(void) const;
+
+  // Utilities
+
+  const unsigned& get_display_period(void) const;
+
+  // Set methods
+
+  void set_default(void);
+
+  // Training parameters
+
+  void set_warning_parameters_norm(const double&);
+  void set_warning_gradient_norm(const double&);
+
+  void set_trust_region_radius(const double&);
+  void set_minimum_trust_region_radius(const double&);
+  void set_maximum_trust_region_radius(const double&);
+
+  void set_minimum_reduction_ratio(const double&);
+
+  void set_maximum_conjugate_gradient_iterations_number(const unsigned&);
+
+  void set_preconditioner_type(const PreconditionerType&);
+  void set_preconditioner_type(const std::string&);
+
+  void set_preconditioner_samples_number(const unsigned&);
+  void set_preconditioner_seed(const unsigned&);
+
+  // Stopping criteria
+
+  void set_minimum_parameters_increment_norm(const double&);
+
+  void set_minimum_performance_increase(const double&);
+  void set_performance_goal(const double&);
+  void set_gradient_norm_goal(const double&);
+  void set_maximum_generalization_performance_decreases(const unsigned&);
+
+  void set_maximum_iterations_number(const unsigned&);
+  void set_maximum_time(const double&);
+
+  // Reserve training history
+
+  void set_reserve_parameters_norm_history(const bool&);
+
+  void set_reserve_performance_history(const bool&);
+  void set_reserve_generalization_performance_history(const bool&);
+  void set_reserve_gradient_norm_history(const bool&);
+
+  void set_reserve_trust_region_radius_history(const bool&);
+  void set_reserve_conjugate_gradient_iterations_history(const bool&);
+  void set_reserve_elapsed_time_history(const bool&);
+
+  void set_reserve_all_training_history(const bool&);
+
+  // Utilities
+
+  void set_display_period(const unsigned&);
+
+  // Training methods
+
+  void check(void) const;
+
+  double calculate_preconditioner_random_sign(void) const;
+
+  Vector<double> calculate_preconditioner(void) const;
+
+  unsigned calculate_training_direction(const Vector<double>&,
+                                        const Vector<double>&, const double&,
+                                        Vector<double>&, double&) const;
+
+  TruncatedNewtonMethodResults* perform_training(void);
+
+  std::string write_training_algorithm_type(void) const;
+
+  // Serialization methods
+
+  Matrix<std::string> to_string_matrix(void) const;
+
+  tinyxml2::XMLDocument* to_XML(void) const;
+  void from_XML(const tinyxml2::XMLDocument&);
+
+ private:
+
+  // TRAINING PARAMETERS
+
+  /// Value for the parameters norm at which a warning message is written to the
+  /// screen.
+
+  double warning_parameters_norm;
+
+  /// Value for the gradient norm at which a warning message is written to the
+  /// screen.
+
+  double warning_gradient_norm;
+
+  /// Radius of the trust region at the current iteration.
+  /// The set value is the radius of the first iteration.
+
+  double trust_region_radius;
+
+  /// Smallest trust region radius allowed by the algorithm.
+
+  double minimum_trust_region_radius;
+
+  /// Largest trust region radius allowed by the algorithm.
+
+  double maximum_trust_region_radius;
+
+  /// Smallest ratio between the actual and the predicted performance
+  /// reductions for a step to be accepted.
+
+  double minimum_reduction_ratio;
+
+  /// Maximum number of conjugate gradient iterations for each training
+  /// direction.
+
+  unsigned maximum_conjugate_gradient_iterations_number;
+
+  /// Diagonal preconditioner of the conjugate gradient iterations.
+
+  PreconditionerType preconditioner_type;
+
+  /// Number of Hessian-vector products used to estimate the Hessian diagonal.
+
+  unsigned preconditioner_samples_number;
+
+  /// Seed of the random number generator of the Hessian diagonal
+  /// preconditioner.
+
+  unsigned preconditioner_seed;
+
+  /// State of the random number generator of the Hessian diagonal
+  /// preconditioner.
+  /// It is owned by the algorithm, so that the random vectors do not depend on
+  /// nor change the state of the global random number generator.
+
+  mutable unsigned preconditioner_random_state;
+
+  // STOPPING CRITERIA
+
+  /// Norm of the parameters increment vector at which training stops.
+
+  double minimum_parameters_increment_norm;
+
+  /// Minimum performance improvement between two successive iterations. It is
+  /// used as a stopping criterion.
+
+  double minimum_performance_increase;
+
+  /// Goal value for the performance. It is used as a stopping criterion.
+
+  double performance_goal;
+
+  /// Goal value for the norm of the objective function gradient. It is used as
+  /// a stopping criterion.
+
+  double gradient_norm_goal;
+
+  /// Maximum number of iterations at which the generalization performance
+  /// decreases.
+  /// This is an early stopping method for improving generalization.
+
+  unsigned maximum_generalization_performance_decreases;
+
+  /// Maximum number of iterations to perform_training. It is used as a stopping
+  /// criterion.
+
+  unsigned maximum_iterations_number;
+
+  /// Maximum training time. It is used as a stopping criterion.
+
+  double maximum_time;
+
+  // TRAINING HISTORY
+
+  /// True if the parameters norm history vector is to be reserved, false
+  /// otherwise.
+
+  bool reserve_parameters_norm_history;
+
+  /// True if the performance history vector is to be reserved, false otherwise.
+
+  bool reserve_performance_history;
+
+  /// True if the Generalization performance history vector is to be reserved,
+  /// false otherwise.
+
+  bool reserve_generalization_performance_history;
+
+  /// True if the gradient norm history vector is to be reserved, false
+  /// otherwise.
+
+  bool reserve_gradient_norm_history;
+
+  /// True if the trust region radius history vector is to be reserved, false
+  /// otherwise.
+
+  bool reserve_trust_region_radius_history;
+
+  /// True if the conjugate gradient iterations history vector is to be
+  /// reserved, false otherwise.
+
+  bool reserve_conjugate_gradient_iterations_history;
+
+  /// True if the elapsed time history vector is to be reserved, false
+  /// otherwise.
+
+  bool reserve_elapsed_time_history;
+
+  /// Number of iterations between the training showing progress.
+
+  unsigned display_period;
+};
+}
+
+#endif
+
+// OpenNN: Open Neural Networks Library.
+// Neural Designer Copyright © 2013 Roberto López and Ismael Santana (Intelnics)
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
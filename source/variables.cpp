@@ -78,6 +78,8 @@ Variables::Variables(const Variables& other_variables) {
 
   items = other_variables.items;
 
+  indices_updated = false;
+
   // Utilities
 
   display = other_variables.display;
@@ -102,6 +104,8 @@ Variables& Variables::operator=(const Variables& other_variables) {
 
     items = other_variables.items;
 
+    indices_updated = false;
+
     // Utilities
 
     display = other_variables.display;
@@ -373,6 +377,33 @@ Vector<unsigned> Variables::arrange_targets_indices(void) const {
   return (targets_indices);
 }
 
+// const Vector<unsigned>& get_inputs_indices(void) const method
+
+/// Returns a reference to the cached indices of the input variables.
+/// The table is only rebuilt when the uses of the variables have changed.
+/// Note that the reference is invalidated by any change in the uses.
+
+const Vector<unsigned>& Variables::get_inputs_indices(void) const {
+  if (!indices_updated) {
+    update_indices();
+  }
+
+  return (inputs_indices);
+}
+
+// const Vector<unsigned>& get_targets_indices(void) const method
+
+/// Returns a reference to the cached indices of the target variables.
+/// Note that the reference is invalidated by any change in the uses.
+
+const Vector<unsigned>& Variables::get_targets_indices(void) const {
+  if (!indices_updated) {
+    update_indices();
+  }
+
+  return (targets_indices);
+}
+
 // Vector<std::string> arrange_names(void) const method
 
 /// Returns the names of all the variables in the data set.
@@ -728,6 +759,8 @@ void Variables::set(const unsigned& new_variables_number) {
 
 void Variables::set(const unsigned& inputs_number,
                     const unsigned& targets_number) {
+  indices_updated = false;
+
   const unsigned variables_number = inputs_number + targets_number;
 
   set_variables_number(variables_number);
@@ -769,7 +802,11 @@ void Variables::set_default(void) { display = true; }
 /// Sets new variable items in this object.
 /// @param new_items Vector of item structures to be set.
 
-void Variables::set_items(const Vector<Item>& new_items) { items = new_items; }
+void Variables::set_items(const Vector<Item>& new_items) {
+  items = new_items;
+
+  indices_updated = false;
+}
 
 // void set_uses(const Vector<Use>&) method
 
@@ -779,6 +816,8 @@ void Variables::set_items(const Vector<Item>& new_items) { items = new_items; }
 /// @param new_uses Vector of use elements.
 
 void Variables::set_uses(const Vector<Variables::Use>& new_uses) {
+  indices_updated = false;
+
   const unsigned variables_number = get_variables_number();
 
   for (unsigned i = 0; i < variables_number; i++) {
@@ -793,6 +832,8 @@ void Variables::set_uses(const Vector<Variables::Use>& new_uses) {
 /// @param new_uses Vector of use strings.
 
 void Variables::set_uses(const Vector<std::string>& new_uses) {
+  indices_updated = false;
+
   const unsigned new_variables_number = new_uses.size();
 
   for (unsigned i = 0; i < new_variables_number; i++) {
@@ -821,6 +862,8 @@ void Variables::set_uses(const Vector<std::string>& new_uses) {
 /// @param new_use Use for that variable.
 
 void Variables::set_use(const unsigned& i, const Use& new_use) {
+  indices_updated = false;
+
 // Control sentence (if debug)
 
 #ifndef NDEBUG
@@ -850,6 +893,8 @@ void Variables::set_use(const unsigned& i, const Use& new_use) {
 /// @param new_use Use for that variable.
 
 void Variables::set_use(const unsigned& i, const std::string& new_use) {
+  indices_updated = false;
+
 // Control sentence (if debug)
 
 #ifndef NDEBUG
@@ -890,6 +935,8 @@ void Variables::set_use(const unsigned& i, const std::string& new_use) {
 /// Sets all the variables in the data set as input variables.
 
 void Variables::set_input(void) {
+  indices_updated = false;
+
   const unsigned variables_number = get_variables_number();
 
   for (unsigned i = 0; i < variables_number; i++) {
@@ -902,6 +949,8 @@ void Variables::set_input(void) {
 /// Sets all the variables in the data set as target variables.
 
 void Variables::set_target(void) {
+  indices_updated = false;
+
   const unsigned variables_number = get_variables_number();
 
   for (unsigned i = 0; i < variables_number; i++) {
@@ -918,6 +967,8 @@ void Variables::set_target(void) {
 /// </ul>
 
 void Variables::set_default_uses(void) {
+  indices_updated = false;
+
   const unsigned variables_number = get_variables_number();
 
   if (variables_number == 0) {
@@ -1144,10 +1195,39 @@ void Variables::set_display(const bool& new_display) { display = new_display; }
 /// @param new_variables_number Number of variables.
 
 void Variables::set_variables_number(const unsigned& new_variables_number) {
+  indices_updated = false;
+
   items.set(new_variables_number);
   set_default_uses();
 }
 
+// void update_indices(void) const method
+
+/// Rebuilds the cached tables of input and target indices in a single pass
+/// over the variables.
+
+void Variables::update_indices(void) const {
+  const unsigned variables_number = get_variables_number();
+
+  inputs_indices.set(count_inputs_number());
+  targets_indices.set(count_targets_number());
+
+  unsigned inputs_count = 0;
+  unsigned targets_count = 0;
+
+  for (unsigned i = 0; i < variables_number; i++) {
+    if (items[i].use == Input) {
+      inputs_indices[inputs_count] = i;
+      inputs_count++;
+    } else if (items[i].use == Target) {
+      targets_indices[targets_count] = i;
+      targets_count++;
+    }
+  }
+
+  indices_updated = true;
+}
+
 // std::string to_string(void) const method
 
 /// Returns a string representation of the current variables object.
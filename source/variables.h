@@ -146,6 +146,9 @@ class Variables {
   Vector<unsigned> arrange_inputs_indices(void) const;
   Vector<unsigned> arrange_targets_indices(void) const;
 
+  const Vector<unsigned>& get_inputs_indices(void) const;
+  const Vector<unsigned>& get_targets_indices(void) const;
+
   // Information methods
 
   Vector<std::string> arrange_names(void) const;
@@ -231,9 +234,28 @@ class Variables {
 
   Vector<Item> items;
 
+  /// Indices of the input variables.
+  /// This table is rebuilt lazily whenever the uses of the variables change.
+
+  mutable Vector<unsigned> inputs_indices;
+
+  /// Indices of the target variables.
+  /// This table is rebuilt lazily whenever the uses of the variables change.
+
+  mutable Vector<unsigned> targets_indices;
+
+  /// True if the tables of indices are consistent with the uses of the
+  /// variables, false otherwise.
+
+  mutable bool indices_updated;
+
   /// Display messages to screen.
 
   bool display;
+
+  // PRIVATE METHODS
+
+  void update_indices(void) const;
 };
 }
 
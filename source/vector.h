@@ -2312,13 +2312,19 @@ class Vector : public std::vector<Type> {
 
     const unsigned columns_number = matrix.get_columns_number();
 
+    // The matrix is traversed row by row, adding each row scaled by the
+    // corresponding vector element to the product
+
     Vector<Type> product(columns_number);
 
-    for (unsigned j = 0; j < columns_number; j++) {
-      product[j] = 0;
+    product.initialize(0);
+
+    for (unsigned i = 0; i < rows_number; i++) {
+      const Type value = (*this)[i];
+      const Type* row = matrix[i];
 
-      for (unsigned i = 0; i < rows_number; i++) {
-        product[j] += (*this)[i] * matrix[i][j];
+      for (unsigned j = 0; j < columns_number; j++) {
+        product[j] += value * row[j];
       }
     }
 
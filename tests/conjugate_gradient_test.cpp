@@ -299,6 +299,32 @@ void ConjugateGradientTest::test_perform_training(void) {
   double gradient_norm = pf.calculate_gradient().calculate_norm();
 
   assert_true(gradient_norm < gradient_norm_goal, LOG);
+
+  // Wolfe line search
+
+  nn.initialize_parameters(-1.0);
+
+  cg.get_training_rate_algorithm_pointer()->set_training_rate_method(
+      TrainingRateAlgorithm::WolfeMethod);
+
+  cg.set_minimum_parameters_increment_norm(0.0);
+  cg.set_performance_goal(performance_goal);
+  cg.set_minimum_performance_increase(0.0);
+  cg.set_gradient_norm_goal(0.0);
+  cg.set_maximum_iterations_number(1000);
+  cg.set_maximum_time(1000.0);
+
+  ConjugateGradient::ConjugateGradientResults* results_pointer =
+      cg.perform_training();
+
+  performance = pf.calculate_performance();
+
+  assert_true(performance < performance_goal, LOG);
+  assert_true(results_pointer->training_rate_evaluations_number >=
+                  results_pointer->iterations_number,
+              LOG);
+
+  delete results_pointer;
 }
 
 void ConjugateGradientTest::test_to_XML(void) {
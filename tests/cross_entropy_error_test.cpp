@@ -233,6 +233,61 @@ void CrossEntropyErrorTest::test_calculate_Hessian(void) {
   message += "test_calculate_Hessian\n";
 }
 
+void CrossEntropyErrorTest::test_calculate_vector_dot_Hessian(void) {
+  message += "test_calculate_vector_dot_Hessian\n";
+
+  DataSet ds;
+  NeuralNetwork nn;
+  CrossEntropyError cee(&nn, &ds);
+
+  Vector<double> parameters;
+  Vector<double> vector;
+
+  Vector<double> vector_Hessian_product;
+  Vector<double> numerical_vector_Hessian_product;
+
+  const double step = 1.0e-4;
+
+  // Test
+
+  ds.set(2, 1, 10);
+  ds.randomize_data_uniform(0.1, 0.9);
+
+  nn.set(2, 3, 1);
+  nn.randomize_parameters_normal();
+
+  nn.get_multilayer_perceptron_pointer()->set_layer_activation_function(
+      1, Perceptron::Logistic);
+
+  nn.construct_probabilistic_layer();
+  nn.get_probabilistic_layer_pointer()->set_probabilistic_method(
+      ProbabilisticLayer::Softmax);
+
+  parameters = nn.arrange_parameters();
+
+  vector.set(nn.count_parameters_number());
+  vector.randomize_normal();
+
+  vector_Hessian_product = cee.calculate_vector_dot_Hessian(vector);
+
+  nn.set_parameters(parameters + vector * step);
+
+  numerical_vector_Hessian_product = cee.calculate_gradient();
+
+  nn.set_parameters(parameters - vector * step);
+
+  numerical_vector_Hessian_product -= cee.calculate_gradient();
+  numerical_vector_Hessian_product /= 2.0 * step;
+
+  nn.set_parameters(parameters);
+
+  assert_true(vector_Hessian_product.size() == nn.count_parameters_number(),
+              LOG);
+  assert_true((vector_Hessian_product - numerical_vector_Hessian_product)
+                      .calculate_absolute_value() < 1.0e-3,
+              LOG);
+}
+
 void CrossEntropyErrorTest::test_to_XML(void) { message += "test_to_XML\n"; }
 
 void CrossEntropyErrorTest::test_from_XML(void) {
@@ -252,6 +307,8 @@ void CrossEntropyErrorTest::run_test_case(void) {
   test_calculate_gradient();
   test_calculate_Hessian();
 
+  test_calculate_vector_dot_Hessian();
+
   // Serialization methods
 
   test_to_XML();
@@ -57,6 +57,8 @@ class CrossEntropyErrorTest : public UnitTesting {
 
   void test_calculate_Hessian(void);
 
+  void test_calculate_vector_dot_Hessian(void);
+
   void test_to_XML(void);
   void test_from_XML(void);
 
@@ -209,6 +209,62 @@ void DataSetTest::test_arrange_target_data(void) {
   assert_true(targets_number == columns_number, LOG);
 }
 
+void DataSetTest::test_get_training_input_block(void) {
+  message += "test_get_training_input_block\n";
+
+  DataSet ds(3, 2, 10);
+
+  Matrix<double> inputs;
+  Matrix<double> targets;
+
+  Matrix<float> single_precision_inputs;
+  Matrix<float> single_precision_targets;
+
+  // Test
+
+  ds.randomize_data_normal();
+
+  assert_true(ds.has_single_precision_data() == false, LOG);
+
+  ds.update_single_precision_data();
+
+  assert_true(ds.has_single_precision_data() == true, LOG);
+
+  ds.get_training_input_block(1, 4, inputs);
+  ds.get_training_target_block(1, 4, targets);
+
+  ds.get_training_input_block(1, 4, single_precision_inputs);
+  ds.get_training_target_block(1, 4, single_precision_targets);
+
+  assert_true(single_precision_inputs.get_rows_number() == 4, LOG);
+  assert_true(single_precision_inputs.get_columns_number() == 3, LOG);
+  assert_true(single_precision_targets.get_rows_number() == 4, LOG);
+  assert_true(single_precision_targets.get_columns_number() == 2, LOG);
+
+  for (unsigned i = 0; i < 4; i++) {
+    for (unsigned j = 0; j < 3; j++) {
+      assert_true(single_precision_inputs[i][j] == (float)inputs[i][j], LOG);
+    }
+
+    for (unsigned j = 0; j < 2; j++) {
+      assert_true(single_precision_targets[i][j] == (float)targets[i][j], LOG);
+    }
+  }
+
+  // Test
+
+  ds.scale_inputs_minimum_maximum();
+
+  assert_true(ds.has_single_precision_data() == false, LOG);
+
+  ds.update_single_precision_data();
+
+  ds.get_training_input_block(1, 4, inputs);
+  ds.get_training_input_block(1, 4, single_precision_inputs);
+
+  assert_true(single_precision_inputs[3][2] == (float)inputs[3][2], LOG);
+}
+
 void DataSetTest::test_get_instance(void) {
   message += "test_get_instance\n";
 
@@ -348,6 +404,27 @@ void DataSetTest::test_get_training_input_instance(void) {
 
   assert_true(training_input_instance.size() == 1, LOG);
   assert_true(training_input_instance == 0.0, LOG);
+
+  // Test
+
+  ds.set(2, 1, 3);
+  ds.initialize_data(0.0);
+
+  ds.set_instance(2, Vector<double>(3, 2.0));
+
+  instances_pointer = ds.get_instances_pointer();
+  instances_pointer->set_training();
+
+  ds.get_training_input_instance(2, training_input_instance);
+
+  assert_true(training_input_instance.size() == 2, LOG);
+  assert_true(training_input_instance == 2.0, LOG);
+
+  instances_pointer->set_use(1, Instances::Unused);
+
+  ds.get_training_input_instance(1, training_input_instance);
+
+  assert_true(training_input_instance == 2.0, LOG);
 }
 
 void DataSetTest::test_get_training_target_instance(void) {
@@ -1390,6 +1467,8 @@ void DataSetTest::run_test_case(void) {
   test_arrange_input_data();
   test_arrange_target_data();
 
+  test_get_training_input_block();
+
   // Instance methods
 
   test_get_instance();
@@ -73,6 +73,8 @@ class DataSetTest : public UnitTesting {
   void test_arrange_input_data(void);
   void test_arrange_target_data(void);
 
+  void test_get_training_input_block(void);
+
   // Instance methods
 
   void test_get_instance(void);
@@ -0,0 +1,403 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   I N F E R E N C E   P L A N   T E S T   C L A S S
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   E-mail: roberto-lopez@users.sourceforge.n
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "inference_plan_test.h"
+
+using namespace OpenNN;
+
+// GENERAL CONSTRUCTOR
+
+InferencePlanTest::InferencePlanTest(void) : UnitTesting() {}
+
+// DESTRUCTOR
+
+InferencePlanTest::~InferencePlanTest(void) {}
+
+// METHODS
+
+void InferencePlanTest::test_constructor(void) {
+  message += "test_constructor\n";
+
+  // Default constructor
+
+  InferencePlan ip1;
+
+  assert_true(ip1.is_empty(), LOG);
+  assert_true(ip1.get_inputs_number() == 0, LOG);
+  assert_true(ip1.get_outputs_number() == 0, LOG);
+
+  // Neural network constructor
+
+  NeuralNetwork nn(2, 3, 4);
+
+  InferencePlan ip2(nn);
+
+  assert_true(!ip2.is_empty(), LOG);
+  assert_true(ip2.get_inputs_number() == 2, LOG);
+  assert_true(ip2.get_outputs_number() == 4, LOG);
+  assert_true(ip2.get_layers_number() == 2, LOG);
+  assert_true(ip2.get_parameters() == nn.arrange_parameters(), LOG);
+
+  // Neural network without multilayer perceptron
+
+  NeuralNetwork nn2;
+
+  try {
+    InferencePlan ip3(nn2);
+
+    assert_true(false, LOG);
+  } catch (const std::logic_error&) {
+    assert_true(true, LOG);
+  }
+}
+
+void InferencePlanTest::test_destructor(void) {
+  message += "test_destructor\n";
+}
+
+void InferencePlanTest::test_get_workspace_size(void) {
+  message += "test_get_workspace_size\n";
+
+  NeuralNetwork nn;
+
+  InferencePlan ip;
+
+  // Test
+
+  nn.set(1, 1);
+
+  ip.set(nn);
+
+  assert_true(ip.get_workspace_size() == 0, LOG);
+
+  // Test
+
+  Vector<unsigned> architecture(4);
+  architecture[0] = 2;
+  architecture[1] = 5;
+  architecture[2] = 3;
+  architecture[3] = 1;
+
+  nn.set(architecture);
+
+  ip.set(nn);
+
+  assert_true(ip.get_workspace_size() == 10, LOG);
+}
+
+void InferencePlanTest::test_calculate_outputs(void) {
+  message += "test_calculate_outputs\n";
+
+  NeuralNetwork nn(3, 4, 2);
+
+  InferencePlan ip;
+
+  Vector<double> inputs(3);
+  Vector<double> outputs;
+
+  Matrix<double> input_data(5, 3);
+  Matrix<double> output_data;
+
+  Vector<double> workspace;
+
+  Vector<Statistics<double> > inputs_statistics(3);
+  inputs_statistics[0].mean = 1.0;
+  inputs_statistics[0].standard_deviation = 2.0;
+  inputs_statistics[1].minimum = -3.0;
+  inputs_statistics[1].maximum = 5.0;
+  inputs_statistics[2].mean = -0.5;
+  inputs_statistics[2].standard_deviation = 0.25;
+
+  Vector<Statistics<double> > outputs_statistics(2);
+  outputs_statistics[0].minimum = 10.0;
+  outputs_statistics[0].maximum = 20.0;
+  outputs_statistics[1].minimum = -1.0;
+  outputs_statistics[1].maximum = 4.0;
+
+  nn.randomize_parameters_normal();
+
+  nn.construct_scaling_layer();
+  nn.get_scaling_layer_pointer()->set_statistics(inputs_statistics);
+
+  nn.construct_unscaling_layer();
+  nn.get_unscaling_layer_pointer()->set_statistics(outputs_statistics);
+
+  MultilayerPerceptron* mlpp = nn.get_multilayer_perceptron_pointer();
+
+  // Test
+
+  nn.get_scaling_layer_pointer()->set_scaling_method(
+      ScalingLayer::MeanStandardDeviation);
+  nn.get_unscaling_layer_pointer()->set_unscaling_method(
+      UnscalingLayer::MinimumMaximum);
+
+  mlpp->set_layer_activation_function(1, Perceptron::Linear);
+
+  ip = nn.compile_inference_plan();
+
+  for (unsigned i = 0; i < 10; i++) {
+    inputs.randomize_normal();
+
+    outputs = ip.calculate_outputs(inputs);
+
+    assert_true((outputs - nn.calculate_outputs(inputs)).calculate_norm() <
+                    1.0e-12,
+                LOG);
+  }
+
+  // Test
+
+  nn.get_scaling_layer_pointer()->set_scaling_method(
+      ScalingLayer::MinimumMaximum);
+  nn.get_unscaling_layer_pointer()->set_unscaling_method(
+      UnscalingLayer::MeanStandardDeviation);
+
+  mlpp->set_layer_activation_function(1, Perceptron::Logistic);
+
+  nn.construct_probabilistic_layer();
+  nn.get_probabilistic_layer_pointer()->set_probabilistic_method(
+      ProbabilisticLayer::Softmax);
+
+  ip = nn.compile_inference_plan();
+
+  for (unsigned i = 0; i < 10; i++) {
+    inputs.randomize_normal();
+
+    outputs = ip.calculate_outputs(inputs);
+
+    assert_true((outputs - nn.calculate_outputs(inputs)).calculate_norm() <
+                    1.0e-12,
+                LOG);
+  }
+
+  // Test
+
+  nn.get_probabilistic_layer_pointer()->set_probabilistic_method(
+      ProbabilisticLayer::Competitive);
+
+  ip = nn.compile_inference_plan();
+
+  inputs.randomize_normal();
+
+  assert_true(ip.calculate_outputs(inputs) == nn.calculate_outputs(inputs),
+              LOG);
+
+  // Test
+
+  nn.get_probabilistic_layer_pointer()->set_probabilistic_method(
+      ProbabilisticLayer::NoProbabilistic);
+
+  nn.construct_bounding_layer();
+  nn.get_bounding_layer_pointer()->set_lower_bounds(Vector<double>(2, 12.0));
+  nn.get_bounding_layer_pointer()->set_upper_bounds(Vector<double>(2, 14.0));
+
+  ip = nn.compile_inference_plan();
+
+  input_data.randomize_normal();
+
+  ip.calculate_outputs(input_data, output_data, workspace);
+
+  assert_true(output_data.get_rows_number() == 5, LOG);
+  assert_true(output_data.get_columns_number() == 2, LOG);
+  assert_true(workspace.size() == ip.get_workspace_size(), LOG);
+
+  for (unsigned i = 0; i < 5; i++) {
+    outputs = nn.calculate_outputs(input_data.arrange_row(i));
+
+    assert_true((output_data.arrange_row(i) - outputs).calculate_norm() <
+                    1.0e-12,
+                LOG);
+  }
+
+  // Test
+
+  const double* output_data_pointer = output_data[0];
+
+  ip.calculate_outputs(input_data, output_data, workspace);
+
+  assert_true(output_data[0] == output_data_pointer, LOG);
+  assert_true(output_data == ip.calculate_outputs(input_data), LOG);
+}
+
+void InferencePlanTest::test_calculate_single_outputs(void) {
+  message += "test_calculate_single_outputs\n";
+
+  NeuralNetwork nn(3, 5, 2);
+
+  InferencePlan ip;
+
+  Matrix<double> input_data(10, 3);
+  Matrix<double> output_data;
+
+  Matrix<float> single_input_data(10, 3);
+  Matrix<float> single_output_data;
+
+  Vector<float> single_workspace;
+
+  Vector<Statistics<double> > outputs_statistics(2);
+  outputs_statistics[0].minimum = 10.0;
+  outputs_statistics[0].maximum = 20.0;
+  outputs_statistics[1].minimum = -1.0;
+  outputs_statistics[1].maximum = 4.0;
+
+  nn.randomize_parameters_normal();
+
+  nn.construct_unscaling_layer();
+  nn.get_unscaling_layer_pointer()->set_statistics(outputs_statistics);
+
+  // Test
+
+  ip = nn.compile_inference_plan();
+
+  assert_true(ip.get_single_parameters().size() == ip.get_parameters().size(),
+              LOG);
+  assert_true(ip.get_single_parameters()[0] == (float)ip.get_parameters()[0],
+              LOG);
+
+  // Test
+
+  input_data.randomize_normal();
+
+  for (unsigned i = 0; i < 10; i++) {
+    for (unsigned j = 0; j < 3; j++) {
+      single_input_data[i][j] = (float)input_data[i][j];
+    }
+  }
+
+  output_data = ip.calculate_outputs(input_data);
+
+  ip.calculate_outputs(single_input_data, single_output_data,
+                       single_workspace);
+
+  assert_true(single_output_data.get_rows_number() == 10, LOG);
+  assert_true(single_output_data.get_columns_number() == 2, LOG);
+  assert_true(single_workspace.size() == ip.get_workspace_size(), LOG);
+
+  for (unsigned i = 0; i < 10; i++) {
+    for (unsigned j = 0; j < 2; j++) {
+      assert_true(fabs(single_output_data[i][j] - output_data[i][j]) <
+                      1.0e-5 * (1.0 + fabs(output_data[i][j])),
+                  LOG);
+    }
+  }
+}
+
+void InferencePlanTest::test_calculate_outputs_concurrently(void) {
+  message += "test_calculate_outputs_concurrently\n";
+
+  NeuralNetwork nn(4, 6, 3);
+
+  const unsigned instances_number = 200;
+  const unsigned repetitions_number = 50;
+
+  Matrix<double> input_data(instances_number, 4);
+  Matrix<double> reference_data;
+
+  Vector<double> workspace;
+
+  nn.randomize_parameters_normal();
+
+  nn.construct_scaling_layer();
+  nn.get_scaling_layer_pointer()->set_scaling_method(
+      ScalingLayer::MeanStandardDeviation);
+
+  nn.construct_unscaling_layer();
+  nn.get_unscaling_layer_pointer()->set_unscaling_method(
+      UnscalingLayer::MinimumMaximum);
+
+  nn.construct_probabilistic_layer();
+  nn.get_probabilistic_layer_pointer()->set_probabilistic_method(
+      ProbabilisticLayer::Softmax);
+
+  nn.construct_bounding_layer();
+  nn.get_bounding_layer_pointer()->set_lower_bounds(Vector<double>(3, 0.1));
+  nn.get_bounding_layer_pointer()->set_upper_bounds(Vector<double>(3, 0.8));
+
+  const InferencePlan ip = nn.compile_inference_plan();
+
+  input_data.randomize_normal();
+
+  ip.calculate_outputs(input_data, reference_data, workspace);
+
+  // Test
+
+  int mismatches_number = 0;
+
+#pragma omp parallel num_threads(8) reduction(+ : mismatches_number)
+  {
+    Vector<double> thread_workspace(ip.get_workspace_size());
+    Vector<double> outputs(3);
+
+#pragma omp for schedule(dynamic)
+    for (int i = 0; i < (int)(repetitions_number * instances_number); i++) {
+      const unsigned instance = i % instances_number;
+
+      ip.calculate_outputs(input_data[instance], &outputs[0],
+                           &thread_workspace[0]);
+
+      for (unsigned j = 0; j < 3; j++) {
+        if (outputs[j] != reference_data[instance][j]) {
+          mismatches_number++;
+        }
+      }
+    }
+  }
+
+  assert_true(mismatches_number == 0, LOG);
+}
+
+void InferencePlanTest::run_test_case(void) {
+  message += "Running inference plan test case...\n";
+
+  // Constructor and destructor methods
+
+  test_constructor();
+  test_destructor();
+
+  // Get methods
+
+  test_get_workspace_size();
+
+  // Output methods
+
+  test_calculate_outputs();
+  test_calculate_single_outputs();
+  test_calculate_outputs_concurrently();
+
+  message += "End of inference plan test case.\n";
+}
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2014 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
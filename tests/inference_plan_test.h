@@ -0,0 +1,84 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   I N F E R E N C E   P L A N   T E S T   C L A S S   H E A D E R
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __INFERENCEPLANTEST_H__
+#define __INFERENCEPLANTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+using namespace OpenNN;
+
+class InferencePlanTest : public UnitTesting {
+
+#define STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__) "\n"
+
+ public:
+
+  // GENERAL CONSTRUCTOR
+
+  explicit InferencePlanTest(void);
+
+  // DESTRUCTOR
+
+  virtual ~InferencePlanTest(void);
+
+  // METHODS
+
+  // Constructor and destructor methods
+
+  void test_constructor(void);
+  void test_destructor(void);
+
+  // Get methods
+
+  void test_get_workspace_size(void);
+
+  // Output methods
+
+  void test_calculate_outputs(void);
+  void test_calculate_single_outputs(void);
+  void test_calculate_outputs_concurrently(void);
+
+  // Unit testing methods
+
+  void run_test_case(void);
+};
+
+#endif
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2014 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -129,6 +129,37 @@ void InstancesTest::test_arrange_training_indices(void) {
   assert_true(training_indices.size() == 1, LOG);
 }
 
+void InstancesTest::test_get_training_indices(void) {
+  message += "test_get_training_indices\n";
+
+  Instances i;
+
+  assert_true(i.get_training_indices().size() == 0, LOG);
+
+  // Test
+
+  i.set(3);
+
+  assert_true(i.get_training_indices().size() == 3, LOG);
+  assert_true(i.get_generalization_indices().size() == 0, LOG);
+
+  // Test
+
+  i.set_use(1, Instances::Testing);
+
+  assert_true(i.get_training_indices().size() == 2, LOG);
+  assert_true(i.get_training_indices()[1] == 2, LOG);
+  assert_true(i.get_testing_indices().size() == 1, LOG);
+  assert_true(i.get_testing_indices()[0] == 1, LOG);
+
+  // Test
+
+  i.set_generalization();
+
+  assert_true(i.get_training_indices().size() == 0, LOG);
+  assert_true(i.get_generalization_indices().size() == 3, LOG);
+}
+
 void InstancesTest::test_count_generalization_instances_number(void) {
   message += "test_count_generalization_instances_number\n";
 
@@ -496,6 +527,8 @@ void InstancesTest::run_test_case(void) {
   test_count_testing_instances_number();
   test_arrange_testing_indices();
 
+  test_get_training_indices();
+
   test_get_display();
 
   // Set methods
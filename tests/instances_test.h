@@ -67,6 +67,8 @@ class InstancesTest : public UnitTesting {
   void test_arrange_training_indices(void);
   void test_arrange_testing_indices(void);
 
+  void test_get_training_indices(void);
+
   void test_get_display(void);
 
   // Set methods
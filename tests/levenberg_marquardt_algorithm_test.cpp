@@ -86,6 +86,27 @@ void LevenbergMarquardtAlgorithmTest::test_set_maximum_damping_parameter(void) {
   message += "test_set_maximum_damping_parameter\n";
 }
 
+void LevenbergMarquardtAlgorithmTest::test_set_solver_type(void) {
+  message += "test_set_solver_type\n";
+
+  LevenbergMarquardtAlgorithm lma;
+
+  // Test
+
+  assert_true(
+      lma.get_solver_type() == LevenbergMarquardtAlgorithm::CHOLESKY_SOLVER,
+      LOG);
+
+  // Test
+
+  lma.set_solver_type("CONJUGATE_GRADIENT_SOLVER");
+
+  assert_true(lma.get_solver_type() ==
+                  LevenbergMarquardtAlgorithm::CONJUGATE_GRADIENT_SOLVER,
+              LOG);
+  assert_true(lma.write_solver_type() == "CONJUGATE_GRADIENT_SOLVER", LOG);
+}
+
 void LevenbergMarquardtAlgorithmTest::test_calculate_performance(void) {
   message += "test_calculate_performance";
 
@@ -285,6 +306,64 @@ void LevenbergMarquardtAlgorithmTest::test_calculate_Hessian_approximation(
       LOG);
 }
 
+void LevenbergMarquardtAlgorithmTest::
+    test_calculate_conjugate_gradient_increment(void) {
+  message += "test_calculate_conjugate_gradient_increment\n";
+
+  NeuralNetwork nn(2, 3, 2);
+
+  DataSet ds(2, 2, 50);
+
+  PerformanceFunctional pf(&nn, &ds);
+
+  LevenbergMarquardtAlgorithm lma(&pf);
+
+  PerformanceTerm::TermsJacobianProducts terms_Jacobian_products;
+
+  Vector<double> gradient;
+  Vector<double> parameters_increment;
+  Vector<double> residual;
+
+  unsigned iterations_number;
+
+  // Test
+
+  nn.randomize_parameters_normal();
+
+  ds.randomize_data_normal();
+
+  lma.set_damping_parameter(1.0e-2);
+  lma.set_conjugate_gradient_tolerance(1.0e-9);
+  lma.set_maximum_conjugate_gradient_iterations_number(1000);
+
+  terms_Jacobian_products = pf.calculate_terms_Jacobian_products();
+
+  gradient = terms_Jacobian_products.JacobianT_dot_terms * 2.0;
+
+  iterations_number = lma.calculate_conjugate_gradient_increment(
+      gradient, terms_Jacobian_products.JacobianT_dot_Jacobian.get_diagonal(),
+      parameters_increment);
+
+  residual =
+      terms_Jacobian_products.JacobianT_dot_Jacobian.dot(parameters_increment) +
+      parameters_increment * lma.get_damping_parameter() + gradient;
+
+  assert_true(iterations_number > 0, LOG);
+  assert_true(residual.calculate_norm() <= 1.0e-6 * gradient.calculate_norm(),
+              LOG);
+
+  // Test
+
+  lma.set_maximum_conjugate_gradient_iterations_number(1);
+
+  iterations_number = lma.calculate_conjugate_gradient_increment(
+      gradient, terms_Jacobian_products.JacobianT_dot_Jacobian.get_diagonal(),
+      parameters_increment);
+
+  assert_true(iterations_number == 1, LOG);
+  assert_true(gradient.dot(parameters_increment) < 0.0, LOG);
+}
+
 void LevenbergMarquardtAlgorithmTest::test_set_reserve_all_training_history(
     void) {
   message += "test_set_reserve_all_training_history\n";
@@ -411,6 +490,58 @@ void LevenbergMarquardtAlgorithmTest::test_perform_training(void) {
   gradient_norm = gradient.calculate_norm();
 
   assert_true(gradient_norm < gradient_norm_goal, LOG);
+
+  // Conjugate gradient solver
+
+  nn.set(2, 3, 1);
+  nn.randomize_parameters_normal();
+
+  ds.set(2, 1, 20);
+  ds.randomize_data_normal();
+
+  lma.set_default();
+  lma.set_display(false);
+  lma.set_solver_type(LevenbergMarquardtAlgorithm::CONJUGATE_GRADIENT_SOLVER);
+  lma.set_maximum_iterations_number(10);
+
+  old_performance = pf.calculate_performance();
+
+  lma.perform_training();
+
+  performance = pf.calculate_performance();
+
+  assert_true(performance < old_performance, LOG);
+
+  // Hessian approximation history
+
+  nn.randomize_parameters_normal();
+
+  lma.set_default();
+  lma.set_display(false);
+  lma.set_reserve_Hessian_approximation_history(true);
+  lma.set_maximum_iterations_number(1);
+
+  LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* lmatr =
+      lma.perform_training();
+
+  const unsigned parameters_number = nn.count_parameters_number();
+
+  const Matrix<double>& Hessian_approximation =
+      lmatr->Hessian_approximation_history[0];
+
+  assert_true(Hessian_approximation.get_rows_number() == parameters_number,
+              LOG);
+
+  // Neither the Cholesky factor nor the tridiagonal reduction write above the
+  // superdiagonal
+
+  for (unsigned i = 0; i < parameters_number; i++) {
+    for (unsigned j = i + 2; j < parameters_number; j++) {
+      assert_true(Hessian_approximation[i][j] == 0.0, LOG);
+    }
+  }
+
+  delete lmatr;
 }
 
 void LevenbergMarquardtAlgorithmTest::test_resize_training_history(void) {
@@ -435,6 +566,17 @@ void LevenbergMarquardtAlgorithmTest::test_resize_training_history(void) {
 
   assert_true(lmatr.damping_parameter_history.size() == 1, LOG);
   assert_true(lmatr.elapsed_time_history.size() == 1, LOG);
+
+  // Test
+
+  lma.set_solver_type(LevenbergMarquardtAlgorithm::CONJUGATE_GRADIENT_SOLVER);
+
+  LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults lmatr2(&lma);
+
+  lmatr2.resize_training_history(1);
+
+  assert_true(lmatr2.gradient_history.size() == 1, LOG);
+  assert_true(lmatr2.Hessian_approximation_history.empty(), LOG);
 }
 
 void LevenbergMarquardtAlgorithmTest::test_to_XML(void) {
@@ -451,6 +593,29 @@ void LevenbergMarquardtAlgorithmTest::test_from_XML(void) {
   message += "test_from_XML\n";
 
   LevenbergMarquardtAlgorithm lma;
+
+  LevenbergMarquardtAlgorithm lma2;
+
+  tinyxml2::XMLDocument* lmad;
+
+  // Test
+
+  lma.set_solver_type(LevenbergMarquardtAlgorithm::CONJUGATE_GRADIENT_SOLVER);
+  lma.set_maximum_conjugate_gradient_iterations_number(7);
+  lma.set_conjugate_gradient_tolerance(1.0e-5);
+
+  lmad = lma.to_XML();
+
+  lma2.from_XML(*lmad);
+
+  assert_true(lma2.get_solver_type() ==
+                  LevenbergMarquardtAlgorithm::CONJUGATE_GRADIENT_SOLVER,
+              LOG);
+  assert_true(lma2.get_maximum_conjugate_gradient_iterations_number() == 7,
+              LOG);
+  assert_true(lma2.get_conjugate_gradient_tolerance() == 1.0e-5, LOG);
+
+  delete lmad;
 }
 
 void LevenbergMarquardtAlgorithmTest::run_test_case(void) {
@@ -479,12 +644,16 @@ void LevenbergMarquardtAlgorithmTest::run_test_case(void) {
   test_set_minimum_damping_parameter();
   test_set_maximum_damping_parameter();
 
+  test_set_solver_type();
+
   // Training methods
 
   test_calculate_performance();
   test_calculate_gradient();
   test_calculate_Hessian_approximation();
 
+  test_calculate_conjugate_gradient_increment();
+
   test_perform_training();
 
   // Training history methods
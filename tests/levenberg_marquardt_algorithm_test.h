@@ -70,12 +70,16 @@ class LevenbergMarquardtAlgorithmTest : public UnitTesting {
   void test_set_minimum_damping_parameter(void);
   void test_set_maximum_damping_parameter(void);
 
+  void test_set_solver_type(void);
+
   // Training methods
 
   void test_calculate_performance(void);
   void test_calculate_gradient(void);
   void test_calculate_Hessian_approximation(void);
 
+  void test_calculate_conjugate_gradient_increment(void);
+
   void test_perform_training(void);
 
   // Training history methods
@@ -100,6 +100,153 @@ void LinearAlgebraicEquationsTest::test_perform_Gauss_Jordan_elimination(void) {
   assert_true(b.size() == 100, LOG);
 }
 
+void LinearAlgebraicEquationsTest::test_perform_Cholesky_factorization(
+    void) {
+  message += "test_perform_Cholesky_factorization\n";
+
+  Matrix<double> a;
+  Matrix<double> L;
+
+  // Test
+
+  a.set(2, 2);
+  a[0][0] = 4.0;
+  a[0][1] = 2.0;
+  a[1][0] = 2.0;
+  a[1][1] = 5.0;
+
+  L = a;
+
+  assert_true(LinearAlgebraicEquations::perform_Cholesky_factorization(L), LOG);
+  assert_true(L[0][0] == 2.0, LOG);
+  assert_true(L[1][0] == 1.0, LOG);
+  assert_true(L[1][1] == 2.0, LOG);
+
+  // Test
+
+  a[1][1] = -1.0;
+
+  L = a;
+
+  assert_true(!LinearAlgebraicEquations::perform_Cholesky_factorization(L),
+              LOG);
+}
+
+void LinearAlgebraicEquationsTest::test_calculate_Cholesky_solution(void) {
+  message += "test_calculate_Cholesky_solution\n";
+
+  Matrix<double> a;
+  Matrix<double> j;
+  Vector<double> b;
+  Vector<double> x;
+
+  // Test
+
+  j.set(30, 20);
+  j.randomize_normal();
+
+  a = j.calculate_transpose().dot(j);
+
+  b.set(20);
+  b.randomize_normal();
+
+  x = LinearAlgebraicEquations::calculate_Cholesky_solution(a, b);
+
+  assert_true((a.dot(x) - b).calculate_absolute_value() < 1.0e-6, LOG);
+
+  // Test
+
+  a.set(3, 3);
+  a[0][0] = 1.0;
+  a[0][1] = 2.0;
+  a[0][2] = 0.0;
+  a[1][0] = 2.0;
+  a[1][1] = 1.0;
+  a[1][2] = 1.0;
+  a[2][0] = 0.0;
+  a[2][1] = 1.0;
+  a[2][2] = 3.0;
+
+  b.set(3);
+  b[0] = 1.0;
+  b[1] = -1.0;
+  b[2] = 2.0;
+
+  x = LinearAlgebraicEquations::calculate_Cholesky_solution(a, b);
+
+  assert_true((a.dot(x) - b).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+void LinearAlgebraicEquationsTest::test_perform_tridiagonal_substitution(
+    void) {
+  message += "test_perform_tridiagonal_substitution\n";
+
+  Matrix<double> a;
+  Matrix<double> j;
+  Matrix<double> reduction;
+  Matrix<double> shifted;
+  Vector<double> b;
+  Vector<double> x;
+
+  // Test
+
+  j.set(30, 20);
+  j.randomize_normal();
+
+  a = j.calculate_transpose().dot(j);
+
+  reduction = a;
+
+  for (unsigned row = 0; row < 20; row++) {
+    for (unsigned column = row + 1; column < 20; column++) {
+      reduction[row][column] = 0.0;
+    }
+  }
+
+  LinearAlgebraicEquations::perform_tridiagonal_reduction(reduction);
+
+  b.set(20);
+  b.randomize_normal();
+
+  for (unsigned k = 0; k < 3; k++) {
+    const double shift = k == 0 ? 1.0e-3 : k == 1 ? 1.0 : 100.0;
+
+    shifted = a;
+
+    for (unsigned i = 0; i < 20; i++) {
+      shifted[i][i] += shift;
+    }
+
+    x = b;
+
+    assert_true(LinearAlgebraicEquations::perform_tridiagonal_substitution(
+                    reduction, shift, x),
+                LOG);
+    assert_true((shifted.dot(x) - b).calculate_absolute_value() < 1.0e-6, LOG);
+  }
+
+  // Test
+
+  a.set(2, 2);
+  a[0][0] = 4.0;
+  a[0][1] = 2.0;
+  a[1][0] = 2.0;
+  a[1][1] = 5.0;
+
+  reduction = a;
+
+  LinearAlgebraicEquations::perform_tridiagonal_reduction(reduction);
+
+  x.set(2, 1.0);
+
+  assert_true(LinearAlgebraicEquations::perform_tridiagonal_substitution(
+                  reduction, 0.0, x),
+              LOG);
+  assert_true(!LinearAlgebraicEquations::perform_tridiagonal_substitution(
+                  reduction, -10.0, x),
+              LOG);
+}
+
 void LinearAlgebraicEquationsTest::run_test_case(void) {
   message += "Running linear algebraic equations test case...\n";
 
@@ -112,6 +259,15 @@ void LinearAlgebraicEquationsTest::run_test_case(void) {
 
   test_perform_Gauss_Jordan_elimination();
 
+  // Cholesky methods
+
+  test_perform_Cholesky_factorization();
+  test_calculate_Cholesky_solution();
+
+  // Tridiagonal reduction methods
+
+  test_perform_tridiagonal_substitution();
+
   message += "End of linear algebraic equations test case.\n";
 }
 
@@ -53,6 +53,15 @@ class LinearAlgebraicEquationsTest : public UnitTesting {
 
   void test_perform_Gauss_Jordan_elimination(void);
 
+  // Cholesky methods
+
+  void test_perform_Cholesky_factorization(void);
+  void test_calculate_Cholesky_solution(void);
+
+  // Tridiagonal reduction methods
+
+  void test_perform_tridiagonal_substitution(void);
+
   // Unit testing methods
 
   void run_test_case(void);
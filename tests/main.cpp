@@ -46,6 +46,8 @@ int main(void) {
                "perceptron_layer\n"
                "perceptron\n"
                "neural_network\n"
+               "inference_plan\n"
+               "quantized_multilayer_perceptron\n"
                "multilayer_perceptron\n"
                "inputs\n"
                "outputs\n"
@@ -71,6 +73,7 @@ int main(void) {
                "random_search\n"
                "quasi_newton_method\n"
                "newton_method\n"
+               "truncated_newton_method\n"
                "levenberg_marquardt_algorithm\n"
                "gradient_descent\n"
                "evolutionary_algorithm\n"
@@ -288,6 +291,22 @@ int main(void) {
       tests_count += neural_network_test.get_tests_count();
       tests_passed_count += neural_network_test.get_tests_passed_count();
       tests_failed_count += neural_network_test.get_tests_failed_count();
+    } else if (test == "inference_plan") {
+      InferencePlanTest inference_plan_test;
+      inference_plan_test.run_test_case();
+      message += inference_plan_test.get_message();
+      tests_count += inference_plan_test.get_tests_count();
+      tests_passed_count += inference_plan_test.get_tests_passed_count();
+      tests_failed_count += inference_plan_test.get_tests_failed_count();
+    } else if (test == "quantized_multilayer_perceptron") {
+      QuantizedMultilayerPerceptronTest quantized_multilayer_perceptron_test;
+      quantized_multilayer_perceptron_test.run_test_case();
+      message += quantized_multilayer_perceptron_test.get_message();
+      tests_count += quantized_multilayer_perceptron_test.get_tests_count();
+      tests_passed_count +=
+          quantized_multilayer_perceptron_test.get_tests_passed_count();
+      tests_failed_count +=
+          quantized_multilayer_perceptron_test.get_tests_failed_count();
     }
 
         //
@@ -454,6 +473,15 @@ int main(void) {
       tests_count += Newton_method_test.get_tests_count();
       tests_passed_count += Newton_method_test.get_tests_passed_count();
       tests_failed_count += Newton_method_test.get_tests_failed_count();
+    } else if (test == "truncated_newton_method") {
+      TruncatedNewtonMethodTest truncated_Newton_method_test;
+      truncated_Newton_method_test.run_test_case();
+      message += truncated_Newton_method_test.get_message();
+      tests_count += truncated_Newton_method_test.get_tests_count();
+      tests_passed_count +=
+          truncated_Newton_method_test.get_tests_passed_count();
+      tests_failed_count +=
+          truncated_Newton_method_test.get_tests_failed_count();
     } else if (test == "conjugate_gradient") {
       ConjugateGradientTest conjugate_gradient_test;
       conjugate_gradient_test.run_test_case();
@@ -730,6 +758,26 @@ int main(void) {
       tests_passed_count += neural_network_test.get_tests_passed_count();
       tests_failed_count += neural_network_test.get_tests_failed_count();
 
+      // inference plan
+
+      InferencePlanTest inference_plan_test;
+      inference_plan_test.run_test_case();
+      message += inference_plan_test.get_message();
+      tests_count += inference_plan_test.get_tests_count();
+      tests_passed_count += inference_plan_test.get_tests_passed_count();
+      tests_failed_count += inference_plan_test.get_tests_failed_count();
+
+      // quantized multilayer perceptron
+
+      QuantizedMultilayerPerceptronTest quantized_multilayer_perceptron_test;
+      quantized_multilayer_perceptron_test.run_test_case();
+      message += quantized_multilayer_perceptron_test.get_message();
+      tests_count += quantized_multilayer_perceptron_test.get_tests_count();
+      tests_passed_count +=
+          quantized_multilayer_perceptron_test.get_tests_passed_count();
+      tests_failed_count +=
+          quantized_multilayer_perceptron_test.get_tests_failed_count();
+
       // P E R F O R M A N C E   F U N C T I O N A L   T E S T S
 
       // performance term
@@ -930,6 +978,17 @@ int main(void) {
       tests_passed_count += Newton_method_test.get_tests_passed_count();
       tests_failed_count += Newton_method_test.get_tests_failed_count();
 
+      // truncated newton method
+
+      TruncatedNewtonMethodTest truncated_Newton_method_test;
+      truncated_Newton_method_test.run_test_case();
+      message += truncated_Newton_method_test.get_message();
+      tests_count += truncated_Newton_method_test.get_tests_count();
+      tests_passed_count +=
+          truncated_Newton_method_test.get_tests_passed_count();
+      tests_failed_count +=
+          truncated_Newton_method_test.get_tests_failed_count();
+
       // conjugate gradient
 
       ConjugateGradientTest conjugate_gradient_test;
@@ -660,7 +660,102 @@ void MatrixTest::test_set_to_identity(void) {
   assert_true(a == b, LOG);
 }
 
-void MatrixTest::test_dot(void) { message += "test_dot\n"; }
+void MatrixTest::test_dot(void) {
+  message += "test_dot\n";
+
+  Matrix<double> a;
+  Matrix<double> b;
+  Matrix<double> c;
+
+  Vector<double> v;
+  Vector<double> w;
+
+  double sum;
+  double error;
+
+  // Test
+
+  a.set(2, 2);
+  a[0][0] = 1.0;
+  a[0][1] = 2.0;
+  a[1][0] = 3.0;
+  a[1][1] = 4.0;
+
+  b.set(2, 2);
+  b[0][0] = 5.0;
+  b[0][1] = 6.0;
+  b[1][0] = 7.0;
+  b[1][1] = 8.0;
+
+  c = a.dot(b);
+
+  assert_true(c[0][0] == 19.0, LOG);
+  assert_true(c[0][1] == 22.0, LOG);
+  assert_true(c[1][0] == 43.0, LOG);
+  assert_true(c[1][1] == 50.0, LOG);
+
+  // Test
+
+  v.set(2);
+  v[0] = 1.0;
+  v[1] = -1.0;
+
+  w = a.dot(v);
+
+  assert_true(w.size() == 2, LOG);
+  assert_true(w[0] == -1.0, LOG);
+  assert_true(w[1] == -1.0, LOG);
+
+  // Test
+
+  a.set(67, 131);
+  a.randomize_normal();
+
+  b.set(131, 259);
+  b.randomize_normal();
+
+  c = a.dot(b);
+
+  assert_true(c.get_rows_number() == 67, LOG);
+  assert_true(c.get_columns_number() == 259, LOG);
+
+  error = 0.0;
+
+  for (unsigned i = 0; i < 67; i++) {
+    for (unsigned j = 0; j < 259; j++) {
+      sum = 0.0;
+
+      for (unsigned k = 0; k < 131; k++) {
+        sum += a[i][k] * b[k][j];
+      }
+
+      error += fabs(c[i][j] - sum);
+    }
+  }
+
+  assert_true(error < 1.0e-9, LOG);
+
+  // Test
+
+  v.set(131);
+  v.randomize_normal();
+
+  w = a.dot(v);
+
+  error = 0.0;
+
+  for (unsigned i = 0; i < 67; i++) {
+    sum = 0.0;
+
+    for (unsigned k = 0; k < 131; k++) {
+      sum += a[i][k] * v[k];
+    }
+
+    error += fabs(w[i] - sum);
+  }
+
+  assert_true(error < 1.0e-9, LOG);
+}
 
 void MatrixTest::test_calculate_mean_standard_deviation(void) {
   message += "test_calculate_mean_standard_deviation\n";
@@ -809,9 +904,17 @@ void MatrixTest::test_calculate_cofactor(void) {
 void MatrixTest::test_calculate_inverse(void) {
   message += "test_calculate_inverse\n";
 
-  Matrix<double> m(1, 1, 1.0);
+  Matrix<double> m(1, 1, 2.0);
+  Matrix<double> inverse;
+  Matrix<double> identity;
+
+  // Test
 
-  //   assert_true(m.calculate_inverse() == 1.0, LOG);
+  inverse = m.calculate_inverse();
+
+  assert_true(inverse == 0.5, LOG);
+
+  // Test
 
   m.resize(2, 2);
 
@@ -821,7 +924,14 @@ void MatrixTest::test_calculate_inverse(void) {
   m[1][0] = 3.0;
   m[1][1] = 4.0;
 
-  //   assert_true(m.calculate_inverse() == -2, LOG);
+  inverse = m.calculate_inverse();
+
+  assert_true(fabs(inverse[0][0] + 2.0) < 1.0e-12, LOG);
+  assert_true(fabs(inverse[0][1] - 1.0) < 1.0e-12, LOG);
+  assert_true(fabs(inverse[1][0] - 1.5) < 1.0e-12, LOG);
+  assert_true(fabs(inverse[1][1] + 0.5) < 1.0e-12, LOG);
+
+  // Test
 
   m.resize(3, 3);
 
@@ -835,33 +945,116 @@ void MatrixTest::test_calculate_inverse(void) {
 
   m[2][0] = 7.0;
   m[2][1] = 8.0;
-  m[2][2] = 9.0;
+  m[2][2] = 0.0;
 
-  //   assert_true(m.calculate_inverse() == 0, LOG);
+  inverse = m.calculate_inverse();
 
-  m.resize(4, 4);
+  identity.set_identity(3);
+
+  assert_true((m.dot(inverse) - identity).calculate_absolute_value() < 1.0e-12,
+              LOG);
+
+  // Test
+
+  m.set(12, 12);
+  m.randomize_normal();
+
+  inverse = m.calculate_inverse();
+
+  identity.set_identity(12);
+
+  assert_true((m.dot(inverse) - identity).calculate_absolute_value() < 1.0e-9,
+              LOG);
+}
+
+void MatrixTest::test_LU_factorization(void) {
+  message += "test_LU_factorization\n";
+
+  Matrix<double> m;
+
+  Vector<double> b;
+  Vector<double> x;
+
+  Matrix<double> B;
+  Matrix<double> X;
+
+  // Test
+
+  m.set(3, 3);
+
+  m[0][0] = 0.0;
+  m[0][1] = 2.0;
+  m[0][2] = 1.0;
+
+  m[1][0] = 1.0;
+  m[1][1] = 1.0;
+  m[1][2] = 0.0;
+
+  m[2][0] = 3.0;
+  m[2][1] = 0.0;
+  m[2][2] = 1.0;
+
+  LUFactorization<double> LU_factorization(m);
+
+  assert_true(!LU_factorization.is_singular(), LOG);
+  assert_true(fabs(LU_factorization.calculate_determinant() + 5.0) < 1.0e-12,
+              LOG);
+  assert_true(LU_factorization.calculate_determinant_sign() == -1, LOG);
+  assert_true(
+      fabs(LU_factorization.calculate_log_determinant() - log(5.0)) < 1.0e-12,
+      LOG);
+
+  b.set(3);
+  b[0] = 3.0;
+  b[1] = 2.0;
+  b[2] = 4.0;
+
+  x = LU_factorization.calculate_solution(b);
+
+  assert_true((m.dot(x) - b).calculate_absolute_value() < 1.0e-12, LOG);
+
+  // Test
+
+  m.set(20, 20);
+  m.randomize_normal();
+
+  B.set(20, 3);
+  B.randomize_normal();
+
+  LU_factorization.set(m);
+
+  X = LU_factorization.calculate_solution(B);
+
+  assert_true(X.get_rows_number() == 20, LOG);
+  assert_true(X.get_columns_number() == 3, LOG);
+  assert_true((m.dot(X) - B).calculate_absolute_value() < 1.0e-9, LOG);
+
+  x = LU_factorization.calculate_solution(B.arrange_column(1));
+
+  assert_true((x - X.arrange_column(1)).calculate_absolute_value() < 1.0e-12,
+              LOG);
+
+  // Test
+
+  m.set(3, 3);
 
   m[0][0] = 1.0;
   m[0][1] = 2.0;
   m[0][2] = 3.0;
-  m[0][3] = 4.0;
 
-  m[1][0] = 5.0;
-  m[1][1] = 6.0;
-  m[1][2] = 7.0;
-  m[1][3] = 8.0;
+  m[1][0] = 2.0;
+  m[1][1] = 4.0;
+  m[1][2] = 6.0;
 
-  m[2][0] = 9.0;
-  m[2][1] = 10.0;
-  m[2][2] = 11.0;
-  m[2][3] = 12.0;
+  m[2][0] = 1.0;
+  m[2][1] = 0.0;
+  m[2][2] = 1.0;
 
-  m[3][0] = 13.0;
-  m[3][1] = 14.0;
-  m[3][2] = 15.0;
-  m[3][3] = 16.0;
+  LU_factorization.set(m);
 
-  //   assert_true(m.calculate_inverse() == 0, LOG);
+  assert_true(LU_factorization.is_singular(), LOG);
+  assert_true(LU_factorization.calculate_determinant() == 0.0, LOG);
+  assert_true(LU_factorization.calculate_determinant_sign() == 0, LOG);
 }
 
 void MatrixTest::test_is_symmetric(void) {
@@ -1202,6 +1395,8 @@ void MatrixTest::run_test_case(void) {
   test_calculate_cofactor();
   test_calculate_inverse();
 
+  test_LU_factorization();
+
   test_is_symmetric();
   test_is_antisymmetric();
 
@@ -155,6 +155,8 @@ class MatrixTest : public UnitTesting {
   void test_calculate_cofactor(void);
   void test_calculate_inverse(void);
 
+  void test_LU_factorization(void);
+
   void test_is_symmetric(void);
   void test_is_antisymmetric(void);
 
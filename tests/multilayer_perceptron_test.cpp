@@ -1111,6 +1111,63 @@ void MultilayerPerceptronTest::test_calculate_outputs(void) {
   assert_true(mlp.calculate_outputs(inputs) ==
                   mlp.calculate_outputs(inputs, parameters),
               LOG);
+
+  // Test
+
+  mlp.set(3, 4, 2);
+  mlp.randomize_parameters_normal();
+
+  Matrix<double> input_data(6, 3);
+  input_data.randomize_normal();
+
+  Vector<Matrix<double> > layers_outputs;
+
+  mlp.calculate_outputs(input_data, layers_outputs);
+
+  assert_true(layers_outputs.size() == 2, LOG);
+  assert_true(layers_outputs[0].get_columns_number() == 4, LOG);
+
+  Matrix<double> output_data = mlp.calculate_outputs(input_data);
+
+  assert_true(output_data == layers_outputs[1], LOG);
+
+  for (unsigned i = 0; i < 6; i++) {
+    outputs = mlp.calculate_outputs(input_data.arrange_row(i));
+
+    assert_true(
+        (output_data.arrange_row(i) - outputs).calculate_norm() < 1.0e-12,
+        LOG);
+  }
+
+  // Test
+
+  Vector<unsigned> architecture(4);
+  architecture[0] = 3;
+  architecture[1] = 5;
+  architecture[2] = 4;
+  architecture[3] = 2;
+
+  mlp.set(architecture);
+  mlp.randomize_parameters_normal();
+
+  parameters.set(mlp.count_parameters_number());
+  parameters.randomize_normal();
+
+  output_data = mlp.calculate_outputs(input_data, parameters);
+
+  assert_true(output_data.get_rows_number() == 6, LOG);
+  assert_true(output_data.get_columns_number() == 2, LOG);
+
+  for (unsigned i = 0; i < 6; i++) {
+    potential_outputs =
+        mlp.calculate_outputs(input_data.arrange_row(i), parameters);
+
+    assert_true(output_data.arrange_row(i) == potential_outputs, LOG);
+  }
+
+  mlp.set_parameters(parameters);
+
+  assert_true(mlp.calculate_outputs(input_data) == output_data, LOG);
 }
 
 void MultilayerPerceptronTest::test_calculate_Jacobian(void) {
@@ -618,6 +618,26 @@ void NeuralNetworkTest::test_calculate_output_data(void) {
   output_data = nn.calculate_output_data(input_data);
 
   assert_true(output_data.get_rows_number() == 2, LOG);
+
+  // Test
+
+  nn.set(2, 3, 2);
+  nn.randomize_parameters_normal();
+
+  input_data.set(4, 2);
+  input_data.randomize_normal();
+
+  output_data = nn.calculate_outputs(input_data);
+
+  assert_true(output_data.get_rows_number() == 4, LOG);
+  assert_true(output_data.get_columns_number() == 2, LOG);
+
+  for (unsigned i = 0; i < 4; i++) {
+    assert_true((output_data.arrange_row(i) -
+                 nn.calculate_outputs(input_data.arrange_row(i)))
+                        .calculate_norm() < 1.0e-12,
+                LOG);
+  }
 }
 
 // @todo
@@ -51,6 +51,8 @@
 #include "outputs_test.h"
 #include "independent_parameters_test.h"
 #include "neural_network_test.h"
+#include "inference_plan_test.h"
+#include "quantized_multilayer_perceptron_test.h"
 
 #include "mock_performance_term.h"
 #include "performance_term_test.h"
@@ -76,6 +78,7 @@
 #include "conjugate_gradient_test.h"
 #include "quasi_newton_method_test.h"
 #include "newton_method_test.h"
+#include "truncated_newton_method_test.h"
 #include "levenberg_marquardt_algorithm_test.h"
 #include "training_strategy_test.h"
 
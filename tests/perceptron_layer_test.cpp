@@ -91,6 +91,35 @@ void PerceptronLayerTest::test_get_perceptrons_number(void) {
   assert_true(pl.get_perceptrons_number() == 1, LOG);
 }
 
+void PerceptronLayerTest::test_get_perceptron(void) {
+  message += "test_get_perceptron\n";
+
+  PerceptronLayer pl(3, 2);
+
+  pl.set_activation_function(Perceptron::Logistic);
+
+  Perceptron perceptron = pl.get_perceptron(1);
+
+  // Test
+
+  assert_true(perceptron.get_inputs_number() == 3, LOG);
+  assert_true(perceptron.get_activation_function() == Perceptron::Logistic,
+              LOG);
+  assert_true(perceptron.arrange_parameters() ==
+                  pl.get_parameters().take_out(4, 4),
+              LOG);
+
+  // Test
+
+  perceptron.initialize_parameters(0.5);
+
+  pl.set_perceptron(1, perceptron);
+
+  assert_true(pl.get_parameters().take_out(4, 4) == 0.5, LOG);
+  assert_true(pl.get_synaptic_weights_pointer(1)[2] == 0.5, LOG);
+  assert_true(pl.arrange_parameters() == pl.get_parameters(), LOG);
+}
+
 void PerceptronLayerTest::test_get_activation_function(void) {
   message += "test_get_activation_function\n";
 
@@ -361,6 +390,26 @@ void PerceptronLayerTest::test_prune_input(void) {
 
   assert_true(pl.get_inputs_number() == 0, LOG);
   assert_true(pl.get_perceptrons_number() == 1, LOG);
+
+  // Test
+
+  Vector<double> parameters(6);
+  parameters[0] = 1.0;
+  parameters[1] = 2.0;
+  parameters[2] = 3.0;
+  parameters[3] = 4.0;
+  parameters[4] = 5.0;
+  parameters[5] = 6.0;
+
+  pl.set(2, 2);
+  pl.set_parameters(parameters);
+  pl.prune_input(0);
+
+  assert_true(pl.get_inputs_number() == 1, LOG);
+  assert_true(pl.count_parameters_number() == 4, LOG);
+  assert_true(pl.arrange_biases()[1] == 4.0, LOG);
+  assert_true(pl.arrange_synaptic_weights()[0][0] == 3.0, LOG);
+  assert_true(pl.arrange_synaptic_weights()[1][0] == 6.0, LOG);
 }
 
 void PerceptronLayerTest::test_prune_perceptron(void) {
@@ -1619,6 +1668,170 @@ void PerceptronLayerTest::test_calculate_outputs(void) {
   assert_true(
       pl.calculate_outputs(inputs) == pl.calculate_outputs(inputs, parameters),
       LOG);
+
+  // Test
+
+  pl.set(3, 4);
+  pl.set_activation_function(Perceptron::Logistic);
+  pl.randomize_parameters_normal();
+
+  Matrix<double> input_data(5, 3);
+  input_data.randomize_normal();
+
+  Matrix<double> output_data = pl.calculate_outputs(input_data);
+
+  assert_true(output_data.get_rows_number() == 5, LOG);
+  assert_true(output_data.get_columns_number() == 4, LOG);
+
+  for (unsigned i = 0; i < 5; i++) {
+    outputs = pl.calculate_outputs(input_data.arrange_row(i));
+
+    assert_true(
+        (output_data.arrange_row(i) - outputs).calculate_norm() < 1.0e-12,
+        LOG);
+  }
+
+  // Test
+
+  parameters.set(16);
+  parameters.randomize_normal();
+
+  pl.calculate_outputs(input_data, &parameters[0], output_data);
+
+  assert_true(output_data.get_rows_number() == 5, LOG);
+  assert_true(output_data.get_columns_number() == 4, LOG);
+
+  for (unsigned i = 0; i < 5; i++) {
+    outputs = pl.calculate_outputs(input_data.arrange_row(i), parameters);
+
+    assert_true(output_data.arrange_row(i) == outputs, LOG);
+
+    pl.calculate_outputs(input_data[i], &parameters[0], &outputs[0]);
+
+    assert_true(output_data.arrange_row(i) == outputs, LOG);
+  }
+}
+
+void PerceptronLayerTest::test_calculate_first_order_forward_propagation(
+    void) {
+  message += "test_calculate_first_order_forward_propagation\n";
+
+  PerceptronLayer pl(3, 4);
+
+  Matrix<double> inputs(6, 3);
+  inputs.randomize_normal();
+
+  Matrix<double> combinations;
+
+  Matrix<double> outputs;
+  Matrix<double> activations;
+  Matrix<double> activations_derivatives;
+
+  Vector<Perceptron::ActivationFunction> activation_functions(3);
+  activation_functions[0] = Perceptron::Logistic;
+  activation_functions[1] = Perceptron::HyperbolicTangent;
+  activation_functions[2] = Perceptron::Linear;
+
+  // Test
+
+  pl.randomize_parameters_normal();
+
+  for (unsigned i = 0; i < activation_functions.size(); i++) {
+    for (unsigned j = 0; j < 2; j++) {
+      pl.set_activation_function(activation_functions[i]);
+      pl.set_activation_accuracy(j == 0 ? Perceptron::Exact
+                                        : Perceptron::Fast);
+
+      combinations = pl.calculate_combinations(inputs);
+
+      pl.calculate_outputs(inputs, outputs);
+
+      assert_true(outputs == pl.calculate_activations(combinations), LOG);
+
+      pl.calculate_first_order_forward_propagation(inputs, activations,
+                                                   activations_derivatives);
+
+      assert_true(activations == outputs, LOG);
+      assert_true(activations_derivatives ==
+                      pl.calculate_activations_derivatives(combinations),
+                  LOG);
+    }
+  }
+
+  // Test
+
+  pl.set_activation_function(Perceptron::HyperbolicTangent);
+  pl.set_activation_accuracy(Perceptron::Exact);
+
+  const Vector<double>& parameters = pl.get_parameters();
+
+  Vector<float> single_precision_parameters(parameters.size());
+
+  for (unsigned i = 0; i < parameters.size(); i++) {
+    single_precision_parameters[i] = (float)parameters[i];
+  }
+
+  Matrix<float> single_precision_inputs(6, 3);
+
+  for (unsigned i = 0; i < 6; i++) {
+    for (unsigned j = 0; j < 3; j++) {
+      single_precision_inputs[i][j] = (float)inputs[i][j];
+    }
+  }
+
+  Matrix<float> single_precision_outputs;
+  Matrix<float> single_precision_activations;
+  Matrix<float> single_precision_activations_derivatives;
+
+  pl.calculate_first_order_forward_propagation(inputs, activations,
+                                               activations_derivatives);
+
+  pl.calculate_outputs(single_precision_inputs, &single_precision_parameters[0],
+                       single_precision_outputs);
+
+  pl.calculate_first_order_forward_propagation(
+      single_precision_inputs, &single_precision_parameters[0],
+      single_precision_activations, single_precision_activations_derivatives);
+
+  for (unsigned i = 0; i < 6; i++) {
+    for (unsigned j = 0; j < 4; j++) {
+      assert_true(single_precision_outputs[i][j] ==
+                      single_precision_activations[i][j],
+                  LOG);
+      assert_true(fabs(single_precision_activations[i][j] -
+                       activations[i][j]) < 1.0e-5,
+                  LOG);
+      assert_true(fabs(single_precision_activations_derivatives[i][j] -
+                       activations_derivatives[i][j]) < 1.0e-5,
+                  LOG);
+    }
+  }
+
+  // Test
+
+  pl.set_activation_function(Perceptron::SymmetricThreshold);
+
+  combinations = pl.calculate_combinations(inputs);
+
+  pl.calculate_outputs(inputs, outputs);
+
+  assert_true(outputs == pl.calculate_activations(combinations), LOG);
+
+  // Test
+
+  pl.set_activation_function(Perceptron::Threshold);
+
+  PerceptronLayer copy(pl);
+
+  copy.set_activation_function("Linear");
+
+  pl.calculate_outputs(inputs, outputs);
+
+  assert_true(outputs == pl.calculate_activations(combinations), LOG);
+
+  copy.calculate_outputs(inputs, outputs);
+
+  assert_true(outputs == combinations, LOG);
 }
 
 void PerceptronLayerTest::test_calculate_Jacobian(void) {
@@ -1956,6 +2169,7 @@ void PerceptronLayerTest::run_test_case(void) {
 
   test_count_inputs_number();
   test_get_perceptrons_number();
+  test_get_perceptron();
 
   // PerceptronLayer parameters
 
@@ -2056,6 +2270,7 @@ void PerceptronLayerTest::run_test_case(void) {
   // PerceptronLayer outputs
 
   test_calculate_outputs();
+  test_calculate_first_order_forward_propagation();
 
   test_calculate_Jacobian();
   test_calculate_Hessian_form();
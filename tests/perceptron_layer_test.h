@@ -148,6 +148,7 @@ class PerceptronLayerTest : public UnitTesting {
   // PerceptronLayer outputs
 
   void test_calculate_outputs(void);
+  void test_calculate_first_order_forward_propagation(void);
 
   void test_calculate_Jacobian(void);
   void test_calculate_Hessian_form(void);
@@ -772,6 +772,113 @@ void PerceptronTest::test_calculate_activation_second_derivative(void) {
               LOG);
 }
 
+void PerceptronTest::test_calculate_activations(void) {
+  message += "test_calculate_activations\n";
+
+  Perceptron p;
+
+  const unsigned size = 4001;
+
+  Vector<double> combinations(size);
+
+  for (unsigned i = 0; i < size; i++) {
+    combinations[i] = -20.0 + 0.01 * i;
+  }
+
+  combinations[0] = -800.0;
+  combinations[size - 1] = 800.0;
+
+  Vector<double> exact(size);
+  Vector<double> fast(size);
+
+  bool exact_match;
+  double maximum_error;
+
+  Vector<Perceptron::ActivationFunction> activation_functions(2);
+  activation_functions[0] = Perceptron::Logistic;
+  activation_functions[1] = Perceptron::HyperbolicTangent;
+
+  for (unsigned k = 0; k < activation_functions.size(); k++) {
+    p.set_activation_function(activation_functions[k]);
+
+    // Test
+
+    Perceptron::calculate_activations(activation_functions[k],
+                                      Perceptron::Exact, &combinations[0],
+                                      &exact[0], size);
+
+    Perceptron::calculate_activations(activation_functions[k],
+                                      Perceptron::Fast, &combinations[0],
+                                      &fast[0], size);
+
+    exact_match = true;
+    maximum_error = 0.0;
+
+    for (unsigned i = 0; i < size; i++) {
+      exact_match &= exact[i] == p.calculate_activation(combinations[i]);
+
+      maximum_error = std::max(maximum_error, fabs(fast[i] - exact[i]));
+    }
+
+    assert_true(exact_match, LOG);
+    assert_true(maximum_error < 1.0e-8, LOG);
+
+    // Test
+
+    Perceptron::calculate_activations_derivatives(
+        activation_functions[k], Perceptron::Exact, &combinations[1],
+        &exact[1], size - 2);
+
+    Perceptron::calculate_activations_derivatives(
+        activation_functions[k], Perceptron::Fast, &combinations[1], &fast[1],
+        size - 2);
+
+    exact_match = true;
+    maximum_error = 0.0;
+
+    for (unsigned i = 1; i < size - 1; i++) {
+      exact_match &=
+          exact[i] == p.calculate_activation_derivative(combinations[i]);
+
+      maximum_error = std::max(maximum_error, fabs(fast[i] - exact[i]));
+    }
+
+    assert_true(exact_match, LOG);
+    assert_true(maximum_error < 1.0e-8, LOG);
+
+    // Test
+
+    Perceptron::calculate_activations_second_derivatives(
+        activation_functions[k], Perceptron::Exact, &combinations[1],
+        &exact[1], size - 2);
+
+    Perceptron::calculate_activations_second_derivatives(
+        activation_functions[k], Perceptron::Fast, &combinations[1], &fast[1],
+        size - 2);
+
+    exact_match = true;
+    maximum_error = 0.0;
+
+    for (unsigned i = 1; i < size - 1; i++) {
+      exact_match &= exact[i] ==
+                     p.calculate_activation_second_derivative(combinations[i]);
+
+      maximum_error = std::max(maximum_error, fabs(fast[i] - exact[i]));
+    }
+
+    assert_true(exact_match, LOG);
+    assert_true(maximum_error < 1.0e-8, LOG);
+  }
+
+  // Test
+
+  Perceptron::calculate_activations(Perceptron::SymmetricThreshold,
+                                    Perceptron::Fast, &combinations[0],
+                                    &fast[0], size);
+
+  assert_true(fast[0] == -1.0 && fast[size - 1] == 1.0, LOG);
+}
+
 void PerceptronTest::test_calculate_output(void) {
   message += "test_calculate_output\n";
 
@@ -1220,6 +1327,7 @@ void PerceptronTest::run_test_case(void) {
   test_calculate_activation();
   test_calculate_activation_derivative();
   test_calculate_activation_second_derivative();
+  test_calculate_activations();
 
   // Output methods
 
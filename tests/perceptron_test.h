@@ -116,6 +116,8 @@ class PerceptronTest : public UnitTesting {
   void test_calculate_activation_derivative(void);
   void test_calculate_activation_second_derivative(void);
 
+  void test_calculate_activations(void);
+
   // Output methods
 
   void test_calculate_output(void);
@@ -378,18 +378,89 @@ void PerformanceFunctionalTest::test_calculate_inverse_Hessian(void) {
 void PerformanceFunctionalTest::test_calculate_vector_dot_Hessian(void) {
   message += "test_calculate_vector_dot_Hessian\n";
 
-  //   NeuralNetwork nn(1, 1);
+  DataSet ds;
+  NeuralNetwork nn;
+  PerformanceFunctional pf(&nn, &ds);
 
-  //   unsigned parameters_number = nn.count_parameters_number();
+  unsigned parameters_number;
+  Vector<double> parameters;
+  Vector<double> vector;
 
-  //   PerformanceFunctional pf(&nn);
+  Vector<double> vector_Hessian_product;
+  Vector<double> numerical_vector_Hessian_product;
 
-  //   Vector<double> vector(0.0, 1.0, parameters_number-1.0);
+  const double step = 1.0e-4;
 
-  //   Matrix<double> Hessian = pf.calculate_Hessian();
+  pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+  // Test
+
+  ds.set(1, 1, 2);
+  ds.initialize_data(0.0);
+
+  nn.set(1, 1);
+  nn.initialize_parameters(0.0);
+
+  parameters_number = nn.count_parameters_number();
+
+  vector.set(parameters_number, 1.0);
+
+  vector_Hessian_product = pf.calculate_vector_dot_Hessian(vector);
+
+  assert_true(vector_Hessian_product.size() == parameters_number, LOG);
+
+  // Test
+
+  ds.set(3, 2, 10);
+  ds.randomize_data_normal();
+
+  nn.set(3, 4, 2);
+  nn.randomize_parameters_normal();
+
+  parameters_number = nn.count_parameters_number();
+  parameters = nn.arrange_parameters();
+
+  vector.set(parameters_number);
+  vector.randomize_normal();
+
+  vector_Hessian_product = pf.calculate_vector_dot_Hessian(vector);
 
-  //   assert_true(pf.calculate_vector_dot_Hessian(vector) ==
-  // vector.dot(Hessian), LOG);
+  nn.set_parameters(parameters + vector * step);
+
+  numerical_vector_Hessian_product = pf.calculate_gradient();
+
+  nn.set_parameters(parameters - vector * step);
+
+  numerical_vector_Hessian_product -= pf.calculate_gradient();
+  numerical_vector_Hessian_product /= 2.0 * step;
+
+  nn.set_parameters(parameters);
+
+  assert_true((vector_Hessian_product - numerical_vector_Hessian_product)
+                      .calculate_absolute_value() < 1.0e-3,
+              LOG);
+
+  // Test
+
+  pf.set_objective_type(
+      PerformanceFunctional::NORMALIZED_SQUARED_ERROR_OBJECTIVE);
+
+  vector_Hessian_product = pf.calculate_vector_dot_Hessian(vector);
+
+  nn.set_parameters(parameters + vector * step);
+
+  numerical_vector_Hessian_product = pf.calculate_gradient();
+
+  nn.set_parameters(parameters - vector * step);
+
+  numerical_vector_Hessian_product -= pf.calculate_gradient();
+  numerical_vector_Hessian_product /= 2.0 * step;
+
+  nn.set_parameters(parameters);
+
+  assert_true((vector_Hessian_product - numerical_vector_Hessian_product)
+                      .calculate_absolute_value() < 1.0e-3,
+              LOG);
 }
 
 void PerformanceFunctionalTest::test_calculate_terms(void) {
@@ -443,6 +514,153 @@ void PerformanceFunctionalTest::test_calculate_terms_Jacobian(void) {
   assert_true(terms_Jacobian == 0.0, LOG);
 }
 
+void PerformanceFunctionalTest::test_calculate_first_order_performance(void) {
+  message += "test_calculate_first_order_performance\n";
+
+  DataSet ds(2, 3, 7);
+  NeuralNetwork nn(2, 4, 3);
+  PerformanceFunctional pf(&nn, &ds);
+
+  pf.set_regularization_type(
+      PerformanceFunctional::NEURAL_PARAMETERS_NORM_REGULARIZATION);
+
+  PerformanceFunctional::FirstOrderperformance first_order_performance;
+
+  double performance;
+  Vector<double> gradient;
+
+  Vector<PerformanceFunctional::ObjectiveType> objective_types(5);
+
+  objective_types[0] = PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE;
+  objective_types[1] = PerformanceFunctional::MEAN_SQUARED_ERROR_OBJECTIVE;
+  objective_types[2] = PerformanceFunctional::ROOT_MEAN_SQUARED_ERROR_OBJECTIVE;
+  objective_types[3] =
+      PerformanceFunctional::NORMALIZED_SQUARED_ERROR_OBJECTIVE;
+  objective_types[4] = PerformanceFunctional::MINKOWSKI_ERROR_OBJECTIVE;
+
+  ds.randomize_data_normal();
+  nn.randomize_parameters_normal();
+
+  // Test
+
+  for (unsigned i = 0; i < objective_types.size(); i++) {
+    pf.set_objective_type(objective_types[i]);
+
+    performance = pf.calculate_performance();
+    gradient = pf.calculate_gradient();
+
+    first_order_performance = pf.calculate_first_order_performance();
+
+    assert_true(fabs(first_order_performance.performance - performance) <
+                    1.0e-12 * fabs(performance),
+                LOG);
+    assert_true((first_order_performance.gradient - gradient).calculate_norm() <
+                    1.0e-12 * gradient.calculate_norm(),
+                LOG);
+  }
+}
+
+void PerformanceFunctionalTest::test_calculate_first_order_terms(void) {
+  message += "test_calculate_first_order_terms\n";
+
+  DataSet ds(2, 3, 7);
+  NeuralNetwork nn(2, 4, 3);
+  PerformanceFunctional pf(&nn, &ds);
+
+  PerformanceTerm::FirstOrderTerms first_order_terms;
+
+  ds.randomize_data_normal();
+  nn.randomize_parameters_normal();
+
+  // Test
+
+  pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+  first_order_terms = pf.calculate_first_order_terms();
+
+  assert_true((first_order_terms.terms - pf.calculate_terms())
+                      .calculate_absolute_value() < 1.0e-12,
+              LOG);
+  assert_true((first_order_terms.Jacobian - pf.calculate_terms_Jacobian())
+                      .calculate_absolute_value() < 1.0e-12,
+              LOG);
+
+  // Test
+
+  pf.set_objective_type(PerformanceFunctional::MEAN_SQUARED_ERROR_OBJECTIVE);
+
+  first_order_terms = pf.calculate_first_order_terms();
+
+  assert_true((first_order_terms.terms - pf.calculate_terms())
+                      .calculate_absolute_value() < 1.0e-12,
+              LOG);
+  assert_true((first_order_terms.Jacobian -
+               pf.get_mean_squared_error_objective_pointer()
+                   ->calculate_terms_Jacobian()).calculate_absolute_value() <
+                  1.0e-12,
+              LOG);
+
+  // Test
+
+  pf.set_objective_type(
+      PerformanceFunctional::NORMALIZED_SQUARED_ERROR_OBJECTIVE);
+
+  first_order_terms = pf.calculate_first_order_terms();
+
+  assert_true((first_order_terms.terms - pf.calculate_terms())
+                      .calculate_absolute_value() < 1.0e-12,
+              LOG);
+  assert_true((first_order_terms.Jacobian -
+               pf.get_normalized_squared_error_objective_pointer()
+                   ->calculate_terms_Jacobian()).calculate_absolute_value() <
+                  1.0e-12,
+              LOG);
+}
+
+void PerformanceFunctionalTest::test_calculate_JacobianT_dot_Jacobian_diagonal(
+    void) {
+  message += "test_calculate_JacobianT_dot_Jacobian_diagonal\n";
+
+  DataSet ds(2, 3, 7);
+  NeuralNetwork nn(2, 4, 3);
+  PerformanceFunctional pf(&nn, &ds);
+
+  Matrix<double> terms_Jacobian;
+
+  Vector<double> diagonal;
+
+  ds.randomize_data_normal();
+  nn.randomize_parameters_normal();
+
+  // Test
+
+  pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+  pf.set_user_regularization_pointer(new SumSquaredError(&nn, &ds));
+
+  terms_Jacobian = pf.calculate_objective_terms_Jacobian();
+
+  diagonal = pf.calculate_JacobianT_dot_Jacobian_diagonal();
+
+  assert_true((diagonal - terms_Jacobian.calculate_transpose()
+                              .dot(terms_Jacobian)
+                              .get_diagonal() * 2.0)
+                      .calculate_absolute_value() < 1.0e-9,
+              LOG);
+
+  // Test
+
+  pf.set_user_objective_pointer(new SumSquaredError(&nn, &ds));
+  pf.set_regularization_type(PerformanceFunctional::NO_REGULARIZATION);
+
+  diagonal = pf.calculate_JacobianT_dot_Jacobian_diagonal();
+
+  assert_true((diagonal - terms_Jacobian.calculate_transpose()
+                              .dot(terms_Jacobian)
+                              .get_diagonal())
+                      .calculate_absolute_value() < 1.0e-9,
+              LOG);
+}
+
 void PerformanceFunctionalTest::test_calculate_zero_order_Taylor_approximation(
     void) {
   message += "test_calculate_zero_order_Taylor_approximation\n";
@@ -703,6 +921,11 @@ void PerformanceFunctionalTest::run_test_case(void) {
   test_calculate_terms();
   test_calculate_terms_Jacobian();
 
+  test_calculate_first_order_performance();
+  test_calculate_first_order_terms();
+
+  test_calculate_JacobianT_dot_Jacobian_diagonal();
+
   // Taylor approximation methods
 
   test_calculate_zero_order_Taylor_approximation();
@@ -95,6 +95,11 @@ class PerformanceFunctionalTest : public UnitTesting {
   void test_calculate_terms(void);
   void test_calculate_terms_Jacobian(void);
 
+  void test_calculate_first_order_performance(void);
+  void test_calculate_first_order_terms(void);
+
+  void test_calculate_JacobianT_dot_Jacobian_diagonal(void);
+
   // Taylor approximation methods
 
   void test_calculate_zero_order_Taylor_approximation(void);
@@ -0,0 +1,276 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   Q U A N T I Z E D   M U L T I L A Y E R   P E R C E P T R O N   T E S T   C L A S S
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   E-mail: roberto-lopez@users.sourceforge.n
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "quantized_multilayer_perceptron_test.h"
+
+using namespace OpenNN;
+
+// GENERAL CONSTRUCTOR
+
+QuantizedMultilayerPerceptronTest::QuantizedMultilayerPerceptronTest(void)
+    : UnitTesting() {}
+
+// DESTRUCTOR
+
+QuantizedMultilayerPerceptronTest::~QuantizedMultilayerPerceptronTest(void) {}
+
+// METHODS
+
+void QuantizedMultilayerPerceptronTest::test_constructor(void) {
+  message += "test_constructor\n";
+
+  // Default constructor
+
+  QuantizedMultilayerPerceptron qmlp1;
+
+  assert_true(qmlp1.is_empty(), LOG);
+  assert_true(qmlp1.get_inputs_number() == 0, LOG);
+  assert_true(qmlp1.get_outputs_number() == 0, LOG);
+
+  // Multilayer perceptron constructor
+
+  MultilayerPerceptron mlp(2, 3, 4);
+
+  Matrix<double> calibration_input_data(10, 2);
+  calibration_input_data.randomize_normal();
+
+  QuantizedMultilayerPerceptron qmlp2(mlp, calibration_input_data);
+
+  assert_true(!qmlp2.is_empty(), LOG);
+  assert_true(qmlp2.get_inputs_number() == 2, LOG);
+  assert_true(qmlp2.get_outputs_number() == 4, LOG);
+  assert_true(qmlp2.get_layers_number() == 2, LOG);
+
+  // Calibration input data with wrong number of columns
+
+  calibration_input_data.set(10, 3);
+
+  try {
+    QuantizedMultilayerPerceptron qmlp3(mlp, calibration_input_data);
+
+    assert_true(false, LOG);
+  } catch (const std::logic_error&) {
+    assert_true(true, LOG);
+  }
+}
+
+void QuantizedMultilayerPerceptronTest::test_destructor(void) {
+  message += "test_destructor\n";
+}
+
+void QuantizedMultilayerPerceptronTest::test_get_layer_synaptic_weights(void) {
+  message += "test_get_layer_synaptic_weights\n";
+
+  MultilayerPerceptron mlp(2, 1);
+
+  Matrix<double> calibration_input_data(1, 2, 1.0);
+
+  Vector<double> parameters(3);
+
+  // Test
+
+  parameters[0] = 0.5;
+  parameters[1] = 2.0;
+  parameters[2] = -1.5;
+
+  mlp.set_parameters(parameters);
+
+  QuantizedMultilayerPerceptron qmlp(mlp, calibration_input_data);
+
+  assert_true(qmlp.get_layer_synaptic_weights(0).size() == 2, LOG);
+  assert_true(qmlp.get_layer_synaptic_weights(0)[0] == 127, LOG);
+  assert_true(qmlp.get_layer_synaptic_weights(0)[1] == -95, LOG);
+  assert_true(qmlp.get_layer_synaptic_weights_scales(0)[0] == 2.0 / 127.0,
+              LOG);
+  assert_true(qmlp.get_layer_biases(0)[0] == 0.5, LOG);
+  assert_true(qmlp.get_layer_inputs_scale(0) == 1.0 / 127.0, LOG);
+
+  // Test
+
+  parameters.initialize(0.0);
+
+  mlp.set_parameters(parameters);
+
+  qmlp.set(mlp, calibration_input_data);
+
+  assert_true(qmlp.get_layer_synaptic_weights(0) == Vector<signed char>(2, 0),
+              LOG);
+  assert_true(qmlp.get_layer_synaptic_weights_scales(0)[0] == 1.0, LOG);
+}
+
+void QuantizedMultilayerPerceptronTest::test_count_memory_size(void) {
+  message += "test_count_memory_size\n";
+
+  QuantizedMultilayerPerceptron qmlp;
+
+  assert_true(qmlp.count_memory_size() == 0, LOG);
+
+  // Test
+
+  MultilayerPerceptron mlp(4, 3, 2);
+
+  Matrix<double> calibration_input_data(5, 4);
+  calibration_input_data.randomize_normal();
+
+  qmlp.set(mlp, calibration_input_data);
+
+  assert_true(qmlp.count_memory_size() ==
+                  18 + 5 * 2 * sizeof(double) + 2 * sizeof(double),
+              LOG);
+  assert_true(qmlp.count_memory_size() <
+                  mlp.count_parameters_number() * sizeof(double),
+              LOG);
+}
+
+void QuantizedMultilayerPerceptronTest::test_quantize(void) {
+  message += "test_quantize\n";
+
+  assert_true(QuantizedMultilayerPerceptron::calculate_scale(0.0) == 1.0, LOG);
+  assert_true(QuantizedMultilayerPerceptron::calculate_scale(127.0) == 1.0,
+              LOG);
+
+  assert_true(QuantizedMultilayerPerceptron::quantize(0.0, 1.0) == 0, LOG);
+  assert_true(QuantizedMultilayerPerceptron::quantize(2.4, 1.0) == 2, LOG);
+  assert_true(QuantizedMultilayerPerceptron::quantize(-2.6, 1.0) == -3, LOG);
+  assert_true(QuantizedMultilayerPerceptron::quantize(1.0, 0.01) == 100, LOG);
+  assert_true(QuantizedMultilayerPerceptron::quantize(1000.0, 1.0) == 127,
+              LOG);
+  assert_true(QuantizedMultilayerPerceptron::quantize(-1000.0, 1.0) == -127,
+              LOG);
+}
+
+void QuantizedMultilayerPerceptronTest::test_calculate_outputs(void) {
+  message += "test_calculate_outputs\n";
+
+  MultilayerPerceptron mlp;
+
+  QuantizedMultilayerPerceptron qmlp;
+
+  Matrix<double> calibration_input_data;
+
+  Matrix<double> inputs;
+  Matrix<double> outputs;
+
+  Vector<double> instance_outputs;
+
+  // Test
+
+  mlp.set(1, 1);
+  mlp.initialize_parameters(1.0);
+  mlp.set_layer_activation_function(0, Perceptron::Linear);
+
+  calibration_input_data.set(3, 1);
+  calibration_input_data[0][0] = -1.0;
+  calibration_input_data[1][0] = 0.0;
+  calibration_input_data[2][0] = 1.0;
+
+  qmlp.set(mlp, calibration_input_data);
+
+  qmlp.calculate_outputs(calibration_input_data, outputs);
+
+  assert_true(outputs.get_rows_number() == 3, LOG);
+  assert_true(outputs.get_columns_number() == 1, LOG);
+  assert_true(fabs(outputs[0][0] - 0.0) < 1.0e-12, LOG);
+  assert_true(fabs(outputs[1][0] - 1.0) < 1.0e-12, LOG);
+  assert_true(fabs(outputs[2][0] - 2.0) < 1.0e-12, LOG);
+
+  // Test
+
+  Vector<unsigned> architecture(4);
+  architecture[0] = 8;
+  architecture[1] = 16;
+  architecture[2] = 12;
+  architecture[3] = 3;
+
+  mlp.set(architecture);
+  mlp.randomize_parameters_normal(0.0, 0.5);
+  mlp.set_layer_activation_function(2, Perceptron::Linear);
+
+  calibration_input_data.set(50, 8);
+  calibration_input_data.randomize_uniform(-1.0, 1.0);
+
+  qmlp.set(mlp, calibration_input_data);
+
+  inputs.set(20, 8);
+  inputs.randomize_uniform(-1.0, 1.0);
+
+  outputs = qmlp.calculate_outputs(inputs);
+
+  assert_true(outputs.get_rows_number() == 20, LOG);
+  assert_true(outputs.get_columns_number() == 3, LOG);
+
+  const Matrix<double> float_outputs = mlp.calculate_outputs(inputs);
+
+  const double maximum_output =
+      float_outputs.calculate_absolute_value().calculate_maximum();
+
+  assert_true((outputs - float_outputs)
+                      .calculate_absolute_value()
+                      .calculate_maximum() < 0.05 * maximum_output,
+              LOG);
+
+  // Test
+
+  instance_outputs = qmlp.calculate_outputs(inputs.arrange_row(0));
+
+  assert_true(instance_outputs == outputs.arrange_row(0), LOG);
+}
+
+void QuantizedMultilayerPerceptronTest::run_test_case(void) {
+  message += "Running quantized multilayer perceptron test case...\n";
+
+  // Constructor and destructor methods
+
+  test_constructor();
+  test_destructor();
+
+  // Get methods
+
+  test_get_layer_synaptic_weights();
+  test_count_memory_size();
+
+  // Quantization methods
+
+  test_quantize();
+
+  // Output methods
+
+  test_calculate_outputs();
+
+  message += "End of quantized multilayer perceptron test case.\n";
+}
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2014 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,87 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   Q U A N T I Z E D   M U L T I L A Y E R   P E R C E P T R O N   T E S T   C L A S S   H E A D E R
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __QUANTIZEDMULTILAYERPERCEPTRONTEST_H__
+#define __QUANTIZEDMULTILAYERPERCEPTRONTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+using namespace OpenNN;
+
+class QuantizedMultilayerPerceptronTest : public UnitTesting {
+
+#define STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__) "\n"
+
+ public:
+
+  // GENERAL CONSTRUCTOR
+
+  explicit QuantizedMultilayerPerceptronTest(void);
+
+  // DESTRUCTOR
+
+  virtual ~QuantizedMultilayerPerceptronTest(void);
+
+  // METHODS
+
+  // Constructor and destructor methods
+
+  void test_constructor(void);
+  void test_destructor(void);
+
+  // Get methods
+
+  void test_get_layer_synaptic_weights(void);
+  void test_count_memory_size(void);
+
+  // Quantization methods
+
+  void test_quantize(void);
+
+  // Output methods
+
+  void test_calculate_outputs(void);
+
+  // Unit testing methods
+
+  void run_test_case(void);
+};
+
+#endif
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2014 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -68,6 +68,11 @@ void QuasiNewtonMethodTest::test_get_inverse_Hessian_approximation_method(
   assert_true(
       qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::BFGS,
       LOG);
+
+  qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::L_BFGS);
+  assert_true(qnm.get_inverse_Hessian_approximation_method() ==
+                  QuasiNewtonMethod::L_BFGS,
+              LOG);
 }
 
 void QuasiNewtonMethodTest::test_get_inverse_Hessian_approximation_method_name(
@@ -85,6 +90,16 @@ void QuasiNewtonMethodTest::test_set_inverse_Hessian_approximation_method(
   assert_true(
       qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::BFGS,
       LOG);
+
+  qnm.set_inverse_Hessian_approximation_method("L_BFGS");
+  assert_true(qnm.get_inverse_Hessian_approximation_method() ==
+                  QuasiNewtonMethod::L_BFGS,
+              LOG);
+  assert_true(qnm.write_inverse_Hessian_approximation_method() == "L_BFGS",
+              LOG);
+
+  qnm.set_L_BFGS_history_length(5);
+  assert_true(qnm.get_L_BFGS_history_length() == 5, LOG);
 }
 
 // @todo
@@ -278,10 +293,187 @@ void QuasiNewtonMethodTest::test_calculate_inverse_Hessian_approximation(void) {
   // old_gradient, gradient, old_inverse_Hessian);
 }
 
+void QuasiNewtonMethodTest::test_update_inverse_Hessian_approximation(void) {
+  message += "test_update_inverse_Hessian_approximation\n";
+
+  QuasiNewtonMethod qnm;
+
+  const unsigned parameters_number = 70;
+
+  Matrix<double> identity(parameters_number, parameters_number);
+  identity.initialize_identity();
+
+  Matrix<double> random(parameters_number, parameters_number);
+  random.randomize_normal();
+
+  const Matrix<double> old_inverse_Hessian =
+      random.dot(random.calculate_transpose()) / parameters_number + identity;
+
+  Vector<double> parameters_difference(parameters_number);
+  parameters_difference.randomize_normal();
+
+  Vector<double> gradient_difference(parameters_number);
+  gradient_difference.randomize_normal();
+  gradient_difference = parameters_difference + gradient_difference * 0.1;
+
+  const double rho = 1.0 / parameters_difference.dot(gradient_difference);
+
+  const Vector<double> inverse_Hessian_gradient_difference =
+      old_inverse_Hessian.dot(gradient_difference);
+
+  Matrix<double> inverse_Hessian;
+  Matrix<double> expected_inverse_Hessian;
+
+  // DFP
+
+  expected_inverse_Hessian =
+      old_inverse_Hessian +
+      parameters_difference.direct(parameters_difference) * rho -
+      inverse_Hessian_gradient_difference.direct(
+          inverse_Hessian_gradient_difference) /
+          gradient_difference.dot(inverse_Hessian_gradient_difference);
+
+  inverse_Hessian = old_inverse_Hessian;
+
+  qnm.update_DFP_inverse_Hessian(parameters_difference, gradient_difference,
+                                 inverse_Hessian);
+
+  assert_true((inverse_Hessian - expected_inverse_Hessian)
+                      .calculate_absolute_value()
+                      .calculate_maximum() < 1.0e-12,
+              LOG);
+
+  // BFGS
+
+  const Matrix<double> left =
+      identity - parameters_difference.direct(gradient_difference) * rho;
+
+  expected_inverse_Hessian =
+      left.dot(old_inverse_Hessian).dot(left.calculate_transpose()) +
+      parameters_difference.direct(parameters_difference) * rho;
+
+  inverse_Hessian = old_inverse_Hessian;
+
+  qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::BFGS);
+  qnm.update_inverse_Hessian_approximation(
+      parameters_difference, gradient_difference, inverse_Hessian);
+
+  assert_true((inverse_Hessian - expected_inverse_Hessian)
+                      .calculate_absolute_value()
+                      .calculate_maximum() < 1.0e-12,
+              LOG);
+
+  assert_true(inverse_Hessian == inverse_Hessian.calculate_transpose(), LOG);
+}
+
 void QuasiNewtonMethodTest::test_calculate_training_direction(void) {
   message += "test_calculate_training_direction\n";
 }
 
+void QuasiNewtonMethodTest::test_calculate_L_BFGS_training_direction(void) {
+  message += "test_calculate_L_BFGS_training_direction\n";
+
+  NeuralNetwork nn(1, 1, 1);
+
+  PerformanceFunctional pf(&nn);
+
+  QuasiNewtonMethod qnm(&pf);
+
+  Vector<double> gradient(4);
+  gradient[0] = 1.0;
+  gradient[1] = -2.0;
+  gradient[2] = 0.5;
+  gradient[3] = 3.0;
+
+  Vector<Vector<double> > parameters_differences;
+  Vector<Vector<double> > gradient_differences;
+
+  Vector<double> training_direction;
+
+  // No history
+
+  training_direction = qnm.calculate_L_BFGS_training_direction(
+      gradient, parameters_differences, gradient_differences);
+
+  assert_true(
+      (training_direction + gradient / gradient.calculate_norm())
+              .calculate_absolute_value()
+              .calculate_maximum() < 1.0e-12,
+      LOG);
+
+  // Two pairs, compared with the dense BFGS update from the same scaled
+  // identity
+
+  Vector<double> parameters_difference(4);
+  Vector<double> gradient_difference(4);
+
+  parameters_difference[0] = 0.1;
+  parameters_difference[1] = 0.2;
+  parameters_difference[2] = -0.1;
+  parameters_difference[3] = 0.3;
+
+  gradient_difference[0] = 0.3;
+  gradient_difference[1] = 0.1;
+  gradient_difference[2] = -0.2;
+  gradient_difference[3] = 0.6;
+
+  qnm.update_L_BFGS_history(parameters_difference, gradient_difference,
+                            parameters_differences, gradient_differences);
+
+  parameters_difference[0] = -0.2;
+  parameters_difference[1] = 0.1;
+  parameters_difference[2] = 0.4;
+  parameters_difference[3] = 0.0;
+
+  gradient_difference[0] = -0.5;
+  gradient_difference[1] = 0.2;
+  gradient_difference[2] = 0.7;
+  gradient_difference[3] = 0.1;
+
+  qnm.update_L_BFGS_history(parameters_difference, gradient_difference,
+                            parameters_differences, gradient_differences);
+
+  assert_true(parameters_differences.size() == 2, LOG);
+
+  const Vector<double> zero(4, 0.0);
+
+  Matrix<double> inverse_Hessian(4, 4);
+  inverse_Hessian.initialize_identity();
+  inverse_Hessian *= parameters_difference.dot(gradient_difference) /
+                     gradient_difference.dot(gradient_difference);
+
+  for (unsigned k = 0; k < 2; k++) {
+    inverse_Hessian = qnm.calculate_BFGS_inverse_Hessian(
+        zero, parameters_differences[k], zero, gradient_differences[k],
+        inverse_Hessian);
+  }
+
+  training_direction = qnm.calculate_L_BFGS_training_direction(
+      gradient, parameters_differences, gradient_differences);
+
+  assert_true((training_direction -
+               qnm.calculate_training_direction(gradient, inverse_Hessian))
+                      .calculate_absolute_value()
+                      .calculate_maximum() < 1.0e-9,
+              LOG);
+
+  // Pairs with negative curvature are skipped and the history length is kept
+
+  qnm.update_L_BFGS_history(parameters_difference, gradient_difference * (-1.0),
+                            parameters_differences, gradient_differences);
+
+  assert_true(parameters_differences.size() == 2, LOG);
+
+  qnm.set_L_BFGS_history_length(2);
+
+  qnm.update_L_BFGS_history(gradient_difference, gradient_difference,
+                            parameters_differences, gradient_differences);
+
+  assert_true(parameters_differences.size() == 2, LOG);
+  assert_true(parameters_differences[1] == gradient_difference, LOG);
+  assert_true(parameters_differences[0] == parameters_difference, LOG);
+}
+
 void QuasiNewtonMethodTest::test_perform_training(void) {
   message += "test_perform_training\n";
 
@@ -370,6 +562,49 @@ void QuasiNewtonMethodTest::test_perform_training(void) {
 
   double gradient_norm = pf.calculate_gradient().calculate_norm();
   assert_true(gradient_norm < gradient_norm_goal, LOG);
+
+  // Limited-memory BFGS
+
+  nn.initialize_parameters(3.1415927);
+
+  old_performance = pf.calculate_performance();
+
+  qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::L_BFGS);
+  qnm.set_L_BFGS_history_length(3);
+
+  qnm.set_minimum_parameters_increment_norm(0.0);
+  qnm.set_performance_goal(0.0);
+  qnm.set_minimum_performance_increase(0.0);
+  qnm.set_gradient_norm_goal(0.0);
+  qnm.set_maximum_iterations_number(10);
+  qnm.set_maximum_time(1000.0);
+
+  qnm.perform_training();
+
+  performance = pf.calculate_performance();
+
+  assert_true(performance < old_performance, LOG);
+
+  // Wolfe line search
+
+  nn.initialize_parameters(3.1415927);
+
+  old_performance = pf.calculate_performance();
+
+  qnm.get_training_rate_algorithm_pointer()->set_training_rate_method(
+      TrainingRateAlgorithm::WolfeMethod);
+
+  QuasiNewtonMethod::QuasiNewtonMethodResults* results_pointer =
+      qnm.perform_training();
+
+  performance = pf.calculate_performance();
+
+  assert_true(performance < old_performance, LOG);
+  assert_true(results_pointer->training_rate_evaluations_number >=
+                  results_pointer->iterations_number,
+              LOG);
+
+  delete results_pointer;
 }
 
 void QuasiNewtonMethodTest::test_to_XML(void) {
@@ -392,6 +627,21 @@ void QuasiNewtonMethodTest::test_load(void) {
   qnm.from_XML(*document);
 
   delete document;
+
+  qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::L_BFGS);
+  qnm.set_L_BFGS_history_length(7);
+
+  document = qnm.to_XML();
+
+  QuasiNewtonMethod qnm_copy;
+  qnm_copy.from_XML(*document);
+
+  assert_true(qnm_copy.get_inverse_Hessian_approximation_method() ==
+                  QuasiNewtonMethod::L_BFGS,
+              LOG);
+  assert_true(qnm_copy.get_L_BFGS_history_length() == 7, LOG);
+
+  delete document;
 }
 
 void QuasiNewtonMethodTest::test_set_reserve_all_training_history(void) {
@@ -424,7 +674,9 @@ void QuasiNewtonMethodTest::run_test_case(void) {
   test_calculate_BFGS_inverse_Hessian_approximation();
 
   test_calculate_inverse_Hessian_approximation();
+  test_update_inverse_Hessian_approximation();
   test_calculate_training_direction();
+  test_calculate_L_BFGS_training_direction();
 
   test_perform_training();
 
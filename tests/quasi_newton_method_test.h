@@ -64,7 +64,9 @@ class QuasiNewtonMethodTest : public UnitTesting {
   void test_calculate_BFGS_inverse_Hessian_approximation(void);
 
   void test_calculate_inverse_Hessian_approximation(void);
+  void test_update_inverse_Hessian_approximation(void);
   void test_calculate_training_direction(void);
+  void test_calculate_L_BFGS_training_direction(void);
 
   void test_perform_training(void);
 
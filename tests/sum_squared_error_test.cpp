@@ -131,6 +131,52 @@ void SumSquaredErrorTest::test_calculate_performance(void) {
               LOG);
 }
 
+void SumSquaredErrorTest::test_calculate_performances(void) {
+  message += "test_calculate_performances\n";
+
+  NeuralNetwork nn(3, 4, 2);
+
+  DataSet ds(3, 2, 203);
+
+  SumSquaredError sse(&nn, &ds);
+
+  const unsigned parameters_number = nn.count_parameters_number();
+
+  Vector<Vector<double> > parameters(3);
+
+  Vector<double> performances;
+
+  // Test
+
+  ds.randomize_data_normal();
+
+  sse.set_batch_instances_number(4);
+
+  for (unsigned i = 0; i < parameters.size(); i++) {
+    parameters[i].set(parameters_number);
+    parameters[i].randomize_normal();
+  }
+
+  performances = sse.calculate_performances(parameters);
+
+  assert_true(performances.size() == parameters.size(), LOG);
+
+  for (unsigned i = 0; i < parameters.size(); i++) {
+    assert_true(
+        fabs(performances[i] - sse.calculate_performance(parameters[i])) <
+            1.0e-9,
+        LOG);
+  }
+
+  // Test
+
+  parameters.set();
+
+  performances = sse.calculate_performances(parameters);
+
+  assert_true(performances.empty(), LOG);
+}
+
 void SumSquaredErrorTest::test_calculate_gradient(void) {
   message += "test_calculate_gradient\n";
 
@@ -263,6 +309,38 @@ void SumSquaredErrorTest::test_calculate_gradient(void) {
       sse, &SumSquaredError::calculate_performance, parameters);
   assert_true(
       (gradient - numerical_gradient).calculate_absolute_value() < 1.0e-3, LOG);
+
+  // Test
+
+  architecture.set(4);
+  architecture[0] = 2;
+  architecture[1] = 3;
+  architecture[2] = 4;
+  architecture[3] = 2;
+
+  nn.set(architecture);
+  nn.randomize_parameters_normal();
+  parameters = nn.arrange_parameters();
+
+  ds.set(2, 2, 7);
+  sse.set(&nn, &ds);
+  ds.randomize_data_normal();
+
+  gradient = sse.calculate_gradient();
+  numerical_gradient = nd.calculate_gradient(
+      sse, &SumSquaredError::calculate_performance, parameters);
+  assert_true(
+      (gradient - numerical_gradient).calculate_absolute_value() < 1.0e-3, LOG);
+
+  sse.set_batch_instances_number(1);
+
+  error = (sse.calculate_gradient() - gradient).calculate_absolute_value();
+  assert_true(error < 1.0e-12, LOG);
+
+  sse.set_batch_instances_number(3);
+
+  error = (sse.calculate_gradient() - gradient).calculate_absolute_value();
+  assert_true(error < 1.0e-12, LOG);
 }
 
 // @todo
@@ -611,6 +689,284 @@ void SumSquaredErrorTest::test_from_XML(void) {
   assert_true(sse2.get_display() == false, LOG);
 }
 
+void SumSquaredErrorTest::test_calculate_parallel_evaluation(void) {
+  message += "test_calculate_parallel_evaluation\n";
+
+  NumericalDifferentiation nd;
+
+  NeuralNetwork nn(3, 4, 2);
+  Vector<double> parameters;
+
+  DataSet ds(3, 2, 203);
+
+  SumSquaredError sse(&nn, &ds);
+
+  double performance;
+  Vector<double> gradient;
+  Vector<double> terms;
+  Matrix<double> terms_Jacobian;
+
+  Matrix<double> numerical_Jacobian_terms;
+
+  // Test
+
+  nn.randomize_parameters_normal();
+  parameters = nn.arrange_parameters();
+
+  ds.randomize_data_normal();
+
+  sse.set_batch_instances_number(4);
+  sse.set_deterministic_reduction(true);
+
+  sse.set_threads_number(1);
+
+  performance = sse.calculate_performance();
+  gradient = sse.calculate_gradient();
+  terms = sse.calculate_terms();
+  terms_Jacobian = sse.calculate_terms_Jacobian();
+
+  sse.set_threads_number(4);
+
+  assert_true(sse.calculate_performance() == performance, LOG);
+  assert_true(sse.calculate_gradient() == gradient, LOG);
+  assert_true(sse.calculate_terms() == terms, LOG);
+  assert_true(sse.calculate_terms_Jacobian() == terms_Jacobian, LOG);
+
+  // Test
+
+  sse.set_deterministic_reduction(false);
+
+  assert_true(fabs(sse.calculate_performance() - performance) <
+                  1.0e-12 * performance,
+              LOG);
+  assert_true((sse.calculate_gradient() - gradient).calculate_norm() <
+                  1.0e-12 * gradient.calculate_norm(),
+              LOG);
+  assert_true(sse.calculate_terms() == terms, LOG);
+
+  numerical_Jacobian_terms =
+      nd.calculate_Jacobian(sse, &SumSquaredError::calculate_terms, parameters);
+
+  assert_true((sse.calculate_terms_Jacobian() - numerical_Jacobian_terms)
+                      .calculate_absolute_value() < 1.0e-3,
+              LOG);
+
+  // Test
+
+  nn.set(2, 3, 1);
+  nn.get_multilayer_perceptron_pointer()->set_layer_activation_function(
+      0, Perceptron::Threshold);
+  nn.initialize_parameters(0.0);
+
+  ds.set(2, 1, 10);
+  ds.randomize_data_normal();
+
+  for (unsigned threads_number = 1; threads_number <= 2; threads_number++) {
+    sse.set_threads_number(threads_number);
+
+    try {
+      sse.calculate_gradient();
+
+      assert_true(false, LOG);
+    }
+    catch (const std::logic_error&) {
+      assert_true(true, LOG);
+    }
+  }
+}
+
+void SumSquaredErrorTest::test_calculate_single_precision_evaluation(void) {
+  message += "test_calculate_single_precision_evaluation\n";
+
+  NeuralNetwork nn(3, 4, 2);
+
+  DataSet ds(3, 2, 203);
+
+  SumSquaredError sse(&nn, &ds);
+
+  double performance;
+  Vector<double> gradient;
+
+  PerformanceTerm::FirstOrderPerformance first_order_performance;
+
+  // Test
+
+  nn.randomize_parameters_normal();
+
+  ds.randomize_data_normal();
+
+  sse.set_batch_instances_number(4);
+  sse.set_deterministic_reduction(true);
+
+  performance = sse.calculate_performance();
+  gradient = sse.calculate_gradient();
+
+  sse.set_single_precision(true);
+
+  assert_true(sse.get_single_precision() == true, LOG);
+
+  assert_true(fabs(sse.calculate_performance() - performance) <
+                  1.0e-5 * performance,
+              LOG);
+  assert_true((sse.calculate_gradient() - gradient).calculate_norm() <
+                  1.0e-5 * gradient.calculate_norm(),
+              LOG);
+
+  first_order_performance = sse.calculate_first_order_performance();
+
+  assert_true(first_order_performance.performance ==
+                  sse.calculate_performance(),
+              LOG);
+  assert_true(first_order_performance.gradient == sse.calculate_gradient(),
+              LOG);
+
+  sse.set_threads_number(4);
+
+  assert_true(sse.calculate_gradient() == first_order_performance.gradient,
+              LOG);
+
+  // Test
+
+  ds.scale_inputs_minimum_maximum();
+
+  sse.set_single_precision(false);
+
+  performance = sse.calculate_performance();
+
+  sse.set_single_precision(true);
+
+  assert_true(fabs(sse.calculate_performance() - performance) <
+                  1.0e-5 * performance,
+              LOG);
+}
+
+void SumSquaredErrorTest::test_calculate_terms_Jacobian_products(void) {
+  message += "test_calculate_terms_Jacobian_products\n";
+
+  NeuralNetwork nn(3, 4, 2);
+
+  DataSet ds(3, 2, 203);
+
+  SumSquaredError sse(&nn, &ds);
+
+  Vector<double> terms;
+  Matrix<double> terms_Jacobian;
+
+  PerformanceTerm::TermsJacobianProducts terms_Jacobian_products;
+
+  // Test
+
+  nn.randomize_parameters_normal();
+
+  ds.randomize_data_normal();
+
+  sse.set_batch_instances_number(4);
+
+  terms = sse.calculate_terms();
+  terms_Jacobian = sse.calculate_terms_Jacobian();
+
+  terms_Jacobian_products = sse.calculate_terms_Jacobian_products();
+
+  assert_true(fabs(terms_Jacobian_products.terms_squared_sum -
+                   terms.dot(terms)) < 1.0e-9,
+              LOG);
+  assert_true((terms_Jacobian_products.JacobianT_dot_terms -
+               terms_Jacobian.calculate_transpose().dot(terms))
+                      .calculate_absolute_value() < 1.0e-9,
+              LOG);
+  assert_true((terms_Jacobian_products.JacobianT_dot_Jacobian -
+               terms_Jacobian.calculate_transpose().dot(terms_Jacobian))
+                      .calculate_absolute_value() < 1.0e-9,
+              LOG);
+  assert_true(terms_Jacobian_products.JacobianT_dot_Jacobian.is_symmetric(),
+              LOG);
+
+  // Test
+
+  sse.set_threads_number(3);
+
+  assert_true(sse.calculate_terms_Jacobian_products().JacobianT_dot_Jacobian ==
+                  terms_Jacobian_products.JacobianT_dot_Jacobian,
+              LOG);
+}
+
+void SumSquaredErrorTest::test_calculate_JacobianT_dot_Jacobian_dot_vector(
+    void) {
+  message += "test_calculate_JacobianT_dot_Jacobian_dot_vector\n";
+
+  NeuralNetwork nn(3, 4, 2);
+
+  DataSet ds(3, 2, 203);
+
+  SumSquaredError sse(&nn, &ds);
+
+  Matrix<double> terms_Jacobian;
+
+  Vector<double> vector;
+  Vector<double> product;
+
+  // Test
+
+  nn.randomize_parameters_normal();
+
+  ds.randomize_data_normal();
+
+  sse.set_batch_instances_number(4);
+
+  terms_Jacobian = sse.calculate_terms_Jacobian();
+
+  vector.set(nn.count_parameters_number());
+  vector.randomize_normal();
+
+  product = sse.calculate_JacobianT_dot_Jacobian_dot_vector(vector);
+
+  assert_true((product - terms_Jacobian.calculate_transpose().dot(
+                             terms_Jacobian.dot(vector)))
+                      .calculate_absolute_value() < 1.0e-9,
+              LOG);
+
+  // Test
+
+  sse.set_threads_number(3);
+
+  assert_true((sse.calculate_JacobianT_dot_Jacobian_dot_vector(vector) -
+               product).calculate_absolute_value() < 1.0e-9,
+              LOG);
+}
+
+void SumSquaredErrorTest::test_calculate_JacobianT_dot_Jacobian_diagonal(
+    void) {
+  message += "test_calculate_JacobianT_dot_Jacobian_diagonal\n";
+
+  NeuralNetwork nn(3, 4, 2);
+
+  DataSet ds(3, 2, 203);
+
+  SumSquaredError sse(&nn, &ds);
+
+  Matrix<double> terms_Jacobian;
+
+  Vector<double> diagonal;
+
+  // Test
+
+  nn.randomize_parameters_normal();
+
+  ds.randomize_data_normal();
+
+  sse.set_batch_instances_number(4);
+
+  terms_Jacobian = sse.calculate_terms_Jacobian();
+
+  diagonal = sse.calculate_JacobianT_dot_Jacobian_diagonal();
+
+  assert_true((diagonal - terms_Jacobian.calculate_transpose()
+                              .dot(terms_Jacobian)
+                              .get_diagonal())
+                      .calculate_absolute_value() < 1.0e-9,
+              LOG);
+}
+
 void SumSquaredErrorTest::run_test_case(void) {
   message += "Running sum squared error test case...\n";
 
@@ -626,6 +982,7 @@ void SumSquaredErrorTest::run_test_case(void) {
   // Objective methods
 
   test_calculate_performance();
+  test_calculate_performances();
   test_calculate_generalization_performance();
 
   test_calculate_gradient();
@@ -638,6 +995,17 @@ void SumSquaredErrorTest::run_test_case(void) {
 
   test_calculate_Jacobian_terms();
 
+  test_calculate_terms_Jacobian_products();
+
+  test_calculate_JacobianT_dot_Jacobian_dot_vector();
+  test_calculate_JacobianT_dot_Jacobian_diagonal();
+
+  // Parallel evaluation methods
+
+  test_calculate_parallel_evaluation();
+
+  test_calculate_single_precision_evaluation();
+
   // Serialization methods
 
   test_to_XML();
@@ -56,6 +56,7 @@ class SumSquaredErrorTest : public UnitTesting {
   // Objective methods
 
   void test_calculate_performance(void);
+  void test_calculate_performances(void);
   void test_calculate_generalization_performance(void);
 
   void test_calculate_gradient(void);
@@ -68,10 +69,21 @@ class SumSquaredErrorTest : public UnitTesting {
 
   void test_calculate_Jacobian_terms(void);
 
+  void test_calculate_terms_Jacobian_products(void);
+
+  void test_calculate_JacobianT_dot_Jacobian_dot_vector(void);
+  void test_calculate_JacobianT_dot_Jacobian_diagonal(void);
+
   // Other methods
 
   void test_calculate_squared_errors(void);
 
+  // Parallel evaluation methods
+
+  void test_calculate_parallel_evaluation(void);
+
+  void test_calculate_single_precision_evaluation(void);
+
   // Serialization methods
 
   void test_to_XML(void);
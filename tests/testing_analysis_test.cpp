@@ -350,6 +350,43 @@ void TestingAnalysisTest::test_calculate_binary_classification_test(void) {
   message += "test_calculate_binary_classification_test\n";
 }
 
+void TestingAnalysisTest::test_perform_quantization_analysis(void) {
+  message += "test_perform_quantization_analysis\n";
+
+  NeuralNetwork nn;
+  DataSet ds;
+
+  TestingAnalysis ta(&nn, &ds);
+
+  TestingAnalysis::QuantizationResults quantization_results;
+
+  // Test
+
+  nn.set(2, 3, 1);
+  nn.randomize_parameters_normal();
+
+  ds.set(2, 1, 20);
+  ds.randomize_data_uniform(0.0, 1.0);
+  ds.get_instances_pointer()->split_random_indices(0.5, 0.0, 0.5);
+
+  quantization_results = ta.perform_quantization_analysis();
+
+  assert_true(quantization_results.mean_absolute_errors.size() == 1, LOG);
+  assert_true(quantization_results.quantized_mean_absolute_errors.size() == 1,
+              LOG);
+  assert_true(quantization_results.maximum_outputs_difference < 0.1, LOG);
+  assert_true(quantization_results.classification_accuracy >= 0.0, LOG);
+  assert_true(quantization_results.classification_accuracy <= 1.0, LOG);
+  assert_true(quantization_results.classification_accuracy_delta ==
+                  quantization_results.quantized_classification_accuracy -
+                      quantization_results.classification_accuracy,
+              LOG);
+  assert_true(quantization_results.memory_size == 13 * sizeof(double), LOG);
+  assert_true(quantization_results.quantized_memory_size <
+                  quantization_results.memory_size,
+              LOG);
+}
+
 void TestingAnalysisTest::run_test_case(void) {
   message += "Running testing analysis test case...\n";
 
@@ -402,6 +439,10 @@ void TestingAnalysisTest::run_test_case(void) {
 
   test_calculate_confusion();
 
+  // Quantization analysis methods
+
+  test_perform_quantization_analysis();
+
   message += "End of testing analysis test case.\n";
 }
 
@@ -97,6 +97,10 @@ class TestingAnalysisTest : public UnitTesting {
   void test_calculate_confusion(void);
   void test_print_confusion(void);
 
+  // Quantization analysis methods
+
+  void test_perform_quantization_analysis(void);
+
   // Unit testing methods
 
   void run_test_case(void);
@@ -35,6 +35,8 @@ SOURCES += \
     perceptron_layer_test.cpp \
     perceptron_test.cpp \
     neural_network_test.cpp \
+    inference_plan_test.cpp \
+    quantized_multilayer_perceptron_test.cpp \
     multilayer_perceptron_test.cpp \
     inputs_test.cpp \
     outputs_test.cpp \
@@ -63,6 +65,7 @@ SOURCES += \
     random_search_test.cpp \
     quasi_newton_method_test.cpp \
     newton_method_test.cpp \
+    truncated_newton_method_test.cpp \
     levenberg_marquardt_algorithm_test.cpp \
     gradient_descent_test.cpp \
     evolutionary_algorithm_test.cpp \
@@ -90,6 +93,8 @@ HEADERS += \
     perceptron_layer_test.h \
     perceptron_test.h \
     neural_network_test.h \
+    inference_plan_test.h \
+    quantized_multilayer_perceptron_test.h \
     multilayer_perceptron_test.h \
     inputs_test.h \
     outputs_test.h \
@@ -118,6 +123,7 @@ HEADERS += \
     random_search_test.h \
     quasi_newton_method_test.h \
     newton_method_test.h \
+    truncated_newton_method_test.h \
     levenberg_marquardt_algorithm_test.h \
     gradient_descent_test.h \
     evolutionary_algorithm_test.h \
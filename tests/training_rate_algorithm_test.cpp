@@ -353,6 +353,65 @@ void TrainingRateAlgorithmTest::test_calculate_bracketing_triplet(void) {
   assert_true(triplet.U[1] <= triplet.B[1], LOG);
 }
 
+void TrainingRateAlgorithmTest::test_calculate_multipoint_bracketing_triplet(
+    void) {
+  message += "test_calculate_multipoint_bracketing_triplet\n";
+
+  DataSet ds(1, 1, 10);
+
+  NeuralNetwork nn(1, 2, 1);
+
+  PerformanceFunctional pf(&nn, &ds);
+
+  pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+  TrainingRateAlgorithm tra(&pf);
+
+  tra.set_evaluation_points_number(4);
+
+  double performance;
+  Vector<double> training_direction;
+
+  TrainingRateAlgorithm::Triplet triplet;
+
+  // Test
+
+  ds.randomize_data_normal();
+
+  nn.randomize_parameters_normal();
+
+  performance = pf.calculate_performance();
+  training_direction = pf.calculate_gradient() * (-1.0);
+
+  tra.reset_evaluations_number();
+
+  triplet = tra.calculate_multipoint_bracketing_triplet(
+      performance, training_direction, 1.0e-4);
+
+  assert_true(triplet.A[0] <= triplet.U[0], LOG);
+  assert_true(triplet.U[0] <= triplet.B[0], LOG);
+  assert_true(triplet.A[1] >= triplet.U[1], LOG);
+  assert_true(triplet.U[1] <= triplet.B[1], LOG);
+  assert_true(tra.get_evaluations_number() % 4 == 0, LOG);
+
+  // Test
+
+  triplet = tra.calculate_multipoint_bracketing_triplet(
+      performance, training_direction, 1.0e3);
+
+  assert_true(triplet.A[0] <= triplet.U[0], LOG);
+  assert_true(triplet.U[0] <= triplet.B[0], LOG);
+  assert_true(triplet.A[1] >= triplet.U[1], LOG);
+  assert_true(triplet.U[1] <= triplet.B[1], LOG);
+
+  // Test
+
+  triplet = tra.calculate_bracketing_triplet(performance, training_direction,
+                                             0.0);
+
+  assert_true(triplet.has_length_zero(), LOG);
+}
+
 void TrainingRateAlgorithmTest::test_calculate_golden_section_directional_point(
     void) {
   message += "test_calculate_golden_section_directional_point\n";
@@ -385,6 +444,18 @@ void TrainingRateAlgorithmTest::test_calculate_golden_section_directional_point(
   assert_true(directional_point.size() == 2, LOG);
   assert_true(directional_point[0] >= 0.0, LOG);
   assert_true(directional_point[1] < performance, LOG);
+
+  // Test
+
+  tra.set_evaluation_points_number(4);
+
+  Vector<double> multipoint_directional_point =
+      tra.calculate_golden_section_directional_point(
+          performance, training_direction, initial_training_rate);
+
+  assert_true(multipoint_directional_point.size() == 2, LOG);
+  assert_true(multipoint_directional_point[0] >= 0.0, LOG);
+  assert_true(multipoint_directional_point[1] < 1.0e-6, LOG);
 }
 
 void TrainingRateAlgorithmTest::test_calculate_Brent_method_directional_point(
@@ -420,6 +491,157 @@ void TrainingRateAlgorithmTest::test_calculate_Brent_method_directional_point(
   assert_true(directional_point[1] < performance, LOG);
 }
 
+void TrainingRateAlgorithmTest::test_calculate_Wolfe_directional_point(void) {
+  message += "test_calculate_Wolfe_directional_point\n";
+
+  DataSet ds(1, 1, 10);
+  ds.randomize_data_normal();
+
+  NeuralNetwork nn(1, 2, 1);
+  nn.randomize_parameters_normal();
+
+  PerformanceFunctional pf(&nn, &ds);
+
+  pf.set_objective_type(PerformanceFunctional::SUM_SQUARED_ERROR_OBJECTIVE);
+
+  TrainingRateAlgorithm tra(&pf);
+
+  tra.set_training_rate_method(TrainingRateAlgorithm::WolfeMethod);
+
+  const Vector<double> parameters = nn.arrange_parameters();
+
+  PerformanceFunctional::FirstOrderperformance first_order_performance;
+
+  Vector<double> training_direction;
+  double slope;
+
+  Vector<double> directional_point;
+  Vector<double> directional_gradient;
+
+  // Test
+
+  first_order_performance = pf.calculate_first_order_performance();
+
+  training_direction = first_order_performance.gradient * (-1.0);
+  slope = first_order_performance.gradient.dot(training_direction);
+
+  tra.reset_evaluations_number();
+
+  directional_point = tra.calculate_Wolfe_directional_point(
+      first_order_performance.performance, first_order_performance.gradient,
+      training_direction, 0.001, directional_gradient);
+
+  assert_true(directional_point.size() == 2, LOG);
+  assert_true(directional_point[0] > 0.0, LOG);
+  assert_true(directional_point[1] <=
+                  first_order_performance.performance +
+                      tra.get_sufficient_decrease_parameter() *
+                          directional_point[0] * slope,
+              LOG);
+  assert_true(fabs(directional_gradient.dot(training_direction)) <=
+                  -tra.get_curvature_parameter() * slope,
+              LOG);
+  assert_true(tra.get_evaluations_number() >= 1, LOG);
+  assert_true(tra.get_evaluations_number() <=
+                  tra.get_maximum_evaluations_number(),
+              LOG);
+  assert_true(nn.arrange_parameters() == parameters, LOG);
+
+  nn.set_parameters(parameters + training_direction * directional_point[0]);
+
+  assert_true(fabs(pf.calculate_performance() - directional_point[1]) < 1.0e-9,
+              LOG);
+  assert_true((pf.calculate_gradient() - directional_gradient)
+                      .calculate_absolute_value()
+                      .calculate_maximum() < 1.0e-9,
+              LOG);
+
+  nn.set_parameters(parameters);
+
+  // Test
+
+  training_direction = first_order_performance.gradient;
+
+  directional_point = tra.calculate_Wolfe_directional_point(
+      first_order_performance.performance, first_order_performance.gradient,
+      training_direction, 0.001, directional_gradient);
+
+  assert_true(directional_point[0] == 0.0, LOG);
+  assert_true(directional_point[1] == first_order_performance.performance,
+              LOG);
+  assert_true(directional_gradient == first_order_performance.gradient, LOG);
+}
+
+void
+TrainingRateAlgorithmTest::test_calculate_cubic_interpolation_training_rate(
+    void) {
+  message += "test_calculate_cubic_interpolation_training_rate\n";
+
+  TrainingRateAlgorithm tra;
+
+  Vector<double> A(3);
+  Vector<double> B(3);
+
+  double training_rate;
+
+  // Test
+
+  A[0] = 0.0;
+  A[1] = 1.0;
+  A[2] = -2.0;
+
+  B[0] = 3.0;
+  B[1] = 4.0;
+  B[2] = 4.0;
+
+  training_rate = tra.calculate_cubic_interpolation_training_rate(A, B);
+
+  assert_true(fabs(training_rate - 1.0) < 1.0e-12, LOG);
+
+  training_rate = tra.calculate_cubic_interpolation_training_rate(B, A);
+
+  assert_true(fabs(training_rate - 1.0) < 1.0e-12, LOG);
+
+  // Test
+
+  A[0] = 0.0;
+  A[1] = 0.0;
+  A[2] = -1.0;
+
+  B[0] = 2.0;
+  B[1] = 2.0 / 3.0;
+  B[2] = 3.0;
+
+  training_rate = tra.calculate_cubic_interpolation_training_rate(A, B);
+
+  assert_true(fabs(training_rate - 1.0) < 1.0e-12, LOG);
+}
+
+void
+TrainingRateAlgorithmTest::test_calculate_quadratic_interpolation_training_rate(
+    void) {
+  message += "test_calculate_quadratic_interpolation_training_rate\n";
+
+  TrainingRateAlgorithm tra;
+
+  Vector<double> A(3);
+  Vector<double> B(3, 0.0);
+
+  // Test
+
+  A[0] = 0.0;
+  A[1] = 1.0;
+  A[2] = -2.0;
+
+  B[0] = 3.0;
+  B[1] = 4.0;
+
+  assert_true(
+      fabs(tra.calculate_quadratic_interpolation_training_rate(A, B) - 1.0) <
+          1.0e-12,
+      LOG);
+}
+
 void TrainingRateAlgorithmTest::test_to_XML(void) {
   message += "test_to_XML\n";
 
@@ -487,11 +709,16 @@ void TrainingRateAlgorithmTest::run_test_case(void) {
   // Training methods
 
   test_calculate_bracketing_triplet();
+  test_calculate_multipoint_bracketing_triplet();
   test_calculate_fixed_directional_point();
   test_calculate_golden_section_directional_point();
   test_calculate_Brent_method_directional_point();
+  test_calculate_Wolfe_directional_point();
   test_calculate_directional_point();
 
+  test_calculate_cubic_interpolation_training_rate();
+  test_calculate_quadratic_interpolation_training_rate();
+
   // Serialization methods
 
   test_to_XML();
@@ -105,10 +105,15 @@ class TrainingRateAlgorithmTest : public UnitTesting {
   void test_calculate_directional_point(void);
 
   void test_calculate_bracketing_triplet(void);
+  void test_calculate_multipoint_bracketing_triplet(void);
 
   void test_calculate_fixed_directional_point(void);
   void test_calculate_golden_section_directional_point(void);
   void test_calculate_Brent_method_directional_point(void);
+  void test_calculate_Wolfe_directional_point(void);
+
+  void test_calculate_cubic_interpolation_training_rate(void);
+  void test_calculate_quadratic_interpolation_training_rate(void);
 
   // Serialization methods
 
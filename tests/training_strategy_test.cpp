@@ -138,6 +138,42 @@ void TrainingStrategyTest::test_from_XML(void) {
   assert_true(ts2.get_main_type() == TrainingStrategy::GRADIENT_DESCENT, LOG);
   assert_true(ts2.get_refinement_type() == TrainingStrategy::NEWTON_METHOD,
               LOG);
+
+  // Test
+
+  ts1.set_threads_number(4);
+  ts1.set_deterministic_reduction(true);
+  ts1.set_single_precision(true);
+
+  document = ts1.to_XML();
+
+  ts2.from_XML(*document);
+
+  delete document;
+
+  assert_true(ts2.get_threads_number() == 4, LOG);
+  assert_true(ts2.get_deterministic_reduction() == true, LOG);
+  assert_true(ts2.get_single_precision() == true, LOG);
+
+  // Test
+
+  ts1.set_refinement_type(TrainingStrategy::TRUNCATED_NEWTON_METHOD);
+  ts1.get_truncated_Newton_method_pointer()->set_preconditioner_type(
+      TruncatedNewtonMethod::GAUSS_NEWTON_DIAGONAL_PRECONDITIONER);
+
+  document = ts1.to_XML();
+
+  ts2.from_XML(*document);
+
+  delete document;
+
+  assert_true(
+      ts2.get_refinement_type() == TrainingStrategy::TRUNCATED_NEWTON_METHOD,
+      LOG);
+  assert_true(
+      ts2.get_truncated_Newton_method_pointer()->get_preconditioner_type() ==
+          TruncatedNewtonMethod::GAUSS_NEWTON_DIAGONAL_PRECONDITIONER,
+      LOG);
 }
 
 void TrainingStrategyTest::test_print(void) { message += "test_print\n"; }
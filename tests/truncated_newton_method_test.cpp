@@ -0,0 +1,398 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library
+ */
+/*   www.intelnics.com/opennn
+ */
+/*                                                                                                              */
+/*   T R U N C A T E D   N E W T O N   M E T H O D   T E S T   C L A S S  
+ */
+/*                                                                                                              */
+/*   Roberto Lopez
+ */
+/*   Intelnics - The artificial intelligence company
+ */
+/*   robertolopez@intelnics.com
+ */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "truncated_newton_method_test.h"
+
+using namespace OpenNN;
+
+// GENERAL CONSTRUCTOR
+
+TruncatedNewtonMethodTest::TruncatedNewtonMethodTest(void) : UnitTesting() {}
+
+// DESTRUCTOR
+
+TruncatedNewtonMethodTest::~TruncatedNewtonMethodTest(void) {}
+
+// METHODS
+
+void TruncatedNewtonMethodTest::test_constructor(void) {
+  message += "test_constructor\n";
+
+  PerformanceFunctional pf;
+
+  // Default constructor
+
+  TruncatedNewtonMethod tnm1;
+  assert_true(tnm1.has_performance_functional() == false, LOG);
+
+  // Performance functional constructor
+
+  TruncatedNewtonMethod tnm2(&pf);
+  assert_true(tnm2.has_performance_functional() == true, LOG);
+}
+
+void TruncatedNewtonMethodTest::test_destructor(void) {
+  message += "test_destructor\n";
+}
+
+void TruncatedNewtonMethodTest::test_set_preconditioner_type(void) {
+  message += "test_set_preconditioner_type\n";
+
+  TruncatedNewtonMethod tnm;
+
+  tnm.set_preconditioner_type("GAUSS_NEWTON_DIAGONAL_PRECONDITIONER");
+
+  assert_true(tnm.get_preconditioner_type() ==
+                  TruncatedNewtonMethod::GAUSS_NEWTON_DIAGONAL_PRECONDITIONER,
+              LOG);
+
+  tnm.set_preconditioner_type(TruncatedNewtonMethod::NO_PRECONDITIONER);
+
+  assert_true(tnm.write_preconditioner_type() == "NO_PRECONDITIONER", LOG);
+}
+
+void TruncatedNewtonMethodTest::test_calculate_preconditioner(void) {
+  message += "test_calculate_preconditioner\n";
+
+  NeuralNetwork nn(1, 2, 1);
+
+  DataSet ds(1, 1, 3);
+  ds.randomize_data_normal();
+
+  PerformanceFunctional pf(&nn, &ds);
+
+  TruncatedNewtonMethod tnm(&pf);
+
+  Vector<double> preconditioner;
+
+  const unsigned parameters_number = nn.count_parameters_number();
+
+  // Test
+
+  tnm.set_preconditioner_type(TruncatedNewtonMethod::NO_PRECONDITIONER);
+
+  preconditioner = tnm.calculate_preconditioner();
+
+  assert_true(preconditioner == 1.0, LOG);
+
+  // Test
+
+  nn.randomize_parameters_normal();
+
+  tnm.set_preconditioner_type(
+      TruncatedNewtonMethod::HESSIAN_DIAGONAL_PRECONDITIONER);
+
+  preconditioner = tnm.calculate_preconditioner();
+
+  assert_true(preconditioner.size() == parameters_number, LOG);
+  assert_true(preconditioner > 0.0, LOG);
+
+  // Test
+
+  tnm.set_preconditioner_seed(3);
+
+  srand(1);
+
+  preconditioner = tnm.calculate_preconditioner();
+
+  const int random_number = rand();
+
+  tnm.set_preconditioner_seed(3);
+
+  srand(2);
+
+  assert_true(tnm.calculate_preconditioner() == preconditioner, LOG);
+
+  srand(1);
+
+  assert_true(rand() == random_number, LOG);
+
+  // Test
+
+  tnm.set_preconditioner_type(
+      TruncatedNewtonMethod::GAUSS_NEWTON_DIAGONAL_PRECONDITIONER);
+
+  preconditioner = tnm.calculate_preconditioner();
+
+  assert_true(preconditioner.size() == parameters_number, LOG);
+  assert_true(preconditioner > 0.0, LOG);
+
+  // Test
+
+  ds.set(1, 1, 10);
+  ds.randomize_data_normal();
+
+  nn.randomize_parameters_normal();
+
+  const Matrix<double> terms_Jacobian = pf.calculate_terms_Jacobian();
+
+  Vector<double> Gauss_Newton_diagonal(parameters_number, 0.0);
+
+  for (unsigned i = 0; i < terms_Jacobian.get_rows_number(); i++) {
+    for (unsigned j = 0; j < parameters_number; j++) {
+      Gauss_Newton_diagonal[j] +=
+          2.0 * terms_Jacobian[i][j] * terms_Jacobian[i][j];
+    }
+  }
+
+  const double mean = Gauss_Newton_diagonal.calculate_mean();
+
+  for (unsigned j = 0; j < parameters_number; j++) {
+    if (Gauss_Newton_diagonal[j] < 1.0e-3 * mean) {
+      Gauss_Newton_diagonal[j] = 1.0e-3 * mean;
+    }
+  }
+
+  preconditioner = tnm.calculate_preconditioner();
+
+  assert_true((preconditioner - Gauss_Newton_diagonal)
+                      .calculate_absolute_value() < 1.0e-9,
+              LOG);
+}
+
+void TruncatedNewtonMethodTest::test_calculate_training_direction(void) {
+  message += "test_calculate_training_direction\n";
+
+  NeuralNetwork nn(1, 2, 1);
+  nn.randomize_parameters_normal();
+
+  DataSet ds(1, 1, 3);
+  ds.randomize_data_normal();
+
+  PerformanceFunctional pf(&nn, &ds);
+
+  TruncatedNewtonMethod tnm(&pf);
+
+  const unsigned parameters_number = nn.count_parameters_number();
+
+  const Vector<double> gradient = pf.calculate_gradient();
+  const Vector<double> preconditioner(parameters_number, 1.0);
+
+  Vector<double> direction;
+  double predicted_reduction;
+
+  unsigned iterations_number;
+
+  // Test
+
+  iterations_number = tnm.calculate_training_direction(
+      gradient, preconditioner, 1.0e-3, direction, predicted_reduction);
+
+  assert_true(iterations_number >= 1, LOG);
+  assert_true(direction.size() == parameters_number, LOG);
+  assert_true(fabs(direction.calculate_norm() - 1.0e-3) < 1.0e-9, LOG);
+  assert_true(predicted_reduction > 0.0, LOG);
+
+  // Test
+
+  tnm.set_maximum_conjugate_gradient_iterations_number(1);
+
+  iterations_number = tnm.calculate_training_direction(
+      gradient, preconditioner, 1.0e3, direction, predicted_reduction);
+
+  assert_true(iterations_number == 1, LOG);
+  assert_true(direction.calculate_norm() <= 1.0e3, LOG);
+  assert_true(direction.dot(gradient) < 0.0, LOG);
+  assert_true(predicted_reduction > 0.0, LOG);
+}
+
+void TruncatedNewtonMethodTest::test_perform_training(void) {
+  message += "test_perform_training\n";
+
+  NeuralNetwork nn;
+
+  DataSet ds;
+
+  PerformanceFunctional pf(&nn, &ds);
+
+  TruncatedNewtonMethod tnm(&pf);
+  tnm.set_display(false);
+
+  TruncatedNewtonMethod::TruncatedNewtonMethodResults* tnmtr;
+
+  double old_performance;
+  double performance;
+  double performance_goal;
+
+  // Test
+
+  nn.set(1, 2, 1);
+  nn.randomize_parameters_normal();
+
+  ds.set(1, 1, 4);
+  ds.randomize_data_normal();
+
+  old_performance = pf.calculate_performance();
+
+  tnm.set_maximum_iterations_number(10);
+
+  tnmtr = tnm.perform_training();
+
+  performance = pf.calculate_performance();
+
+  assert_true(performance < old_performance, LOG);
+  assert_true(fabs(tnmtr->final_performance - performance) < 1.0e-12, LOG);
+  assert_true(tnm.get_trust_region_radius() == 1.0, LOG);
+
+  delete tnmtr;
+
+  // Test
+
+  nn.randomize_parameters_normal();
+
+  old_performance = pf.calculate_performance();
+
+  tnm.set_preconditioner_type(
+      TruncatedNewtonMethod::GAUSS_NEWTON_DIAGONAL_PRECONDITIONER);
+
+  tnmtr = tnm.perform_training();
+
+  performance = pf.calculate_performance();
+
+  assert_true(performance < old_performance, LOG);
+
+  delete tnmtr;
+
+  // Performance goal
+
+  nn.randomize_parameters_normal();
+
+  performance_goal = 100.0;
+
+  tnm.set_preconditioner_type(TruncatedNewtonMethod::NO_PRECONDITIONER);
+  tnm.set_performance_goal(performance_goal);
+
+  delete tnm.perform_training();
+
+  performance = pf.calculate_performance();
+
+  assert_true(performance < performance_goal, LOG);
+}
+
+void TruncatedNewtonMethodTest::test_resize_training_history(void) {
+  message += "test_resize_training_history\n";
+
+  TruncatedNewtonMethod tnm;
+
+  tnm.set_reserve_all_training_history(true);
+
+  TruncatedNewtonMethod::TruncatedNewtonMethodResults tnmtr(&tnm);
+
+  tnmtr.resize_training_history(1);
+
+  assert_true(tnmtr.parameters_norm_history.size() == 1, LOG);
+
+  assert_true(tnmtr.performance_history.size() == 1, LOG);
+  assert_true(tnmtr.generalization_performance_history.size() == 1, LOG);
+  assert_true(tnmtr.gradient_norm_history.size() == 1, LOG);
+
+  assert_true(tnmtr.trust_region_radius_history.size() == 1, LOG);
+  assert_true(tnmtr.conjugate_gradient_iterations_history.size() == 1, LOG);
+  assert_true(tnmtr.elapsed_time_history.size() == 1, LOG);
+}
+
+void TruncatedNewtonMethodTest::test_to_XML(void) {
+  message += "test_to_XML\n";
+
+  TruncatedNewtonMethod tnm;
+
+  tinyxml2::XMLDocument* tnmd = tnm.to_XML();
+
+  assert_true(tnmd != NULL, LOG);
+
+  delete tnmd;
+}
+
+void TruncatedNewtonMethodTest::test_from_XML(void) {
+  message += "test_from_XML\n";
+
+  TruncatedNewtonMethod tnm1;
+  TruncatedNewtonMethod tnm2;
+
+  tnm1.set_trust_region_radius(0.5);
+  tnm1.set_maximum_conjugate_gradient_iterations_number(7);
+  tnm1.set_preconditioner_type(
+      TruncatedNewtonMethod::HESSIAN_DIAGONAL_PRECONDITIONER);
+  tnm1.set_preconditioner_seed(11);
+  tnm1.set_display(false);
+
+  tinyxml2::XMLDocument* tnmd = tnm1.to_XML();
+
+  tnm2.from_XML(*tnmd);
+
+  delete tnmd;
+
+  assert_true(tnm2.get_trust_region_radius() == 0.5, LOG);
+  assert_true(tnm2.get_maximum_conjugate_gradient_iterations_number() == 7,
+              LOG);
+  assert_true(tnm2.get_preconditioner_type() ==
+                  TruncatedNewtonMethod::HESSIAN_DIAGONAL_PRECONDITIONER,
+              LOG);
+  assert_true(tnm2.get_preconditioner_seed() == 11, LOG);
+  assert_true(tnm2.get_display() == false, LOG);
+}
+
+void TruncatedNewtonMethodTest::run_test_case(void) {
+  message += "Running truncated Newton method test case...\n";
+
+  // Constructor and destructor methods
+
+  test_constructor();
+  test_destructor();
+
+  // Set methods
+
+  test_set_preconditioner_type();
+
+  // Training methods
+
+  test_calculate_preconditioner();
+  test_calculate_training_direction();
+  test_perform_training();
+
+  // Training history methods
+
+  test_resize_training_history();
+
+  // Serialization methods
+
+  test_to_XML();
+  test_from_XML();
+
+  message += "End of truncated Newton method test case.\n";
+}
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2014 Roberto Lopez
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA